@@ -1,7 +1,29 @@
 require 'PrintFile'
 
 class GeneratorCPP
+  # Field types that can be generated as fixed point FIX::Decimal fields
+  # instead of doubles, chosen with e.g. QF_DECIMAL_TYPES=PRICE,QTY,AMT
+  DECIMAL_TYPES = ["PRICE", "AMT", "QTY"]
+
+  # Field types that fixed messages keep in a C++ type of their own,
+  # fields of any other type are kept as strings
+  FIXED_TYPES = {
+    "INT" => "int", "LENGTH" => "int", "SEQNUM" => "int",
+    "NUMINGROUP" => "int", "DAYOFMONTH" => "int",
+    "FLOAT" => "double", "PRICE" => "double", "QTY" => "double",
+    "AMT" => "double", "PRICEOFFSET" => "double", "PERCENTAGE" => "double",
+    "CHAR" => "char", "BOOLEAN" => "bool", "UTCTIMESTAMP" => "FIX::DateTime" }
+
+  # Entries a fixed message keeps inline for each repeating group,
+  # groups that hold other groups keep a single entry inline
+  FIXED_GROUP_SIZE = 4
+
+  # A field, or the fields and groups of a fixed message, header, trailer
+  # or group entry
+  FixedNode = Struct.new(:name, :number, :delim, :order, :items, :parent)
+
   def initialize(type, major, minor, sp, verid, basedir)
+    @decimalTypes = (ENV["QF_DECIMAL_TYPES"] || "").upcase.split(",") & DECIMAL_TYPES
     @type = type
     @major = major
     @minor = minor
@@ -9,6 +31,14 @@ class GeneratorCPP
     if( sp != "0" )
       @namespace += "SP#{sp}"
     end
+    # Messages also generated as Fixed<Message>.h, chosen with e.g.
+    # QF_FIXED_MESSAGES=NewOrderSingle,FIX42:ExecutionReport
+    @fixedMessages = (ENV["QF_FIXED_MESSAGES"] || "").split(",").map { |message|
+      version, name = message.include?(":") ? message.split(":") : [@namespace, message]
+      version.upcase == @namespace.upcase ? name : nil }.compact
+    @fieldTypes = Hash.new
+    @fixed = nil
+    @fixedCount = 0
     @verid = verid
     @beginstring = type + "." + major + "." + minor
     if @type == "FIX" && major >= "5"
@@ -39,10 +69,15 @@ class GeneratorCPP
     @f.puts "{"
   end
 
+  def fieldTypes(types)
+    @fieldTypes = types
+  end
+
   def field(name, number)
     @f.indent
     @f.puts "FIELD_SET(*this, FIX::" + name + ");"
     @f.dedent
+    fixedField(name, number) if @fixed
   end
 
   def headerStart
@@ -50,12 +85,15 @@ class GeneratorCPP
     @f.puts "class Header : public FIX::Header"
     @f.puts "{"
     @f.puts "public:"
+    @fixed = FixedNode.new("FixedHeader", nil, nil, nil, [], nil) if @fixedMessages.size > 0
   end
 
   def headerEnd
     @f.puts "};"
     @f.puts
     @f.dedent
+    @fixedHeader = @fixed
+    @fixed = nil
   end
 
   def trailerStart
@@ -63,12 +101,15 @@ class GeneratorCPP
     @f.puts "class Trailer : public FIX::Trailer"
     @f.puts "{"
     @f.puts "public:"
+    @fixed = FixedNode.new("FixedTrailer", nil, nil, nil, [], nil) if @fixedMessages.size > 0
   end
 
   def trailerEnd
     @f.puts "};"
     @f.puts
     @f.dedent
+    @fixedTrailer = @fixed
+    @fixed = nil
   end
 
   def baseMessageStart
@@ -109,11 +150,13 @@ class GeneratorCPP
     @f.print name + "() : FIX::Group(" + number + "," + delim + "," + "FIX::message_order("
     order.each { |field| @f.printInline field + "," }
     @f.putsInline "0)) {}"
+    fixedGroupStart(name, number, delim, order) if @fixed
   end
 
   def groupEnd
     @f.puts "};"
     @f.dedent
+    @fixed = @fixed.parent if @fixed
   end
 
   def messageStart(name, msgtype, required)
@@ -162,6 +205,11 @@ class GeneratorCPP
     end
     @f.puts
     @f.dedent
+
+    if( @fixedMessages.include?(name) )
+      @fixed = FixedNode.new("Fixed" + name, nil, nil, nil, [], nil)
+      @fixedMsgType = msgtype
+    end
   end
 
   def messageEnd
@@ -172,6 +220,11 @@ class GeneratorCPP
     @f.puts
     @f.puts "#endif"
     @f.close
+
+    if( @fixed )
+      fixedMessage(@fixed)
+      @fixed = nil
+    end
   end
 
   def back
@@ -179,6 +232,297 @@ class GeneratorCPP
     @f.puts "}"
     @f.puts
     @f.puts "#endif"
+    fixedBase if @fixedCount > 0
+  end
+
+  def fixedField(name, number)
+    # BeginString, BodyLength, MsgType and CheckSum are written by the message
+    return if ["8", "9", "35", "10"].include?(number)
+    return if @fixed.items.any? { |item| item.number == number }
+    @fixed.items.push(FixedNode.new(name, number, nil, nil, nil, @fixed))
+  end
+
+  def fixedGroupStart(name, number, delim, order)
+    # the group writes its own count field
+    @fixed.items.delete_if { |item| item.number == number }
+    group = FixedNode.new(name, number, delim, order, [], @fixed)
+    @fixed.items.push(group)
+    @fixed = group
+  end
+
+  def fixedType(name)
+    type = (@fieldTypes[name] || "STRING").upcase
+    return "FIX::Decimal" if @decimalTypes.include?(type)
+    return FIXED_TYPES[type] || "std::string"
+  end
+
+  def fixedParameter(type)
+    case type
+      when "std::string", "FIX::Decimal"
+        "const #{type}&"
+      when "FIX::DateTime"
+        "const FIX::UtcTimeStamp&"
+      else
+        type
+    end
+  end
+
+  def fixedGroupType(group)
+    size = group.items.any? { |item| item.items } ? 1 : FIXED_GROUP_SIZE
+    "FIX::FixedGroup< #{group.name}, #{size} >"
+  end
+
+  # Header, trailer and message fields go in tag order, group entries
+  # in the order of the group
+  def fixedOrder(node)
+    return node.items.sort_by { |item| item.number.to_i } if !node.order
+    ordered = node.order.map { |number|
+      node.items.find { |item| item.number == number } }.compact
+    return ordered + node.items.reject { |item| ordered.any? { |o| o.equal?(item) } }
+  end
+
+  def fixedClass(f, node, message = false)
+    fields = node.items.select { |item| !item.items }
+    groups = node.items.select { |item| item.items }
+    applVerID = message && @verid != "0" &&
+      @fixedHeader.items.any? { |item| item.name == "ApplVerID" }
+
+    f.puts "class #{node.name}"
+    f.puts "{"
+    f.puts "public:"
+    f.indent
+
+    groups.each { |group|
+      fixedClass(f, group)
+      f.puts
+    }
+
+    # timestamps remember whether they are written with milliseconds
+    scalars = []
+    fields.each { |field|
+      type = fixedType(field.name)
+      scalars.push(field.name) if type != "std::string"
+      scalars.push(field.name + "Milliseconds") if type == "FIX::DateTime"
+    }
+    body = applVerID ? " { m_header.setApplVerID( \"#{@verid}\" ); }" : " {}"
+    if( scalars.size == 0 )
+      f.puts "#{node.name}()" + body
+    else
+      f.puts "#{node.name}()"
+      scalars.each_index { |i|
+        f.print i == 0 ? ": " : "  "
+        f.printInline "m_#{scalars[i]}()"
+        if( i != scalars.size-1 )
+          f.putsInline ","
+        else
+          f.putsInline body
+        end
+      }
+    end
+
+    if( message )
+      f.puts "static FIX::MsgType MsgType() { return FIX::MsgType(\"#{@fixedMsgType}\"); }"
+      f.puts
+      f.puts "FixedHeader& getHeader() { return m_header; }"
+      f.puts "const FixedHeader& getHeader() const { return m_header; }"
+      f.puts "FixedTrailer& getTrailer() { return m_trailer; }"
+      f.puts "const FixedTrailer& getTrailer() const { return m_trailer; }"
+    end
+    f.puts
+
+    fields.each_index { |i|
+      name = fields[i].name
+      type = fixedType(name)
+      result = type == "FIX::DateTime" ? "FIX::UtcTimeStamp" : fixedParameter(type)
+      value = type == "FIX::DateTime" ? "FIX::UtcTimeStamp( m_#{name} )" : "m_#{name}"
+      f.puts "bool isSet#{name}() const { return m_present.test( #{i} ); }"
+      f.puts "#{result} get#{name}() const"
+      f.puts "{"
+      f.puts "  if( !m_present.test( #{i} ) ) throw FIX::FieldNotFound( FIX::FIELD::#{name} );"
+      f.puts "  return #{value};"
+      f.puts "}"
+      if( type == "FIX::DateTime" )
+        f.puts "void set#{name}( #{fixedParameter(type)} value, bool showMilliseconds = false )"
+        f.puts "{ m_#{name} = value; m_#{name}Milliseconds = showMilliseconds; m_present.set( #{i} ); }"
+      else
+        f.puts "void set#{name}( #{fixedParameter(type)} value )"
+        f.puts "{ m_#{name} = value; m_present.set( #{i} ); }"
+      end
+      f.puts "void remove#{name}() { m_present.reset( #{i} ); }"
+      f.puts
+    }
+
+    groups.each { |group|
+      f.puts "#{fixedGroupType(group)}& get#{group.name}() { return m_#{group.name}; }"
+      f.puts "const #{fixedGroupType(group)}& get#{group.name}() const { return m_#{group.name}; }"
+      f.puts
+    }
+
+    f.puts "void clear()"
+    f.puts "{"
+    f.indent
+    if( message )
+      f.puts "m_header.clear();"
+      f.puts "m_header.setApplVerID( \"#{@verid}\" );" if applVerID
+      f.puts "m_trailer.clear();"
+    end
+    f.puts "m_present.clear();"
+    groups.each { |group| f.puts "m_#{group.name}.clear();" }
+    f.dedent
+    f.puts "}"
+    f.puts
+
+    if( message )
+      f.puts "std::string toString() const"
+      f.puts "{"
+      f.puts "  std::string string;"
+      f.puts "  return toString( string );"
+      f.puts "}"
+      f.puts
+      f.puts "std::string& toString( std::string& string ) const"
+      f.puts "{"
+      f.indent
+      f.puts "std::string::size_type length"
+      f.puts "  = FIX::FixedWriter::begin( string, \"#{@beginstring}\", \"#{@fixedMsgType}\" );"
+      f.puts "m_header.write( string );"
+      f.puts "write( string );"
+      f.puts "m_trailer.write( string );"
+      f.puts "FIX::FixedWriter::end( string, length );"
+      f.puts "return string;"
+      f.dedent
+      f.puts "}"
+      f.puts
+      f.puts "void setString( const std::string& string, bool validate = true )"
+      f.puts "{"
+      f.indent
+      f.puts "FIX::FixedParser parser( string );"
+      f.puts "parser.begin( \"#{@beginstring}\", \"#{@fixedMsgType}\" );"
+      f.puts "clear();"
+      f.puts
+      f.puts "int tag = 0;"
+      f.puts "while( parser.next( tag ) && tag != FIX::FIELD::CheckSum )"
+      f.puts "{"
+      f.puts "  if( !m_header.setField( tag, parser )"
+      f.puts "      && !setField( tag, parser )"
+      f.puts "      && !m_trailer.setField( tag, parser ) )"
+      f.puts "    throw FIX::TagNotDefinedForMessage( tag );"
+      f.puts "}"
+      f.puts
+      f.puts "if( validate )"
+      f.puts "  parser.end( tag );"
+      f.dedent
+      f.puts "}"
+      f.puts
+    end
+
+    f.puts "bool setField( int tag, FIX::FixedParser& parser )"
+    f.puts "{"
+    f.indent
+    f.puts "switch( tag )"
+    f.puts "{"
+    node.items.each { |item|
+      f.puts "case FIX::FIELD::#{item.name}:"
+      f.indent
+      if( item.items )
+        delim = item.items.find { |entry| entry.number == item.delim }
+        delim = delim ? "FIX::FIELD::#{delim.name}" : item.delim
+        f.puts "{"
+        f.puts "  int count = 0;"
+        f.puts "  parser.get( count );"
+        f.puts "  m_#{item.name}.read( parser, FIX::FIELD::#{item.name}, #{delim}, count );"
+        f.puts "}"
+      elsif( fixedType(item.name) == "FIX::DateTime" )
+        f.puts "parser.get( m_#{item.name}, m_#{item.name}Milliseconds );"
+        f.puts "m_present.set( #{fields.index { |field| field.equal?(item) }} );"
+      else
+        f.puts "parser.get( m_#{item.name} );"
+        if( (@fieldTypes[item.name] || "").upcase == "LENGTH" )
+          f.puts "parser.setDataLength( m_#{item.name} );"
+        end
+        f.puts "m_present.set( #{fields.index { |field| field.equal?(item) }} );"
+      end
+      f.puts "return true;"
+      f.dedent
+    }
+    f.puts "default:"
+    f.puts "  return false;"
+    f.puts "}"
+    f.dedent
+    f.puts "}"
+    f.puts
+
+    f.puts "void write( std::string& string ) const"
+    f.puts "{"
+    f.indent
+    fixedOrder(node).each { |item|
+      if( item.items )
+        f.puts "m_#{item.name}.write( string, FIX::FIELD::#{item.name} );"
+      else
+        f.puts "if( m_present.test( #{fields.index { |field| field.equal?(item) }} ) )"
+        milliseconds = fixedType(item.name) == "FIX::DateTime" ? ", m_#{item.name}Milliseconds" : ""
+        f.puts "  FIX::FixedWriter::field( string, FIX::FIELD::#{item.name}, m_#{item.name}#{milliseconds} );"
+      end
+    }
+    f.dedent
+    f.puts "}"
+    f.dedent
+    f.puts
+
+    f.puts "private:"
+    f.indent
+    if( message )
+      f.puts "FixedHeader m_header;"
+      f.puts "FixedTrailer m_trailer;"
+    end
+    f.puts "FIX::FixedPresence< #{fields.size} > m_present;"
+    fields.each { |field|
+      f.puts "#{fixedType(field.name)} m_#{field.name};"
+      f.puts "bool m_#{field.name}Milliseconds;" if fixedType(field.name) == "FIX::DateTime"
+    }
+    groups.each { |group| f.puts "#{fixedGroupType(group)} m_#{group.name};" }
+    f.dedent
+    f.puts "};"
+  end
+
+  def fixedMessage(node)
+    f = createVersionFile(node.name + ".h")
+    f.puts "#ifndef " + @namespace + "_" + node.name.upcase + "_H"
+    f.puts "#define " + @namespace + "_" + node.name.upcase + "_H"
+    f.puts
+    f.puts "#include \"FixedMessage.h\""
+    f.puts
+    f.puts "namespace " + @namespace
+    f.puts "{"
+    f.puts
+    f.indent
+    fixedClass(f, node, true)
+    f.puts
+    f.dedent
+    f.puts "}"
+    f.puts
+    f.puts "#endif"
+    f.close
+    @fixedCount += 1
+  end
+
+  def fixedBase
+    f = createVersionFile("FixedMessage.h")
+    f.puts "#ifndef " + @namespace + "_FIXEDMESSAGE_H"
+    f.puts "#define " + @namespace + "_FIXEDMESSAGE_H"
+    f.puts
+    f.puts "#include \"../FixedMessage.h\""
+    f.puts
+    f.puts "namespace " + @namespace
+    f.puts "{"
+    f.indent
+    fixedClass(f, @fixedHeader)
+    f.puts
+    fixedClass(f, @fixedTrailer)
+    f.dedent
+    f.puts "}"
+    f.puts
+    f.puts "#endif"
+    f.close
   end
 
   def fieldsStart
@@ -221,6 +565,8 @@ class GeneratorCPP
   def fixFields(f, name, number, type)
     if( name == "CheckSum" )
       f.puts "DEFINE_CHECKSUM(#{name});"
+    elsif( @decimalTypes.include?(type.upcase) )
+      f.puts "DEFINE_DECIMAL_#{type.upcase}(#{name});"
     else
       f.puts "DEFINE_#{type.upcase}(#{name});"
     end
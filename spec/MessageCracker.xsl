@@ -106,29 +106,39 @@ public:
   {
     const std::string&amp; msgTypeValue 
       = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    <xsl:for-each select="//fix/messages/message">
-    <xsl:if test="position()!=1">
-    else
-    </xsl:if>if( msgTypeValue == "<xsl:value-of select="@msgtype"/>" )
-      onMessage( (const <xsl:value-of select="@name"/>&amp;)message, sessionID );</xsl:for-each>
-    else onMessage( message, sessionID );
+
+    switch( FIX::Message::msgTypeKey( msgTypeValue ) )
+    {<xsl:for-each select="//fix/messages/message">
+    case <xsl:call-template name="msgtype-key"><xsl:with-param name="value" select="@msgtype"/></xsl:call-template>:
+      onMessage( (const <xsl:value-of select="@name"/>&amp;)message, sessionID ); break;</xsl:for-each>
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
-void crack( Message&amp; message, 
-            const FIX::SessionID&amp; sessionID )
+  void crack( Message&amp; message, 
+              const FIX::SessionID&amp; sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    <xsl:for-each select="//fix/messages/message">
-    <xsl:if test="position()!=1">
-    else
-    </xsl:if>if( msgTypeValue == "<xsl:value-of select="@msgtype"/>" )
-      onMessage( (<xsl:value-of select="@name"/>&amp;)message, sessionID );</xsl:for-each>
-    else onMessage( message, sessionID );
+    const std::string&amp; msgTypeValue 
+      = message.getHeader().getField( FIX::FIELD::MsgType );
+
+    switch( FIX::Message::msgTypeKey( msgTypeValue ) )
+    {<xsl:for-each select="//fix/messages/message">
+    case <xsl:call-template name="msgtype-key"><xsl:with-param name="value" select="@msgtype"/></xsl:call-template>:
+      onMessage( (<xsl:value-of select="@name"/>&amp;)message, sessionID ); break;</xsl:for-each>
+    default:
+      onMessage( message, sessionID );
+    }
   }
 </xsl:template>
 
+<!-- case label matching FIX::Message::msgTypeKey -->
+<xsl:template name="msgtype-key">
+ <xsl:param name="value"/>
+ <xsl:choose>
+  <xsl:when test="string-length($value)=1">'<xsl:value-of select="$value"/>'</xsl:when>
+  <xsl:otherwise>(<xsl:call-template name="msgtype-key"><xsl:with-param name="value" select="substring($value, 1, string-length($value) - 1)"/></xsl:call-template>) * 256 + '<xsl:value-of select="substring($value, string-length($value))"/>'</xsl:otherwise>
+ </xsl:choose>
+</xsl:template>
+
 </xsl:stylesheet>
@@ -24,17 +24,20 @@ class Processor
 
   def populateFieldHash
     @fieldHash = Hash.new
+    @fieldTypeHash = Hash.new
     if( @major == "5" )
       @fieldsT.elements.each("field") { |field|
         name = field.attributes["name"]
         number = field.attributes["number"]
         @fieldHash[name] = number;
+        @fieldTypeHash[name] = field.attributes["type"]
       }
     end
     @fields.elements.each("field") { |field|
       name = field.attributes["name"]
       number = field.attributes["number"]
       @fieldHash[name] = number;
+      @fieldTypeHash[name] = field.attributes["type"]
     }
   end
 
@@ -105,6 +108,7 @@ class Processor
 
   def front
     @generators.each { |generator|
+      generator.fieldTypes(@fieldTypeHash) if generator.respond_to?(:fieldTypes)
       generator.front
     }
   end
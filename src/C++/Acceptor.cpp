@@ -88,6 +88,8 @@ void Acceptor::initialize() throw ( ConfigError )
 
   if ( !m_sessions.size() )
     throw ConfigError( "No sessions defined for acceptor" );
+
+  m_sendBatch = SendBatch::parse( m_settings.get() );
 }
 
 Acceptor::~Acceptor()
@@ -89,6 +89,8 @@ public:
   Application& getApplication() { return m_application; }
   MessageStoreFactory& getMessageStoreFactory()
   { return m_messageStoreFactory; }
+  /// How connections batch outgoing messages
+  const SendBatch& getSendBatch() const { return m_sendBatch; }
 
 private:
   void initialize() throw ( ConfigError );
@@ -115,6 +117,7 @@ private:
   Application& m_application;
   MessageStoreFactory& m_messageStoreFactory;
   SessionSettings m_settings;
+  SendBatch m_sendBatch;
   LogFactory* m_pLogFactory;
   Log* m_pLog;
   NullLog m_nullLog;
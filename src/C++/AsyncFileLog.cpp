@@ -0,0 +1,462 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "AsyncFileLog.h"
+#include "FieldConvertors.h"
+
+namespace FIX
+{
+namespace
+{
+const char JOURNAL_HEADER[] = "QFJRNL01";
+const size_t JOURNAL_HEADER_SIZE = sizeof(JOURNAL_HEADER) - 1;
+/// Timestamp, kind and length of the text
+const size_t RECORD_HEADER_SIZE = 8 + 1 + 4;
+}
+
+Log* AsyncFileLogFactory::create()
+{
+  m_globalLogCount++;
+  if( m_globalLogCount > 1 ) return m_globalLog;
+
+  try
+  {
+    std::string path = m_path;
+    std::string backupPath = m_backupPath;
+    size_t queueSize = m_queueSize;
+    int flushInterval = m_flushInterval;
+
+    if( m_useSettings )
+      getSettings( m_settings.get(), path, backupPath, queueSize, flushInterval );
+
+    return m_globalLog =
+      new AsyncFileLog( path, backupPath, queueSize, flushInterval );
+  }
+  catch( ConfigError& )
+  {
+    m_globalLogCount--;
+    throw;
+  }
+}
+
+Log* AsyncFileLogFactory::create( const SessionID& s )
+{
+  std::string path = m_path;
+  std::string backupPath = m_backupPath;
+  size_t queueSize = m_queueSize;
+  int flushInterval = m_flushInterval;
+
+  if( m_useSettings )
+    getSettings( m_settings.get( s ), path, backupPath, queueSize, flushInterval );
+
+  return new AsyncFileLog( path, backupPath, s, queueSize, flushInterval );
+}
+
+void AsyncFileLogFactory::destroy( Log* pLog )
+{
+  if( pLog == m_globalLog )
+  {
+    m_globalLogCount--;
+    if( m_globalLogCount == 0 )
+    {
+      delete pLog;
+      m_globalLog = 0;
+    }
+  }
+  else
+  {
+    delete pLog;
+  }
+}
+
+void AsyncFileLogFactory::getSettings( const Dictionary& settings,
+                                       std::string& path,
+                                       std::string& backupPath,
+                                       size_t& queueSize,
+                                       int& flushInterval )
+{
+  path = settings.getString( FILE_LOG_PATH );
+  backupPath = path;
+  if( settings.has( FILE_LOG_BACKUP_PATH ) )
+    backupPath = settings.getString( FILE_LOG_BACKUP_PATH );
+  if( settings.has( ASYNC_LOG_QUEUE_SIZE ) )
+    queueSize = settings.getInt( ASYNC_LOG_QUEUE_SIZE );
+  if( settings.has( ASYNC_LOG_FLUSH_INTERVAL ) )
+    flushInterval = settings.getInt( ASYNC_LOG_FLUSH_INTERVAL );
+
+  if( flushInterval < 1 )
+    throw ConfigError( std::string(ASYNC_LOG_FLUSH_INTERVAL) + " must be positive" );
+}
+
+AsyncFileLog::AsyncFileLog( const std::string& path, size_t queueSize,
+                            int flushInterval )
+: m_queue( queueSize ? queueSize : AsyncFileLogFactory::DEFAULT_QUEUE_SIZE ),
+  m_shared( true ), m_dropped( 0 ), m_reportedDropped( 0 ), m_pFile( 0 ),
+  m_flushInterval( 0 ), m_stop( false )
+{
+  init( path, path, "GLOBAL", flushInterval );
+}
+
+AsyncFileLog::AsyncFileLog( const std::string& path,
+                            const std::string& backupPath,
+                            size_t queueSize, int flushInterval )
+: m_queue( queueSize ? queueSize : AsyncFileLogFactory::DEFAULT_QUEUE_SIZE ),
+  m_shared( true ), m_dropped( 0 ), m_reportedDropped( 0 ), m_pFile( 0 ),
+  m_flushInterval( 0 ), m_stop( false )
+{
+  init( path, backupPath, "GLOBAL", flushInterval );
+}
+
+AsyncFileLog::AsyncFileLog( const std::string& path, const SessionID& s,
+                            size_t queueSize, int flushInterval )
+: m_queue( queueSize ? queueSize : AsyncFileLogFactory::DEFAULT_QUEUE_SIZE ),
+  m_shared( false ), m_dropped( 0 ), m_reportedDropped( 0 ), m_pFile( 0 ),
+  m_flushInterval( 0 ), m_stop( false )
+{
+  init( path, path, generatePrefix(s), flushInterval );
+}
+
+AsyncFileLog::AsyncFileLog( const std::string& path,
+                            const std::string& backupPath,
+                            const SessionID& s,
+                            size_t queueSize, int flushInterval )
+: m_queue( queueSize ? queueSize : AsyncFileLogFactory::DEFAULT_QUEUE_SIZE ),
+  m_shared( false ), m_dropped( 0 ), m_reportedDropped( 0 ), m_pFile( 0 ),
+  m_flushInterval( 0 ), m_stop( false )
+{
+  init( path, backupPath, generatePrefix(s), flushInterval );
+}
+
+AsyncFileLog::~AsyncFileLog()
+{
+  atomic_store_release( m_stop, true );
+  m_writerEvent.signal();
+  thread_join( m_thread );
+  if( m_pFile )
+    file_fclose( m_pFile );
+}
+
+std::string AsyncFileLog::generatePrefix( const SessionID& s )
+{
+  const std::string& begin =
+    s.getBeginString().getString();
+  const std::string& sender =
+    s.getSenderCompID().getString();
+  const std::string& target =
+    s.getTargetCompID().getString();
+  const std::string& qualifier =
+    s.getSessionQualifier();
+
+  std::string prefix = begin + "-" + sender + "-" + target;
+  if( qualifier.size() )
+    prefix += "-" + qualifier;
+
+  return prefix;
+}
+
+void AsyncFileLog::init( std::string path, std::string backupPath,
+                         const std::string& prefix, int flushInterval )
+{
+  file_mkdir( path.c_str() );
+  file_mkdir( backupPath.c_str() );
+
+  if ( path.empty() ) path = ".";
+  if ( backupPath.empty() ) backupPath = path;
+
+  m_fileName = file_appendpath( path, prefix + ".journal.current.bin" );
+  m_fullBackupPrefix = file_appendpath( backupPath, prefix + "." );
+  m_flushInterval = flushInterval > 0 ? flushInterval : 1;
+  m_buffer.reserve( WRITE_SIZE );
+
+  open( "ab" );
+  if( !m_pFile )
+    throw ConfigError( "Could not open journal file: " + m_fileName );
+
+  if( !thread_spawn( &writerThread, this, m_thread ) )
+  {
+    file_fclose( m_pFile );
+    throw RuntimeError( "Unable to spawn thread" );
+  }
+}
+
+void AsyncFileLog::clear()
+{
+  control( CLEAR );
+}
+
+void AsyncFileLog::backup()
+{
+  control( BACKUP );
+}
+
+void AsyncFileLog::flush()
+{
+  control( FLUSH );
+}
+
+size_t AsyncFileLog::getDroppedCount() const
+{
+  return atomic_load_acquire( m_dropped );
+}
+
+void AsyncFileLog::push( char kind, const char* data, size_t size )
+{
+  if( m_shared )
+  {
+    Locker l( m_producerMutex );
+    enqueue( kind, data, size );
+  }
+  else
+    enqueue( kind, data, size );
+}
+
+void AsyncFileLog::enqueue( char kind, const char* data, size_t size )
+{
+  size_t position = m_queue.writePosition();
+  if( m_queue.full() )
+  {
+    atomic_store_release( m_dropped, m_dropped + 1 );
+    return;
+  }
+
+  // records are reused, so the text is copied into memory it already owns
+  Record& record = m_queue.at( position );
+  record.time = time_nanoseconds();
+  record.kind = kind;
+  record.text.assign( data, size );
+  m_queue.publish( ++position );
+
+  // the writer otherwise sleeps until the next flush, waking it once half
+  // the queue is used leaves room for bursts while it catches up
+  if( position - m_queue.readPosition() == m_queue.capacity() / 2 )
+    m_writerEvent.signal();
+}
+
+void AsyncFileLog::control( char kind )
+{
+  Locker l( m_producerMutex );
+
+  while( m_queue.full() )
+  {
+    m_writerEvent.signal();
+    m_writtenEvent.wait( 0.1 );
+  }
+
+  size_t position = m_queue.writePosition();
+  m_queue.at( position ).kind = kind;
+  m_queue.publish( ++position );
+  m_writerEvent.signal();
+
+  // positions only grow, so anything but a distance of one to capacity
+  // means that the writer has passed the position
+  while( position - m_queue.readPosition() - 1 < m_queue.capacity() )
+    m_writtenEvent.wait( 0.1 );
+}
+
+THREAD_PROC AsyncFileLog::writerThread( void* p )
+{
+  AsyncFileLog * pLog = static_cast < AsyncFileLog* > ( p );
+  pLog->write();
+  return 0;
+}
+
+void AsyncFileLog::write()
+{
+  long lastFlush = process_milliseconds();
+
+  while( true )
+  {
+    size_t begin = m_queue.readPosition();
+    size_t end = m_queue.writePosition();
+    if( begin != end && write( begin, end ) )
+      m_writtenEvent.broadcast();
+
+    size_t dropped = atomic_load_acquire( m_dropped );
+    if( dropped != m_reportedDropped )
+    {
+      Record record;
+      record.time = time_nanoseconds();
+      record.text = "Log queue full, dropped "
+        + IntConvertor::convert( (int)(dropped - m_reportedDropped) ) + " records";
+      encode( record );
+      m_reportedDropped = dropped;
+    }
+
+    long now = process_milliseconds();
+    long elapsed = now - lastFlush;
+    if( elapsed >= m_flushInterval )
+    {
+      writeBuffer();
+      lastFlush = now;
+      elapsed = 0;
+    }
+    else if( m_buffer.size() >= WRITE_SIZE )
+      writeBuffer();
+
+    if( atomic_load_acquire( m_stop ) )
+    {
+      if( !m_queue.empty() ) continue;
+      writeBuffer();
+      break;
+    }
+
+    if( m_queue.empty() )
+      m_writerEvent.wait( (m_flushInterval - elapsed) / 1000.0 );
+  }
+}
+
+bool AsyncFileLog::write( size_t begin, size_t end )
+{
+  bool controlled = false;
+
+  for( size_t i = begin; i != end; ++i )
+  {
+    const Record& record = m_queue.at( i );
+    switch( record.kind )
+    {
+    case CLEAR:
+      m_buffer.clear();
+      open( "wb" );
+      controlled = true;
+      break;
+    case BACKUP:
+      writeBuffer();
+      rotate();
+      controlled = true;
+      break;
+    case FLUSH:
+      writeBuffer();
+      controlled = true;
+      break;
+    default:
+      encode( record );
+    }
+  }
+
+  m_queue.release( end );
+  return controlled;
+}
+
+void AsyncFileLog::encode( const Record& record )
+{
+  char header[ RECORD_HEADER_SIZE ];
+  unsigned long long time = (unsigned long long)record.time;
+  size_t length = record.text.size();
+
+  for( int i = 0; i < 8; ++i )
+    header[ i ] = (char)( time >> (8 * i) );
+  header[ 8 ] = record.kind;
+  for( int i = 0; i < 4; ++i )
+    header[ 9 + i ] = (char)( length >> (8 * i) );
+
+  m_buffer.append( header, RECORD_HEADER_SIZE );
+  m_buffer.append( record.text );
+}
+
+void AsyncFileLog::writeBuffer()
+{
+  if( m_buffer.empty() ) return;
+  if( m_pFile )
+    fwrite( m_buffer.data(), 1, m_buffer.size(), m_pFile );
+  m_buffer.clear();
+}
+
+void AsyncFileLog::open( const char* mode )
+{
+  if( m_pFile )
+    file_fclose( m_pFile );
+
+  m_pFile = file_fopen( m_fileName.c_str(), mode );
+  if( !m_pFile ) return;
+
+  // batches are already large, every one is a single write to the file
+  setvbuf( m_pFile, 0, _IONBF, 0 );
+  fseek( m_pFile, 0, SEEK_END );
+  if( ftell( m_pFile ) == 0 )
+    fwrite( JOURNAL_HEADER, 1, JOURNAL_HEADER_SIZE, m_pFile );
+}
+
+void AsyncFileLog::rotate()
+{
+  if( m_pFile )
+  {
+    file_fclose( m_pFile );
+    m_pFile = 0;
+  }
+
+  for( int i = 1; ; ++i )
+  {
+    std::string backupFileName = m_fullBackupPrefix
+      + "journal.backup." + IntConvertor::convert( i ) + ".bin";
+    if( !file_exists( backupFileName.c_str() ) )
+    {
+      file_rename( m_fileName.c_str(), backupFileName.c_str() );
+      break;
+    }
+  }
+
+  open( "wb" );
+}
+
+bool AsyncFileLog::readHeader( std::istream& stream )
+{
+  char header[ JOURNAL_HEADER_SIZE ];
+  if( !stream.read( header, JOURNAL_HEADER_SIZE ) )
+    return false;
+  return std::string( header, JOURNAL_HEADER_SIZE ) == JOURNAL_HEADER;
+}
+
+bool AsyncFileLog::readRecord( std::istream& stream, Record& record )
+{
+  unsigned char header[ RECORD_HEADER_SIZE ];
+  if( !stream.read( (char*)header, RECORD_HEADER_SIZE ) )
+    return false;
+
+  unsigned long long time = 0;
+  for( int i = 7; i >= 0; --i )
+    time = ( time << 8 ) | header[ i ];
+  size_t length = 0;
+  for( int i = 3; i >= 0; --i )
+    length = ( length << 8 ) | header[ 9 + i ];
+
+  record.time = (long long)time;
+  record.kind = (char)header[ 8 ];
+  record.text.resize( length );
+  return !length || stream.read( &record.text[0], length );
+}
+
+std::string& AsyncFileLog::formatRecord( const Record& record,
+                                         bool millisecondsInTimeStamp,
+                                         std::string& result )
+{
+  UtcTimeStamp time( (time_t)( record.time / 1000000000 ),
+                     (int)( record.time % 1000000000 / 1000000 ) );
+  result = UtcTimeStampConvertor::convert( time, millisecondsInTimeStamp );
+  result += " : ";
+  result += record.text;
+  return result;
+}
+
+} //namespace FIX
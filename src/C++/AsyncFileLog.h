@@ -0,0 +1,198 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_ASYNCFILELOG_H
+#define FIX_ASYNCFILELOG_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Log.h"
+#include "SessionSettings.h"
+#include "SpscQueue.h"
+#include "Event.h"
+#include "Mutex.h"
+#include "Utility.h"
+#include <istream>
+#include <string>
+
+namespace FIX
+{
+/**
+ * Creates AsyncFileLog logs, one journal per session and one shared
+ * global journal.
+ */
+class AsyncFileLogFactory : public LogFactory
+{
+public:
+  enum { DEFAULT_QUEUE_SIZE = 8192, DEFAULT_FLUSH_INTERVAL = 100 };
+
+  AsyncFileLogFactory( const SessionSettings& settings )
+  : m_settings( settings ), m_useSettings( true ),
+    m_queueSize( DEFAULT_QUEUE_SIZE ), m_flushInterval( DEFAULT_FLUSH_INTERVAL ),
+    m_globalLog( 0 ), m_globalLogCount( 0 ) {}
+  AsyncFileLogFactory( const std::string& path,
+                       size_t queueSize = DEFAULT_QUEUE_SIZE,
+                       int flushInterval = DEFAULT_FLUSH_INTERVAL )
+  : m_path( path ), m_backupPath( path ), m_useSettings( false ),
+    m_queueSize( queueSize ), m_flushInterval( flushInterval ),
+    m_globalLog( 0 ), m_globalLogCount( 0 ) {}
+  AsyncFileLogFactory( const std::string& path, const std::string& backupPath,
+                       size_t queueSize = DEFAULT_QUEUE_SIZE,
+                       int flushInterval = DEFAULT_FLUSH_INTERVAL )
+  : m_path( path ), m_backupPath( backupPath ), m_useSettings( false ),
+    m_queueSize( queueSize ), m_flushInterval( flushInterval ),
+    m_globalLog( 0 ), m_globalLogCount( 0 ) {}
+
+  Log* create();
+  Log* create( const SessionID& );
+  void destroy( Log* log );
+
+private:
+  void getSettings( const Dictionary&, std::string& path, std::string& backupPath,
+                    size_t& queueSize, int& flushInterval );
+
+  std::string m_path;
+  std::string m_backupPath;
+  SessionSettings m_settings;
+  bool m_useSettings;
+  size_t m_queueSize;
+  int m_flushInterval;
+  Log* m_globalLog;
+  int m_globalLogCount;
+};
+
+/**
+ * File based implementation of Log that writes a binary journal on a
+ * thread of its own.
+ *
+ * Logging copies the text and a nanosecond timestamp into a queue
+ * without formatting anything or waiting for the disk.  The writer thread
+ * appends whatever has queued up to the journal with one write and
+ * flushes it at most every flushInterval milliseconds.  When the queue is
+ * full records are dropped instead of waiting for the writer, and the
+ * number of dropped records is written to the journal as an event.
+ *
+ * A session log must only be used under the lock of its session, which
+ * every Session does.  The global log is shared by the threads of an
+ * acceptor or initiator and serializes them with a mutex.
+ *
+ * The logdump tool prints a journal in the text format of FileLog.
+ */
+class AsyncFileLog : public Log
+{
+public:
+  enum Kind { INCOMING = 'I', OUTGOING = 'O', EVENT = 'E' };
+
+  /// Entry of a journal
+  struct Record
+  {
+    Record() : time( 0 ), kind( EVENT ) {}
+
+    /// Nanoseconds since the epoch
+    long long time;
+    char kind;
+    std::string text;
+  };
+
+  AsyncFileLog( const std::string& path,
+                size_t queueSize = AsyncFileLogFactory::DEFAULT_QUEUE_SIZE,
+                int flushInterval = AsyncFileLogFactory::DEFAULT_FLUSH_INTERVAL );
+  AsyncFileLog( const std::string& path, const std::string& backupPath,
+                size_t queueSize = AsyncFileLogFactory::DEFAULT_QUEUE_SIZE,
+                int flushInterval = AsyncFileLogFactory::DEFAULT_FLUSH_INTERVAL );
+  AsyncFileLog( const std::string& path, const SessionID& sessionID,
+                size_t queueSize = AsyncFileLogFactory::DEFAULT_QUEUE_SIZE,
+                int flushInterval = AsyncFileLogFactory::DEFAULT_FLUSH_INTERVAL );
+  AsyncFileLog( const std::string& path, const std::string& backupPath,
+                const SessionID& sessionID,
+                size_t queueSize = AsyncFileLogFactory::DEFAULT_QUEUE_SIZE,
+                int flushInterval = AsyncFileLogFactory::DEFAULT_FLUSH_INTERVAL );
+  virtual ~AsyncFileLog();
+
+  void clear();
+  void backup();
+
+  void onIncoming( const std::string& value )
+  { push( INCOMING, value.data(), value.size() ); }
+  void onOutgoing( const std::string& value )
+  { push( OUTGOING, value.data(), value.size() ); }
+  void onOutgoing( const char* data, size_t size )
+  { push( OUTGOING, data, size ); }
+  void onEvent( const std::string& value )
+  { push( EVENT, value.data(), value.size() ); }
+
+  /// Wait until every queued record has been written and flushed
+  void flush();
+  /// Number of records dropped because the queue was full
+  size_t getDroppedCount() const;
+  const std::string& getFileName() const { return m_fileName; }
+
+  /// Read the header at the start of a journal
+  static bool readHeader( std::istream& );
+  /// Read the next record of a journal
+  static bool readRecord( std::istream&, Record& );
+  /// Format a record the way FileLog writes it
+  static std::string& formatRecord( const Record&, bool millisecondsInTimeStamp,
+                                    std::string& result );
+
+private:
+  /// Queued requests of the logging threads, besides records
+  enum Control { CLEAR = 'c', BACKUP = 'b', FLUSH = 'f' };
+  enum { WRITE_SIZE = 64 * 1024 };
+
+  void init( std::string path, std::string backupPath,
+             const std::string& prefix, int flushInterval );
+  std::string generatePrefix( const SessionID& sessionID );
+
+  void push( char kind, const char* data, size_t size );
+  void enqueue( char kind, const char* data, size_t size );
+  void control( char kind );
+
+  static THREAD_PROC writerThread( void* p );
+  void write();
+  bool write( size_t begin, size_t end );
+  void encode( const Record& record );
+  void writeBuffer();
+  void open( const char* mode );
+  void rotate();
+
+  SpscQueue < Record > m_queue;
+  bool m_shared;
+  Mutex m_producerMutex;
+  volatile size_t m_dropped;
+  size_t m_reportedDropped;
+
+  std::string m_fileName;
+  std::string m_fullBackupPrefix;
+  FILE* m_pFile;
+  std::string m_buffer;
+  long m_flushInterval;
+
+  Event m_writerEvent;
+  Event m_writtenEvent;
+  volatile bool m_stop;
+  thread_id m_thread;
+};
+}
+
+#endif //FIX_ASYNCFILELOG_H
@@ -0,0 +1,393 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "AsyncMessageStore.h"
+#include "SessionID.h"
+#include "FieldConvertors.h"
+#include "Utility.h"
+
+namespace FIX
+{
+MessageStore* AsyncMessageStoreFactory::create( const SessionID& s )
+{
+  size_t queueSize = m_queueSize;
+  bool persistBeforeSend = m_persistBeforeSend;
+
+  if ( m_useSettings )
+  {
+    Dictionary settings = m_settings.get( s );
+    if( settings.has( ASYNC_STORE_QUEUE_SIZE ) )
+      queueSize = settings.getInt( ASYNC_STORE_QUEUE_SIZE );
+    if( settings.has( ASYNC_STORE_PERSIST_BEFORE_SEND ) )
+      persistBeforeSend = settings.getBool( ASYNC_STORE_PERSIST_BEFORE_SEND );
+  }
+
+  return new AsyncMessageStore( m_factory, s, queueSize, persistBeforeSend );
+}
+
+void AsyncMessageStoreFactory::destroy( MessageStore* pStore )
+{
+  delete pStore;
+}
+
+AsyncMessageStore::AsyncMessageStore( MessageStoreFactory& factory,
+                                      const SessionID& s,
+                                      size_t queueSize,
+                                      bool persistBeforeSend )
+: m_factory( factory ), m_pStore( factory.create( s ) ),
+  m_persistBeforeSend( persistBeforeSend ),
+  m_queue( queueSize ? queueSize : AsyncMessageStoreFactory::DEFAULT_QUEUE_SIZE ),
+  m_failed( false ), m_writerWaiting( false ), m_stop( false ),
+  m_durableMsgSeqNum( 0 )
+{
+  load();
+
+  if( !thread_spawn( &writerThread, this, m_thread ) )
+  {
+    m_factory.destroy( m_pStore );
+    throw RuntimeError( "Unable to spawn thread" );
+  }
+}
+
+AsyncMessageStore::~AsyncMessageStore()
+{
+  atomic_store_release( m_stop, true );
+  m_writerEvent.signal();
+  thread_join( m_thread );
+  m_factory.destroy( m_pStore );
+}
+
+bool AsyncMessageStore::set( int msgSeqNum, const std::string& msg )
+throw ( IOException )
+{
+  Entry& entry = beginPush();
+  entry.msgSeqNum = msgSeqNum;
+  entry.message = msg;
+  endPush();
+  return true;
+}
+
+bool AsyncMessageStore::set( int msgSeqNum, const char* data, size_t size )
+throw ( IOException )
+{
+  Entry& entry = beginPush();
+  entry.msgSeqNum = msgSeqNum;
+  entry.message.assign( data, size );
+  endPush();
+  return true;
+}
+
+void AsyncMessageStore::get( int begin, int end,
+                             std::vector < std::string > & result ) const
+throw ( IOException )
+{
+  // Queued entries stay untouched until they are overwritten by the
+  // thread calling this, so they can be read while the writer works.
+  typedef std::map < int, const std::string* > Pending;
+  Pending pending;
+  size_t last = m_queue.writePosition();
+  for ( size_t i = m_queue.readPosition(); i != last; ++i )
+  {
+    const Entry& entry = m_queue.at( i );
+    if ( entry.msgSeqNum && entry.msgSeqNum >= begin && entry.msgSeqNum <= end )
+      pending[ entry.msgSeqNum ] = &entry.message;
+  }
+
+  if ( pending.empty() )
+  {
+    Locker l( m_storeMutex );
+    m_pStore->get( begin, end, result );
+    return;
+  }
+
+  // queued messages are newer than the stored ones
+  result.clear();
+  if ( begin < pending.begin()->first )
+  {
+    Locker l( m_storeMutex );
+    m_pStore->get( begin, pending.begin()->first - 1, result );
+  }
+  Pending::const_iterator i;
+  for ( i = pending.begin(); i != pending.end(); ++i )
+    result.push_back( *i->second );
+}
+
+void AsyncMessageStore::forEach( int begin, int end,
+                                 StoredMessageCallback& callback ) const
+throw ( IOException )
+{
+  typedef std::map < int, const std::string* > Pending;
+  Pending pending;
+  size_t last = m_queue.writePosition();
+  for ( size_t i = m_queue.readPosition(); i != last; ++i )
+  {
+    const Entry& entry = m_queue.at( i );
+    if ( entry.msgSeqNum && entry.msgSeqNum >= begin && entry.msgSeqNum <= end )
+      pending[ entry.msgSeqNum ] = &entry.message;
+  }
+
+  // stored messages are read a batch at a time so that the writer is not
+  // held up while they are passed on
+  int storedEnd = pending.empty() ? end : pending.begin()->first - 1;
+  std::vector < std::string > messages;
+  std::vector < std::string > ::const_iterator j;
+  for ( int batch = begin; batch <= storedEnd; batch += FOR_EACH_BATCH )
+  {
+    int batchEnd = batch + FOR_EACH_BATCH - 1;
+    if ( batchEnd > storedEnd || batchEnd < batch ) batchEnd = storedEnd;
+    {
+      Locker l( m_storeMutex );
+      m_pStore->get( batch, batchEnd, messages );
+    }
+    for ( j = messages.begin(); j != messages.end(); ++j )
+      callback.onMessage( *j );
+    if ( batchEnd == storedEnd ) break;
+  }
+
+  Pending::const_iterator i;
+  for ( i = pending.begin(); i != pending.end(); ++i )
+    callback.onMessage( *i->second );
+}
+
+int AsyncMessageStore::getNextSenderMsgSeqNum() const throw ( IOException )
+{
+  return m_cache.getNextSenderMsgSeqNum();
+}
+
+int AsyncMessageStore::getNextTargetMsgSeqNum() const throw ( IOException )
+{
+  return m_cache.getNextTargetMsgSeqNum();
+}
+
+void AsyncMessageStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
+{
+  m_cache.setNextSenderMsgSeqNum( value );
+  pushSeqNums();
+}
+
+void AsyncMessageStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
+{
+  m_cache.setNextTargetMsgSeqNum( value );
+  pushSeqNums();
+}
+
+void AsyncMessageStore::incrNextSenderMsgSeqNum() throw ( IOException )
+{
+  m_cache.incrNextSenderMsgSeqNum();
+  pushSeqNums();
+}
+
+void AsyncMessageStore::incrNextTargetMsgSeqNum() throw ( IOException )
+{
+  m_cache.incrNextTargetMsgSeqNum();
+  pushSeqNums();
+}
+
+UtcTimeStamp AsyncMessageStore::getCreationTime() const throw ( IOException )
+{
+  return m_cache.getCreationTime();
+}
+
+void AsyncMessageStore::reset() throw ( IOException )
+{
+  waitFor( m_queue.writePosition() );
+  Locker l( m_storeMutex );
+  // changes left behind by a failure are dropped along with the rest
+  m_queue.release( m_queue.writePosition() );
+  m_pStore->reset();
+  load();
+
+  Locker errorLocker( m_errorMutex );
+  m_failed = false;
+  m_writerEvent.signal();
+}
+
+void AsyncMessageStore::refresh() throw ( IOException )
+{
+  flush();
+  Locker l( m_storeMutex );
+  m_pStore->refresh();
+  load();
+}
+
+void AsyncMessageStore::flush() throw ( IOException )
+{
+  waitFor( m_queue.writePosition() );
+  checkError();
+}
+
+int AsyncMessageStore::getDurableMsgSeqNum() const
+{
+  return m_durableMsgSeqNum;
+}
+
+AsyncMessageStore::Entry& AsyncMessageStore::beginPush() throw ( IOException )
+{
+  checkError();
+  while ( m_queue.full() )
+  {
+    m_writtenEvent.wait( 0.1 );
+    checkError();
+  }
+  return m_queue.at( m_queue.writePosition() );
+}
+
+void AsyncMessageStore::endPush()
+{
+  size_t position = m_queue.writePosition() + 1;
+  m_queue.publish( position );
+
+  // pairs with the fence of a writer that is about to go to sleep
+  atomic_fence();
+  if ( m_writerWaiting )
+    m_writerEvent.signal();
+
+  if ( m_persistBeforeSend )
+  {
+    waitFor( position );
+    checkError();
+  }
+}
+
+void AsyncMessageStore::pushSeqNums() throw ( IOException )
+{
+  Entry& entry = beginPush();
+  entry.msgSeqNum = 0;
+  entry.nextSenderMsgSeqNum = m_cache.getNextSenderMsgSeqNum();
+  entry.nextTargetMsgSeqNum = m_cache.getNextTargetMsgSeqNum();
+  endPush();
+}
+
+void AsyncMessageStore::waitFor( size_t position ) const
+{
+  // positions only grow, so anything but a distance of one to capacity
+  // means that the writer has reached the position
+  while ( position - m_queue.readPosition() - 1 < m_queue.capacity()
+          && !m_failed )
+    m_writtenEvent.wait( 0.1 );
+}
+
+void AsyncMessageStore::checkError() throw ( IOException )
+{
+  if ( !m_failed ) return;
+
+  Locker l( m_errorMutex );
+  if ( m_failed )
+    throw IOException( m_error );
+}
+
+void AsyncMessageStore::load()
+{
+  m_cache.setNextSenderMsgSeqNum( m_pStore->getNextSenderMsgSeqNum() );
+  m_cache.setNextTargetMsgSeqNum( m_pStore->getNextTargetMsgSeqNum() );
+  m_cache.setCreationTime( m_pStore->getCreationTime() );
+  m_durableMsgSeqNum = 0;
+}
+
+THREAD_PROC AsyncMessageStore::writerThread( void* p )
+{
+  AsyncMessageStore * pStore = static_cast < AsyncMessageStore* > ( p );
+  pStore->write();
+  return 0;
+}
+
+void AsyncMessageStore::write()
+{
+  while ( true )
+  {
+    // after a failure the queue is left alone until the store is reset
+    if ( !m_queue.empty() && !m_failed )
+    {
+      writeQueued();
+      m_writtenEvent.broadcast();
+      continue;
+    }
+
+    if ( atomic_load_acquire( m_stop ) )
+    {
+      if ( m_queue.empty() || m_failed ) break;
+      continue;
+    }
+
+    m_writerWaiting = true;
+    atomic_fence();
+    if ( ( m_queue.empty() || m_failed ) && !m_stop )
+      m_writerEvent.wait( 1 );
+    m_writerWaiting = false;
+  }
+}
+
+void AsyncMessageStore::writeQueued()
+{
+  Locker l( m_storeMutex );
+
+  size_t begin = m_queue.readPosition();
+  size_t end = m_queue.writePosition();
+  m_batch.clear();
+  const Entry* pSeqNums = 0;
+  int durableMsgSeqNum = m_durableMsgSeqNum;
+
+  for ( size_t i = begin; i != end; ++i )
+  {
+    const Entry& entry = m_queue.at( i );
+    if ( entry.msgSeqNum )
+    {
+      m_batch.push_back( std::make_pair( entry.msgSeqNum, &entry.message ) );
+      durableMsgSeqNum = entry.msgSeqNum;
+    }
+    else
+      pSeqNums = &entry;
+  }
+
+  try
+  {
+    m_pStore->setBatch( m_batch );
+    // only the latest sequence numbers matter
+    if ( pSeqNums )
+    {
+      m_pStore->setNextMsgSeqNums( pSeqNums->nextSenderMsgSeqNum,
+                                   pSeqNums->nextTargetMsgSeqNum );
+    }
+    m_durableMsgSeqNum = durableMsgSeqNum;
+  }
+  catch ( std::exception& e )
+  {
+    // the batch stays queued so that it can still be resent
+    Locker errorLocker( m_errorMutex );
+    m_error = "Unable to store messages";
+    if ( !m_batch.empty() )
+    {
+      m_error += " " + IntConvertor::convert( m_batch.front().first )
+                 + " to " + IntConvertor::convert( m_batch.back().first );
+    }
+    m_error += std::string( ": " ) + e.what();
+    m_failed = true;
+    return;
+  }
+
+  m_queue.release( end );
+}
+
+} //namespace FIX
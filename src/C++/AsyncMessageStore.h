@@ -0,0 +1,163 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_ASYNCMESSAGESTORE_H
+#define FIX_ASYNCMESSAGESTORE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "MessageStore.h"
+#include "SessionSettings.h"
+#include "SpscQueue.h"
+#include "Event.h"
+#include "Mutex.h"
+#include <string>
+
+namespace FIX
+{
+/**
+ * Creates stores that write through another MessageStoreFactory's
+ * stores on a thread of their own.
+ */
+class AsyncMessageStoreFactory : public MessageStoreFactory
+{
+public:
+  enum { DEFAULT_QUEUE_SIZE = 4096 };
+
+  AsyncMessageStoreFactory( MessageStoreFactory& factory,
+                            const SessionSettings& settings )
+  : m_factory( factory ), m_settings( settings ), m_useSettings( true ),
+    m_queueSize( DEFAULT_QUEUE_SIZE ), m_persistBeforeSend( false ) {}
+  AsyncMessageStoreFactory( MessageStoreFactory& factory,
+                            size_t queueSize = DEFAULT_QUEUE_SIZE,
+                            bool persistBeforeSend = false )
+  : m_factory( factory ), m_useSettings( false ),
+    m_queueSize( queueSize ), m_persistBeforeSend( persistBeforeSend ) {}
+
+  MessageStore* create( const SessionID& );
+  void destroy( MessageStore* );
+private:
+  MessageStoreFactory& m_factory;
+  SessionSettings m_settings;
+  bool m_useSettings;
+  size_t m_queueSize;
+  bool m_persistBeforeSend;
+};
+/*! @} */
+
+/**
+ * MessageStore that hands its changes to a writer thread.
+ *
+ * Messages and sequence numbers are queued without taking a lock and the
+ * writer thread stores everything that has queued up since its last
+ * round with one MessageStore::setBatch, followed by the latest sequence
+ * numbers. Sequence numbers and the creation time are answered from
+ * memory, and messages that have not been stored yet are served from
+ * the queue when they are requested for a resend.
+ *
+ * By default changes return as soon as they are queued, so a message can
+ * be sent while it is being stored and at most queueSize changes are
+ * waiting to be stored at any time. With persistBeforeSend every change
+ * returns once the writer has stored it.
+ *
+ * When the underlying store fails, the changes it could not store stay
+ * queued, so get and forEach still return their messages, and the writer
+ * stops. Every later change throws the error until the store is reset.
+ */
+class AsyncMessageStore : public MessageStore
+{
+public:
+  AsyncMessageStore( MessageStoreFactory& factory, const SessionID& s,
+                     size_t queueSize = AsyncMessageStoreFactory::DEFAULT_QUEUE_SIZE,
+                     bool persistBeforeSend = false );
+  virtual ~AsyncMessageStore();
+
+  bool set( int, const std::string& ) throw ( IOException );
+  bool set( int, const char*, size_t ) throw ( IOException );
+  void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  void forEach( int, int, StoredMessageCallback& ) const throw ( IOException );
+
+  int getNextSenderMsgSeqNum() const throw ( IOException );
+  int getNextTargetMsgSeqNum() const throw ( IOException );
+  void setNextSenderMsgSeqNum( int value ) throw ( IOException );
+  void setNextTargetMsgSeqNum( int value ) throw ( IOException );
+  void incrNextSenderMsgSeqNum() throw ( IOException );
+  void incrNextTargetMsgSeqNum() throw ( IOException );
+
+  UtcTimeStamp getCreationTime() const throw ( IOException );
+
+  void reset() throw ( IOException );
+  void refresh() throw ( IOException );
+
+  /// Wait until every queued change has been written to the store
+  void flush() throw ( IOException );
+  /// Sequence number of the last message written to the store
+  int getDurableMsgSeqNum() const;
+
+private:
+  /// A message to store, or the sequence numbers if msgSeqNum is zero
+  struct Entry
+  {
+    Entry() : msgSeqNum( 0 ), nextSenderMsgSeqNum( 0 ), nextTargetMsgSeqNum( 0 ) {}
+
+    int msgSeqNum;
+    std::string message;
+    int nextSenderMsgSeqNum;
+    int nextTargetMsgSeqNum;
+  };
+
+  Entry& beginPush() throw ( IOException );
+  void endPush();
+  void pushSeqNums() throw ( IOException );
+  void waitFor( size_t position ) const;
+  void checkError() throw ( IOException );
+  void load();
+
+  static THREAD_PROC writerThread( void* p );
+  void write();
+  void writeQueued();
+
+  MessageStoreFactory& m_factory;
+  MessageStore* m_pStore;
+  bool m_persistBeforeSend;
+
+  MemoryStore m_cache;
+  SpscQueue < Entry > m_queue;
+  MessageBatch m_batch;
+
+  /// Held by the writer while it changes the store and releases entries
+  mutable Mutex m_storeMutex;
+  Mutex m_errorMutex;
+  std::string m_error;
+  volatile bool m_failed;
+
+  mutable Event m_writerEvent;
+  mutable Event m_writtenEvent;
+  volatile bool m_writerWaiting;
+  volatile bool m_stop;
+  volatile int m_durableMsgSeqNum;
+  thread_id m_thread;
+};
+}
+
+#endif //FIX_ASYNCMESSAGESTORE_H
@@ -103,6 +103,46 @@ typedef boost::detail::atomic_count atomic_count;
 
 #endif
 
+  /// Read a value written by another thread with atomic_store_release
+  template < typename T > inline T atomic_load_acquire( const volatile T& value )
+  {
+#if defined(_MSC_VER)
+    T result = value;
+    _ReadWriteBarrier();
+    return result;
+#elif defined(__ATOMIC_ACQUIRE)
+    return __atomic_load_n( &value, __ATOMIC_ACQUIRE );
+#else
+    T result = value;
+    __sync_synchronize();
+    return result;
+#endif
+  }
+
+  /// Publish a value and everything written before it to other threads
+  template < typename T > inline void atomic_store_release( volatile T& value, T newValue )
+  {
+#if defined(_MSC_VER)
+    _ReadWriteBarrier();
+    value = newValue;
+#elif defined(__ATOMIC_RELEASE)
+    __atomic_store_n( &value, newValue, __ATOMIC_RELEASE );
+#else
+    __sync_synchronize();
+    value = newValue;
+#endif
+  }
+
+  /// Order all reads and writes before the fence against the ones after it
+  inline void atomic_fence()
+  {
+#ifdef _MSC_VER
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+  }
+
 }
 
 #endif
@@ -0,0 +1,228 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "CharScanner.h"
+#include <algorithm>
+
+#if defined(__GNUC__) && defined(__SSE2__) \
+    && ( defined(__x86_64__) || defined(__i386__) )
+#define FIX_SCAN_SSE2
+// AVX2 intrinsics in functions with target("avx2") need gcc 4.9 or clang 3.8
+#if defined(__clang__)
+#if __clang_major__ > 3 || ( __clang_major__ == 3 && __clang_minor__ >= 8 )
+#define FIX_SCAN_AVX2
+#endif
+#elif __GNUC__ > 4 || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 9 )
+#define FIX_SCAN_AVX2
+#endif
+#include <immintrin.h>
+#elif defined(_MSC_VER) \
+    && ( defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 ) )
+#define FIX_SCAN_SSE2
+#include <emmintrin.h>
+#include <intrin.h>
+#endif
+
+namespace FIX
+{
+void CharScanner::scalarField( const char* begin, const char* end,
+                               const char*& equalSign, const char*& soh )
+{
+  equalSign = std::find( begin, end, '=' );
+  soh = equalSign == end ? end : std::find( equalSign + 1, end, '\001' );
+}
+
+unsigned int CharScanner::scalarSum( const char* begin, const char* end )
+{
+  unsigned int result = 0;
+  for( ; begin != end; ++begin )
+    result += (unsigned char)*begin;
+  return result;
+}
+
+#ifdef FIX_SCAN_SSE2
+
+static inline unsigned int first_bit( unsigned int mask )
+{
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward( &index, mask );
+  return index;
+#else
+  return __builtin_ctz( mask );
+#endif
+}
+
+static void sse2Field( const char* begin, const char* end,
+                       const char*& equalSign, const char*& soh )
+{
+  const __m128i equals = _mm_set1_epi8( '=' );
+  const __m128i sohs = _mm_set1_epi8( '\001' );
+  const char* found = 0;
+
+  for( ; end - begin >= 16; begin += 16 )
+  {
+    __m128i chunk = _mm_loadu_si128( (const __m128i*)begin );
+    unsigned int sohMask = _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, sohs ) );
+
+    if( !found )
+    {
+      unsigned int equalMask =
+        _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, equals ) );
+      if( !equalMask ) continue;
+      unsigned int index = first_bit( equalMask );
+      found = begin + index;
+      sohMask &= ~( ( 2u << index ) - 1 );
+    }
+
+    if( sohMask )
+    {
+      equalSign = found;
+      soh = begin + first_bit( sohMask );
+      return;
+    }
+  }
+
+  if( !found )
+  {
+    CharScanner::scalarField( begin, end, equalSign, soh );
+    return;
+  }
+
+  equalSign = found;
+  soh = std::find( begin, end, '\001' );
+}
+
+static unsigned int sse2Sum( const char* begin, const char* end )
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i total = zero;
+
+  for( ; end - begin >= 16; begin += 16 )
+  {
+    __m128i chunk = _mm_loadu_si128( (const __m128i*)begin );
+    total = _mm_add_epi64( total, _mm_sad_epu8( chunk, zero ) );
+  }
+
+  unsigned int result = (unsigned int)_mm_cvtsi128_si32( total )
+    + (unsigned int)_mm_cvtsi128_si32( _mm_srli_si128( total, 8 ) );
+  return result + CharScanner::scalarSum( begin, end );
+}
+
+#endif
+
+#ifdef FIX_SCAN_AVX2
+
+__attribute__((target("avx2")))
+static void avx2Field( const char* begin, const char* end,
+                       const char*& equalSign, const char*& soh )
+{
+  const __m256i equals = _mm256_set1_epi8( '=' );
+  const __m256i sohs = _mm256_set1_epi8( '\001' );
+  const char* found = 0;
+
+  for( ; end - begin >= 32; begin += 32 )
+  {
+    __m256i chunk = _mm256_loadu_si256( (const __m256i*)begin );
+    unsigned int sohMask =
+      (unsigned int)_mm256_movemask_epi8( _mm256_cmpeq_epi8( chunk, sohs ) );
+
+    if( !found )
+    {
+      unsigned int equalMask =
+        (unsigned int)_mm256_movemask_epi8( _mm256_cmpeq_epi8( chunk, equals ) );
+      if( !equalMask ) continue;
+      unsigned int index = first_bit( equalMask );
+      found = begin + index;
+      sohMask = index == 31 ? 0 : sohMask & ~( ( 2u << index ) - 1 );
+    }
+
+    if( sohMask )
+    {
+      equalSign = found;
+      soh = begin + first_bit( sohMask );
+      return;
+    }
+  }
+
+  if( !found )
+  {
+    sse2Field( begin, end, equalSign, soh );
+    return;
+  }
+
+  equalSign = found;
+  soh = std::find( begin, end, '\001' );
+}
+
+__attribute__((target("avx2")))
+static unsigned int avx2Sum( const char* begin, const char* end )
+{
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i total = zero;
+
+  for( ; end - begin >= 32; begin += 32 )
+  {
+    __m256i chunk = _mm256_loadu_si256( (const __m256i*)begin );
+    total = _mm256_add_epi64( total, _mm256_sad_epu8( chunk, zero ) );
+  }
+
+  __m128i half = _mm_add_epi64( _mm256_castsi256_si128( total ),
+                                _mm256_extracti128_si256( total, 1 ) );
+  unsigned int result = (unsigned int)_mm_cvtsi128_si32( half )
+    + (unsigned int)_mm_cvtsi128_si32( _mm_srli_si128( half, 8 ) );
+  return result + sse2Sum( begin, end );
+}
+
+#endif
+
+CharScanner::Functions CharScanner::select()
+{
+#if defined(FIX_SCAN_AVX2)
+  __builtin_cpu_init();
+  if( __builtin_cpu_supports( "avx2" ) )
+  {
+    Functions avx2 = { &avx2Field, &avx2Sum, "avx2" };
+    return avx2;
+  }
+#endif
+#if defined(FIX_SCAN_SSE2)
+  Functions sse2 = { &sse2Field, &sse2Sum, "sse2" };
+  return sse2;
+#else
+  Functions scalar = { &scalarField, &scalarSum, "scalar" };
+  return scalar;
+#endif
+}
+
+// constant initialized, so that scans made by other static initializers
+// before the selection below still get a correct result
+CharScanner::Functions CharScanner::s_functions =
+  { &CharScanner::scalarField, &CharScanner::scalarSum, "scalar" };
+
+// selected before main, a local static is not initialized thread safely
+// by every supported compiler
+const bool CharScanner::s_selected = ( s_functions = CharScanner::select(), true );
+}
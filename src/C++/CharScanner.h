@@ -0,0 +1,76 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_CHARSCANNER_H
+#define FIX_CHARSCANNER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+namespace FIX
+{
+/**
+ * Searches %FIX buffers for delimiters and adds up checksums.
+ *
+ * The SSE2 or AVX2 implementation is chosen during static initialization,
+ * depending on what the processor supports.  Other platforms use a plain
+ * byte by byte implementation.
+ */
+class CharScanner
+{
+public:
+  /// Find the '=' of a field and the SOH following it.
+  /// A delimiter that is not found is set to end.
+  static void field( const char* begin, const char* end,
+                     const char*& equalSign, const char*& soh )
+  { functions().field( begin, end, equalSign, soh ); }
+
+  /// Add up all bytes in a buffer, the result modulo 256 is a %FIX checksum
+  static unsigned int sum( const char* begin, const char* end )
+  { return functions().sum( begin, end ); }
+
+  /// Name of the implementation in use
+  static const char* implementation()
+  { return functions().name; }
+
+  static void scalarField( const char* begin, const char* end,
+                           const char*& equalSign, const char*& soh );
+  static unsigned int scalarSum( const char* begin, const char* end );
+
+private:
+  struct Functions
+  {
+    void (*field)( const char*, const char*, const char*&, const char*& );
+    unsigned int (*sum)( const char*, const char* );
+    const char* name;
+  };
+
+  /// The implementation, selected during static initialization
+  static const Functions& functions() { return s_functions; }
+  static Functions select();
+
+  static Functions s_functions;
+  static const bool s_selected;
+};
+}
+
+#endif //FIX_CHARSCANNER_H
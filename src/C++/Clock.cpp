@@ -0,0 +1,110 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "Clock.h"
+#include "Utility.h"
+#include <string.h>
+
+namespace FIX
+{
+namespace
+{
+/// Length of YYYYMMDD-HH:MM:SS
+const size_t SECOND_LENGTH = 17;
+
+struct SecondCache
+{
+  SecondCache() : date( 0 ), second( -1 ) {}
+
+  int date;
+  int second;
+  char text[ SECOND_LENGTH ];
+};
+
+ThreadLocal<SecondCache> s_secondCache;
+
+inline void writeTwoDigits( char* p, int value )
+{
+  p[0] = char( '0' + value / 10 );
+  p[1] = char( '0' + value % 10 );
+}
+
+void formatSecond( const DateTime& time, char* p )
+{
+  int year, month, day, hour, minute, second, millis;
+  time.getYMD( year, month, day );
+  time.getHMS( hour, minute, second, millis );
+
+  writeTwoDigits( p, year / 100 );
+  writeTwoDigits( p + 2, year % 100 );
+  writeTwoDigits( p + 4, month );
+  writeTwoDigits( p + 6, day );
+  p[8] = '-';
+  writeTwoDigits( p + 9, hour );
+  p[11] = ':';
+  writeTwoDigits( p + 12, minute );
+  p[14] = ':';
+  writeTwoDigits( p + 15, second );
+}
+}
+
+DateTime Clock::now()
+{
+  long long milliseconds = time_nanoseconds() / 1000000;
+  long long days = milliseconds / DateTime::MILLIS_PER_DAY;
+  return DateTime( (int)days + DateTime::JULIAN_19700101,
+                   (int)( milliseconds - days * DateTime::MILLIS_PER_DAY ) );
+}
+
+size_t Clock::format( const DateTime& time, bool showMilliseconds,
+                      char* buffer )
+{
+  const int second = time.m_time / DateTime::MILLIS_PER_SEC;
+
+  SecondCache* pCache = s_secondCache.get();
+  if( !pCache )
+    formatSecond( time, buffer );
+  else
+  {
+    if( pCache->second != second || pCache->date != time.m_date )
+    {
+      formatSecond( time, pCache->text );
+      pCache->date = time.m_date;
+      pCache->second = second;
+    }
+    memcpy( buffer, pCache->text, SECOND_LENGTH );
+  }
+
+  if( !showMilliseconds )
+    return SECOND_LENGTH;
+
+  int millis = time.m_time - second * DateTime::MILLIS_PER_SEC;
+  char* p = buffer + SECOND_LENGTH;
+  p[0] = '.';
+  p[1] = char( '0' + millis / 100 );
+  writeTwoDigits( p + 2, millis % 100 );
+  return SECOND_LENGTH + 4;
+}
+}
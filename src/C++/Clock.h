@@ -0,0 +1,67 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_CLOCK_H
+#define FIX_CLOCK_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "FieldTypes.h"
+#include <string>
+#include <stddef.h>
+
+namespace FIX
+{
+/**
+ * Wall clock shared by sessions and logs.
+ *
+ * Reading the clock works out the day and the time of day from the
+ * system time with integer arithmetic instead of going through gmtime.
+ *
+ * Most of formatting a timestamp is turning its date and second into
+ * "YYYYMMDD-HH:MM:SS", which only changes once a second.  Every thread
+ * keeps the text of the last second it formatted, timestamps within the
+ * same second copy it and only write their milliseconds.
+ */
+class Clock
+{
+public:
+  /// Current UTC time
+  static DateTime now();
+
+  /// Longest timestamp written by format
+  enum { MAX_FORMAT = 21 };
+
+  /// Write YYYYMMDD-HH:MM:SS[.sss] to a buffer of at least MAX_FORMAT
+  /// characters, returns the number of characters written
+  static size_t format( const DateTime& time, bool showMilliseconds,
+                        char* buffer );
+  static std::string format( const DateTime& time, bool showMilliseconds )
+  {
+    char buffer[ MAX_FORMAT ];
+    return std::string( buffer, format( time, showMilliseconds, buffer ) );
+  }
+};
+}
+
+#endif //FIX_CLOCK_H
@@ -27,6 +27,7 @@
 #include "Message.h"
 #include <fstream>
 #include <memory>
+#include <algorithm>
 
 #include "PUGIXML_DOMDocument.h"
 
@@ -40,13 +41,15 @@ namespace FIX
 {
 DataDictionary::DataDictionary()
 : m_hasVersion( false ), m_checkFieldsOutOfOrder( true ),
-  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true )
+  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ),
+  m_compiled( false ), m_msgBitWords( 0 )
 {}
 
 DataDictionary::DataDictionary( std::istream& stream )
 throw( ConfigError )
 : m_hasVersion( false ), m_checkFieldsOutOfOrder( true ),
-  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true )
+  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ),
+  m_compiled( false ), m_msgBitWords( 0 )
 {
   readFromStream( stream );
 }
@@ -55,12 +58,13 @@ DataDictionary::DataDictionary( const std::string& url )
 throw( ConfigError )
 : m_hasVersion( false ), m_checkFieldsOutOfOrder( true ),
   m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ),
-  m_orderedFieldsArray(0)
+  m_orderedFieldsArray(0), m_compiled( false ), m_msgBitWords( 0 )
 {
   readFromURL( url );
 }
 
 DataDictionary::DataDictionary( const DataDictionary& copy )
+: m_compiled( false ), m_msgBitWords( 0 )
 {
   *this = copy;
 }
@@ -111,12 +115,18 @@ DataDictionary& DataDictionary::operator=( const DataDictionary& rhs )
       addGroup( iter->first, i->first, iter->second.first, *iter->second.second );
   }
   }
+
+  // the tables point at our own copies of the groups
+  m_compiled = false;
+  if( rhs.m_compiled )
+    compile();
   return *this;
 }
 
 void DataDictionary::validate( const Message& message,
                                const DataDictionary* const pSessionDD,
-                               const DataDictionary* const pAppDD )
+                               const DataDictionary* const pAppDD,
+                               const FieldValidation* pFieldValidation )
 throw( FIX::Exception )
 {  
   const Header& header = message.getHeader();
@@ -144,6 +154,9 @@ throw( FIX::Exception )
     pAppDD->checkHasRequired( message.getHeader(), message, message.getTrailer(), msgType );
   }
 
+  if( pFieldValidation && pFieldValidation->passed( pSessionDD, pAppDD ) )
+    return;
+
   if( pSessionDD != 0 )
   {
     pSessionDD->iterate( message.getHeader(), msgType );
@@ -159,6 +172,7 @@ throw( FIX::Exception )
 void DataDictionary::iterate( const FieldMap& map, const MsgType& msgType ) const
 {
   int lastField = 0;
+  int msgIndex = m_compiled ? m_msgTypeIndex.find( msgType.getString() ) : -1;
 
   FieldMap::iterator i;
   for ( i = map.begin(); i != map.end(); ++i )
@@ -166,25 +180,72 @@ void DataDictionary::iterate( const FieldMap& map, const MsgType& msgType ) cons
     const FieldBase& field = i->second;
     if( i != map.begin() && (field.getTag() == lastField) )
       throw RepeatedTag( lastField );
-    checkHasValue( field );
+    checkField( field, map, msgType, msgIndex );
+    lastField = field.getTag();
+  }
+}
 
-    if ( m_hasVersion )
-    {
-      checkValidFormat( field );
-      checkValue( field );
-    }
+void DataDictionary::checkField( const FieldBase& field, const FieldMap& map,
+                                 const std::string& msgType, int msgIndex ) const
+{
+  checkHasValue( field );
 
-    if ( m_beginString.getValue().length() && shouldCheckTag(field) )
+  if ( m_hasVersion )
+  {
+    checkValidFormat( field );
+    checkValue( field );
+  }
+
+  if ( m_beginString.getValue().length() && shouldCheckTag(field) )
+  {
+    checkValidTagNumber( field );
+    if ( !Message::isHeaderField( field, this )
+         && !Message::isTrailerField( field, this ) )
     {
-      checkValidTagNumber( field );
-      if ( !Message::isHeaderField( field, this )
-           && !Message::isTrailerField( field, this ) )
-      {
-        checkIsInMessage( field, msgType );
-        checkGroupCount( field, map, msgType );
-      }
+      checkIsInMessage( field, msgType, msgIndex );
+      checkGroupCount( field, map, msgType, msgIndex );
     }
-    lastField = field.getTag();
+  }
+}
+
+void DataDictionary::FieldValidation::reset
+( const DataDictionary* pSessionDD, const DataDictionary* pApplicationDD )
+{
+  m_pSessionDD = pSessionDD;
+  m_pApplicationDD = pApplicationDD;
+  m_msgIndex = -1;
+  m_failed = false;
+}
+
+void DataDictionary::FieldValidation::checkBody
+( const FieldBase& field, const FieldMap& body,
+  const std::string& msgType, bool repeated )
+{
+  if( m_msgIndex < 0 && m_pApplicationDD && m_pApplicationDD->m_compiled )
+    m_msgIndex = m_pApplicationDD->m_msgTypeIndex.find( msgType );
+  check( m_pApplicationDD, field, body, msgType, m_msgIndex, repeated );
+}
+
+void DataDictionary::FieldValidation::check
+( const DataDictionary* pDD, const FieldBase& field, const FieldMap& map,
+  const std::string& msgType, int msgIndex, bool repeated )
+{
+  if( m_failed || !pDD ) return;
+
+  // any failure leaves the exact error to be found by validate()
+  if( repeated )
+  {
+    m_failed = true;
+    return;
+  }
+
+  try
+  {
+    pDD->checkField( field, map, msgType, msgIndex );
+  }
+  catch( FIX::Exception& )
+  {
+    m_failed = true;
   }
 }
 
@@ -422,6 +483,8 @@ throw( ConfigError )
     }
     RESET_AUTO_PTR(pMessageNode, pMessageNode->getNextSiblingNode());
   }
+
+  compile();
 }
 
 message_order const& DataDictionary::getOrderedFields() const
@@ -441,6 +504,370 @@ message_order const& DataDictionary::getOrderedFields() const
   return m_orderedFieldsArray;
 }
 
+static void updateTagRange( const std::set < int > & fields, int& minTag, int& maxTag )
+{
+  if( fields.empty() ) return;
+  if( *fields.begin() < minTag ) minTag = *fields.begin();
+  if( *fields.rbegin() > maxTag ) maxTag = *fields.rbegin();
+}
+
+template < typename Map >
+static void updateKeyRange( const Map& map, int& minTag, int& maxTag )
+{
+  if( map.empty() ) return;
+  if( map.begin()->first < minTag ) minTag = map.begin()->first;
+  if( map.rbegin()->first > maxTag ) maxTag = map.rbegin()->first;
+}
+
+void DataDictionary::compile()
+{
+  m_compiled = false;
+  m_tagFlags.clear();
+  m_tagTypes.clear();
+  m_tagValueSets.clear();
+  m_valueSets.clear();
+  m_msgTypeIndex.clear();
+  m_msgTypeFlags.clear();
+  m_msgBitWords = 0;
+  m_msgFieldBits.clear();
+  m_requiredFieldBits.clear();
+  m_requiredFieldLists.clear();
+  m_requiredHeaderFields.clear();
+  m_requiredTrailerFields.clear();
+  m_msgGroups.clear();
+
+  std::set < std::string > msgTypes( m_messages );
+  MsgTypeToField::const_iterator iM;
+  int minTag = 0;
+  int maxTag = 0;
+  updateTagRange( m_fields, minTag, maxTag );
+  updateTagRange( m_dataFields, minTag, maxTag );
+  updateKeyRange( m_headerFields, minTag, maxTag );
+  updateKeyRange( m_trailerFields, minTag, maxTag );
+  updateKeyRange( m_fieldTypes, minTag, maxTag );
+  updateKeyRange( m_fieldValues, minTag, maxTag );
+  updateKeyRange( m_groups, minTag, maxTag );
+  for( iM = m_messageFields.begin(); iM != m_messageFields.end(); ++iM )
+  {
+    msgTypes.insert( iM->first );
+    updateTagRange( iM->second, minTag, maxTag );
+  }
+  for( iM = m_requiredFields.begin(); iM != m_requiredFields.end(); ++iM )
+  {
+    msgTypes.insert( iM->first );
+    updateTagRange( iM->second, minTag, maxTag );
+  }
+
+  FieldToGroup::const_iterator iG;
+  FieldPresenceMap::const_iterator iP;
+  for( iG = m_groups.begin(); iG != m_groups.end(); ++iG )
+  {
+    for( iP = iG->second.begin(); iP != iG->second.end(); ++iP )
+    {
+      msgTypes.insert( iP->first );
+      if( !iP->second.second->m_compiled )
+        iP->second.second->compile();
+    }
+  }
+
+  if( minTag < 0 || maxTag > MAX_COMPILED_TAG ) return;
+  std::vector < std::string > keys( msgTypes.begin(), msgTypes.end() );
+  if( !m_msgTypeIndex.build( keys ) ) return;
+
+  // tag tables
+  size_t tags = maxTag + 1;
+  m_tagFlags.assign( tags, 0 );
+
+  Fields::const_iterator iF;
+  for( iF = m_fields.begin(); iF != m_fields.end(); ++iF )
+    m_tagFlags[ *iF ] |= TAG_FIELD;
+  for( iF = m_dataFields.begin(); iF != m_dataFields.end(); ++iF )
+    m_tagFlags[ *iF ] |= TAG_DATA;
+
+  NonBodyFields::const_iterator iNBF;
+  for( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
+  {
+    m_tagFlags[ iNBF->first ] |= TAG_HEADER;
+    if( iNBF->second )
+      m_requiredHeaderFields.push_back( iNBF->first );
+  }
+  for( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
+  {
+    m_tagFlags[ iNBF->first ] |= TAG_TRAILER;
+    if( iNBF->second )
+      m_requiredTrailerFields.push_back( iNBF->first );
+  }
+
+  if( !m_fieldTypes.empty() )
+    m_tagTypes.assign( tags, (unsigned char)TYPE::Unknown );
+  FieldTypes::const_iterator iT;
+  for( iT = m_fieldTypes.begin(); iT != m_fieldTypes.end(); ++iT )
+  {
+    m_tagFlags[ iT->first ] |= TAG_TYPED;
+    m_tagTypes[ iT->first ] = (unsigned char)iT->second;
+    if( iT->second == TYPE::MultipleValueString
+        || iT->second == TYPE::MultipleCharValue
+        || iT->second == TYPE::MultipleStringValue )
+      m_tagFlags[ iT->first ] |= TAG_MULTIPLE_VALUE;
+  }
+
+  if( !m_fieldValues.empty() )
+  {
+    m_tagValueSets.assign( tags, -1 );
+    m_valueSets.resize( m_fieldValues.size() );
+  }
+  FieldToValue::const_iterator iV;
+  int valueSet = 0;
+  for( iV = m_fieldValues.begin(); iV != m_fieldValues.end(); ++iV, ++valueSet )
+  {
+    m_tagFlags[ iV->first ] |= TAG_VALUES;
+    m_tagValueSets[ iV->first ] = valueSet;
+    m_valueSets[ valueSet ].assign( iV->second );
+  }
+
+  // message type tables, numbered in the order of the keys
+  size_t count = keys.size();
+  m_msgBitWords = ( tags + 31 ) / 32;
+  m_msgTypeFlags.assign( count, 0 );
+  m_msgFieldBits.assign( count * m_msgBitWords, 0 );
+  m_requiredFieldBits.assign( count * m_msgBitWords, 0 );
+  m_requiredFieldLists.resize( count );
+  m_msgGroups.resize( count );
+
+  MsgTypes::const_iterator iMT;
+  for( iMT = m_messages.begin(); iMT != m_messages.end(); ++iMT )
+    m_msgTypeFlags[ m_msgTypeIndex.find( *iMT ) ] |= MSG_DEFINED;
+
+  for( iM = m_messageFields.begin(); iM != m_messageFields.end(); ++iM )
+  {
+    unsigned* bits = &m_msgFieldBits[ m_msgTypeIndex.find( iM->first ) * m_msgBitWords ];
+    for( iF = iM->second.begin(); iF != iM->second.end(); ++iF )
+      bits[ *iF >> 5 ] |= 1u << ( *iF & 31 );
+  }
+
+  for( iM = m_requiredFields.begin(); iM != m_requiredFields.end(); ++iM )
+  {
+    int index = m_msgTypeIndex.find( iM->first );
+    unsigned* bits = &m_requiredFieldBits[ index * m_msgBitWords ];
+    m_msgTypeFlags[ index ] |= MSG_REQUIRED;
+    m_requiredFieldLists[ index ].assign( iM->second.begin(), iM->second.end() );
+    for( iF = iM->second.begin(); iF != iM->second.end(); ++iF )
+      bits[ *iF >> 5 ] |= 1u << ( *iF & 31 );
+  }
+
+  // groups are visited by field so every list comes out sorted
+  for( iG = m_groups.begin(); iG != m_groups.end(); ++iG )
+  {
+    m_tagFlags[ iG->first ] |= TAG_GROUP;
+    for( iP = iG->second.begin(); iP != iG->second.end(); ++iP )
+    {
+      GroupEntry entry;
+      entry.field = iG->first;
+      entry.delim = iP->second.first;
+      entry.pDataDictionary = iP->second.second;
+      m_msgGroups[ m_msgTypeIndex.find( iP->first ) ].push_back( entry );
+    }
+  }
+
+  m_compiled = true;
+}
+
+bool DataDictionary::isCompiledFieldValue( int field, const std::string& value ) const
+{
+  unsigned char flags = getTagFlags( field );
+  if( !(flags & TAG_VALUES) ) return false;
+
+  const ValueSet& values = m_valueSets[ m_tagValueSets[ field ] ];
+  if( !(flags & TAG_MULTIPLE_VALUE) )
+    return values.contains( value.data(), value.size() );
+
+  // MultipleValue
+  const char* start = value.data();
+  const char* end = start + value.size();
+  while( true )
+  {
+    const char* space = (const char*)memchr( start, ' ', end - start );
+    const char* stop = space ? space : end;
+    if( !values.contains( start, stop - start ) )
+      return false;
+    if( !space )
+      return true;
+    start = space + 1;
+  }
+}
+
+bool DataDictionary::findGroup( int msgIndex, int field, int& delim,
+                                const DataDictionary*& pDataDictionary ) const
+{
+  if( msgIndex < 0 || !(getTagFlags( field ) & TAG_GROUP) ) return false;
+
+  const GroupEntries& groups = m_msgGroups[ msgIndex ];
+  GroupEntries::const_iterator i
+    = std::lower_bound( groups.begin(), groups.end(), field );
+  if( i == groups.end() || i->field != field ) return false;
+
+  delim = i->delim;
+  pDataDictionary = i->pDataDictionary;
+  return true;
+}
+
+void DataDictionary::checkHasRequired
+( const FieldMap& header, const FieldMap& body, const FieldMap& trailer,
+  const MsgType& msgType ) const
+throw( RequiredTagMissing )
+{
+  if( m_compiled )
+  {
+    OrderedFields::const_iterator iR;
+    for( iR = m_requiredHeaderFields.begin(); iR != m_requiredHeaderFields.end(); ++iR )
+    {
+      if( !header.isSetField(*iR) )
+        throw RequiredTagMissing( *iR );
+    }
+
+    for( iR = m_requiredTrailerFields.begin(); iR != m_requiredTrailerFields.end(); ++iR )
+    {
+      if( !trailer.isSetField(*iR) )
+        throw RequiredTagMissing( *iR );
+    }
+
+    int index = m_msgTypeIndex.find( msgType.getString() );
+    if( !(getMsgTypeFlags( index ) & MSG_REQUIRED) ) return ;
+
+    const OrderedFields& fields = m_requiredFieldLists[ index ];
+    for( iR = fields.begin(); iR != fields.end(); ++iR )
+    {
+      if( !body.isSetField(*iR) )
+        throw RequiredTagMissing( *iR );
+    }
+
+    FieldMap::g_iterator groups;
+    for( groups = body.g_begin(); groups != body.g_end(); ++groups )
+    {
+      int delim;
+      const DataDictionary* DD = 0;
+      if( findGroup( index, groups->first, delim, DD ) )
+      {
+        std::vector<FieldMap*>::const_iterator group;
+        for( group = groups->second.begin(); group != groups->second.end(); ++group )
+          DD->checkHasRequired( **group, **group, **group, msgType );
+      }
+    }
+    return;
+  }
+
+  NonBodyFields::const_iterator iNBF;
+  for( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
+  {
+    if( iNBF->second == true && !header.isSetField(iNBF->first) )
+      throw RequiredTagMissing( iNBF->first );
+  }
+
+  for( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
+  {
+    if( iNBF->second == true && !trailer.isSetField(iNBF->first) )
+      throw RequiredTagMissing( iNBF->first );
+  }
+
+  MsgTypeToField::const_iterator iM
+    = m_requiredFields.find( msgType.getString() );
+  if ( iM == m_requiredFields.end() ) return ;
+
+  const MsgFields& fields = iM->second;
+  MsgFields::const_iterator iF;
+  for( iF = fields.begin(); iF != fields.end(); ++iF )
+  {
+    if( !body.isSetField(*iF) )
+      throw RequiredTagMissing( *iF );
+  }
+
+  FieldMap::g_iterator groups;
+  for( groups = body.g_begin(); groups != body.g_end(); ++groups )
+  {
+    int delim;
+    const DataDictionary* DD = 0;
+    int field = groups->first;
+    if( getGroup( msgType.getValue(), field, delim, DD ) )
+    {
+      std::vector<FieldMap*>::const_iterator group;
+      for( group = groups->second.begin(); group != groups->second.end(); ++group )
+        DD->checkHasRequired( **group, **group, **group, msgType );
+    }
+  }
+}
+
+void DataDictionary::ValueSet::assign( const Values& values )
+{
+  memset( m_chars, 0, sizeof(m_chars) );
+  m_singleChars = true;
+  m_values.clear();
+
+  Values::const_iterator i;
+  for( i = values.begin(); i != values.end(); ++i )
+  {
+    if( i->size() != 1 )
+      m_singleChars = false;
+  }
+
+  if( !m_singleChars )
+  {
+    // std::set keeps them in the order contains() searches in
+    m_values.assign( values.begin(), values.end() );
+    return;
+  }
+
+  for( i = values.begin(); i != values.end(); ++i )
+  {
+    unsigned char c = (unsigned char)(*i)[ 0 ];
+    m_chars[ c >> 5 ] |= 1u << ( c & 31 );
+  }
+}
+
+bool DataDictionary::MsgTypeIndex::build( const std::vector < std::string > & msgTypes )
+{
+  clear();
+  if( msgTypes.empty() ) return true;
+  if( msgTypes.size() > 0x7fff ) return false;
+
+  // growing the table until some seed leaves every type in a slot of its own
+  const size_t MAX_SLOTS = 1 << 20;
+  const unsigned SEEDS = 16;
+  m_keys = msgTypes;
+
+  size_t size = 1;
+  while( size < msgTypes.size() * 2 ) size <<= 1;
+  for( ; size <= MAX_SLOTS; size <<= 1 )
+  {
+    m_mask = (unsigned)size - 1;
+    for( unsigned attempt = 0; attempt < SEEDS; ++attempt )
+    {
+      m_seed = attempt * 0x9e3779b9u;
+      m_slots.assign( size, -1 );
+
+      size_t i = 0;
+      for( ; i < m_keys.size(); ++i )
+      {
+        short& slot = m_slots[ hash( m_keys[i].data(), m_keys[i].size() ) & m_mask ];
+        if( slot >= 0 ) break;
+        slot = (short)i;
+      }
+      if( i == m_keys.size() )
+        return true;
+    }
+  }
+
+  clear();
+  return false;
+}
+
+void DataDictionary::MsgTypeIndex::clear()
+{
+  m_keys.clear();
+  m_slots.clear();
+  m_seed = 0;
+  m_mask = 0;
+}
+
 int DataDictionary::lookupXMLFieldNumber( DOMDocument* pDoc, DOMNode* pNode ) const
 {
   DOMAttributesPtr attrs = pNode->getAttributes();
@@ -32,6 +32,7 @@
 #include "Exceptions.h"
 #include <set>
 #include <map>
+#include <vector>
 #include <string.h>
 
 namespace FIX
@@ -69,7 +70,155 @@ class DataDictionary
   typedef std::map < std::string, std::pair < int, DataDictionary* > > FieldPresenceMap;
   typedef std::map < int, FieldPresenceMap > FieldToGroup;
 
+  /// Interns message types into small integers using a perfect hash
+  class MsgTypeIndex
+  {
+  public:
+    MsgTypeIndex() : m_seed( 0 ), m_mask( 0 ) {}
+
+    /// Number every message type by its position, false if no hash was found
+    bool build( const std::vector < std::string > & msgTypes );
+    void clear();
+
+    /// Number of the message type, -1 if it is not indexed
+    int find( const std::string& msgType ) const
+    {
+      if( m_slots.empty() ) return -1;
+      int index = m_slots[ hash( msgType.data(), msgType.size() ) & m_mask ];
+      if( index < 0 || m_keys[ index ] != msgType ) return -1;
+      return index;
+    }
+
+    size_t size() const { return m_keys.size(); }
+
+  private:
+    unsigned hash( const char* value, size_t length ) const
+    {
+      unsigned h = 2166136261u ^ m_seed;
+      for( size_t i = 0; i < length; ++i )
+        h = ( h ^ (unsigned char)value[ i ] ) * 16777619u;
+      return h ^ ( h >> 16 );
+    }
+
+    std::vector < std::string > m_keys;
+    std::vector < short > m_slots;
+    unsigned m_seed;
+    unsigned m_mask;
+  };
+
+  /// Enumerated values of a field
+  class ValueSet
+  {
+  public:
+    ValueSet() : m_singleChars( true )
+    { memset( m_chars, 0, sizeof(m_chars) ); }
+
+    void assign( const Values& values );
+
+    bool contains( const char* value, size_t length ) const
+    {
+      if( m_singleChars )
+      {
+        if( length != 1 ) return false;
+        unsigned char c = (unsigned char)*value;
+        return (( m_chars[ c >> 5 ] >> ( c & 31 ) ) & 1) != 0;
+      }
+
+      size_t low = 0, high = m_values.size();
+      while( low < high )
+      {
+        size_t middle = ( low + high ) / 2;
+        int result = m_values[ middle ].compare( 0, std::string::npos, value, length );
+        if( result == 0 ) return true;
+        if( result < 0 ) low = middle + 1;
+        else high = middle;
+      }
+      return false;
+    }
+
+  private:
+    unsigned m_chars[ 8 ];
+    bool m_singleChars;
+    std::vector < std::string > m_values;
+  };
+
+  struct GroupEntry
+  {
+    int field;
+    int delim;
+    const DataDictionary* pDataDictionary;
+    bool operator<( int rhs ) const { return field < rhs; }
+  };
+
+  typedef std::vector < unsigned > MsgBits;
+  typedef std::vector < GroupEntry > GroupEntries;
+
+  enum
+  {
+    TAG_FIELD = 0x01,
+    TAG_HEADER = 0x02,
+    TAG_TRAILER = 0x04,
+    TAG_DATA = 0x08,
+    TAG_GROUP = 0x10,
+    TAG_VALUES = 0x20,
+    TAG_MULTIPLE_VALUE = 0x40,
+    TAG_TYPED = 0x80
+  };
+
+  enum
+  {
+    MSG_DEFINED = 0x01,
+    MSG_REQUIRED = 0x02
+  };
+
 public:
+  /// Dictionaries with larger tags are only looked up through the maps
+  static const int MAX_COMPILED_TAG = 65535;
+
+  /**
+   * Applies the checks validate() makes on each field while a message
+   * is being parsed.
+   *
+   * A message whose fields all passed is not walked again when it is
+   * validated with the same dictionaries. If a field fails, validate()
+   * checks the whole message as usual so it reports the same error.
+   */
+  class FieldValidation
+  {
+  public:
+    FieldValidation()
+    : m_pSessionDD( 0 ), m_pApplicationDD( 0 ), m_msgIndex( -1 ),
+      m_failed( true ) {}
+
+    void reset( const DataDictionary* pSessionDD,
+                const DataDictionary* pApplicationDD );
+
+    void checkHeader( const FieldBase& field, const FieldMap& header, bool repeated )
+    { check( m_pSessionDD, field, header, "", -1, repeated ); }
+    void checkTrailer( const FieldBase& field, const FieldMap& trailer, bool repeated )
+    { check( m_pSessionDD, field, trailer, "", -1, repeated ); }
+    void checkBody( const FieldBase& field, const FieldMap& body,
+                    const std::string& msgType, bool repeated );
+
+    /// True if every field passed the checks of these dictionaries
+    bool passed( const DataDictionary* pSessionDD,
+                 const DataDictionary* pApplicationDD ) const
+    {
+      return !m_failed && pSessionDD == m_pSessionDD
+             && pApplicationDD == m_pApplicationDD;
+    }
+
+  private:
+    void check( const DataDictionary* pDD, const FieldBase& field,
+                const FieldMap& map, const std::string& msgType,
+                int msgIndex, bool repeated );
+
+    const DataDictionary* m_pSessionDD;
+    const DataDictionary* m_pApplicationDD;
+    int m_msgIndex;
+    bool m_failed;
+  };
+
   DataDictionary();
   DataDictionary( const DataDictionary& copy );
   DataDictionary( std::istream& stream ) throw( ConfigError );
@@ -82,6 +231,15 @@ public:
 
   message_order const& getOrderedFields() const;
 
+  /**
+   * Build the tables validation looks fields and message types up in.
+   *
+   * Done once a dictionary has been read from a document. Changing the
+   * dictionary afterwards drops the tables until it is compiled again.
+   */
+  void compile();
+  bool isCompiled() const { return m_compiled; }
+
   // storage functions
   void setVersion( const std::string& beginString )
   {
@@ -95,6 +253,7 @@ public:
 
   void addField( int field )
   {
+    m_compiled = false;
     m_fields.insert( field );
     m_orderedFields.push_back( field );
   }
@@ -137,26 +296,34 @@ public:
 
   bool isField( int field ) const
   {
+    if( m_compiled )
+      return (getTagFlags( field ) & TAG_FIELD) != 0;
     return m_fields.find( field ) != m_fields.end();
   }
 
   void addMsgType( const std::string& msgType )
   {
+    m_compiled = false;
     m_messages.insert( msgType );
   }
 
   bool isMsgType( const std::string& msgType ) const
   {
+    if( m_compiled )
+      return (getMsgTypeFlags( m_msgTypeIndex.find( msgType ) ) & MSG_DEFINED) != 0;
     return m_messages.find( msgType ) != m_messages.end();
   }
 
   void addMsgField( const std::string& msgType, int field )
   {
+    m_compiled = false;
     m_messageFields[ msgType ].insert( field );
   }
 
   bool isMsgField( const std::string& msgType, int field ) const
   {
+    if( m_compiled )
+      return testMsgBit( m_msgFieldBits, m_msgTypeIndex.find( msgType ), field );
     MsgTypeToField::const_iterator i = m_messageFields.find( msgType );
     if ( i == m_messageFields.end() ) return false;
     return i->second.find( field ) != i->second.end();
@@ -164,26 +331,33 @@ public:
 
   void addHeaderField( int field, bool required )
   {
+    m_compiled = false;
     m_headerFields[ field ] = required;
   }
 
   bool isHeaderField( int field ) const
   {
+    if( m_compiled )
+      return (getTagFlags( field ) & TAG_HEADER) != 0;
     return m_headerFields.find( field ) != m_headerFields.end();
   }
 
   void addTrailerField( int field, bool required )
   {
+    m_compiled = false;
     m_trailerFields[ field ] = required;
   }
 
   bool isTrailerField( int field ) const
   {
+    if( m_compiled )
+      return (getTagFlags( field ) & TAG_TRAILER) != 0;
     return m_trailerFields.find( field ) != m_trailerFields.end();
   }
 
   void addFieldType( int field, FIX::TYPE::Type type )
   {
+    m_compiled = false;
     m_fieldTypes[ field ] = type;
 
     if( type == FIX::TYPE::Data )
@@ -192,6 +366,12 @@ public:
 
   bool getFieldType( int field, FIX::TYPE::Type& type ) const
   {
+    if( m_compiled )
+    {
+      if( !(getTagFlags( field ) & TAG_TYPED) ) return false;
+      type = (TYPE::Type)m_tagTypes[ field ];
+      return true;
+    }
     FieldTypes::const_iterator i = m_fieldTypes.find( field );
     if ( i == m_fieldTypes.end() ) return false;
     type = i->second;
@@ -200,11 +380,14 @@ public:
 
   void addRequiredField( const std::string& msgType, int field )
   {
+    m_compiled = false;
     m_requiredFields[ msgType ].insert( field );
   }
 
   bool isRequiredField( const std::string& msgType, int field ) const
   {
+    if( m_compiled )
+      return testMsgBit( m_requiredFieldBits, m_msgTypeIndex.find( msgType ), field );
     MsgTypeToField::const_iterator i = m_requiredFields.find( msgType );
     if ( i == m_requiredFields.end() ) return false;
     return i->second.find( field ) != i->second.end();
@@ -212,17 +395,23 @@ public:
 
   void addFieldValue( int field, const std::string& value )
   {
+    m_compiled = false;
     m_fieldValues[ field ].insert( value );
   }
 
   bool hasFieldValue( int field ) const
   {
+    if( m_compiled )
+      return (getTagFlags( field ) & TAG_VALUES) != 0;
     FieldToValue::const_iterator i = m_fieldValues.find( field );
     return i != m_fieldValues.end();
   }
 
   bool isFieldValue( int field, const std::string& value ) const
   {
+    if( m_compiled )
+      return isCompiledFieldValue( field, value );
+
     FieldToValue::const_iterator i = m_fieldValues.find( field );
     if ( i == m_fieldValues.end() )
       return false;
@@ -247,6 +436,7 @@ public:
   void addGroup( const std::string& msg, int field, int delim,
                  const DataDictionary& dataDictionary )
   {
+    m_compiled = false;
     DataDictionary * pDD = new DataDictionary( dataDictionary );
     pDD->setVersion( getVersion() );
 
@@ -256,6 +446,13 @@ public:
 
   bool isGroup( const std::string& msg, int field ) const
   {
+    if( m_compiled )
+    {
+      int delim;
+      const DataDictionary* pDD;
+      return findGroup( m_msgTypeIndex.find( msg ), field, delim, pDD );
+    }
+
     FieldToGroup::const_iterator i = m_groups.find( field );
     if ( i == m_groups.end() ) return false;
 
@@ -268,6 +465,9 @@ public:
   bool getGroup( const std::string& msg, int field, int& delim,
                  const DataDictionary*& pDataDictionary ) const
   {
+    if( m_compiled )
+      return findGroup( m_msgTypeIndex.find( msg ), field, delim, pDataDictionary );
+
     FieldToGroup::const_iterator i = m_groups.find( field );
     if ( i == m_groups.end() ) return false;
 
@@ -284,12 +484,16 @@ public:
 
   bool isDataField( int field ) const
   {
+    if( m_compiled )
+      return (getTagFlags( field ) & TAG_DATA) != 0;
     MsgFields::const_iterator iter = m_dataFields.find( field );
     return iter != m_dataFields.end();
   }
 
   bool isMultipleValueField( int field ) const
   {
+    if( m_compiled )
+      return (getTagFlags( field ) & TAG_MULTIPLE_VALUE) != 0;
     FieldTypes::const_iterator i = m_fieldTypes.find( field );
     return i != m_fieldTypes.end() 
       && (i->second == TYPE::MultipleValueString 
@@ -304,10 +508,11 @@ public:
   void checkUserDefinedFields( bool value )
   { m_checkUserDefinedFields = value; }
 
-  /// Validate a message.
+  /// Validate a message, skipping the field checks it passed while being parsed.
   static void validate( const Message& message,
                         const DataDictionary* const pSessionDD,
-                        const DataDictionary* const pAppID ) throw( FIX::Exception );
+                        const DataDictionary* const pAppID,
+                        const FieldValidation* pFieldValidation = 0 ) throw( FIX::Exception );
 
   void validate( const Message& message ) const throw ( FIX::Exception )
   { validate( message, false ); }
@@ -319,6 +524,31 @@ public:
 private:
   /// Iterate through fields while applying checks.
   void iterate( const FieldMap& map, const MsgType& msgType ) const;
+  /// Checks iterate applies to a single field of a map.
+  void checkField( const FieldBase& field, const FieldMap& map,
+                   const std::string& msgType, int msgIndex ) const;
+
+  unsigned char getTagFlags( int field ) const
+  {
+    if( (unsigned)field >= m_tagFlags.size() ) return 0;
+    return m_tagFlags[ field ];
+  }
+
+  unsigned char getMsgTypeFlags( int msgIndex ) const
+  {
+    if( msgIndex < 0 ) return 0;
+    return m_msgTypeFlags[ msgIndex ];
+  }
+
+  bool testMsgBit( const MsgBits& bits, int msgIndex, int field ) const
+  {
+    if( msgIndex < 0 || (unsigned)field >= m_tagFlags.size() ) return false;
+    return (( bits[ msgIndex * m_msgBitWords + (field >> 5) ] >> ( field & 31 ) ) & 1) != 0;
+  }
+
+  bool isCompiledFieldValue( int field, const std::string& value ) const;
+  bool findGroup( int msgIndex, int field, int& delim,
+                  const DataDictionary*& pDataDictionary ) const;
 
   /// Check if message type is defined in spec.
   void checkMsgType( const MsgType& msgType ) const
@@ -340,7 +570,7 @@ private:
   void checkValidTagNumber( const FieldBase& field ) const
   throw( InvalidTagNumber )
   {
-    if( m_fields.find( field.getTag() ) == m_fields.end() )
+    if( !isField( field.getTag() ) )
       throw InvalidTagNumber( field.getTag() );
   }
 
@@ -358,13 +588,21 @@ private:
       case TYPE::Char:
         CHAR_CONVERTOR::convert( field.getString() ); break;
       case TYPE::Price:
-        PRICE_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::DOUBLE_CACHE ) )
+          field.cacheDouble( PRICE_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Int:
-        INT_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::INT_CACHE ) )
+          field.cacheInt( INT_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Amt:
-        AMT_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::DOUBLE_CACHE ) )
+          field.cacheDouble( AMT_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Qty:
-        QTY_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::DOUBLE_CACHE ) )
+          field.cacheDouble( QTY_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Currency:
         CURRENCY_CONVERTOR::convert( field.getString() ); break;
       case TYPE::MultipleValueString:
@@ -376,7 +614,9 @@ private:
       case TYPE::Exchange:
         EXCHANGE_CONVERTOR::convert( field.getString() ); break;
       case TYPE::UtcTimeStamp:
-        UTCTIMESTAMP_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::TIME_CACHE ) )
+          field.cacheTime( UTCTIMESTAMP_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Boolean:
         BOOLEAN_CONVERTOR::convert( field.getString() ); break;
       case TYPE::LocalMktDate:
@@ -384,9 +624,13 @@ private:
       case TYPE::Data:
         DATA_CONVERTOR::convert( field.getString() ); break;
       case TYPE::Float:
-        FLOAT_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::DOUBLE_CACHE ) )
+          field.cacheDouble( FLOAT_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::PriceOffset:
-        PRICEOFFSET_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::DOUBLE_CACHE ) )
+          field.cacheDouble( PRICEOFFSET_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::MonthYear:
         MONTHYEAR_CONVERTOR::convert( field.getString() ); break;
       case TYPE::DayOfMonth:
@@ -396,13 +640,21 @@ private:
       case TYPE::UtcTimeOnly:
         UTCTIMEONLY_CONVERTOR::convert( field.getString() ); break;
       case TYPE::NumInGroup:
-        NUMINGROUP_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::INT_CACHE ) )
+          field.cacheInt( NUMINGROUP_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Percentage:
-        PERCENTAGE_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::DOUBLE_CACHE ) )
+          field.cacheDouble( PERCENTAGE_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::SeqNum:
-        SEQNUM_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::INT_CACHE ) )
+          field.cacheInt( SEQNUM_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Length:
-        LENGTH_CONVERTOR::convert( field.getString() ); break;
+        if( !field.isCached( FieldBase::INT_CACHE ) )
+          field.cacheInt( LENGTH_CONVERTOR::convert( field.getString() ) );
+        break;
       case TYPE::Country:
         COUNTRY_CONVERTOR::convert( field.getString() ); break;
       case TYPE::TzTimeOnly:
@@ -440,20 +692,27 @@ private:
 
   /// Check if a field is in this message type.
   void checkIsInMessage
-  ( const FieldBase& field, const MsgType& msgType ) const
+  ( const FieldBase& field, const std::string& msgType, int msgIndex = -1 ) const
   throw( TagNotDefinedForMessage )
   {
-    if ( !isMsgField( msgType, field.getTag() ) )
+    bool found = m_compiled ? testMsgBit( m_msgFieldBits, msgIndex, field.getTag() )
+                            : isMsgField( msgType, field.getTag() );
+    if ( !found )
       throw TagNotDefinedForMessage( field.getTag() );
   }
 
   /// Check if group count matches number of groups in
   void checkGroupCount
-  ( const FieldBase& field, const FieldMap& fieldMap, const MsgType& msgType ) const
+  ( const FieldBase& field, const FieldMap& fieldMap, const std::string& msgType,
+    int msgIndex = -1 ) const
   throw( RepeatingGroupCountMismatch )
   {
     int fieldNum = field.getTag();
-    if( isGroup(msgType, fieldNum) )
+    int delim;
+    const DataDictionary* pDD;
+    bool found = m_compiled ? findGroup( msgIndex, fieldNum, delim, pDD )
+                            : isGroup( msgType, fieldNum );
+    if( found )
     {
       if( (int)fieldMap.groupCount(fieldNum)
         != IntConvertor::convert(field.getString()) )
@@ -465,47 +724,7 @@ private:
   void checkHasRequired
   ( const FieldMap& header, const FieldMap& body, const FieldMap& trailer,
     const MsgType& msgType ) const
-  throw( RequiredTagMissing )
-  {
-    NonBodyFields::const_iterator iNBF;
-    for( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
-    {
-      if( iNBF->second == true && !header.isSetField(iNBF->first) )
-        throw RequiredTagMissing( iNBF->first );
-    }
-
-    for( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
-    {
-      if( iNBF->second == true && !trailer.isSetField(iNBF->first) )
-        throw RequiredTagMissing( iNBF->first );
-    }
-
-    MsgTypeToField::const_iterator iM
-      = m_requiredFields.find( msgType.getString() );
-    if ( iM == m_requiredFields.end() ) return ;
-
-    const MsgFields& fields = iM->second;
-    MsgFields::const_iterator iF;
-    for( iF = fields.begin(); iF != fields.end(); ++iF )
-    {
-      if( !body.isSetField(*iF) )
-        throw RequiredTagMissing( *iF );
-    }
-
-    FieldMap::g_iterator groups;
-    for( groups = body.g_begin(); groups != body.g_end(); ++groups )
-    {
-      int delim;
-      const DataDictionary* DD = 0;
-      int field = groups->first;
-      if( getGroup( msgType.getValue(), field, delim, DD ) )
-      {
-        std::vector<FieldMap*>::const_iterator group;
-        for( group = groups->second.begin(); group != groups->second.end(); ++group )
-          DD->checkHasRequired( **group, **group, **group, msgType );
-      }
-    }
-  }
+  throw( RequiredTagMissing );
 
   int lookupXMLFieldNumber( DOMDocument*, DOMNode* ) const;
   int lookupXMLFieldNumber( DOMDocument*, const std::string& name ) const;
@@ -533,6 +752,21 @@ private:
   ValueToName m_valueNames;
   FieldToGroup m_groups;
   MsgFields m_dataFields;
+
+  bool m_compiled;
+  std::vector < unsigned char > m_tagFlags;
+  std::vector < unsigned char > m_tagTypes;
+  std::vector < int > m_tagValueSets;
+  std::vector < ValueSet > m_valueSets;
+  MsgTypeIndex m_msgTypeIndex;
+  std::vector < unsigned char > m_msgTypeFlags;
+  size_t m_msgBitWords;
+  MsgBits m_msgFieldBits;
+  MsgBits m_requiredFieldBits;
+  std::vector < OrderedFields > m_requiredFieldLists;
+  OrderedFields m_requiredHeaderFields;
+  OrderedFields m_requiredTrailerFields;
+  std::vector < GroupEntries > m_msgGroups;
 };
 }
 
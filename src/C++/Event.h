@@ -37,9 +37,11 @@ class Event
 {
 public:
   Event()
+  : m_signaled( false ), m_generation( 0 )
   {
 #ifdef _MSC_VER
-    m_event = CreateEvent( 0, false, false, 0 );
+    InitializeCriticalSection( &m_mutex );
+    InitializeConditionVariable( &m_event );
 #else
     pthread_mutex_init( &m_mutex, 0 );
     pthread_cond_init( &m_event, 0 );
@@ -49,46 +51,87 @@ public:
   ~Event()
   {
 #ifdef _MSC_VER
-    CloseHandle( m_event );
+    DeleteCriticalSection( &m_mutex );
 #else
     pthread_cond_destroy( &m_event );
     pthread_mutex_destroy( &m_mutex );
 #endif
   }
 
+  /// Wake one waiting thread, or the next one to wait if none is
   void signal()
   {
+    lock();
+    m_signaled = true;
 #ifdef _MSC_VER
-    SetEvent( m_event );
+    WakeConditionVariable( &m_event );
+#else
+    pthread_cond_signal( &m_event );
+#endif
+    unlock();
+  }
+
+  /// Wake every waiting thread, or the next one to wait if none is
+  void broadcast()
+  {
+    lock();
+    m_signaled = true;
+    ++m_generation;
+#ifdef _MSC_VER
+    WakeAllConditionVariable( &m_event );
 #else
-    pthread_mutex_lock( &m_mutex );
     pthread_cond_broadcast( &m_event );
-    pthread_mutex_unlock( &m_mutex );
 #endif
+    unlock();
   }
 
   void wait( double s )
   {
+    // a signal is kept until it is waited for, a broadcast also releases
+    // the threads that were already waiting when it was made
+    lock();
+    unsigned long generation = m_generation;
 #ifdef _MSC_VER
-    WaitForSingleObject( m_event, (long)(s * 1000) );
+    DWORD deadline = GetTickCount() + (DWORD)(s * 1000);
+    while( !m_signaled && generation == m_generation )
+    {
+      long remaining = (long)( deadline - GetTickCount() );
+      if( remaining <= 0
+          || !SleepConditionVariableCS( &m_event, &m_mutex, remaining ) )
+        break;
+    }
 #else
-    pthread_mutex_lock( &m_mutex );
-    timespec time, remainder;
+    timeval now;
+    gettimeofday( &now, 0 );
     double intpart;
-    time.tv_nsec = (long)(modf(s, &intpart) * 1e9);
-    time.tv_sec = (int)intpart;
-    pthread_cond_timedwait( &m_event, &m_mutex, &time );
-    pthread_mutex_unlock( &m_mutex );
+    long nsec = now.tv_usec * 1000 + (long)(modf(s, &intpart) * 1e9);
+    timespec time;
+    time.tv_sec = now.tv_sec + (time_t)intpart + nsec / 1000000000;
+    time.tv_nsec = nsec % 1000000000;
+
+    while( !m_signaled && generation == m_generation
+           && pthread_cond_timedwait( &m_event, &m_mutex, &time ) == 0 ) {}
 #endif
+    m_signaled = false;
+    unlock();
   }
 
 private:
 #ifdef _MSC_VER
-  HANDLE m_event;
+  void lock() { EnterCriticalSection( &m_mutex ); }
+  void unlock() { LeaveCriticalSection( &m_mutex ); }
+
+  CONDITION_VARIABLE m_event;
+  CRITICAL_SECTION m_mutex;
 #else
+  void lock() { pthread_mutex_lock( &m_mutex ); }
+  void unlock() { pthread_mutex_unlock( &m_mutex ); }
+
   pthread_cond_t m_event;
   pthread_mutex_t m_mutex;
 #endif
+  bool m_signaled;
+  unsigned long m_generation;
 };
 }
 
@@ -35,6 +35,8 @@
 
 namespace FIX
 {
+class FieldMap;
+
 /**
  * Base representation of all Field classes.
  *
@@ -71,30 +73,62 @@ class FieldBase
   };
 
   friend class Message;
-
-  /// Constructor which also calculates field metrics
-  FieldBase( int tag, 
-             std::string::const_iterator valueStart, 
-             std::string::const_iterator valueEnd,
-             std::string::const_iterator tagStart, 
-             std::string::const_iterator tagEnd )
+  friend class FieldMap;
+  friend class DataDictionary;
+
+  /// Constructor which refers to a field inside of a received buffer.
+  /// The value is only copied out of the buffer once it is requested.
+  FieldBase( int tag,
+             const char* fieldStart,
+             const char* valueStart,
+             const char* fieldEnd )
     : m_tag( tag )
-    , m_string( valueStart, valueEnd )
-    , m_metrics( calculateMetrics( tagStart, tagEnd ) )
+    , m_metrics( no_metrics() )
+    , m_pField( fieldStart )
+    , m_pValue( valueStart )
+    , m_pEnd( fieldEnd )
+    , m_cacheType( NO_CACHE )
   {}
 
 public:
   FieldBase( int tag, const std::string& string )
-    : m_tag( tag ), m_string(string), m_metrics( no_metrics() )
+    : m_tag( tag ), m_string(string), m_metrics( no_metrics() ),
+      m_pField( 0 ), m_pValue( 0 ), m_pEnd( 0 ), m_cacheType( NO_CACHE )
   {}
 
+  /// Copies always own their value, they never refer to a received buffer
+  FieldBase( const FieldBase& copy )
+    : m_tag( copy.m_tag )
+    , m_data( copy.m_data )
+    , m_metrics( copy.m_metrics )
+    , m_pField( 0 ), m_pValue( 0 ), m_pEnd( 0 )
+    , m_cache( copy.m_cache ), m_cacheType( copy.m_cacheType )
+  {
+    copy.copyValueTo( m_string );
+  }
+
   virtual ~FieldBase() {}
 
+  FieldBase& operator=( const FieldBase& rhs )
+  {
+    if( this == &rhs ) return *this;
+    m_tag = rhs.m_tag;
+    rhs.copyValueTo( m_string );
+    m_data = rhs.m_data;
+    m_metrics = rhs.m_metrics;
+    m_pField = m_pValue = m_pEnd = 0;
+    m_cache = rhs.m_cache;
+    m_cacheType = rhs.m_cacheType;
+    return *this;
+  }
+
   void setTag( int tag )
   {
+    getString();
     m_tag = tag;
     m_metrics = no_metrics();
     m_data.clear();
+    m_pField = m_pEnd = 0;
   }
 
   /// @deprecated Use setTag
@@ -108,6 +142,8 @@ public:
     m_string = string;
     m_metrics = no_metrics();
     m_data.clear();
+    m_pField = m_pValue = m_pEnd = 0;
+    m_cacheType = NO_CACHE;
   }
 
   /// Get the fields integer tag.
@@ -120,13 +156,25 @@ public:
 
   /// Get the string representation of the fields value.
   const std::string& getString() const
-  { return m_string; }
+  {
+    if( m_pValue )
+    {
+      m_string.assign( m_pValue, m_pEnd - 1 );
+      m_pValue = 0;
+    }
+    return m_string;
+  }
 
   /// Get the string representation of the Field (i.e.) 55=MSFT[SOH]
   const std::string& getFixString() const
   {
     if( m_data.empty() )
-      encodeTo( m_data );
+    {
+      if( m_pField )
+        m_data.assign( m_pField, m_pEnd );
+      else
+        encodeTo( m_data );
+    }
 
     return m_data;
   }
@@ -149,13 +197,86 @@ public:
   bool operator < ( const FieldBase& field ) const
   { return m_tag < field.m_tag; }
 
+protected:
+  /// Kind of value held by the cache of the converted value
+  enum CacheType { NO_CACHE, INT_CACHE, DOUBLE_CACHE, TIME_CACHE };
+
+  /**
+   * The value converted from its string, kept until the string changes.
+   *
+   * Filled by the typed getters and by validation, so a field read
+   * several times is only converted once.
+   */
+  bool isCached( CacheType type ) const
+  { return m_cacheType == type; }
+
+  void cacheInt( long long value ) const
+  {
+    m_cache.integer = value;
+    m_cacheType = INT_CACHE;
+  }
+
+  void cacheDouble( double value ) const
+  {
+    m_cache.real = value;
+    m_cacheType = DOUBLE_CACHE;
+  }
+
+  void cacheTime( const DateTime& value ) const
+  {
+    m_cache.time.date = value.m_date;
+    m_cache.time.time = value.m_time;
+    m_cacheType = TIME_CACHE;
+  }
+
+  long long getCachedInt() const
+  { return m_cache.integer; }
+  double getCachedDouble() const
+  { return m_cache.real; }
+  DateTime getCachedTime() const
+  { return DateTime( m_cache.time.date, m_cache.time.time ); }
+
 private:
 
   void calculate() const
   {
     if( m_metrics.isValid() ) return;
 
-    m_metrics = calculateMetrics( getFixString() );
+    if( m_pField )
+      m_metrics = calculateMetrics( m_pField, m_pEnd );
+    else
+      m_metrics = calculateMetrics( getFixString() );
+  }
+
+  /// Append the string representation of the Field without caching it
+  void appendTo( std::string& result ) const
+  {
+    if( m_pField )
+      result.append( m_pField, m_pEnd );
+    else if( !m_data.empty() )
+      result += m_data;
+    else
+    {
+      char buffer[ 16 ];
+      char* tag = FIX::integer_to_string( buffer, sizeof(buffer), m_tag );
+      buffer[ sizeof(buffer) - 1 ] = '=';
+      result.append( tag, buffer + sizeof(buffer) );
+      result += m_string;
+      result += '\001';
+    }
+  }
+
+  /// Start of the value inside of the received buffer
+  const char* valueStart() const
+  { return m_pValue ? m_pValue : m_pEnd - 1 - m_string.size(); }
+
+  /// Copy the value without caching it in this field
+  void copyValueTo( std::string& result ) const
+  {
+    if( m_pValue )
+      result.assign( m_pValue, m_pEnd - 1 );
+    else
+      result = m_string;
   }
 
   /// Serializes string representation of the Field to input string
@@ -180,26 +301,38 @@ private:
   }
 
   /// Calculate metrics for any input string
-  static field_metrics calculateMetrics( 
-    std::string::const_iterator const start,
-    std::string::const_iterator const end )
+  static field_metrics calculateMetrics( const char* start, const char* end )
   {
     int checksum = 0;
-    for ( std::string::const_iterator str = start; str != end; ++str )
+    for ( const char* str = start; str != end; ++str )
       checksum += (unsigned char)( *str );
 
-    return field_metrics( std::distance( start, end ), checksum );
+    return field_metrics( end - start, checksum );
   }
 
   static field_metrics calculateMetrics( const std::string& field )
   {
-    return calculateMetrics( field.begin(), field.end() );
+    return calculateMetrics( field.data(), field.data() + field.size() );
   }
 
   int m_tag;
-  std::string m_string;
+  mutable std::string m_string;
   mutable std::string m_data;
   mutable field_metrics m_metrics;
+
+  /// Position of the field inside of the buffer it was parsed from, if any
+  const char* m_pField;
+  /// Start of the value while it has not been copied into m_string
+  mutable const char* m_pValue;
+  const char* m_pEnd;
+
+  mutable union
+  {
+    long long integer;
+    double real;
+    struct { int date; int time; } time;
+  } m_cache;
+  mutable char m_cacheType;
 };
 /*! @} */
 
@@ -350,11 +483,33 @@ public:
   void setValue( double value, int padding = 0 )
     { setString( DoubleConvertor::convert( value, padding ) ); }
   double getValue() const throw ( IncorrectDataFormat )
+    { if( isCached( DOUBLE_CACHE ) ) return getCachedDouble();
+      try
+      { cacheDouble( DoubleConvertor::convert( getString() ) ); }
+      catch( FieldConvertError& )
+      { throw IncorrectDataFormat( getTag(), getString() ); }
+      return getCachedDouble(); }
+  operator double() const
+    { return getValue(); }
+};
+
+/// Field that contains a fixed point decimal value
+class DecimalField : public FieldBase
+{
+public:
+  explicit DecimalField( int field, const Decimal& data, int padding = 0 )
+: FieldBase( field, DecimalConvertor::convert( data, padding ) ) {}
+  DecimalField( int field )
+: FieldBase( field, "" ) {}
+
+  void setValue( const Decimal& value, int padding = 0 )
+    { setString( DecimalConvertor::convert( value, padding ) ); }
+  Decimal getValue() const throw ( IncorrectDataFormat )
     { try
-      { return DoubleConvertor::convert( getString() ); }
+      { return DecimalConvertor::convert( getString() ); }
       catch( FieldConvertError& )
       { throw IncorrectDataFormat( getTag(), getString() ); } }
-  operator double() const
+  operator Decimal() const
     { return getValue(); }
 };
 
@@ -363,17 +518,19 @@ class IntField : public FieldBase
 {
 public:
   explicit IntField( int field, int data )
-: FieldBase( field, IntConvertor::convert( data ) ) {}
+: FieldBase( field, IntConvertor::convert( data ) ) { cacheInt( data ); }
   IntField( int field )
 : FieldBase( field, "" ) {}
 
   void setValue( int value )
-    { setString( IntConvertor::convert( value ) ); }
+    { setString( IntConvertor::convert( value ) ); cacheInt( value ); }
   int getValue() const throw ( IncorrectDataFormat )
-    { try
-      { return IntConvertor::convert( getString() ); }
+    { if( isCached( INT_CACHE ) ) return (int)getCachedInt();
+      try
+      { cacheInt( IntConvertor::convert( getString() ) ); }
       catch( FieldConvertError& )
-      { throw IncorrectDataFormat( getTag(), getString() ); } }
+      { throw IncorrectDataFormat( getTag(), getString() ); }
+      return (int)getCachedInt(); }
   operator const int() const
     { return getValue(); }
 };
@@ -410,10 +567,12 @@ public:
   void setValue( const UtcTimeStamp& value )
     { setString( UtcTimeStampConvertor::convert( value ) ); }
   UtcTimeStamp getValue() const throw ( IncorrectDataFormat )
-    { try
-      { return UtcTimeStampConvertor::convert( getString() ); }
+    { if( isCached( TIME_CACHE ) ) return UtcTimeStamp( getCachedTime() );
+      try
+      { cacheTime( UtcTimeStampConvertor::convert( getString() ) ); }
       catch( FieldConvertError& )
-      { throw IncorrectDataFormat( getTag(), getString() ); } }
+      { throw IncorrectDataFormat( getTag(), getString() ); }
+      return UtcTimeStamp( getCachedTime() ); }
   operator UtcTimeStamp() const
     { return getValue(); }
 
@@ -502,6 +661,9 @@ public:
 typedef DoubleField PriceField;
 typedef DoubleField AmtField;
 typedef DoubleField QtyField;
+typedef DecimalField DecimalPriceField;
+typedef DecimalField DecimalAmtField;
+typedef DecimalField DecimalQtyField;
 typedef StringField CurrencyField;
 typedef StringField MultipleValueStringField;
 typedef StringField MultipleStringValueField;
@@ -564,6 +726,12 @@ DEFINE_FIELD_TIMECLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
   DEFINE_FIELD_CLASS(NAME, Amt, FIX::AMT)
 #define DEFINE_QTY( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Qty, FIX::QTY)
+#define DEFINE_DECIMAL_PRICE( NAME ) \
+  DEFINE_FIELD_CLASS(NAME, DecimalPrice, FIX::DECIMAL)
+#define DEFINE_DECIMAL_AMT( NAME ) \
+  DEFINE_FIELD_CLASS(NAME, DecimalAmt, FIX::DECIMAL)
+#define DEFINE_DECIMAL_QTY( NAME ) \
+  DEFINE_FIELD_CLASS(NAME, DecimalQty, FIX::DECIMAL)
 #define DEFINE_CURRENCY( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Currency, FIX::CURRENCY)
 #define DEFINE_MULTIPLEVALUESTRING( NAME ) \
@@ -627,6 +795,12 @@ DEFINE_FIELD_TIMECLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
   DEFINE_FIELD_CLASS_NUM(NAME, Amt, FIX::AMT, NUM)
 #define USER_DEFINE_QTY( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Qty, FIX::QTY, NUM)
+#define USER_DEFINE_DECIMAL_PRICE( NAME, NUM ) \
+  DEFINE_FIELD_CLASS_NUM(NAME, DecimalPrice, FIX::DECIMAL, NUM)
+#define USER_DEFINE_DECIMAL_AMT( NAME, NUM ) \
+  DEFINE_FIELD_CLASS_NUM(NAME, DecimalAmt, FIX::DECIMAL, NUM)
+#define USER_DEFINE_DECIMAL_QTY( NAME, NUM ) \
+  DEFINE_FIELD_CLASS_NUM(NAME, DecimalQty, FIX::DECIMAL, NUM)
 #define USER_DEFINE_CURRENCY( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Currency, FIX::CURRENCY, NUM)
 #define USER_DEFINE_MULTIPLEVALUESTRING( NAME, NUM ) \
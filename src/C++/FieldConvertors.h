@@ -23,6 +23,7 @@
 #define FIX_FIELDCONVERTORS_H
 
 #include "FieldTypes.h"
+#include "Clock.h"
 #include "Exceptions.h"
 #include "Utility.h"
 #include <string>
@@ -161,9 +162,10 @@ struct IntConvertor
     return std::string( start, buffer + sizeof (buffer) - start - 1 );
   }
 
+  template<typename Iterator>
   static bool convert(     
-    std::string::const_iterator str, 
-    std::string::const_iterator end, 
+    Iterator str, 
+    Iterator end, 
     signed_int& result )
   {
     bool isNegative = false;
@@ -500,6 +502,113 @@ static bool convert( const std::string& value, double& result )
   }
 };
 
+/// Converts Decimal to/from a string without going through a double
+struct DecimalConvertor
+{
+  /// Formats all the digits of the mantissa, padding is the minimum
+  /// number of decimal places
+  static std::string convert( const Decimal& value, int padding = 0 )
+  {
+    const long long mantissa = value.getMantissa();
+    const int exponent = value.getExponent();
+    unsigned long long number = mantissa < 0
+      ? 0ULL - (unsigned long long)mantissa : (unsigned long long)mantissa;
+
+    int digits = 1;
+    for( unsigned long long rest = number; rest > 9; rest /= 10 )
+      ++digits;
+
+    const int decimals = exponent < 0 ? -exponent : 0;
+    const int shown = decimals > padding ? decimals : padding;
+    const int zeros = ( exponent > 0 && number ) ? exponent : 0;
+    const int integers = digits > decimals ? digits - decimals : 1;
+    const int size = ( mantissa < 0 ? 1 : 0 ) + integers + zeros
+                     + ( shown ? shown + 1 : 0 );
+
+    // every position not written below is a zero
+    std::string result( size, '0' );
+    char* p = &result[0] + size - ( shown - decimals );
+    if( shown )
+    {
+      for( int i = 0; i < decimals; ++i, number /= 10 )
+        *--p = char( '0' + number % 10 );
+      *--p = '.';
+    }
+    p -= zeros;
+    for( ; number; number /= 10 )
+      *--p = char( '0' + number % 10 );
+    if( mantissa < 0 )
+      result[0] = '-';
+    return result;
+  }
+
+  /// Parses [-]digits[.digits], values with more than 18 significant
+  /// digits do not fit the mantissa and are rejected
+  template<typename Iterator>
+  static bool convert( Iterator str, Iterator end, Decimal& result )
+  {
+    const unsigned long long HIGH_MARK = 100000000000000000ULL;
+
+    if( str == end )
+      return false;
+
+    bool isNegative = false;
+    if( *str == '-' )
+    {
+      isNegative = true;
+      if( ++str == end )
+        return false;
+    }
+
+    unsigned long long x = 0;
+    int exponent = 0;
+    bool haveDigit = false;
+
+    for( ; str != end; ++str )
+    {
+      const unsigned_int c = *str - '0';
+      if( c > 9 ) break;
+      if( x >= HIGH_MARK ) return false;
+      x = 10 * x + c;
+      haveDigit = true;
+    }
+
+    if( str != end && *str == '.' )
+    {
+      while( ++str != end )
+      {
+        const unsigned_int c = *str - '0';
+        if( c > 9 ) return false;
+        if( x >= HIGH_MARK ) return false;
+        x = 10 * x + c;
+        --exponent;
+        haveDigit = true;
+      }
+    }
+
+    if( str != end || !haveDigit )
+      return false;
+
+    result = Decimal( isNegative ? -(long long)x : (long long)x, exponent );
+    return true;
+  }
+
+  static bool convert( const std::string& value, Decimal& result )
+  {
+    return convert( value.begin(), value.end(), result );
+  }
+
+  static Decimal convert( const std::string& value )
+  throw( FieldConvertError )
+  {
+    Decimal result;
+    if( !convert( value.begin(), value.end(), result ) )
+      throw FieldConvertError(value);
+    else
+      return result;
+  }
+};
+
 /// Converts character to/from a string
 struct CharConvertor
 {
@@ -567,33 +676,7 @@ struct UtcTimeStampConvertor
                               bool showMilliseconds = false )
   throw( FieldConvertError )
   {
-    char result[ 18+4 ];
-    int year, month, day, hour, minute, second, millis;
-
-    value.getYMD( year, month, day );
-    value.getHMS( hour, minute, second, millis );
-
-    integer_to_string_padded( result, 5, year, 4 );
-    integer_to_string_padded( result + 4, 3, month, 2 );
-    integer_to_string_padded( result + 6, 3, day, 2 );
-    result[8]  = '-';
-    integer_to_string_padded( result + 9, 3, hour, 2 );
-    result[11] = ':';
-    integer_to_string_padded( result + 12, 3, minute, 2 );
-    result[14] = ':';
-    integer_to_string_padded( result + 15, 3, second, 2 );
-
-    if( showMilliseconds )
-    {
-      result[17] = '.';
-      if( integer_to_string_padded ( result + 18, 4, millis, 3 )
-          != result + 18 )
-      {
-        throw FieldConvertError();
-      }
-    }
-
-    return result;
+    return Clock::format( value, showMilliseconds );
   }
 
   static UtcTimeStamp convert( const std::string& value,
@@ -858,6 +941,7 @@ typedef StringConvertor TZTIMESTAMP_CONVERTOR;
 typedef StringConvertor XMLDATA_CONVERTOR;
 typedef StringConvertor LANGUAGE_CONVERTOR;
 typedef CheckSumConvertor CHECKSUM_CONVERTOR;
+typedef DecimalConvertor DECIMAL_CONVERTOR;
 }
 
 #endif //FIX_FIELDCONVERTORS_H
@@ -24,12 +24,117 @@
 #endif
 
 #include "FieldMap.h"
+#include "MessagePool.h"
 #include <algorithm>
 #include <iterator>
 #include <deque>
 
 namespace FIX
 {
+FieldMap::Fields::~Fields()
+{
+  clear();
+
+  Blocks::iterator i;
+  for ( i = m_blocks.begin(); i != m_blocks.end(); ++i )
+    ::operator delete( i->data );
+}
+
+FieldMap::Fields& FieldMap::Fields::operator=( const Fields& rhs )
+{
+  if ( this == &rhs ) return *this;
+
+  clear();
+  m_order = rhs.m_order;
+  m_index.reserve( rhs.m_index.size() );
+
+  Index::const_iterator i;
+  for ( i = rhs.m_index.begin(); i != rhs.m_index.end(); ++i )
+    link( new( allocate() ) value_type( (*i)->second ) );
+
+  return *this;
+}
+
+void FieldMap::Fields::erase( value_type* field )
+{
+  Index::iterator i = std::find( m_index.begin(), m_index.end(), field );
+  if ( i == m_index.end() ) return;
+  m_index.erase( i );
+
+  // the other fields stay where they are, the slot is reused by the next insert
+  field->~value_type();
+  m_free.push_back( field );
+}
+
+void FieldMap::Fields::clear()
+{
+  Index::iterator i;
+  for ( i = m_index.begin(); i != m_index.end(); ++i )
+    (*i)->~value_type();
+
+  Blocks::iterator j;
+  for ( j = m_blocks.begin(); j != m_blocks.end(); ++j )
+    j->size = 0;
+
+  m_block = 0;
+  m_index.clear();
+  m_free.clear();
+}
+
+bool FieldMap::Fields::link( value_type* field )
+{
+  // fields usually arrive in order so check the end first
+  if ( m_index.empty() || !m_order( field->first, m_index.back()->first ) )
+  {
+    bool repeated = !m_index.empty() && m_index.back()->first == field->first;
+    m_index.push_back( field );
+    return repeated;
+  }
+
+  Index::iterator i = m_index.begin();
+  size_t length = m_index.size();
+  while ( length > 0 )
+  {
+    size_t half = length >> 1;
+    if ( m_order( field->first, (*(i + half))->first ) )
+      length = half;
+    else
+    {
+      i += half + 1;
+      length -= half + 1;
+    }
+  }
+  bool repeated = i != m_index.begin() && (*(i - 1))->first == field->first;
+  m_index.insert( i, field );
+  return repeated;
+}
+
+void* FieldMap::Fields::allocate()
+{
+  if ( !m_free.empty() )
+  {
+    value_type* field = m_free.back();
+    m_free.pop_back();
+    return field;
+  }
+
+  if ( m_blocks.size() && m_blocks[ m_block ].size == m_blocks[ m_block ].capacity )
+    ++m_block;
+
+  if ( m_block == m_blocks.size() )
+  {
+    Block block;
+    block.capacity = m_blocks.size() ? m_blocks.back().capacity * 2 : 8;
+    block.data = static_cast < value_type* >
+      ( ::operator new( block.capacity * sizeof( value_type ) ) );
+    block.size = 0;
+    m_blocks.push_back( block );
+  }
+
+  Block& block = m_blocks[ m_block ];
+  return block.data + block.size++;
+}
+
 FieldMap::~FieldMap()
 {
   clear();
@@ -47,7 +152,7 @@ FieldMap& FieldMap::operator=( const FieldMap& rhs )
     std::vector < FieldMap* > ::const_iterator j;
     for ( j = i->second.begin(); j != i->second.end(); ++j )
     {
-        FieldMap * pGroup = new FieldMap( **j );
+        FieldMap * pGroup = MessagePool::acquireGroup( **j );
         m_groups[ i->first ].push_back( pGroup );
     }
   }
@@ -57,7 +162,7 @@ FieldMap& FieldMap::operator=( const FieldMap& rhs )
 
 void FieldMap::addGroup( int field, const FieldMap& group, bool setCount )
 {
-  FieldMap * pGroup = new FieldMap( group );
+  FieldMap * pGroup = MessagePool::acquireGroup( group );
 
   addGroupPtr( field, pGroup, setCount );
 }
@@ -94,7 +199,7 @@ void FieldMap::removeGroup( int num, int field )
   std::vector< FieldMap* >::iterator iter = vector.begin();
   std::advance( iter, ( num - 1 ) );
 
-  delete (*iter);
+  MessagePool::releaseGroup( *iter );
   vector.erase( iter );
 
   if( vector.size() == 0 )
@@ -116,8 +221,8 @@ void FieldMap::removeGroup( int field )
 
 void FieldMap::removeField( int field )
 {
-  Fields::iterator i = m_fields.find( field );
-  if ( i != m_fields.end() )
+  Fields::value_type* i = m_fields.find( field );
+  if ( i != 0 )
     m_fields.erase( i );
 }
 
@@ -149,7 +254,7 @@ void FieldMap::clear()
   {
     std::vector < FieldMap* > ::iterator j;
     for ( j = i->second.begin(); j != i->second.end(); ++j )
-      delete *j;
+      MessagePool::releaseGroup( *j );
   }
   m_groups.clear();
 }
@@ -175,10 +280,17 @@ size_t FieldMap::totalFields() const
 
 std::string& FieldMap::calculateString( std::string& result ) const
 {  
-  Fields::const_iterator i;
-  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
+  appendFields( result, begin(), end() );
+  return result;
+}
+
+void FieldMap::appendFields( std::string& result,
+                             iterator begin, iterator end ) const
+{
+  iterator i;
+  for ( i = begin; i != end; ++i )
   {
-    result += i->second.getFixString();
+    i->second.appendTo( result );
 
     // add groups if they exist
     if( !m_groups.size() ) continue;
@@ -188,7 +300,6 @@ std::string& FieldMap::calculateString( std::string& result ) const
     for ( k = j->second.begin(); k != j->second.end(); ++k )
       ( *k ) ->calculateString( result );
   }
-  return result;
 }
 
 int FieldMap::calculateLength( int beginStringField,
@@ -32,6 +32,8 @@
 #include "Utility.h"
 #include <map>
 #include <vector>
+#include <new>
+#include <iterator>
 #include <sstream>
 #include <algorithm>
 
@@ -46,12 +48,147 @@ namespace FIX
 class FieldMap
 {
 public:
+  /**
+   * Flat collection of fields sorted by a message_order.
+   *
+   * Fields are constructed in blocks of contiguous memory which never move,
+   * so references to them stay valid until they are removed.  An index of
+   * pointers into the blocks is kept in the order of the message.  Clearing
+   * the collection keeps the blocks so a reused map does not allocate.
+   */
+  class Fields
+  {
+  public:
+    struct value_type
+    {
+      value_type( const FieldBase& field )
+      : first( field.getTag() ), second( field ) {}
+      value_type( const FieldBase& field, const char* )
+      : first( field.getTag() ),
+        second( field.m_tag, field.m_pField, field.valueStart(), field.m_pEnd ) {}
+
+      int first;
+      FieldBase second;
+    };
+
+#if defined(_MSC_VER) && _MSC_VER < 1300
+    typedef std::vector < value_type* > Index;
+#else
+    typedef std::vector < value_type*, ALLOCATOR<value_type*> > Index;
+#endif
+
+    class const_iterator
+    {
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Fields::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const value_type* pointer;
+      typedef const value_type& reference;
+
+      const_iterator() {}
+      explicit const_iterator( Index::const_iterator i ) : m_i( i ) {}
+
+      reference operator*() const { return **m_i; }
+      pointer operator->() const { return *m_i; }
+      const_iterator& operator++() { ++m_i; return *this; }
+      const_iterator operator++( int ) { return const_iterator( m_i++ ); }
+      const_iterator& operator--() { --m_i; return *this; }
+      const_iterator operator--( int ) { return const_iterator( m_i-- ); }
+      bool operator==( const const_iterator& rhs ) const
+      { return m_i == rhs.m_i; }
+      bool operator!=( const const_iterator& rhs ) const
+      { return m_i != rhs.m_i; }
+
+    private:
+      Index::const_iterator m_i;
+    };
+
+    Fields( const message_order& order = message_order( message_order::normal ) )
+    : m_order( order ), m_block( 0 ) {}
+    Fields( const Fields& copy )
+    : m_block( 0 ) { *this = copy; }
+    ~Fields();
+
+    Fields& operator=( const Fields& rhs );
+
+    const_iterator begin() const { return const_iterator( m_index.begin() ); }
+    const_iterator end() const { return const_iterator( m_index.end() ); }
+    size_t size() const { return m_index.size(); }
+
+    /// Find the first field with a tag
+    value_type* find( int tag ) const
+    {
+      Index::const_iterator i = lower_bound( tag );
+      if( i == m_index.end() || (*i)->first != tag ) return 0;
+      return *i;
+    }
+
+    /// Insert a copy of a field after all fields with the same tag
+    void insert( const FieldBase& field )
+    { link( new( allocate() ) value_type( field ) ); }
+    /// Insert a field that keeps referring to its received buffer,
+    /// repeated is set if a field with the same tag comes right before it
+    value_type& insertView( const FieldBase& field, bool& repeated )
+    {
+      value_type* pField = new( allocate() ) value_type( field, "" );
+      repeated = link( pField );
+      return *pField;
+    }
+
+    void erase( value_type* field );
+    void clear();
+
+    /// Sort an empty collection by another order
+    void setOrder( const message_order& order )
+    { m_order = order; }
+
+  private:
+    struct Block
+    {
+      value_type* data;
+      size_t size;
+      size_t capacity;
+    };
+
+#if defined(_MSC_VER) && _MSC_VER < 1300
+    typedef std::vector < Block > Blocks;
+#else
+    typedef std::vector < Block, ALLOCATOR<Block> > Blocks;
+#endif
+
+    Index::const_iterator lower_bound( int tag ) const
+    {
+      Index::const_iterator first = m_index.begin();
+      size_t length = m_index.size();
+      while( length > 0 )
+      {
+        size_t half = length >> 1;
+        if( m_order( (*(first + half))->first, tag ) )
+        {
+          first += half + 1;
+          length -= half + 1;
+        }
+        else
+          length = half;
+      }
+      return first;
+    }
+
+    bool link( value_type* field );
+    void* allocate();
+
+    message_order m_order;
+    Blocks m_blocks;
+    size_t m_block;
+    Index m_index;
+    /// Slots of erased fields
+    Index m_free;
+  };
+
 #if defined(_MSC_VER) && _MSC_VER < 1300
-  typedef std::multimap < int, FieldBase, message_order > Fields;
   typedef std::map < int, std::vector < FieldMap* >, std::less<int> > Groups;
 #else
-  typedef std::multimap < int, FieldBase, message_order, 
-                          ALLOCATOR<std::pair<const int,FieldBase> > > Fields;
   typedef std::map < int, std::vector < FieldMap* >, std::less<int>, 
                      ALLOCATOR<std::pair<const int, std::vector< FieldMap* > > > > Groups;
 #endif
@@ -80,12 +217,12 @@ public:
   throw( RepeatedTag )
   {
       if(!overwrite)
-          m_fields.insert( Fields::value_type( field.getTag(), field ) );
+          m_fields.insert( field );
       else
       {
-          Fields::iterator i = m_fields.find( field.getTag() );
-          if( i == m_fields.end() )
-              m_fields.insert( Fields::value_type( field.getTag(), field ) );
+          Fields::value_type* i = m_fields.find( field.getTag() );
+          if( i == 0 )
+              m_fields.insert( field );
           else
               i->second = field;
       }
@@ -101,8 +238,8 @@ public:
   /// Get a field if set
   bool getFieldIfSet( FieldBase& field ) const
   {
-    Fields::const_iterator iter = m_fields.find( field.getTag() );
-    if ( iter == m_fields.end() )
+    Fields::value_type* iter = m_fields.find( field.getTag() );
+    if ( iter == 0 )
       return false;
     field = iter->second;
     return true;
@@ -127,8 +264,8 @@ public:
   const FieldBase& getFieldRef( int tag )
   const throw( FieldNotFound )
   {
-    Fields::const_iterator iter = m_fields.find( tag );
-    if ( iter == m_fields.end() )
+    Fields::value_type* iter = m_fields.find( tag );
+    if ( iter == 0 )
       throw FieldNotFound( tag );
     return iter->second;
   }
@@ -145,7 +282,7 @@ public:
   { return isSetField( field.getTag() ); }
   /// Check to see if a field is set by referencing its number
   bool isSetField( int tag ) const
-  { return m_fields.find( tag ) != m_fields.end(); }
+  { return m_fields.find( tag ) != 0; }
 
   /// Remove a field. If field is not present, this is a no-op.
   void removeField( int tag );
@@ -217,6 +354,20 @@ public:
   g_iterator g_end() const { return m_groups.end(); }
 
 private:
+  friend class Message;
+  friend class MessagePool;
+
+  /// Append a range of fields and the groups that follow them
+  void appendFields( std::string& result, iterator begin, iterator end ) const;
+
+  /// Add a field that refers to the buffer owned by the message it was parsed from
+  void addFieldView( const FieldBase& field )
+  { bool repeated; m_fields.insertView( field, repeated ); }
+  /// Add a field view and return the stored field, repeated is set
+  /// if the map already had a field with its tag
+  const FieldBase& addFieldView( const FieldBase& field, bool& repeated )
+  { return m_fields.insertView( field, repeated ).second; }
+
   Fields m_fields;
   Groups m_groups;
 };
@@ -24,26 +24,19 @@
 #endif
 
 #include "FieldTypes.h"
+#include "Clock.h"
 
 #ifdef HAVE_FTIME
 # include <sys/timeb.h>
 #endif
+#include <math.h>
+#include <limits.h>
 
 namespace FIX {
 
 DateTime DateTime::nowUtc()
 {
-#if defined( HAVE_FTIME )
-    timeb tb;
-    ftime (&tb);
-    return fromUtcTimeT (tb.time, tb.millitm);
-#elif defined( _POSIX_SOURCE )
-    struct timeval tv;
-    gettimeofday (&tv, 0);
-    return fromUtcTimeT( tv.tv_sec, tv.tv_usec / 1000 );
-#else
-    return fromUtcTimeT( ::time (0), 0 );
-#endif
+  return Clock::now();
 }
 
 DateTime DateTime::nowLocal()
@@ -61,4 +54,58 @@ DateTime DateTime::nowLocal()
 #endif
 }
 
+static const long long s_powersOfTen[] =
+{
+  1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL,
+  100000000LL, 1000000000LL, 10000000000LL, 100000000000LL,
+  1000000000000LL, 10000000000000LL, 100000000000000LL,
+  1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+  1000000000000000000LL
+};
+
+static const int MAX_POWER_OF_TEN = 18;
+
+Decimal Decimal::fromDouble( double value, int decimals )
+{
+  double scaled = value * pow( 10.0, decimals );
+  return Decimal( (long long)( scaled < 0 ? scaled - 0.5 : scaled + 0.5 ),
+                  -decimals );
+}
+
+double Decimal::toDouble() const
+{
+  // dividing by an exact power of ten rounds only once
+  if( m_exponent < 0 && m_exponent >= -22 )
+    return (double)m_mantissa / pow( 10.0, -m_exponent );
+  return (double)m_mantissa * pow( 10.0, m_exponent );
+}
+
+int Decimal::compare( const Decimal& rhs ) const
+{
+  long long lhsMantissa = m_mantissa;
+  long long rhsMantissa = rhs.m_mantissa;
+
+  // scale the mantissa with the larger exponent down to the other one
+  int difference = m_exponent - rhs.m_exponent;
+  long long& scaled = difference > 0 ? lhsMantissa : rhsMantissa;
+  if( difference < 0 )
+    difference = -difference;
+
+  if( difference && scaled )
+  {
+    if( difference > MAX_POWER_OF_TEN )
+      return toDouble() < rhs.toDouble() ? -1 : 1;
+
+    long long power = s_powersOfTen[ difference ];
+    long long limit = LLONG_MAX / power;
+    if( scaled > limit || scaled < -limit )
+      return toDouble() < rhs.toDouble() ? -1 : 1;
+    scaled *= power;
+  }
+
+  if( lhsMantissa < rhsMantissa )
+    return -1;
+  return lhsMantissa > rhsMantissa ? 1 : 0;
+}
+
 }
@@ -424,6 +424,9 @@ public:
   UtcTimeStamp( const tm* time, int millisecond = 0 )
   : DateTime( fromTm (*time, millisecond) ) {}
 
+  explicit UtcTimeStamp( const DateTime& value )
+  : DateTime( value ) {}
+
   void setCurrent() 
   {
     set( DateTime::nowUtc() );
@@ -619,6 +622,48 @@ public:
   }
 };
 
+/// Fixed point decimal number, a 64 bit mantissa scaled by a power of ten.
+///
+/// Holds prices and quantities with the exact digits they were sent
+/// with, no rounding happens on the way in or out.  1.5 and 1.50 compare
+/// equal but each is formatted the way it was given.
+class Decimal
+{
+public:
+  Decimal() : m_mantissa( 0 ), m_exponent( 0 ) {}
+  explicit Decimal( long long mantissa, int exponent = 0 )
+  : m_mantissa( mantissa ), m_exponent( exponent ) {}
+
+  /// Round a double to the given number of decimal places
+  static Decimal fromDouble( double value, int decimals );
+
+  long long getMantissa() const { return m_mantissa; }
+  int getExponent() const { return m_exponent; }
+
+  /// Nearest double to the value
+  double toDouble() const;
+
+  /// Compare values regardless of the number of digits they carry
+  int compare( const Decimal& rhs ) const;
+
+private:
+  long long m_mantissa;
+  int m_exponent;
+};
+
+inline bool operator==( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) == 0; }
+inline bool operator!=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) != 0; }
+inline bool operator<( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) < 0; }
+inline bool operator>( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) > 0; }
+inline bool operator<=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) <= 0; }
+inline bool operator>=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) >= 0; }
+
 /*! @} */
 
 typedef UtcDate UtcDateOnly;
@@ -654,6 +699,7 @@ typedef std::string TZTIMEONLY;
 typedef std::string TZTIMESTAMP;
 typedef std::string XMLDATA;
 typedef std::string LANGUAGE;
+typedef Decimal DECIMAL;
 
 namespace TYPE
 {
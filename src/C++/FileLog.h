@@ -80,15 +80,13 @@ public:
   void backup();
 
   void onIncoming( const std::string& value )
-  { m_messages << UtcTimeStampConvertor::convert(UtcTimeStamp(), m_millisecondsInTimeStamp) << " : " << value << std::endl; }
+  { write( m_messages, value.data(), value.size() ); }
   void onOutgoing( const std::string& value )
-  { m_messages << UtcTimeStampConvertor::convert(UtcTimeStamp(), m_millisecondsInTimeStamp) << " : " << value << std::endl; }
+  { write( m_messages, value.data(), value.size() ); }
+  void onOutgoing( const char* data, size_t size )
+  { write( m_messages, data, size ); }
   void onEvent( const std::string& value )
-  {
-    UtcTimeStamp now;
-    m_event << UtcTimeStampConvertor::convert( now, m_millisecondsInTimeStamp )
-            << " : " << value << std::endl;
-  }
+  { write( m_event, value.data(), value.size() ); }
 
   bool getMillisecondsInTimeStamp() const
   { return m_millisecondsInTimeStamp; }
@@ -96,6 +94,15 @@ public:
   { m_millisecondsInTimeStamp = value; }
 
 private:
+  void write( std::ofstream& stream, const char* data, size_t size )
+  {
+    char time[ Clock::MAX_FORMAT ];
+    stream.write( time, Clock::format( Clock::now(), m_millisecondsInTimeStamp, time ) );
+    stream << " : ";
+    stream.write( data, size );
+    stream << std::endl;
+  }
+
   std::string generatePrefix( const SessionID& sessionID );
   void init( std::string path, std::string backupPath, const std::string& prefix );
 
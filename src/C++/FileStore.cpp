@@ -183,6 +183,32 @@ void FileStoreFactory::destroy( MessageStore* pStore )
 
 bool FileStore::set( int msgSeqNum, const std::string& msg )
 throw ( IOException )
+{
+  return set( msgSeqNum, msg.data(), msg.size() );
+}
+
+bool FileStore::set( int msgSeqNum, const char* data, size_t size )
+throw ( IOException )
+{
+  long offset = seekToEnd();
+  write( msgSeqNum, data, size, offset );
+  flush();
+  return true;
+}
+
+void FileStore::setBatch( const MessageBatch& batch )
+throw ( IOException )
+{
+  if ( batch.empty() ) return;
+
+  long offset = seekToEnd();
+  MessageBatch::const_iterator i;
+  for ( i = batch.begin(); i != batch.end(); ++i )
+    write( i->first, i->second->data(), i->second->size(), offset );
+  flush();
+}
+
+long FileStore::seekToEnd()
 {
   if ( fseek( m_msgFile, 0, SEEK_END ) ) 
     throw IOException( "Cannot seek to end of " + m_msgFileName );
@@ -192,19 +218,26 @@ throw ( IOException )
   long offset = ftell( m_msgFile );
   if ( offset < 0 ) 
     throw IOException( "Unable to get file pointer position from " + m_msgFileName );
-  size_t size = msg.size();
+  return offset;
+}
 
+void FileStore::write( int msgSeqNum, const char* msg, size_t size, long& offset )
+{
   if ( fprintf( m_headerFile, "%d,%ld,%lu ", msgSeqNum, offset, size ) < 0 )
     throw IOException( "Unable to write to file " + m_headerFileName );
   m_offsets[ msgSeqNum ] = std::make_pair( offset, size );
-  fwrite( msg.c_str(), sizeof( char ), msg.size(), m_msgFile );
+  fwrite( msg, sizeof( char ), size, m_msgFile );
   if ( ferror( m_msgFile ) ) 
     throw IOException( "Unable to write to file " + m_msgFileName );
+  offset += size;
+}
+
+void FileStore::flush()
+{
   if ( fflush( m_msgFile ) == EOF ) 
     throw IOException( "Unable to flush file " + m_msgFileName );
   if ( fflush( m_headerFile ) == EOF ) 
     throw IOException( "Unable to flush file " + m_headerFileName );
-  return true;
 }
 
 void FileStore::get( int begin, int end,
@@ -220,6 +253,45 @@ throw ( IOException )
   }
 }
 
+void FileStore::forEach( int begin, int end,
+                         StoredMessageCallback& callback ) const
+throw ( IOException )
+{
+  if ( begin > end ) return;
+
+  NumToOffset::const_iterator i = m_offsets.lower_bound( begin );
+  NumToOffset::const_iterator last = m_offsets.upper_bound( end );
+  std::vector < char > buffer;
+  std::string msg;
+
+  while ( i != last )
+  {
+    // messages following each other in the file are read at once
+    long start = i->second.first;
+    long size = 0;
+    NumToOffset::const_iterator runEnd = i;
+    do
+    {
+      size += runEnd->second.second;
+      ++runEnd;
+    } while ( runEnd != last && runEnd->second.first == start + size
+              && size + runEnd->second.second <= READ_SIZE );
+
+    buffer.resize( size + 1 );
+    if ( fseek( m_msgFile, start, SEEK_SET ) ) 
+      throw IOException( "Unable to seek in file " + m_msgFileName );
+    size_t result = fread( &buffer[ 0 ], sizeof( char ), size, m_msgFile );
+    if ( ferror( m_msgFile ) || result != (size_t)size ) 
+      throw IOException( "Unable to read from file " + m_msgFileName );
+
+    for ( ; i != runEnd; ++i )
+    {
+      msg.assign( &buffer[ i->second.first - start ], i->second.second );
+      callback.onMessage( msg );
+    }
+  }
+}
+
 int FileStore::getNextSenderMsgSeqNum() const throw ( IOException )
 {
   return m_cache.getNextSenderMsgSeqNum();
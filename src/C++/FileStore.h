@@ -85,7 +85,10 @@ public:
   virtual ~FileStore();
 
   bool set( int, const std::string& ) throw ( IOException );
+  bool set( int, const char*, size_t ) throw ( IOException );
+  void setBatch( const MessageBatch& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  void forEach( int, int, StoredMessageCallback& ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException );
   int getNextTargetMsgSeqNum() const throw ( IOException );
@@ -103,9 +106,15 @@ private:
   typedef std::pair < int, int > OffsetSize;
   typedef std::map < int, OffsetSize > NumToOffset;
 
+  /// Largest read of messages written one after another in forEach
+  enum { READ_SIZE = 1024 * 1024 };
+
   void open( bool deleteFile );
   void populateCache();
   bool readFromFile( int offset, int size, std::string& msg );
+  long seekToEnd();
+  void write( int msgSeqNum, const char* msg, size_t size, long& offset );
+  void flush();
   void setSeqNum();
   void setSession();
 
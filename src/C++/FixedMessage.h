@@ -0,0 +1,376 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_FIXEDMESSAGE_H
+#define FIX_FIXEDMESSAGE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "Fields.h"
+#include "FieldConvertors.h"
+#include "Clock.h"
+#include "CharScanner.h"
+#include "Exceptions.h"
+#include <string>
+#include <vector>
+#include <string.h>
+
+namespace FIX
+{
+/**
+ * Building blocks of the fixed messages made by the code generator.
+ *
+ * A fixed message keeps every field its message type declares in a member
+ * of the field's own type, with a bit saying whether the field is set.
+ * Repeating groups keep their first few entries inline.  Each type writes
+ * and parses its own string, without going through a FieldMap.
+ */
+
+/// Bits telling which of N fields are set
+template< size_t N >
+class FixedPresence
+{
+public:
+  FixedPresence() { clear(); }
+
+  bool test( size_t bit ) const
+  { return ( m_bits[ bit / 32 ] >> ( bit % 32 ) ) & 1; }
+  void set( size_t bit )
+  { m_bits[ bit / 32 ] |= 1u << ( bit % 32 ); }
+  void reset( size_t bit )
+  { m_bits[ bit / 32 ] &= ~( 1u << ( bit % 32 ) ); }
+  void clear()
+  { for( size_t i = 0; i < WORDS; ++i ) m_bits[ i ] = 0; }
+
+private:
+  enum { WORDS = N / 32 + 1 };
+  unsigned int m_bits[ WORDS ];
+};
+
+/// Reads the fields of a message string in place
+class FixedParser
+{
+public:
+  FixedParser( const std::string& string )
+  : m_begin( string.data() ), m_pos( m_begin ),
+    m_end( string.data() + string.size() ), m_bodyStart( m_begin ),
+    m_field( m_pos ), m_value( m_pos ), m_length( 0 ), m_tag( 0 ),
+    m_dataLength( -1 ), m_bodyLength( 0 ) {}
+
+  /// Read BeginString, BodyLength and MsgType, which start every message
+  void begin( const char* beginString, const char* msgType )
+  throw( InvalidMessage )
+  {
+    int tag = 0;
+    if( !next( tag ) || tag != FIELD::BeginString || !equals( beginString ) )
+      throw InvalidMessage( "BeginString is not " + std::string( beginString ) );
+    if( !next( tag ) || tag != FIELD::BodyLength
+        || !IntConvertor::convert( m_value, m_value + m_length, m_bodyLength ) )
+      throw InvalidMessage( "BodyLength is not the second field" );
+    m_bodyStart = m_pos;
+    if( !next( tag ) || tag != FIELD::MsgType || !equals( msgType ) )
+      throw InvalidMessage( "MsgType is not " + std::string( msgType ) );
+  }
+
+  /// Check the BodyLength read by begin and the CheckSum, tag is the last
+  /// field read, which has to be the CheckSum ending the string
+  void end( int tag ) const throw( InvalidMessage )
+  {
+    if( tag != FIELD::CheckSum || m_pos != m_end )
+      throw InvalidMessage( "CheckSum is not the last field" );
+
+    int length = (int)( m_field - m_bodyStart );
+    if( length != m_bodyLength )
+      throw InvalidMessage( "Expected BodyLength=" + IntConvertor::convert( length )
+                            + ", Received BodyLength="
+                            + IntConvertor::convert( m_bodyLength ) );
+
+    int checkSum = (int)( CharScanner::sum( m_begin, m_field ) % 256 );
+    int received = -1;
+    if( !IntConvertor::convert( m_value, m_value + m_length, received )
+        || received != checkSum )
+      throw InvalidMessage( "Expected CheckSum=" + IntConvertor::convert( checkSum )
+                            + ", Received CheckSum=" + string() );
+  }
+
+  /// Read the next field, false at the end of the string
+  bool next( int& tag ) throw( InvalidMessage )
+  {
+    if( m_pos == m_end )
+      return false;
+
+    const char* equals = (const char*)memchr( m_pos, '=', m_end - m_pos );
+    signed_int number = 0;
+    if( !equals || !IntConvertor::convert( m_pos, equals, number ) || number <= 0 )
+      throw InvalidMessage( "Field tag is not a number" );
+
+    const char* value = equals + 1;
+    const char* soh = 0;
+    if( m_dataLength >= 0 )
+    {
+      if( m_end - value <= m_dataLength || value[ m_dataLength ] != '\001' )
+        throw InvalidMessage( "Data field does not match its length" );
+      soh = value + m_dataLength;
+      m_dataLength = -1;
+    }
+    else
+    {
+      soh = (const char*)memchr( value, '\001', m_end - value );
+      if( !soh )
+        throw InvalidMessage( "Field is not terminated" );
+    }
+
+    m_field = m_pos;
+    m_value = value;
+    m_length = soh - value;
+    m_pos = soh + 1;
+    m_tag = tag = number;
+    return true;
+  }
+
+  /// Make the last field read the next one again
+  void back() { m_pos = m_field; }
+  /// The next field is data of the given length
+  void setDataLength( int length ) { m_dataLength = length; }
+
+  void get( std::string& value ) const
+  { value.assign( m_value, m_length ); }
+  void get( int& value ) const throw( IncorrectDataFormat )
+  {
+    if( !IntConvertor::convert( m_value, m_value + m_length, value ) )
+      throw IncorrectDataFormat( m_tag, string() );
+  }
+  void get( double& value ) const throw( IncorrectDataFormat )
+  {
+    if( !DoubleConvertor::convert( string(), value ) )
+      throw IncorrectDataFormat( m_tag, string() );
+  }
+  void get( Decimal& value ) const throw( IncorrectDataFormat )
+  {
+    if( !DecimalConvertor::convert( m_value, m_value + m_length, value ) )
+      throw IncorrectDataFormat( m_tag, string() );
+  }
+  void get( char& value ) const throw( IncorrectDataFormat )
+  {
+    if( m_length != 1 )
+      throw IncorrectDataFormat( m_tag, string() );
+    value = *m_value;
+  }
+  void get( bool& value ) const throw( IncorrectDataFormat )
+  {
+    if( m_length != 1 || ( *m_value != 'Y' && *m_value != 'N' ) )
+      throw IncorrectDataFormat( m_tag, string() );
+    value = *m_value == 'Y';
+  }
+  /// Also tells whether the timestamp was written with milliseconds
+  void get( DateTime& value, bool& showMilliseconds ) const
+  throw( IncorrectDataFormat )
+  {
+    try
+    {
+      value = UtcTimeStampConvertor::convert( string() );
+      showMilliseconds = m_length > 17;
+    }
+    catch( FieldConvertError& )
+    {
+      throw IncorrectDataFormat( m_tag, string() );
+    }
+  }
+
+private:
+  std::string string() const { return std::string( m_value, m_length ); }
+  bool equals( const char* value ) const
+  { return strlen( value ) == m_length && !memcmp( value, m_value, m_length ); }
+
+  const char* m_begin;
+  const char* m_pos;
+  const char* m_end;
+  const char* m_bodyStart;
+  const char* m_field;
+  const char* m_value;
+  size_t m_length;
+  int m_tag;
+  int m_dataLength;
+  int m_bodyLength;
+};
+
+/// Appends fields to a message string
+struct FixedWriter
+{
+  /// Start a message, returns where its BodyLength goes
+  static std::string::size_type begin
+  ( std::string& string, const char* beginString, const char* msgType )
+  {
+    string.assign( "8=" );
+    string.append( beginString );
+    string.append( "\0019=" );
+    std::string::size_type length = string.size();
+    string.append( "35=" );
+    string.append( msgType );
+    string.append( 1, '\001' );
+    return length;
+  }
+
+  /// Fill in the BodyLength and append the CheckSum
+  static void end( std::string& string, std::string::size_type length )
+  {
+    char buffer[ std::numeric_limits<signed_int>::digits10 + 3 ];
+    const char* start = integer_to_string
+      ( buffer, sizeof( buffer ), (signed_int)( string.size() - length ) );
+    buffer[ sizeof( buffer ) - 1 ] = '\001';
+    string.insert( length, start, buffer + sizeof( buffer ) - start );
+
+    unsigned int checkSum = CharScanner::sum
+      ( string.data(), string.data() + string.size() ) % 256;
+
+    char trailer[] = "10=000\001";
+    trailer[ 3 ] = char( '0' + checkSum / 100 );
+    trailer[ 4 ] = char( '0' + checkSum / 10 % 10 );
+    trailer[ 5 ] = char( '0' + checkSum % 10 );
+    string.append( trailer, sizeof( trailer ) - 1 );
+  }
+
+  static void field( std::string& string, int tag, const std::string& value )
+  {
+    appendTag( string, tag );
+    string.append( value );
+    string.append( 1, '\001' );
+  }
+  static void field( std::string& string, int tag, int value )
+  {
+    appendTag( string, tag );
+    appendInt( string, value );
+    string.append( 1, '\001' );
+  }
+  static void field( std::string& string, int tag, double value )
+  { field( string, tag, DoubleConvertor::convert( value ) ); }
+  static void field( std::string& string, int tag, const Decimal& value )
+  { field( string, tag, DecimalConvertor::convert( value ) ); }
+  static void field( std::string& string, int tag, char value )
+  {
+    appendTag( string, tag );
+    string.append( 1, value );
+    string.append( 1, '\001' );
+  }
+  static void field( std::string& string, int tag, bool value )
+  { field( string, tag, value ? 'Y' : 'N' ); }
+  /// Milliseconds are written when asked for, zero or not, as the
+  /// UtcTimeStamp fields of a Message do
+  static void field( std::string& string, int tag, const DateTime& value,
+                     bool showMilliseconds )
+  {
+    char buffer[ Clock::MAX_FORMAT ];
+    appendTag( string, tag );
+    string.append( buffer, Clock::format( value, showMilliseconds, buffer ) );
+    string.append( 1, '\001' );
+  }
+
+private:
+  static void appendTag( std::string& string, int tag )
+  {
+    appendInt( string, tag );
+    string.append( 1, '=' );
+  }
+  static void appendInt( std::string& string, int value )
+  {
+    char buffer[ std::numeric_limits<signed_int>::digits10 + 3 ];
+    const char* start = integer_to_string( buffer, sizeof( buffer ), value );
+    string.append( start, buffer + sizeof( buffer ) - 1 - start );
+  }
+};
+
+/**
+ * Entries of a repeating group in a fixed message.
+ *
+ * The first N entries live inside the group, later ones in a vector,
+ * N has to be at least one.
+ * Clearing the group keeps the entries around so that filling it again
+ * reuses their strings.
+ */
+template< typename T, size_t N >
+class FixedGroup
+{
+public:
+  FixedGroup() : m_size( 0 ) {}
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  void clear() { m_size = 0; }
+
+  /// Add a cleared entry to the end of the group
+  T& add()
+  {
+    if( m_size >= N && m_size - N == m_overflow.size() )
+      m_overflow.push_back( T() );
+    T& entry = (*this)[ m_size++ ];
+    entry.clear();
+    return entry;
+  }
+
+  T& operator[]( size_t i )
+  { return i < N ? m_inline[ i ] : m_overflow[ i - N ]; }
+  const T& operator[]( size_t i ) const
+  { return i < N ? m_inline[ i ] : m_overflow[ i - N ]; }
+
+  /// Append the count field and every entry
+  void write( std::string& string, int field ) const
+  {
+    if( !m_size ) return;
+    FixedWriter::field( string, field, (int)m_size );
+    for( size_t i = 0; i < m_size; ++i )
+      (*this)[ i ].write( string );
+  }
+
+  /// Read count entries, each starting with the delimiter
+  void read( FixedParser& parser, int field, int delim, int count )
+  throw( InvalidMessage, IncorrectDataFormat, RepeatingGroupCountMismatch )
+  {
+    clear();
+    int tag = 0;
+    while( parser.next( tag ) )
+    {
+      if( tag == delim )
+      {
+        if( (int)m_size == count )
+          throw RepeatingGroupCountMismatch( field );
+        add();
+      }
+      if( !m_size || !(*this)[ m_size - 1 ].setField( tag, parser ) )
+      {
+        parser.back();
+        break;
+      }
+    }
+
+    if( (int)m_size != count )
+      throw RepeatingGroupCountMismatch( field );
+  }
+
+private:
+  size_t m_size;
+  T m_inline[ N ];
+  std::vector< T > m_overflow;
+};
+}
+
+#endif //FIX_FIXEDMESSAGE_H
@@ -83,6 +83,8 @@ void Initiator::initialize() throw ( ConfigError )
 
   if ( !m_sessions.size() )
     throw ConfigError( "No sessions defined for initiator" );
+
+  m_sendBatch = SendBatch::parse( m_settings.get() );
 }
 
 Initiator::~Initiator()
@@ -87,7 +87,18 @@ public:
   virtual void backup() = 0;
   virtual void onIncoming( const std::string& ) = 0;
   virtual void onOutgoing( const std::string& ) = 0;
+  /// Log an outgoing message that is part of a larger buffer, the
+  /// default copies it into a string of its own
+  virtual void onOutgoing( const char* data, size_t size )
+  { onOutgoing( std::string( data, size ) ); }
   virtual void onEvent( const std::string& ) = 0;
+
+  /// Whether entries are held back until they are due to be written
+  virtual bool hasPendingWrites() const
+  { return false; }
+  /// Write out held back entries that are due, the session calls this
+  /// about once a second while hasPendingWrites() is true
+  virtual void onTimer() {}
 };
 /*! @} */
 
@@ -104,6 +115,7 @@ public:
   void backup() {}
   void onIncoming( const std::string& ) {}
   void onOutgoing( const std::string& ) {}
+  void onOutgoing( const char*, size_t ) {}
   void onEvent( const std::string& ) {}
 };
 
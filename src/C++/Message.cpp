@@ -24,6 +24,8 @@
 #endif
 
 #include "Message.h"
+#include "MessagePool.h"
+#include "CharScanner.h"
 #include "Utility.h"
 #include "Values.h"
 #include <iomanip>
@@ -58,11 +60,7 @@ Message::Message( const std::string& string,
 throw( InvalidMessage )
 : m_validStructure( true )
 {
-  setStringHeader( string );
-  if( isAdmin() )
-    setString( string, validate, &sessionDataDictionary, &sessionDataDictionary );
-  else
-    setString( string, validate, &sessionDataDictionary, &applicationDataDictionary );
+  setString( string, sessionDataDictionary, applicationDataDictionary, validate );
 }
 
 bool Message::InitializeXML( const std::string& url )
@@ -177,6 +175,16 @@ std::string& Message::toString( std::string& str,
                                 int bodyLengthField, 
                                 int checkSumField ) const
 {
+  std::string::size_type start = 0;
+  if( beginStringField == FIELD::BeginString
+      && bodyLengthField == FIELD::BodyLength
+      && checkSumField == FIELD::CheckSum
+      && encode( str, start ) )
+  {
+    str.erase( 0, start );
+    return str;
+  }
+
   int length = bodyLength( beginStringField, bodyLengthField, checkSumField );
   m_header.setField( IntField(bodyLengthField, length) );
   m_trailer.setField( CheckSumField(checkSumField, checkSum(checkSumField)) );
@@ -197,6 +205,14 @@ std::string& Message::toString( std::string& str,
   return str;
 }
 
+std::string::size_type Message::toBuffer( std::string& str ) const
+{
+  std::string::size_type start = 0;
+  if( !encode( str, start ) )
+    toString( str );
+  return start;
+}
+
 std::string Message::toXML() const
 {
   std::string str;
@@ -265,10 +281,36 @@ std::string Message::toXMLFields(const FieldMap& fields, int space) const
 void Message::setString( const std::string& string,
                          bool doValidation,
                          const DataDictionary* pSessionDataDictionary,
-                         const DataDictionary* pApplicationDataDictionary )
+                         const DataDictionary* pApplicationDataDictionary,
+                         DataDictionary::FieldValidation* pFieldValidation )
 throw( InvalidMessage )
 {
   clear();
+  m_raw = string;
+  parseString( doValidation, pSessionDataDictionary,
+               pApplicationDataDictionary, pFieldValidation );
+}
+
+void Message::setString( const char* data, std::string::size_type length,
+                         bool doValidation,
+                         const DataDictionary* pSessionDataDictionary,
+                         const DataDictionary* pApplicationDataDictionary,
+                         DataDictionary::FieldValidation* pFieldValidation )
+throw( InvalidMessage )
+{
+  clear();
+  m_raw.assign( data, length );
+  parseString( doValidation, pSessionDataDictionary,
+               pApplicationDataDictionary, pFieldValidation );
+}
+
+void Message::parseString( bool doValidation,
+                           const DataDictionary* pSessionDataDictionary,
+                           const DataDictionary* pApplicationDataDictionary,
+                           DataDictionary::FieldValidation* pFieldValidation )
+{
+  if ( pFieldValidation )
+    pFieldValidation->reset( pSessionDataDictionary, pApplicationDataDictionary );
 
   std::string::size_type pos = 0;
   int count = 0;
@@ -283,9 +325,9 @@ throw( InvalidMessage )
 
   field_type type = header;
 
-  while ( pos < string.size() )
+  while ( pos < m_raw.size() )
   {
-    FieldBase field = extractField( string, pos, pSessionDataDictionary, pApplicationDataDictionary );
+    FieldBase field = extractField( pos, pSessionDataDictionary, pApplicationDataDictionary );
     if ( count < 3 && headerOrder[ count++ ] != field.getTag() )
       if ( doValidation ) throw InvalidMessage("Header fields out of order");
 
@@ -298,20 +340,26 @@ throw( InvalidMessage )
       }
 
       if ( field.getTag() == FIELD::MsgType )
-        msg = field.getString();
+        field.copyValueTo( msg );
 
-      m_header.setField( field, false );
+      bool repeated;
+      const FieldBase& stored = m_header.addFieldView( field, repeated );
 
       if ( pSessionDataDictionary )
-        setGroup( "_header_", field, string, pos, getHeader(), *pSessionDataDictionary );
+        setGroup( "_header_", field, pos, getHeader(), *pSessionDataDictionary );
+      if ( pFieldValidation )
+        pFieldValidation->checkHeader( stored, m_header, repeated );
     }
     else if ( isTrailerField( field, pSessionDataDictionary ) )
     {
       type = trailer;
-      m_trailer.setField( field, false );
+      bool repeated;
+      const FieldBase& stored = m_trailer.addFieldView( field, repeated );
 
       if ( pSessionDataDictionary )
-        setGroup( "_trailer_", field, string, pos, getTrailer(), *pSessionDataDictionary );
+        setGroup( "_trailer_", field, pos, getTrailer(), *pSessionDataDictionary );
+      if ( pFieldValidation )
+        pFieldValidation->checkTrailer( stored, m_trailer, repeated );
     }
     else
     {
@@ -322,10 +370,14 @@ throw( InvalidMessage )
       }
 
       type = body;
-      setField( field, false );
+      bool repeated;
+      const FieldBase& stored = addFieldView( field, repeated );
 
       if ( pApplicationDataDictionary )
-        setGroup( msg, field, string, pos, *this, *pApplicationDataDictionary );
+        setGroup( msg, field, pos, *this, *pApplicationDataDictionary );
+      // after its groups have been read so their count can be checked
+      if ( pFieldValidation )
+        pFieldValidation->checkBody( stored, *this, msg, repeated );
     }
   }
 
@@ -333,8 +385,48 @@ throw( InvalidMessage )
     validate();
 }
 
+void Message::setString( const std::string& string,
+                         const DataDictionary& sessionDataDictionary,
+                         const DataDictionary& applicationDataDictionary,
+                         bool validate,
+                         DataDictionary::FieldValidation* pFieldValidation )
+throw( InvalidMessage )
+{
+  clear();
+  m_raw = string;
+  parseString( sessionDataDictionary, applicationDataDictionary,
+               validate, pFieldValidation );
+}
+
+void Message::setString( const char* data, std::string::size_type length,
+                         const DataDictionary& sessionDataDictionary,
+                         const DataDictionary& applicationDataDictionary,
+                         bool validate,
+                         DataDictionary::FieldValidation* pFieldValidation )
+throw( InvalidMessage )
+{
+  clear();
+  m_raw.assign( data, length );
+  parseString( sessionDataDictionary, applicationDataDictionary,
+               validate, pFieldValidation );
+}
+
+void Message::parseString( const DataDictionary& sessionDataDictionary,
+                           const DataDictionary& applicationDataDictionary,
+                           bool validate,
+                           DataDictionary::FieldValidation* pFieldValidation )
+{
+  // the header tells which dictionary the body is read with
+  parseHeader();
+  bool admin = isAdmin();
+  clear();
+  if( admin )
+    parseString( validate, &sessionDataDictionary, &sessionDataDictionary, pFieldValidation );
+  else
+    parseString( validate, &sessionDataDictionary, &applicationDataDictionary, pFieldValidation );
+}
+
 void Message::setGroup( const std::string& msg, const FieldBase& field,
-                        const std::string& string,
                         std::string::size_type& pos, FieldMap& map,
                         const DataDictionary& dataDictionary )
 {
@@ -342,61 +434,272 @@ void Message::setGroup( const std::string& msg, const FieldBase& field,
   int delim;
   const DataDictionary* pDD = 0;
   if ( !dataDictionary.getGroup( msg, group, delim, pDD ) ) return ;
-  std::auto_ptr<Group> pGroup;
+  FieldMap* pGroup = 0;
 
-  while ( pos < string.size() )
+  try
   {
-    std::string::size_type oldPos = pos;
-    FieldBase field = extractField( string, pos, &dataDictionary, &dataDictionary, pGroup.get() );
-       
-    // Start a new group because...
-    if (// found delimiter
-    (field.getTag() == delim) ||
-    // no delimiter, but field belongs to group OR field already processed
-    (pDD->isField( field.getTag() ) && (pGroup.get() == 0 || pGroup->isSetField( field.getTag() )) ))
+    while ( pos < m_raw.size() )
     {
-      if ( pGroup.get() )
+      std::string::size_type oldPos = pos;
+      FieldBase field = extractField( pos, &dataDictionary, &dataDictionary, pGroup );
+
+      // Start a new group because...
+      if (// found delimiter
+      (field.getTag() == delim) ||
+      // no delimiter, but field belongs to group OR field already processed
+      (pDD->isField( field.getTag() ) && (pGroup == 0 || pGroup->isSetField( field.getTag() )) ))
       {
-        map.addGroupPtr( group, pGroup.release(), false );
+        if ( pGroup )
+        {
+          map.addGroupPtr( group, pGroup, false );
+        }
+        pGroup = MessagePool::acquireGroup( pDD->getOrderedFields() );
       }
-      pGroup.reset( new Group( field.getTag(), delim, pDD->getOrderedFields() ) );
-    }
-    else if ( !pDD->isField( field.getTag() ) )
-    {
-      if ( pGroup.get() )
+      else if ( !pDD->isField( field.getTag() ) )
       {
-        map.addGroupPtr( group, pGroup.release(), false );
+        if ( pGroup )
+        {
+          map.addGroupPtr( group, pGroup, false );
+        }
+        pos = oldPos;
+        return ;
       }
-      pos = oldPos;
-      return ;
-    }
 
-    if ( !pGroup.get() ) return ;
-    pGroup->setField( field, false );
-    setGroup( msg, field, string, pos, *pGroup, *pDD );
+      if ( !pGroup ) return ;
+      pGroup->addFieldView( field );
+      setGroup( msg, field, pos, *pGroup, *pDD );
+    }
+  }
+  catch( ... )
+  {
+    MessagePool::releaseGroup( pGroup );
+    throw;
   }
+
+  MessagePool::releaseGroup( pGroup );
 }
 
 bool Message::setStringHeader( const std::string& string )
 {
   clear();
+  m_raw = string;
+  return parseHeader();
+}
 
+bool Message::parseHeader()
+{
   std::string::size_type pos = 0;
   int count = 0;
 
-  while ( pos < string.size() )
+  while ( pos < m_raw.size() )
   {
-    FieldBase field = extractField( string, pos );
+    FieldBase field = extractField( pos );
     if ( count < 3 && headerOrder[ count++ ] != field.getTag() )
       return false;
 
     if ( isHeaderField( field ) )
-      m_header.setField( field, false );
+      m_header.addFieldView( field );
     else break;
   }
   return true;
 }
 
+namespace
+{
+  /// Find the next field of a message string, a data field takes its
+  /// length from the field before it
+  bool nextField( const char*& pos, const char* end, int& tag,
+                  const char*& value, const char*& soh, int& dataLength )
+  {
+    const char* equalSign;
+    CharScanner::field( pos, end, equalSign, soh );
+    if( equalSign == end || !IntConvertor::convert( pos, equalSign, tag ) )
+      return false;
+
+    value = equalSign + 1;
+    if( dataLength >= 0 )
+    {
+      if( end - value <= dataLength || value[ dataLength ] != '\001' )
+        return false;
+      soh = value + dataLength;
+      dataLength = -1;
+    }
+    else if( soh == end )
+      return false;
+
+    if( tag == FIELD::SecureDataLen || tag == FIELD::XmlDataLen )
+    {
+      if( !IntConvertor::convert( value, soh, dataLength ) || dataLength < 0 )
+        return false;
+    }
+    return true;
+  }
+
+  /// SecureData is not a header field on its own but follows SecureDataLen
+  bool isStoredHeaderField( int tag )
+  { return tag == FIELD::SecureData || Message::isHeaderField( tag ); }
+}
+
+bool Message::readHeader( const std::string& message,
+                          std::string& msgType, int& msgSeqNum )
+{
+  const char* pos = message.data();
+  const char* const end = pos + message.size();
+  bool haveMsgType = false;
+  bool haveMsgSeqNum = false;
+  int dataLength = -1;
+
+  for( int count = 0; pos != end; ++count )
+  {
+    int tag = 0;
+    const char* value;
+    const char* soh;
+    if( !nextField( pos, end, tag, value, soh, dataLength ) )
+      return false;
+    if( count < 3 ? headerOrder[ count ] != tag : !isStoredHeaderField( tag ) )
+      break;
+
+    if( tag == FIELD::MsgType )
+    {
+      msgType.assign( value, soh );
+      haveMsgType = true;
+    }
+    else if( tag == FIELD::MsgSeqNum )
+    {
+      if( !IntConvertor::convert( value, soh, msgSeqNum ) )
+        return false;
+      haveMsgSeqNum = true;
+    }
+    pos = soh + 1;
+  }
+
+  return haveMsgType && haveMsgSeqNum;
+}
+
+bool Message::toPossDup( const std::string& message,
+                         const std::string& sendingTime,
+                         std::string& result,
+                         std::string::size_type& start )
+{
+  std::string::size_type checkSumPos = message.rfind( "\001" "10=" );
+  if( checkSumPos == std::string::npos )
+    return false;
+
+  const char* pos = message.data();
+  const char* const end = pos + checkSumPos + 1;
+  const char* beginString = 0;
+  const char* beginStringEnd = 0;
+  const char* origSendingTime = 0;
+  const char* origSendingTimeEnd = 0;
+  bool possDupWritten = false;
+  bool origSendingTimeWritten = false;
+  int dataLength = -1;
+
+  // written behind a gap for BeginString and BodyLength as encode does
+  const std::string::size_type reserved = 32;
+  result.reserve( reserved + message.size() + 2 * sendingTime.size() + 16 );
+  result.assign( reserved, '\0' );
+
+  for( int count = 0; pos != end; ++count )
+  {
+    int tag = 0;
+    const char* value;
+    const char* soh;
+    if( !nextField( pos, end, tag, value, soh, dataLength ) )
+      return false;
+    if( count < 3 && headerOrder[ count ] != tag )
+      return false;
+    if( count >= 3 && !isStoredHeaderField( tag ) )
+      break;
+
+    // header fields are in tag order, the new ones go where they belong
+    if( tag > FIELD::PossDupFlag && !possDupWritten )
+    {
+      result.append( "43=Y\001" );
+      possDupWritten = true;
+    }
+    if( tag > FIELD::OrigSendingTime && !origSendingTimeWritten
+        && origSendingTime )
+    {
+      result.append( "122=" );
+      result.append( origSendingTime, origSendingTimeEnd );
+      result.append( 1, '\001' );
+      origSendingTimeWritten = true;
+    }
+
+    switch( tag )
+    {
+      case FIELD::BeginString:
+      beginString = value;
+      beginStringEnd = soh;
+      break;
+      case FIELD::BodyLength:
+      break;
+      case FIELD::PossDupFlag:
+      if( !possDupWritten )
+        result.append( "43=Y\001" );
+      possDupWritten = true;
+      break;
+      case FIELD::SendingTime:
+      origSendingTime = value;
+      origSendingTimeEnd = soh;
+      result.append( "52=" );
+      result.append( sendingTime );
+      result.append( 1, '\001' );
+      break;
+      case FIELD::OrigSendingTime:
+      if( !origSendingTime )
+        return false;
+      result.append( "122=" );
+      result.append( origSendingTime, origSendingTimeEnd );
+      result.append( 1, '\001' );
+      origSendingTimeWritten = true;
+      break;
+      default:
+      result.append( pos, soh + 1 );
+    }
+    pos = soh + 1;
+  }
+
+  if( !beginString || !origSendingTime )
+    return false;
+  if( !possDupWritten )
+    result.append( "43=Y\001" );
+  if( !origSendingTimeWritten )
+  {
+    result.append( "122=" );
+    result.append( origSendingTime, origSendingTimeEnd );
+    result.append( 1, '\001' );
+  }
+  result.append( pos, end );
+
+  const std::string::size_type version = beginStringEnd - beginString;
+  const int length = (int)( result.size() - reserved );
+  char lengthBuffer[ 16 ];
+  const char* digits =
+    integer_to_string( lengthBuffer, sizeof(lengthBuffer), length );
+  const std::string::size_type digitsSize =
+    lengthBuffer + sizeof(lengthBuffer) - 1 - digits;
+  if( version + digitsSize + 6 > reserved )
+    return false;
+
+  start = reserved - version - digitsSize - 6;
+  char* p = &result[ start ];
+  *p++ = '8'; *p++ = '=';
+  memcpy( p, beginString, version ); p += version;
+  *p++ = '\001'; *p++ = '9'; *p++ = '=';
+  memcpy( p, digits, digitsSize ); p += digitsSize;
+  *p = '\001';
+
+  const int checksum = (int)( CharScanner::sum( result.data() + start,
+                                                result.data() + result.size() ) % 256 );
+  char checksumBuffer[ 8 ] = { '1', '0', '=' };
+  integer_to_string_padded( checksumBuffer + 3, 4, checksum, 3 );
+  checksumBuffer[ 6 ] = '\001';
+  result.append( checksumBuffer, 7 );
+  return true;
+}
+
 bool Message::isHeaderField( int field )
 {
   switch ( field )
@@ -493,7 +796,13 @@ void Message::validate()
     const BodyLength& aBodyLength = FIELD_GET_REF( m_header, BodyLength );
 
     const int expectedLength = (int)aBodyLength;
-    const int actualLength = bodyLength();
+    int actualLength = 0;
+    int actualChecksum = 0;
+    if( !calculateFromString( actualLength, actualChecksum ) )
+    {
+      actualLength = bodyLength();
+      actualChecksum = -1;
+    }
 
     if ( expectedLength != actualLength )
     {
@@ -506,7 +815,8 @@ void Message::validate()
     const CheckSum& aCheckSum = FIELD_GET_REF( m_trailer, CheckSum );
 
     const int expectedChecksum = (int)aCheckSum;
-    const int actualChecksum = checkSum();
+    if( actualChecksum < 0 )
+      actualChecksum = checkSum();
 
     if ( expectedChecksum != actualChecksum )
     {
@@ -528,23 +838,121 @@ void Message::validate()
   }
 }
 
-FIX::FieldBase Message::extractField( const std::string& string, std::string::size_type& pos, 
+bool Message::encode( std::string& str, std::string::size_type& start ) const
+{
+  // Fields are written in a single pass behind a gap that is big enough
+  // for BeginString and any BodyLength. Once the length is known they are
+  // written right aligned into the gap, so the message begins at start,
+  // and the checksum is taken from the bytes that were produced. Anything
+  // but a leading BeginString followed by at most one BodyLength is left
+  // to the field by field calculation.
+  FieldMap::iterator headerBegin = m_header.begin();
+  if( headerBegin == m_header.end()
+      || headerBegin->first != FIELD::BeginString )
+    return false;
+  const FieldBase& beginString = headerBegin->second;
+  if( ++headerBegin != m_header.end()
+      && headerBegin->first == FIELD::BodyLength )
+    ++headerBegin;
+  if( headerBegin != m_header.end()
+      && headerBegin->first == FIELD::BodyLength )
+    return false;
+
+  FieldMap::iterator trailerEnd = m_trailer.end();
+  if( trailerEnd != m_trailer.begin() )
+  {
+    FieldMap::iterator last = trailerEnd;
+    if( (--last)->first == FIELD::CheckSum )
+    {
+      trailerEnd = last;
+      if( last != m_trailer.begin() && (--last)->first == FIELD::CheckSum )
+        return false;
+    }
+  }
+
+  const std::string& version = beginString.getString();
+  // 8= value SOH 9= up to ten digits SOH
+  const std::string::size_type reserved = version.size() + 16;
+
+  str.reserve( reserved + m_raw.size() + 256 );
+  str.assign( reserved, '\0' );
+  m_header.appendFields( str, headerBegin, m_header.end() );
+  FieldMap::appendFields( str, begin(), end() );
+  m_trailer.appendFields( str, m_trailer.begin(), trailerEnd );
+
+  const int length = (int)( str.size() - reserved );
+  char lengthBuffer[ 16 ];
+  const char* digits =
+    integer_to_string( lengthBuffer, sizeof(lengthBuffer), length );
+  const std::string::size_type digitsSize =
+    lengthBuffer + sizeof(lengthBuffer) - 1 - digits;
+
+  start = reserved - version.size() - digitsSize - 6;
+  char* p = &str[ start ];
+  *p++ = '8'; *p++ = '=';
+  memcpy( p, version.data(), version.size() ); p += version.size();
+  *p++ = '\001'; *p++ = '9'; *p++ = '=';
+  memcpy( p, digits, digitsSize ); p += digitsSize;
+  *p = '\001';
+
+  const int checksum = (int)( CharScanner::sum( str.data() + start,
+                                                str.data() + str.size() ) % 256 );
+  char checksumBuffer[ 8 ] = { '1', '0', '=' };
+  integer_to_string_padded( checksumBuffer + 3, 4, checksum, 3 );
+  checksumBuffer[ 6 ] = '\001';
+  str.append( checksumBuffer, 7 );
+
+  m_header.setField( IntField(FIELD::BodyLength, length) );
+  m_trailer.setField( CheckSumField(FIELD::CheckSum, checksum) );
+  return true;
+}
+
+bool Message::calculateFromString( int& length, int& checksum ) const
+{
+  // The parsed string can be used instead of the fields when it starts
+  // with BeginString and BodyLength, ends with CheckSum and none of them
+  // are repeated, which is what a well formed message looks like.
+  FieldMap::iterator i = m_header.begin();
+  if( i == m_header.end() || i->first != FIELD::BeginString ) return false;
+  const FieldBase& beginString = i->second;
+  if( ++i == m_header.end() || i->first != FIELD::BodyLength ) return false;
+  const FieldBase& bodyLength = i->second;
+  if( ++i != m_header.end() && i->first == FIELD::BodyLength ) return false;
+
+  i = m_trailer.end();
+  if( i == m_trailer.begin() || (--i)->first != FIELD::CheckSum ) return false;
+  const FieldBase& checkSum = i->second;
+  if( i != m_trailer.begin() && (--i)->first == FIELD::CheckSum ) return false;
+
+  const char* const begin = m_raw.data();
+  if( beginString.m_pField != begin
+      || bodyLength.m_pField != beginString.m_pEnd
+      || checkSum.m_pEnd != begin + m_raw.size() )
+    return false;
+
+  length = (int)( checkSum.m_pField - bodyLength.m_pEnd );
+  checksum = (int)( CharScanner::sum( begin, checkSum.m_pField ) % 256 );
+  return true;
+}
+
+FIX::FieldBase Message::extractField( std::string::size_type& pos,
                                       const DataDictionary* pSessionDD /*= 0*/, const DataDictionary* pAppDD /*= 0*/, 
-                                      const Group* pGroup /*= 0*/ )
+                                      const FieldMap* pGroup /*= 0*/ )
 {
-  std::string::const_iterator const tagStart = string.begin() + pos;
-  std::string::const_iterator const strEnd = string.end();
+  const char* const tagStart = m_raw.data() + pos;
+  const char* const strEnd = m_raw.data() + m_raw.size();
 
-  std::string::const_iterator const equalSign = std::find( tagStart, strEnd, '=' );
+  const char* equalSign;
+  const char* soh;
+  CharScanner::field( tagStart, strEnd, equalSign, soh );
   if( equalSign == strEnd )
     throw InvalidMessage("Equal sign not found in field");
 
   int field = 0;
   IntConvertor::convert( tagStart, equalSign, field );
 
-  std::string::const_iterator const valueStart = equalSign + 1;
+  const char* const valueStart = equalSign + 1;
 
-  std::string::const_iterator soh = std::find( valueStart, strEnd, '\001' );
   if ( soh == strEnd )
     throw InvalidMessage("SOH not found at end of field");
 
@@ -577,16 +985,18 @@ FIX::FieldBase Message::extractField( const std::string& string, std::string::si
         soh = valueStart + atol( fieldLength.c_str() );
       }
     }
+
+    if ( soh < valueStart || soh >= strEnd )
+      throw InvalidMessage("SOH not found at end of field");
   }
 
-  std::string::const_iterator const tagEnd = soh + 1;
-  pos = std::distance( string.begin(), tagEnd );
+  const char* const tagEnd = soh + 1;
+  pos = tagEnd - m_raw.data();
 
   return FieldBase (
     field,
+    tagStart,
     valueStart,
-    soh,
-    tagStart, 
     tagEnd );
 }
 }
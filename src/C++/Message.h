@@ -141,6 +141,9 @@ public:
                          int beginStringField = FIELD::BeginString,
                          int bodyLengthField = FIELD::BodyLength, 
                          int checkSumField = FIELD::CheckSum ) const;
+  /// Get a string representation written into a buffer, the message
+  /// starts at the returned offset instead of being moved to the front
+  std::string::size_type toBuffer( std::string& ) const;
   /// Get a XML representation of the message
   std::string toXML() const;
   /// Get a XML representation without making a copy
@@ -171,14 +174,54 @@ public:
   throw( InvalidMessage )
   { setString(string, validate, pDataDictionary, pDataDictionary); }
 
+  /**
+   * Set a message based on a string representation using a session and
+   * application data dictionary.  If given pFieldValidation applies the
+   * field checks of DataDictionary::validate while the fields are read.
+   */
   void setString( const std::string& string,
                   bool validate,
                   const FIX::DataDictionary* pSessionDataDictionary,
-                  const FIX::DataDictionary* pApplicationDataDictionary )
+                  const FIX::DataDictionary* pApplicationDataDictionary,
+                  DataDictionary::FieldValidation* pFieldValidation = 0 )
+  throw( InvalidMessage );
+
+  /**
+   * Set a message based on a string representation using a session and
+   * application data dictionary.  Like the matching constructor the
+   * application dictionary is only used for application messages, which
+   * lets a message object be reused for every message of a session.
+   */
+  void setString( const std::string& string,
+                  const FIX::DataDictionary& sessionDataDictionary,
+                  const FIX::DataDictionary& applicationDataDictionary,
+                  bool validate = true,
+                  DataDictionary::FieldValidation* pFieldValidation = 0 )
+  throw( InvalidMessage );
+
+  /**
+   * Set a message from a buffer that only has to be valid during the
+   * call, such as a message framed by the Parser.  The buffer is copied
+   * once, into the string the parsed fields refer to.
+   */
+  void setString( const char* data, std::string::size_type length,
+                  bool validate,
+                  const FIX::DataDictionary* pSessionDataDictionary,
+                  const FIX::DataDictionary* pApplicationDataDictionary,
+                  DataDictionary::FieldValidation* pFieldValidation )
+  throw( InvalidMessage );
+  void setString( const char* data, std::string::size_type length,
+                  const FIX::DataDictionary& sessionDataDictionary,
+                  const FIX::DataDictionary& applicationDataDictionary,
+                  bool validate,
+                  DataDictionary::FieldValidation* pFieldValidation )
   throw( InvalidMessage );
 
+  /// String the message was last set from
+  const std::string& getRawString() const { return m_raw; }
+
   void setGroup( const std::string& msg, const FieldBase& field,
-                 const std::string& string, std::string::size_type& pos,
+                 std::string::size_type& pos,
                  FieldMap& map, const DataDictionary& dataDictionary );
 
   /**
@@ -242,6 +285,7 @@ public:
   void clear()
   { 
     m_tag = 0;
+    m_validStructure = true;
     m_header.clear();
     FieldMap::clear();
     m_trailer.clear();
@@ -254,6 +298,20 @@ public:
              msgType.getValue().c_str() [ 0 ] ) != 0;
   }
 
+  /// MsgType packed one byte per character into an integer to switch
+  /// on, "AE" becomes 'A' * 256 + 'E'.  Types longer than three
+  /// characters have no key and give -1.
+  static int msgTypeKey( const std::string& msgType )
+  {
+    std::string::size_type length = msgType.length();
+    if( !length || length > 3 ) return -1;
+
+    int key = 0;
+    for( std::string::size_type i = 0; i < length; ++i )
+      key = key * 256 + (unsigned char)msgType[ i ];
+    return key;
+  }
+
   static ApplVerID toApplVerID(const BeginString& value)
   {
     if( value == BeginString_FIX40 )
@@ -305,6 +363,21 @@ public:
   static bool isTrailerField( const FieldBase& field,
                               const DataDictionary* pD = 0 );
 
+  /// Read MsgType and MsgSeqNum from the header of a message string
+  /// without parsing the message, false if either is missing
+  static bool readHeader( const std::string& message,
+                          std::string& msgType, int& msgSeqNum );
+
+  /// Copy a stored message for resending as a possible duplicate.
+  /// PossDupFlag is set, the old SendingTime becomes OrigSendingTime and
+  /// sendingTime takes its place, with BodyLength and CheckSum worked out
+  /// again.  The body is copied as it is and the copy begins at start in
+  /// result.  False if the header can't be read or has no SendingTime.
+  static bool toPossDup( const std::string& message,
+                         const std::string& sendingTime,
+                         std::string& result,
+                         std::string::size_type& start );
+
   /// Returns the session ID of the intended recipient
   SessionID getSessionID( const std::string& qualifier = "" ) const
   throw( FieldNotFound );
@@ -313,9 +386,9 @@ public:
 
 private:
   FieldBase extractField( 
-    const std::string& string, std::string::size_type& pos,
+    std::string::size_type& pos,
     const DataDictionary* pSessionDD = 0, const DataDictionary* pAppDD = 0,
-    const Group* pGroup = 0);
+    const FieldMap* pGroup = 0);
 
   static bool IsDataField( 
     int field, 
@@ -331,7 +404,19 @@ private:
     return false;
   }
 
+  void parseString( bool validate,
+                    const DataDictionary* pSessionDataDictionary,
+                    const DataDictionary* pApplicationDataDictionary,
+                    DataDictionary::FieldValidation* pFieldValidation );
+  void parseString( const DataDictionary& sessionDataDictionary,
+                    const DataDictionary& applicationDataDictionary,
+                    bool validate,
+                    DataDictionary::FieldValidation* pFieldValidation );
+  bool parseHeader();
+
   void validate();
+  bool calculateFromString( int& length, int& checksum ) const;
+  bool encode( std::string& str, std::string::size_type& start ) const;
   std::string toXMLFields(const FieldMap& fields, int space) const;
 
 protected:
@@ -339,6 +424,8 @@ protected:
   mutable Trailer m_trailer;
   bool m_validStructure;
   int m_tag;
+  /// Received message which parsed fields refer to
+  std::string m_raw;
   static std::auto_ptr<DataDictionary> s_dataDictionary;
 };
 /*! @} */
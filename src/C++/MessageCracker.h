@@ -65,16 +65,29 @@ public:
               const SessionID& sessionID,
               const BeginString& beginString )
   {
-    if ( beginString == BeginString_FIX40 )
-      ((FIX40::MessageCracker&)(*this)).crack((const FIX40::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX41 )
-      ((FIX41::MessageCracker&)(*this)).crack((const FIX41::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX42 )
-      ((FIX42::MessageCracker&)(*this)).crack((const FIX42::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX43 )
-      ((FIX43::MessageCracker&)(*this)).crack((const FIX43::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX44 )
-      ((FIX44::MessageCracker&)(*this)).crack((const FIX44::Message&) message, sessionID);
+    // FIX.4.x versions differ in their last character only
+    const std::string& value = beginString.getString();
+    if ( value.length() == 7 && value.compare( 0, 6, "FIX.4." ) == 0 )
+    {
+      switch ( value[ 6 ] )
+      {
+      case '0':
+        ((FIX40::MessageCracker&)(*this)).crack((const FIX40::Message&) message, sessionID);
+        break;
+      case '1':
+        ((FIX41::MessageCracker&)(*this)).crack((const FIX41::Message&) message, sessionID);
+        break;
+      case '2':
+        ((FIX42::MessageCracker&)(*this)).crack((const FIX42::Message&) message, sessionID);
+        break;
+      case '3':
+        ((FIX43::MessageCracker&)(*this)).crack((const FIX43::Message&) message, sessionID);
+        break;
+      case '4':
+        ((FIX44::MessageCracker&)(*this)).crack((const FIX44::Message&) message, sessionID);
+        break;
+      }
+    }
     else if ( beginString == BeginString_FIXT11 )
     {
       if( message.isAdmin() )
@@ -99,22 +112,38 @@ public:
               const SessionID& sessionID,
               const ApplVerID& applVerID )
   {
-    if ( applVerID == ApplVerID_FIX40 )
+    // every ApplVerID cracked here is a single digit
+    const std::string& value = applVerID.getString();
+    if ( value.length() != 1 )
+      return;
+
+    switch ( value[ 0 ] )
+    {
+    case '2': // ApplVerID_FIX40
       ((FIX40::MessageCracker&)(*this)).crack((const FIX40::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX41 )
+      break;
+    case '3': // ApplVerID_FIX41
       ((FIX41::MessageCracker&)(*this)).crack((const FIX41::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX42 )
+      break;
+    case '4': // ApplVerID_FIX42
       ((FIX42::MessageCracker&)(*this)).crack((const FIX42::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX43 )
+      break;
+    case '5': // ApplVerID_FIX43
       ((FIX43::MessageCracker&)(*this)).crack((const FIX43::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX44 )
+      break;
+    case '6': // ApplVerID_FIX44
       ((FIX44::MessageCracker&)(*this)).crack((const FIX44::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50 )
+      break;
+    case '7': // ApplVerID_FIX50
       ((FIX50::MessageCracker&)(*this)).crack((const FIX50::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP1 )
+      break;
+    case '8': // ApplVerID_FIX50SP1
       ((FIX50SP1::MessageCracker&)(*this)).crack((const FIX50SP1::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP2 )
+      break;
+    case '9': // ApplVerID_FIX50SP2
       ((FIX50SP2::MessageCracker&)(*this)).crack((const FIX50SP2::Message&) message, sessionID);
+      break;
+    }
   }
 
   void crack( Message& message,
@@ -130,16 +159,29 @@ public:
               const SessionID& sessionID,
               const BeginString& beginString )
   {
-    if ( beginString == BeginString_FIX40 )
-      ((FIX40::MessageCracker&)(*this)).crack((FIX40::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX41 )
-      ((FIX41::MessageCracker&)(*this)).crack((FIX41::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX42 )
-      ((FIX42::MessageCracker&)(*this)).crack((FIX42::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX43 )
-      ((FIX43::MessageCracker&)(*this)).crack((FIX43::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX44 )
-      ((FIX44::MessageCracker&)(*this)).crack((FIX44::Message&) message, sessionID);
+    // FIX.4.x versions differ in their last character only
+    const std::string& value = beginString.getString();
+    if ( value.length() == 7 && value.compare( 0, 6, "FIX.4." ) == 0 )
+    {
+      switch ( value[ 6 ] )
+      {
+      case '0':
+        ((FIX40::MessageCracker&)(*this)).crack((FIX40::Message&) message, sessionID);
+        break;
+      case '1':
+        ((FIX41::MessageCracker&)(*this)).crack((FIX41::Message&) message, sessionID);
+        break;
+      case '2':
+        ((FIX42::MessageCracker&)(*this)).crack((FIX42::Message&) message, sessionID);
+        break;
+      case '3':
+        ((FIX43::MessageCracker&)(*this)).crack((FIX43::Message&) message, sessionID);
+        break;
+      case '4':
+        ((FIX44::MessageCracker&)(*this)).crack((FIX44::Message&) message, sessionID);
+        break;
+      }
+    }
     else if ( beginString == BeginString_FIXT11 )
     {
       if( message.isAdmin() )
@@ -164,22 +206,38 @@ public:
               const SessionID& sessionID,
               const ApplVerID& applVerID )
   {
-    if ( applVerID == ApplVerID_FIX40 )
+    // every ApplVerID cracked here is a single digit
+    const std::string& value = applVerID.getString();
+    if ( value.length() != 1 )
+      return;
+
+    switch ( value[ 0 ] )
+    {
+    case '2': // ApplVerID_FIX40
       ((FIX40::MessageCracker&)(*this)).crack((FIX40::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX41 )
+      break;
+    case '3': // ApplVerID_FIX41
       ((FIX41::MessageCracker&)(*this)).crack((FIX41::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX42 )
+      break;
+    case '4': // ApplVerID_FIX42
       ((FIX42::MessageCracker&)(*this)).crack((FIX42::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX43 )
+      break;
+    case '5': // ApplVerID_FIX43
       ((FIX43::MessageCracker&)(*this)).crack((FIX43::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX44 )
+      break;
+    case '6': // ApplVerID_FIX44
       ((FIX44::MessageCracker&)(*this)).crack((FIX44::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50 )
+      break;
+    case '7': // ApplVerID_FIX50
       ((FIX50::MessageCracker&)(*this)).crack((FIX50::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP1 )
+      break;
+    case '8': // ApplVerID_FIX50SP1
       ((FIX50SP1::MessageCracker&)(*this)).crack((FIX50SP1::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP2 )
+      break;
+    case '9': // ApplVerID_FIX50SP2
       ((FIX50SP2::MessageCracker&)(*this)).crack((FIX50SP2::Message&) message, sessionID);
+      break;
+    }
   }
 
 };
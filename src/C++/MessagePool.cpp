@@ -0,0 +1,122 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "MessagePool.h"
+#include "Message.h"
+#include "Utility.h"
+#include <typeinfo>
+
+namespace FIX
+{
+namespace
+{
+struct FreeLists
+{
+  ~FreeLists()
+  {
+    std::vector<Message*>::iterator i;
+    for( i = messages.begin(); i != messages.end(); ++i )
+      delete *i;
+    std::vector<FieldMap*>::iterator j;
+    for( j = groups.begin(); j != groups.end(); ++j )
+      delete *j;
+  }
+
+  std::vector<Message*> messages;
+  std::vector<FieldMap*> groups;
+};
+
+ThreadLocal<FreeLists> s_freeLists;
+}
+
+Message* MessagePool::acquire()
+{
+  FreeLists* pLists = s_freeLists.get();
+  if( !pLists || pLists->messages.empty() )
+    return new Message;
+
+  Message* pMessage = pLists->messages.back();
+  pLists->messages.pop_back();
+  return pMessage;
+}
+
+void MessagePool::release( Message* pMessage )
+{
+  if( !pMessage ) return;
+
+  FreeLists* pLists = s_freeLists.get();
+  if( !pLists
+      || pLists->messages.size() >= MAX_MESSAGES
+      || typeid( *pMessage ) != typeid( Message ) )
+  {
+    delete pMessage;
+    return;
+  }
+
+  pMessage->clear();
+  pLists->messages.push_back( pMessage );
+}
+
+FieldMap* MessagePool::acquireGroup( const message_order& order )
+{
+  FreeLists* pLists = s_freeLists.get();
+  if( !pLists || pLists->groups.empty() )
+    return new FieldMap( order );
+
+  FieldMap* pGroup = pLists->groups.back();
+  pLists->groups.pop_back();
+  pGroup->m_fields.setOrder( order );
+  return pGroup;
+}
+
+FieldMap* MessagePool::acquireGroup( const FieldMap& group )
+{
+  FreeLists* pLists = s_freeLists.get();
+  if( !pLists || pLists->groups.empty() )
+    return new FieldMap( group );
+
+  FieldMap* pGroup = pLists->groups.back();
+  pLists->groups.pop_back();
+  *pGroup = group;
+  return pGroup;
+}
+
+void MessagePool::releaseGroup( FieldMap* pGroup )
+{
+  if( !pGroup ) return;
+
+  FreeLists* pLists = s_freeLists.get();
+  if( !pLists
+      || pLists->groups.size() >= MAX_GROUPS
+      || typeid( *pGroup ) != typeid( FieldMap ) )
+  {
+    delete pGroup;
+    return;
+  }
+
+  pGroup->clear();
+  pLists->groups.push_back( pGroup );
+}
+}
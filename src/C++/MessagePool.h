@@ -0,0 +1,80 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_MESSAGEPOOL_H
+#define FIX_MESSAGEPOOL_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+namespace FIX
+{
+class Message;
+class FieldMap;
+struct message_order;
+
+/**
+ * Recycles messages and repeating groups.
+ *
+ * A released object is cleared but keeps the memory of its fields, so
+ * parsing into recycled objects stops allocating once the pool is warm.
+ * Every thread has its own free lists and never takes a lock.  An object
+ * may be released on another thread than the one that acquired it, it is
+ * then kept by the releasing thread.  Only plain Message and FieldMap
+ * objects are kept, instances of derived classes are deleted.
+ */
+class MessagePool
+{
+public:
+  /// Get an empty message, it must be given back with release
+  static Message* acquire();
+  static void release( Message* );
+
+  /// Get an empty group sorted by an order
+  static FieldMap* acquireGroup( const message_order& );
+  /// Get a copy of a group
+  static FieldMap* acquireGroup( const FieldMap& );
+  static void releaseGroup( FieldMap* );
+
+  /// Objects kept by each thread, any more are deleted
+  enum { MAX_MESSAGES = 64, MAX_GROUPS = 1024 };
+};
+
+/// Message taken from the pool and given back when going out of scope
+class PooledMessage
+{
+public:
+  PooledMessage() : m_pMessage( MessagePool::acquire() ) {}
+  ~PooledMessage() { MessagePool::release( m_pMessage ); }
+
+  Message& operator*() const { return *m_pMessage; }
+  Message* operator->() const { return m_pMessage; }
+
+private:
+  PooledMessage( const PooledMessage& );
+  PooledMessage& operator=( const PooledMessage& );
+
+  Message* m_pMessage;
+};
+}
+
+#endif //FIX_MESSAGEPOOL_H
@@ -37,6 +37,38 @@ void MemoryStoreFactory::destroy( MessageStore* pStore )
   delete pStore;
 }
 
+void MessageStore::setBatch( const MessageBatch& batch )
+throw( IOException )
+{
+  MessageBatch::const_iterator i;
+  for ( i = batch.begin(); i != batch.end(); ++i )
+    set( i->first, *i->second );
+}
+
+void MessageStore::setNextMsgSeqNums( int sender, int target )
+throw( IOException )
+{
+  setNextSenderMsgSeqNum( sender );
+  setNextTargetMsgSeqNum( target );
+}
+
+void MessageStore::forEach( int begin, int end,
+                            StoredMessageCallback& callback ) const
+throw( IOException )
+{
+  std::vector < std::string > messages;
+  std::vector < std::string > ::const_iterator i;
+  for ( int batch = begin; batch <= end; batch += FOR_EACH_BATCH )
+  {
+    int batchEnd = batch + FOR_EACH_BATCH - 1;
+    if ( batchEnd > end || batchEnd < batch ) batchEnd = end;
+    get( batch, batchEnd, messages );
+    for ( i = messages.begin(); i != messages.end(); ++i )
+      callback.onMessage( *i );
+    if ( batchEnd == end ) break;
+  }
+}
+
 bool MemoryStore::set( int msgSeqNum, const std::string& msg )
 throw( IOException )
 {
@@ -44,6 +76,13 @@ throw( IOException )
   return true;
 }
 
+bool MemoryStore::set( int msgSeqNum, const char* data, size_t size )
+throw( IOException )
+{
+  m_messages[ msgSeqNum ].assign( data, size );
+  return true;
+}
+
 void MemoryStore::get( int begin, int end,
                        std::vector < std::string > & messages ) const
 throw( IOException )
@@ -54,6 +93,15 @@ throw( IOException )
     messages.push_back( find->second );
 }
 
+void MemoryStore::forEach( int begin, int end,
+                           StoredMessageCallback& callback ) const
+throw( IOException )
+{
+  Messages::const_iterator i = m_messages.lower_bound( begin );
+  for ( ; i != m_messages.end() && i->first <= end; ++i )
+    callback.onMessage( i->second );
+}
+
 MessageStore* MessageStoreFactoryExceptionWrapper::create( const SessionID& sessionID, bool& threw, ConfigError& ex )
 {
   threw = false;
@@ -80,6 +128,13 @@ void MessageStoreExceptionWrapper::get( int begin, int end, std::vector < std::s
   catch ( IOException & e ) { threw = true; ex = e; }
 }
 
+void MessageStoreExceptionWrapper::forEach( int begin, int end, StoredMessageCallback& callback, bool& threw, IOException& ex ) const
+{
+  threw = false;
+  try { m_pStore->forEach( begin, end, callback ); }
+  catch ( IOException & e ) { threw = true; ex = e; }
+}
+
 int MessageStoreExceptionWrapper::getNextSenderMsgSeqNum( bool& threw, IOException& ex ) const
 {
   threw = false;
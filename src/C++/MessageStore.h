@@ -59,6 +59,19 @@ public:
   void destroy( MessageStore* );
 };
 
+/// Messages to be stored at once as pairs of sequence number and message
+typedef std::vector < std::pair < int, const std::string* > > MessageBatch;
+
+/// Receives the messages read by MessageStore::forEach
+class StoredMessageCallback
+{
+public:
+  virtual ~StoredMessageCallback() {}
+  /// Called for each stored message in sequence number order, the string
+  /// is only valid during the call
+  virtual void onMessage( const std::string& ) = 0;
+};
+
 /**
  * This interface must be implemented to store and retrieve messages and
  * sequence numbers.
@@ -66,17 +79,35 @@ public:
 class MessageStore
 {
 public:
+  /// Messages read at once by the default forEach
+  enum { FOR_EACH_BATCH = 1024 };
+
   virtual ~MessageStore() {}
 
   virtual bool set( int, const std::string& )
   throw ( IOException ) = 0;
+  /// Store a message that is part of a larger buffer, the default
+  /// copies it into a string of its own
+  virtual bool set( int num, const char* data, size_t size )
+  throw ( IOException )
+  { return set( num, std::string( data, size ) ); }
+  /// Store several messages, implementations may write them all at once
+  virtual void setBatch( const MessageBatch& )
+  throw ( IOException );
   virtual void get( int, int, std::vector < std::string > & ) const
   throw ( IOException ) = 0;
+  /// Pass the messages from begin to end to a callback, holding only a
+  /// bounded batch of them at a time.  The default gets them in batches.
+  virtual void forEach( int, int, StoredMessageCallback& ) const
+  throw ( IOException );
 
   virtual int getNextSenderMsgSeqNum() const throw ( IOException ) = 0;
   virtual int getNextTargetMsgSeqNum() const throw ( IOException ) = 0;
   virtual void setNextSenderMsgSeqNum( int ) throw ( IOException ) = 0;
   virtual void setNextTargetMsgSeqNum( int ) throw ( IOException ) = 0;
+  /// Set both sequence numbers, implementations may write them at once
+  virtual void setNextMsgSeqNums( int sender, int target )
+  throw ( IOException );
   virtual void incrNextSenderMsgSeqNum() throw ( IOException ) = 0;
   virtual void incrNextTargetMsgSeqNum() throw ( IOException ) = 0;
 
@@ -84,6 +115,13 @@ public:
 
   virtual void reset() throw ( IOException ) = 0;
   virtual void refresh() throw ( IOException ) = 0;
+
+  /// Whether changes are held back until they are due to be written
+  virtual bool hasPendingWrites() const throw ( IOException )
+  { return false; }
+  /// Write out held back changes that are due, the session calls this
+  /// about once a second while hasPendingWrites() is true
+  virtual void onTimer() throw ( IOException ) {}
 };
 /*! @} */
 
@@ -99,7 +137,9 @@ public:
   MemoryStore() : m_nextSenderMsgSeqNum( 1 ), m_nextTargetMsgSeqNum( 1 ) {}
 
   bool set( int, const std::string& ) throw ( IOException );
+  bool set( int, const char*, size_t ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  void forEach( int, int, StoredMessageCallback& ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException )
   { return m_nextSenderMsgSeqNum; }
@@ -157,6 +197,7 @@ public:
 
   bool set( int, const std::string&, bool&, IOException& );
   void get( int, int, std::vector < std::string > &, bool&, IOException& ) const;
+  void forEach( int, int, StoredMessageCallback&, bool&, IOException& ) const;
   int getNextSenderMsgSeqNum( bool&, IOException& ) const;
   int getNextTargetMsgSeqNum( bool&, IOException& ) const;
   void setNextSenderMsgSeqNum( int, bool&, IOException& );
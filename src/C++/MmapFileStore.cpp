@@ -0,0 +1,608 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "MmapFileStore.h"
+#include "SessionID.h"
+#include "FieldConvertors.h"
+#include "Utility.h"
+
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#endif
+
+namespace FIX
+{
+namespace
+{
+/// Location of a message inside of the data file
+struct IndexRecord
+{
+  unsigned long long offset;
+  unsigned int size;
+  int msgSeqNum;
+};
+
+/// Length of "%10.10d : %10.10d", the format of the sequence number file
+const size_t SEQNUMS_SIZE = 10 + 3 + 10;
+}
+
+MmapFileStore::MappedFile::MappedFile()
+#ifdef _MSC_VER
+: m_file( INVALID_HANDLE_VALUE ), m_mapping( 0 ),
+#else
+: m_file( -1 ),
+#endif
+  m_data( 0 ), m_size( 0 ) {}
+
+MmapFileStore::MappedFile::~MappedFile()
+{
+  close();
+}
+
+#ifdef _MSC_VER
+
+void MmapFileStore::MappedFile::open( const std::string& fileName, size_t size )
+throw ( IOException )
+{
+  close();
+  m_fileName = fileName;
+  m_file = CreateFileA( fileName.c_str(), GENERIC_READ | GENERIC_WRITE,
+                        FILE_SHARE_READ, 0, OPEN_ALWAYS,
+                        FILE_ATTRIBUTE_NORMAL, 0 );
+  if( m_file == INVALID_HANDLE_VALUE )
+    throw IOException( "Could not open file: " + fileName );
+
+  LARGE_INTEGER fileSize;
+  if( !GetFileSizeEx( m_file, &fileSize ) )
+    throw IOException( "Could not get size of file: " + fileName );
+  m_size = (size_t)fileSize.QuadPart > size ? (size_t)fileSize.QuadPart : size;
+  map();
+}
+
+void MmapFileStore::MappedFile::close()
+{
+  unmap();
+  if( m_file != INVALID_HANDLE_VALUE )
+    CloseHandle( m_file );
+  m_file = INVALID_HANDLE_VALUE;
+  m_size = 0;
+}
+
+void MmapFileStore::MappedFile::map() throw ( IOException )
+{
+  // the file is extended to the size of the mapping if it is smaller
+  unsigned long long size = m_size;
+  m_mapping = CreateFileMappingA( m_file, 0, PAGE_READWRITE,
+                                  (DWORD)( size >> 32 ), (DWORD)size, 0 );
+  if( !m_mapping )
+    throw IOException( "Could not map file: " + m_fileName );
+  m_data = (char*)MapViewOfFile( m_mapping, FILE_MAP_WRITE, 0, 0, m_size );
+  if( !m_data )
+    throw IOException( "Could not map file: " + m_fileName );
+}
+
+void MmapFileStore::MappedFile::unmap()
+{
+  if( m_data ) UnmapViewOfFile( m_data );
+  if( m_mapping ) CloseHandle( m_mapping );
+  m_data = 0;
+  m_mapping = 0;
+}
+
+void MmapFileStore::MappedFile::sync( size_t begin, size_t end )
+throw ( IOException )
+{
+  if( begin < end && !FlushViewOfFile( m_data + begin, end - begin ) )
+    throw IOException( "Unable to flush file " + m_fileName );
+  if( !FlushFileBuffers( m_file ) )
+    throw IOException( "Unable to flush file " + m_fileName );
+}
+
+#else
+
+void MmapFileStore::MappedFile::open( const std::string& fileName, size_t size )
+throw ( IOException )
+{
+  close();
+  m_fileName = fileName;
+  m_file = ::open( fileName.c_str(), O_RDWR | O_CREAT, 0644 );
+  if( m_file < 0 )
+    throw IOException( "Could not open file: " + fileName );
+
+  struct stat fileStat;
+  if( fstat( m_file, &fileStat ) != 0 )
+    throw IOException( "Could not get size of file: " + fileName );
+  m_size = (size_t)fileStat.st_size;
+  if( m_size < size )
+  {
+    if( ftruncate( m_file, size ) != 0 )
+      throw IOException( "Could not resize file: " + fileName );
+    m_size = size;
+  }
+  map();
+}
+
+void MmapFileStore::MappedFile::close()
+{
+  unmap();
+  if( m_file >= 0 )
+    ::close( m_file );
+  m_file = -1;
+  m_size = 0;
+}
+
+void MmapFileStore::MappedFile::map() throw ( IOException )
+{
+  void* data = mmap( 0, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0 );
+  if( data == MAP_FAILED )
+    throw IOException( "Could not map file: " + m_fileName );
+  m_data = (char*)data;
+}
+
+void MmapFileStore::MappedFile::unmap()
+{
+  if( m_data ) munmap( m_data, m_size );
+  m_data = 0;
+}
+
+void MmapFileStore::MappedFile::sync( size_t begin, size_t end )
+throw ( IOException )
+{
+  if( begin >= end ) return;
+
+  static const size_t pageSize = (size_t)sysconf( _SC_PAGESIZE );
+  begin -= begin % pageSize;
+  if( msync( m_data + begin, end - begin, MS_SYNC ) != 0 )
+    throw IOException( "Unable to flush file " + m_fileName );
+}
+
+#endif
+
+void MmapFileStore::MappedFile::resize( size_t size ) throw ( IOException )
+{
+  if( size <= m_size ) return;
+
+  unmap();
+#ifndef _MSC_VER
+  if( ftruncate( m_file, size ) != 0 )
+    throw IOException( "Could not resize file: " + m_fileName );
+#endif
+  m_size = size;
+  map();
+}
+
+MmapFileStore::MmapFileStore( std::string path, const SessionID& s,
+                              size_t segmentSize, int syncCount, int syncInterval )
+: m_dataEnd( 0 ), m_indexEnd( 0 ), m_dataSynced( 0 ), m_indexSynced( 0 ),
+  m_segmentSize( segmentSize ? segmentSize : DEFAULT_SEGMENT_SIZE ),
+  m_syncCount( syncCount ), m_syncInterval( syncInterval ), m_unsynced( 0 )
+{
+  file_mkdir( path.c_str() );
+
+  if ( path.empty() ) path = ".";
+  const std::string& begin =
+    s.getBeginString().getString();
+  const std::string& sender =
+    s.getSenderCompID().getString();
+  const std::string& target =
+    s.getTargetCompID().getString();
+  const std::string& qualifier =
+    s.getSessionQualifier();
+
+  std::string sessionid = begin + "-" + sender + "-" + target;
+  if( qualifier.size() )
+    sessionid += "-" + qualifier;
+
+  std::string prefix
+    = file_appendpath(path, sessionid + ".");
+
+  m_dataFileName = prefix + "data";
+  m_indexFileName = prefix + "index";
+  m_seqNumsFileName = prefix + "seqnums";
+  m_sessionFileName = prefix + "session";
+  m_bodyFileName = prefix + "body";
+  m_headerFileName = prefix + "header";
+
+  try
+  {
+    open( false );
+  }
+  catch ( IOException & e )
+  {
+    throw ConfigError( e.what() );
+  }
+}
+
+MmapFileStore::~MmapFileStore()
+{
+  close();
+}
+
+void MmapFileStore::close()
+{
+  m_dataFile.close();
+  m_indexFile.close();
+  m_seqNumsFile.close();
+
+  m_offsets.clear();
+  m_dataEnd = m_indexEnd = 0;
+  m_dataSynced = m_indexSynced = 0;
+  m_unsynced = 0;
+}
+
+void MmapFileStore::open( bool deleteFile )
+{
+  close();
+
+  if ( deleteFile )
+  {
+    file_unlink( m_dataFileName.c_str() );
+    file_unlink( m_indexFileName.c_str() );
+    file_unlink( m_seqNumsFileName.c_str() );
+    file_unlink( m_sessionFileName.c_str() );
+    file_unlink( m_bodyFileName.c_str() );
+    file_unlink( m_headerFileName.c_str() );
+  }
+
+  populateCache();
+
+  m_dataFile.open( m_dataFileName, m_segmentSize );
+  m_indexFile.open( m_indexFileName, m_segmentSize / 16 + sizeof(IndexRecord) );
+  loadIndex();
+  if( m_offsets.empty() )
+    importFileStore();
+
+  m_seqNumsFile.open( m_seqNumsFileName, SEQNUMS_SIZE );
+
+  if ( !file_exists( m_sessionFileName.c_str() ) ) setSession();
+
+  setNextSenderMsgSeqNum( getNextSenderMsgSeqNum() );
+  setNextTargetMsgSeqNum( getNextTargetMsgSeqNum() );
+  m_lastSync = UtcTimeStamp();
+}
+
+void MmapFileStore::populateCache()
+{
+  FILE* seqNumsFile = file_fopen( m_seqNumsFileName.c_str(), "r+" );
+  if ( seqNumsFile )
+  {
+    int sender, target;
+    if ( FILE_FSCANF( seqNumsFile, "%d : %d", &sender, &target ) == 2 )
+    {
+      m_cache.setNextSenderMsgSeqNum( sender );
+      m_cache.setNextTargetMsgSeqNum( target );
+    }
+    fclose( seqNumsFile );
+  }
+
+  FILE* sessionFile = file_fopen( m_sessionFileName.c_str(), "r+" );
+  if ( sessionFile )
+  {
+    char time[ 22 ];
+#ifdef HAVE_FSCANF_S
+    int result = FILE_FSCANF( sessionFile, "%s", time, 22 );
+#else
+    int result = FILE_FSCANF( sessionFile, "%s", time );
+#endif
+    if( result == 1 )
+    {
+      m_cache.setCreationTime( UtcTimeStampConvertor::convert( time, true ) );
+    }
+    fclose( sessionFile );
+  }
+}
+
+void MmapFileStore::loadIndex()
+{
+  const char* data = m_indexFile.data();
+  while ( m_indexEnd + sizeof(IndexRecord) <= m_indexFile.size() )
+  {
+    const IndexRecord& record = *(const IndexRecord*)( data + m_indexEnd );
+    if ( record.msgSeqNum == 0 ) break;
+    // a record pointing past the data file was not completely written
+    if ( record.offset + record.size > m_dataFile.size() ) break;
+
+    m_offsets[ record.msgSeqNum ] =
+      std::make_pair( (size_t)record.offset, (size_t)record.size );
+    m_dataEnd = (size_t)( record.offset + record.size );
+    m_indexEnd += sizeof(IndexRecord);
+  }
+  m_dataSynced = m_dataEnd;
+  m_indexSynced = m_indexEnd;
+}
+
+void MmapFileStore::importFileStore()
+{
+  FILE* headerFile = file_fopen( m_headerFileName.c_str(), "r" );
+  if ( !headerFile ) return;
+  FILE* bodyFile = file_fopen( m_bodyFileName.c_str(), "rb" );
+  if ( !bodyFile )
+  {
+    fclose( headerFile );
+    return;
+  }
+
+  int num;
+  long offset;
+  unsigned long size;
+  std::string msg;
+
+  while ( FILE_FSCANF( headerFile, "%d,%ld,%lu ", &num, &offset, &size ) == 3 )
+  {
+    msg.resize( size );
+    if ( fseek( bodyFile, offset, SEEK_SET )
+         || ( size && fread( &msg[ 0 ], sizeof( char ), size, bodyFile ) != size ) )
+    {
+      fclose( headerFile );
+      fclose( bodyFile );
+      throw IOException( "Unable to read from file " + m_bodyFileName );
+    }
+    append( num, msg.data(), msg.size() );
+  }
+
+  fclose( headerFile );
+  fclose( bodyFile );
+}
+
+MessageStore* MmapFileStoreFactory::create( const SessionID& s )
+{
+  if ( m_path.size() ) return new MmapFileStore( m_path, s );
+
+  Dictionary settings = m_settings.get( s );
+  std::string path = settings.getString( MMAP_FILE_STORE_PATH );
+
+  size_t segmentSize = MmapFileStore::DEFAULT_SEGMENT_SIZE;
+  int syncCount = 0;
+  int syncInterval = 0;
+  if( settings.has( MMAP_FILE_STORE_SEGMENT_SIZE ) )
+    segmentSize = settings.getInt( MMAP_FILE_STORE_SEGMENT_SIZE );
+  if( settings.has( MMAP_FILE_STORE_SYNC_COUNT ) )
+    syncCount = settings.getInt( MMAP_FILE_STORE_SYNC_COUNT );
+  if( settings.has( MMAP_FILE_STORE_SYNC_INTERVAL ) )
+    syncInterval = settings.getInt( MMAP_FILE_STORE_SYNC_INTERVAL );
+
+  return new MmapFileStore( path, s, segmentSize, syncCount, syncInterval );
+}
+
+void MmapFileStoreFactory::destroy( MessageStore* pStore )
+{
+  delete pStore;
+}
+
+bool MmapFileStore::set( int msgSeqNum, const std::string& msg )
+throw ( IOException )
+{
+  return set( msgSeqNum, msg.data(), msg.size() );
+}
+
+bool MmapFileStore::set( int msgSeqNum, const char* data, size_t size )
+throw ( IOException )
+{
+  append( msgSeqNum, data, size );
+  written();
+  return true;
+}
+
+void MmapFileStore::setBatch( const MessageBatch& batch )
+throw ( IOException )
+{
+  if ( batch.empty() ) return;
+
+  MessageBatch::const_iterator i;
+  for ( i = batch.begin(); i != batch.end(); ++i )
+    append( i->first, i->second->data(), i->second->size() );
+  written();
+}
+
+void MmapFileStore::append( int msgSeqNum, const char* msg, size_t size )
+{
+  reserve( m_dataFile, m_dataEnd + size, m_segmentSize );
+  reserve( m_indexFile, m_indexEnd + sizeof(IndexRecord), m_segmentSize / 16 );
+
+  memcpy( m_dataFile.data() + m_dataEnd, msg, size );
+
+  IndexRecord& record = *(IndexRecord*)( m_indexFile.data() + m_indexEnd );
+  record.offset = m_dataEnd;
+  record.size = (unsigned int)size;
+  // the sequence number is written last since it marks the record as used
+  record.msgSeqNum = msgSeqNum;
+
+  m_offsets[ msgSeqNum ] = std::make_pair( m_dataEnd, size );
+  m_dataEnd += size;
+  m_indexEnd += sizeof(IndexRecord);
+}
+
+void MmapFileStore::reserve( MappedFile& file, size_t size, size_t segmentSize )
+{
+  if ( size <= file.size() ) return;
+  if ( segmentSize < sizeof(IndexRecord) ) segmentSize = sizeof(IndexRecord);
+  file.resize( ( size / segmentSize + 1 ) * segmentSize );
+}
+
+void MmapFileStore::get( int begin, int end,
+                         std::vector < std::string > & result ) const
+throw ( IOException )
+{
+  result.clear();
+  if ( begin > end ) return;
+
+  NumToOffset::const_iterator i = m_offsets.lower_bound( begin );
+  NumToOffset::const_iterator last = m_offsets.upper_bound( end );
+  for ( ; i != last; ++i )
+  {
+    const OffsetSize& offset = i->second;
+    result.push_back( std::string( m_dataFile.data() + offset.first,
+                                   offset.second ) );
+  }
+}
+
+void MmapFileStore::forEach( int begin, int end,
+                             StoredMessageCallback& callback ) const
+throw ( IOException )
+{
+  if ( begin > end ) return;
+
+  std::string msg;
+  NumToOffset::const_iterator i = m_offsets.lower_bound( begin );
+  NumToOffset::const_iterator last = m_offsets.upper_bound( end );
+  for ( ; i != last; ++i )
+  {
+    const OffsetSize& offset = i->second;
+    msg.assign( m_dataFile.data() + offset.first, offset.second );
+    callback.onMessage( msg );
+  }
+}
+
+int MmapFileStore::getNextSenderMsgSeqNum() const throw ( IOException )
+{
+  return m_cache.getNextSenderMsgSeqNum();
+}
+
+int MmapFileStore::getNextTargetMsgSeqNum() const throw ( IOException )
+{
+  return m_cache.getNextTargetMsgSeqNum();
+}
+
+void MmapFileStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
+{
+  m_cache.setNextSenderMsgSeqNum( value );
+  setSeqNum();
+}
+
+void MmapFileStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
+{
+  m_cache.setNextTargetMsgSeqNum( value );
+  setSeqNum();
+}
+
+void MmapFileStore::incrNextSenderMsgSeqNum() throw ( IOException )
+{
+  m_cache.incrNextSenderMsgSeqNum();
+  setSeqNum();
+}
+
+void MmapFileStore::incrNextTargetMsgSeqNum() throw ( IOException )
+{
+  m_cache.incrNextTargetMsgSeqNum();
+  setSeqNum();
+}
+
+UtcTimeStamp MmapFileStore::getCreationTime() const throw ( IOException )
+{
+  return m_cache.getCreationTime();
+}
+
+void MmapFileStore::reset() throw ( IOException )
+{
+  try
+  {
+    m_cache.reset();
+    open( true );
+    setSession();
+  }
+  catch( std::exception& e )
+  {
+    throw IOException( e.what() );
+  }
+}
+
+void MmapFileStore::refresh() throw ( IOException )
+{
+  try
+  {
+    m_cache.reset();
+    open( false );
+  }
+  catch( std::exception& e )
+  {
+    throw IOException( e.what() );
+  }
+}
+
+void MmapFileStore::sync() throw ( IOException )
+{
+  m_dataFile.sync( m_dataSynced, m_dataEnd );
+  m_indexFile.sync( m_indexSynced, m_indexEnd );
+  m_seqNumsFile.sync( 0, SEQNUMS_SIZE );
+
+  m_dataSynced = m_dataEnd;
+  m_indexSynced = m_indexEnd;
+  m_unsynced = 0;
+  m_lastSync = UtcTimeStamp();
+}
+
+bool MmapFileStore::hasPendingWrites() const throw ( IOException )
+{
+  return m_syncInterval && m_unsynced;
+}
+
+void MmapFileStore::onTimer() throw ( IOException )
+{
+  if ( hasPendingWrites() && syncDue() )
+    sync();
+}
+
+void MmapFileStore::written()
+{
+  ++m_unsynced;
+  if ( ( m_syncCount && m_unsynced >= m_syncCount )
+       || ( m_syncInterval && syncDue() ) )
+    sync();
+}
+
+bool MmapFileStore::syncDue() const
+{
+  UtcTimeStamp now;
+  int elapsed = ( now - m_lastSync ) * 1000
+                + now.getMillisecond() - m_lastSync.getMillisecond();
+  return elapsed >= m_syncInterval;
+}
+
+void MmapFileStore::setSeqNum()
+{
+  // written in place with the fixed width format of FileStore
+  char buffer[ 11 ];
+  char* seqNums = m_seqNumsFile.data();
+  memcpy( seqNums, integer_to_string_padded
+          ( buffer, sizeof(buffer), getNextSenderMsgSeqNum(), 10 ), 10 );
+  memcpy( seqNums + 10, " : ", 3 );
+  memcpy( seqNums + 13, integer_to_string_padded
+          ( buffer, sizeof(buffer), getNextTargetMsgSeqNum(), 10 ), 10 );
+  written();
+}
+
+void MmapFileStore::setSession()
+{
+  FILE* sessionFile = file_fopen( m_sessionFileName.c_str(), "w" );
+  if ( !sessionFile )
+    throw IOException( "Could not open session file " + m_sessionFileName );
+  fprintf( sessionFile, "%s",
+           UtcTimeStampConvertor::convert( m_cache.getCreationTime() ).c_str() );
+  bool failed = ferror( sessionFile ) != 0;
+  if ( fclose( sessionFile ) || failed )
+    throw IOException( "Unable to write to file " + m_sessionFileName );
+}
+
+} //namespace FIX
@@ -0,0 +1,195 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_MMAPFILESTORE_H
+#define FIX_MMAPFILESTORE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "MessageStore.h"
+#include "SessionSettings.h"
+#include <string>
+
+namespace FIX
+{
+class Session;
+
+/// Creates a memory mapped file based implementation of MessageStore.
+class MmapFileStoreFactory : public MessageStoreFactory
+{
+public:
+  MmapFileStoreFactory( const SessionSettings& settings )
+: m_settings( settings ) {};
+  MmapFileStoreFactory( const std::string& path )
+: m_path( path ) {};
+
+  MessageStore* create( const SessionID& );
+  void destroy( MessageStore* );
+private:
+  std::string m_path;
+  SessionSettings m_settings;
+};
+/*! @} */
+
+/**
+ * Memory mapped file based implementation of MessageStore.
+ *
+ * Outgoing messages are copied into a mapped data file and located through
+ * a mapped index of fixed width records, so storing and retrieving messages
+ * does not make system calls unless a file has to grow by another segment
+ * or the sync policy asks for the changes to be written through to disk.
+ *
+ * The files created by this implementation are:<br>
+ * &nbsp;&nbsp;
+ *   [path]+[BeginString]-[SenderCompID]-[TargetCompID].data<br>
+ * &nbsp;&nbsp;
+ *   [path]+[BeginString]-[SenderCompID]-[TargetCompID].index<br>
+ * &nbsp;&nbsp;
+ *   [path]+[BeginString]-[SenderCompID]-[TargetCompID].seqnums<br>
+ * &nbsp;&nbsp;
+ *   [path]+[BeginString]-[SenderCompID]-[TargetCompID].session<br>
+ *
+ * The data file is a pure stream of %FIX messages followed by unused space.
+ * Each index record holds the offset and size of a message followed by its
+ * sequence number, a sequence number of zero marks the end of the index.
+ * The sequence number and session files have the same format as the ones
+ * of FileStore. When there is no index yet the messages of an existing
+ * FileStore (.body and .header files) are imported.
+ *
+ * Changes are written through to disk every syncCount updates or once
+ * syncInterval milliseconds have passed since the last time, whichever
+ * comes first. When both are zero this is left to the operating system.
+ * The interval is also checked by onTimer, so changes do not stay unsynced
+ * when no more messages are written.
+ */
+class MmapFileStore : public MessageStore
+{
+public:
+  enum { DEFAULT_SEGMENT_SIZE = 16 * 1024 * 1024 };
+
+  MmapFileStore( std::string, const SessionID& s,
+                 size_t segmentSize = DEFAULT_SEGMENT_SIZE,
+                 int syncCount = 0, int syncInterval = 0 );
+  virtual ~MmapFileStore();
+
+  bool set( int, const std::string& ) throw ( IOException );
+  bool set( int, const char*, size_t ) throw ( IOException );
+  void setBatch( const MessageBatch& ) throw ( IOException );
+  void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  void forEach( int, int, StoredMessageCallback& ) const throw ( IOException );
+
+  int getNextSenderMsgSeqNum() const throw ( IOException );
+  int getNextTargetMsgSeqNum() const throw ( IOException );
+  void setNextSenderMsgSeqNum( int value ) throw ( IOException );
+  void setNextTargetMsgSeqNum( int value ) throw ( IOException );
+  void incrNextSenderMsgSeqNum() throw ( IOException );
+  void incrNextTargetMsgSeqNum() throw ( IOException );
+
+  UtcTimeStamp getCreationTime() const throw ( IOException );
+
+  void reset() throw ( IOException );
+  void refresh() throw ( IOException );
+
+  bool hasPendingWrites() const throw ( IOException );
+  void onTimer() throw ( IOException );
+
+  /// Write all changes through to disk
+  void sync() throw ( IOException );
+
+private:
+  /// A file that is mapped into memory as a whole
+  class MappedFile
+  {
+  public:
+    MappedFile();
+    ~MappedFile();
+
+    /// Open or create a file and map at least size bytes of it
+    void open( const std::string& fileName, size_t size ) throw ( IOException );
+    void close();
+    /// Grow the file and map it again
+    void resize( size_t size ) throw ( IOException );
+    /// Write a range of the mapping through to disk
+    void sync( size_t begin, size_t end ) throw ( IOException );
+
+    char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+  private:
+    void map() throw ( IOException );
+    void unmap();
+
+    std::string m_fileName;
+#ifdef _MSC_VER
+    void* m_file;
+    void* m_mapping;
+#else
+    int m_file;
+#endif
+    char* m_data;
+    size_t m_size;
+  };
+
+  typedef std::pair < size_t, size_t > OffsetSize;
+  typedef std::map < int, OffsetSize > NumToOffset;
+
+  void open( bool deleteFile );
+  void close();
+  void populateCache();
+  void loadIndex();
+  void importFileStore();
+  void append( int msgSeqNum, const char* msg, size_t size );
+  void reserve( MappedFile& file, size_t size, size_t segmentSize );
+  void setSeqNum();
+  void setSession();
+  void written();
+  bool syncDue() const;
+
+  MemoryStore m_cache;
+  NumToOffset m_offsets;
+
+  std::string m_dataFileName;
+  std::string m_indexFileName;
+  std::string m_seqNumsFileName;
+  std::string m_sessionFileName;
+  std::string m_bodyFileName;
+  std::string m_headerFileName;
+
+  MappedFile m_dataFile;
+  MappedFile m_indexFile;
+  MappedFile m_seqNumsFile;
+
+  size_t m_dataEnd;
+  size_t m_indexEnd;
+  size_t m_dataSynced;
+  size_t m_indexSynced;
+
+  size_t m_segmentSize;
+  int m_syncCount;
+  int m_syncInterval;
+  int m_unsynced;
+  UtcTimeStamp m_lastSync;
+};
+}
+
+#endif //FIX_MMAPFILESTORE_H
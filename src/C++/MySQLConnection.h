@@ -37,6 +37,9 @@
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
 #include "Mutex.h"
+#include <map>
+#include <vector>
+#include <string.h>
 
 #undef MYSQL_PORT
 
@@ -45,10 +48,29 @@ namespace FIX
 class MySQLQuery
 {
 public:
+  /// Most rows written by one multi row INSERT
+  enum { MAX_BATCH_ROWS = 1000 };
+
   MySQLQuery( const std::string& query ) 
-  : m_result( 0 ), m_query( query ) 
+  : m_result( 0 ), m_status( -1 ), m_query( query ) 
   {}
 
+  /// Rows for the next statement of a multi row INSERT with rows left to
+  /// write.  Only the batch size and the powers of two below it are used,
+  /// so a few prepared statements serve any number of rows.
+  static int batchRows( int rows, int batchSize )
+  {
+    if( batchSize > MAX_BATCH_ROWS )
+      batchSize = MAX_BATCH_ROWS;
+    if( rows >= batchSize )
+      return batchSize;
+
+    int result = 1;
+    while( result * 2 <= rows )
+      result *= 2;
+    return result;
+  }
+
   ~MySQLQuery()
   {
     if( m_result )
@@ -65,7 +87,10 @@ public:
       int errcode = mysql_query( pConnection, m_query.c_str() );
       m_result = mysql_store_result( pConnection );
       if( errcode == 0 )
+      {
+        m_status = 0;
         return true;
+      }
       m_status = mysql_errno( pConnection );
       m_reason = mysql_error( pConnection );
       mysql_ping( pConnection );
@@ -74,6 +99,49 @@ public:
     return success();
   }
 
+  /// Set the value of the next ? placeholder, a query with parameters is
+  /// run as a statement prepared on its connection and returns no rows
+  void addParameter( const std::string& value )
+  { m_parameters.push_back( value ); }
+
+  const std::string& text() const
+  { return m_query; }
+
+  int parameters() const
+  { return (int)m_parameters.size(); }
+
+  bool execute( MYSQL_STMT* pStatement )
+  {
+    std::vector<MYSQL_BIND> binds( m_parameters.size() );
+    std::vector<unsigned long> lengths( m_parameters.size() );
+    memset( &binds[ 0 ], 0, binds.size() * sizeof( MYSQL_BIND ) );
+    for( size_t i = 0; i < m_parameters.size(); ++i )
+    {
+      lengths[ i ] = (unsigned long)m_parameters[ i ].size();
+      binds[ i ].buffer_type = MYSQL_TYPE_STRING;
+      binds[ i ].buffer = const_cast<char*>( m_parameters[ i ].data() );
+      binds[ i ].buffer_length = lengths[ i ];
+      binds[ i ].length = &lengths[ i ];
+    }
+
+    if( mysql_stmt_bind_param( pStatement, &binds[ 0 ] ) == 0
+        && mysql_stmt_execute( pStatement ) == 0 )
+    {
+      m_status = 0;
+      return true;
+    }
+    m_status = mysql_stmt_errno( pStatement );
+    m_reason = mysql_stmt_error( pStatement );
+    return false;
+  }
+
+  /// Record why the statement for the query could not be prepared
+  void failed( MYSQL* pConnection )
+  {
+    m_status = mysql_errno( pConnection );
+    m_reason = mysql_error( pConnection );
+  }
+
   bool success()
   {
     return m_status == 0;
@@ -112,6 +180,7 @@ private:
   std::string m_query; 
   std::string m_reason;
   std::vector<MYSQL_ROW> m_rows;
+  std::vector<std::string> m_parameters;
 };
 
 class MySQLConnection
@@ -134,6 +203,7 @@ public:
 
   ~MySQLConnection()
   {
+    closeStatements();
     if( m_pConnection )
       mysql_close( m_pConnection );
   }
@@ -158,10 +228,59 @@ public:
   bool execute( MySQLQuery& pQuery )
   {
     Locker locker( m_mutex );
-    return pQuery.execute( m_pConnection );
+    if( !pQuery.parameters() )
+      return pQuery.execute( m_pConnection );
+
+    // statements live as long as the connection, so once it has been
+    // reconnected the statement is prepared again on the new one
+    for( int retry = 0; retry <= 1; ++retry )
+    {
+      MYSQL_STMT* pStatement = prepare( pQuery );
+      if( pStatement && pQuery.execute( pStatement ) )
+        return true;
+      if( mysql_ping( m_pConnection ) != 0
+          || mysql_thread_id( m_pConnection ) == m_threadID )
+        return false;
+      closeStatements();
+    }
+    return false;
   }
 
 private:
+  /// Statement prepared for the text of a query, queries of every
+  /// session using the connection share it
+  MYSQL_STMT* prepare( MySQLQuery& query )
+  {
+    Statements::iterator i = m_statements.find( query.text() );
+    if( i != m_statements.end() )
+      return i->second;
+
+    // texts that are not used again would otherwise pile up, the stores
+    // and logs keep to a few of them
+    if( m_statements.size() >= MAX_STATEMENTS )
+      closeStatements();
+
+    MYSQL_STMT* pStatement = mysql_stmt_init( m_pConnection );
+    if( pStatement && mysql_stmt_prepare
+        ( pStatement, query.text().c_str(), (unsigned long)query.text().size() ) == 0 )
+      return m_statements[ query.text() ] = pStatement;
+
+    query.failed( m_pConnection );
+    if( pStatement )
+      mysql_stmt_close( pStatement );
+    return 0;
+  }
+
+  void closeStatements()
+  {
+    Statements::iterator i;
+    for( i = m_statements.begin(); i != m_statements.end(); ++i )
+      mysql_stmt_close( i->second );
+    m_statements.clear();
+    if( m_pConnection )
+      m_threadID = mysql_thread_id( m_pConnection );
+  }
+
   void connect()
   {
     short port = m_connectionID.getPort();
@@ -177,10 +296,18 @@ private:
     my_bool reconnect = 1;
     mysql_options( m_pConnection, MYSQL_OPT_RECONNECT, static_cast<char*>(&reconnect) );
     #endif
+    m_threadID = mysql_thread_id( m_pConnection );
   }
 
+  /// Statements by query text
+  typedef std::map < std::string, MYSQL_STMT* > Statements;
+  /// Most statements kept prepared on the connection
+  enum { MAX_STATEMENTS = 64 };
+
   MYSQL* m_pConnection;
   DatabaseConnectionID m_connectionID;
+  Statements m_statements;
+  unsigned long m_threadID;
   Mutex m_mutex;
 };
 
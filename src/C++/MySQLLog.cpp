@@ -29,6 +29,7 @@
 #include "SessionID.h"
 #include "SessionSettings.h"
 #include "Utility.h"
+#include "FieldConvertors.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -73,6 +74,7 @@ MySQLLog::MySQLLog
   const std::string& password, const std::string& host, short port )
   : m_pConnectionPool( 0 ), m_pSessionID( 0 )
 {
+  init();
   m_pConnection = new MySQLConnection( database, user, password, host, port );
 }
 
@@ -81,10 +83,15 @@ void MySQLLog::init()
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
+  m_pendingRows = 0;
+  m_firstPending = 0;
+  m_batchSize = MySQLLogFactory::DEFAULT_BATCH_SIZE;
+  m_flushInterval = MySQLLogFactory::DEFAULT_FLUSH_INTERVAL;
 }
 
 MySQLLog::~MySQLLog()
 {
+  flush();
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -176,6 +183,12 @@ void MySQLLogFactory::initLog( const Dictionary& settings, MySQLLog& log )
 
   try { log.setEventTable( settings.getString( MYSQL_LOG_EVENT_TABLE ) ); }
   catch( ConfigError& ) {}
+
+  try { log.setBatchSize( settings.getInt( MYSQL_LOG_BATCH_SIZE ) ); }
+  catch( ConfigError& ) {}
+
+  try { log.setFlushInterval( settings.getInt( MYSQL_LOG_FLUSH_INTERVAL ) ); }
+  catch( ConfigError& ) {}
 }
 
 void MySQLLogFactory::destroy( Log* pLog )
@@ -185,6 +198,11 @@ void MySQLLogFactory::destroy( Log* pLog )
 
 void MySQLLog::clear()
 {
+  // rows still waiting would only be deleted again
+  Locker l( m_mutex );
+  m_pending.clear();
+  m_pendingRows = 0;
+
   std::stringstream whereClause;
 
   whereClause << "WHERE ";
@@ -225,6 +243,7 @@ void MySQLLog::clear()
 
 void MySQLLog::backup()
 {
+  flush();
 }
 
 void MySQLLog::insert( const std::string& table, const std::string value )
@@ -238,36 +257,77 @@ void MySQLLog::insert( const std::string& table, const std::string value )
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
            year, month, day, hour, minute, second );
 
-  char* valueCopy = new char[ (value.size() * 2) + 1 ];
-  mysql_escape_string( valueCopy, value.c_str(), value.size() );
+  Locker l( m_mutex );
+  std::vector<std::string>& rows = m_pending[ table ];
+  rows.push_back( sqlTime );
+  rows.push_back( IntConvertor::convert( millis ) );
+  rows.push_back( value );
+
+  long now = process_milliseconds();
+  if( !m_pendingRows++ )
+    m_firstPending = now;
+  if( m_pendingRows >= m_batchSize || now - m_firstPending >= m_flushInterval )
+    flush();
+}
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, time_milliseconds, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "'" << sqlTime << "','" << millis << "',";
+void MySQLLog::onTimer()
+{
+  Locker l( m_mutex );
+  if( m_pendingRows && process_milliseconds() - m_firstPending >= m_flushInterval )
+    flush();
+}
 
+void MySQLLog::flush()
+{
+  Locker l( m_mutex );
+  // each row binds its time and milliseconds, the session columns that
+  // are not NULL and its text
+  std::string row = "(?,?,NULL,NULL,NULL,NULL,?)";
   if( m_pSessionID )
   {
-    queryString
-    << "\"" << m_pSessionID->getBeginString().getValue() << "\","
-    << "\"" << m_pSessionID->getSenderCompID().getValue() << "\","
-    << "\"" << m_pSessionID->getTargetCompID().getValue() << "\",";
-    if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
-    else
-      queryString << "\"" << m_pSessionID->getSessionQualifier() << "\",";
+    row = m_pSessionID->getSessionQualifier().empty()
+      ? "(?,?,?,?,?,NULL,?)" : "(?,?,?,?,?,?,?)";
   }
-  else
+
+  PendingRows::iterator i;
+  for( i = m_pending.begin(); i != m_pending.end(); ++i )
   {
-    queryString << "NULL, NULL, NULL, NULL, ";
+    std::vector<std::string>& rows = i->second;
+    size_t begin = 0;
+    while( begin < rows.size() )
+    {
+      size_t end = begin + 3 * MySQLQuery::batchRows
+        ( (int)( rows.size() - begin ) / 3, m_batchSize );
+
+      std::stringstream queryString;
+      queryString << "INSERT INTO " << i->first << " "
+      << "(time, time_milliseconds, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+      << "VALUES ";
+      for( size_t j = begin; j < end; j += 3 )
+        queryString << ( j != begin ? "," : "" ) << row;
+
+      MySQLQuery query( queryString.str() );
+      for( size_t j = begin; j < end; j += 3 )
+      {
+        query.addParameter( rows[ j ] );
+        query.addParameter( rows[ j + 1 ] );
+        if( m_pSessionID )
+        {
+          query.addParameter( m_pSessionID->getBeginString().getValue() );
+          query.addParameter( m_pSessionID->getSenderCompID().getValue() );
+          query.addParameter( m_pSessionID->getTargetCompID().getValue() );
+          if( !m_pSessionID->getSessionQualifier().empty() )
+            query.addParameter( m_pSessionID->getSessionQualifier() );
+        }
+        query.addParameter( rows[ j + 2 ] );
+      }
+
+      m_pConnection->execute( query );
+      begin = end;
+    }
+    rows.clear();
   }
-
-  queryString << "\"" << valueCopy << "\")";
-  delete [] valueCopy;
-
-  MySQLQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  m_pendingRows = 0;
 }
 
 } //namespace FIX
@@ -35,8 +35,11 @@
 #include "Log.h"
 #include "SessionSettings.h"
 #include "MySQLConnection.h"
+#include "Mutex.h"
 #include <fstream>
 #include <string>
+#include <map>
+#include <vector>
 
 namespace FIX
 {
@@ -61,6 +64,20 @@ public:
   { m_outgoingTable = outgoingTable; }
   void setEventTable( const std::string& eventTable )
   { m_eventTable = eventTable; }
+  /// Rows written by one INSERT, with one each row is written at once,
+  /// up to MySQLQuery::MAX_BATCH_ROWS
+  void setBatchSize( int value )
+  { m_batchSize = value > 0 ? value : 1; }
+  /// Milliseconds a row may wait for the rest of its batch, it is written
+  /// with the first row logged after that or by the session timer
+  void setFlushInterval( int value )
+  { m_flushInterval = value; }
+  /// Write the rows waiting for their batch
+  void flush();
+
+  bool hasPendingWrites() const
+  { Locker l( m_mutex ); return m_pendingRows > 0; }
+  void onTimer();
 
   void onIncoming( const std::string& value )
   { insert( m_incomingTable, value ); }
@@ -73,12 +90,23 @@ private:
   void init();
   void insert( const std::string& table, const std::string value );
 
+  /// Time, milliseconds and text of the rows waiting to be written by table
+  typedef std::map < std::string, std::vector < std::string > > PendingRows;
+
   std::string m_incomingTable;
   std::string m_outgoingTable;
   std::string m_eventTable;
   MySQLConnection* m_pConnection;
   MySQLConnectionPool* m_pConnectionPool;
   SessionID* m_pSessionID;
+  PendingRows m_pending;
+  int m_pendingRows;
+  long m_firstPending;
+  int m_batchSize;
+  int m_flushInterval;
+  /// Guards the pending rows, the session timer flushes them from
+  /// another thread than the one logging
+  mutable Mutex m_mutex;
 };
 
 /// Creates a MySQL based implementation of Log.
@@ -90,6 +118,7 @@ public:
   static const std::string DEFAULT_PASSWORD;
   static const std::string DEFAULT_HOST;
   static const short DEFAULT_PORT;
+  enum { DEFAULT_BATCH_SIZE = 1, DEFAULT_FLUSH_INTERVAL = 1000 };
 
   MySQLLogFactory( const SessionSettings& settings )
 : m_settings( settings ), m_useSettings( true ) 
@@ -43,9 +43,14 @@ const std::string MySQLStoreFactory::DEFAULT_PASSWORD = "";
 const std::string MySQLStoreFactory::DEFAULT_HOST = "localhost";
 const short MySQLStoreFactory::DEFAULT_PORT = 3306;
 
+/// Rows of the session, its key is passed as four parameters
+static const char* SESSION_KEY =
+  "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
 MySQLStore::MySQLStore
 ( const SessionID& s, const DatabaseConnectionID& d, MySQLConnectionPool* p )
-  : m_pConnectionPool( p ), m_sessionID( s )
+  : m_pConnectionPool( p ), m_sessionID( s ),
+    m_batchSize( MySQLStoreFactory::DEFAULT_BATCH_SIZE )
 {
   m_pConnection = m_pConnectionPool->create( d );
   populateCache();
@@ -54,7 +59,8 @@ MySQLStore::MySQLStore
 MySQLStore::MySQLStore
 ( const SessionID& s, const std::string& database, const std::string& user,
   const std::string& password, const std::string& host, short port )
-  : m_pConnectionPool( 0 ), m_sessionID( s )
+  : m_pConnectionPool( 0 ), m_sessionID( s ),
+    m_batchSize( MySQLStoreFactory::DEFAULT_BATCH_SIZE )
 {
   m_pConnection = new MySQLConnection( database, user, password, host, port );
   populateCache();
@@ -158,7 +164,12 @@ MessageStore* MySQLStoreFactory::create( const SessionID& s, const Dictionary& s
   catch( ConfigError& ) {}
 
   DatabaseConnectionID id( database, user, password, host, port );
-  return new MySQLStore( s, id, m_connectionPoolPtr.get() );
+  MySQLStore* pStore = new MySQLStore( s, id, m_connectionPoolPtr.get() );
+
+  try { pStore->setBatchSize( settings.getInt( MYSQL_STORE_BATCH_SIZE ) ); }
+  catch( ConfigError& ) {}
+
+  return pStore;
 }
 
 void MySQLStoreFactory::destroy( MessageStore* pStore )
@@ -169,39 +180,66 @@ void MySQLStoreFactory::destroy( MessageStore* pStore )
 bool MySQLStore::set( int msgSeqNum, const std::string& msg )
 throw ( IOException )
 {
-  char* msgCopy = new char[ (msg.size() * 2) + 1 ];
-  mysql_escape_string( msgCopy, msg.c_str(), msg.size() );
+  MySQLQuery query( "INSERT INTO messages "
+                    "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+                    "VALUES (?,?,?,?,?,?)" );
+  addSessionParameters( query );
+  query.addParameter( IntConvertor::convert( msgSeqNum ) );
+  query.addParameter( msg );
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "\"" << m_sessionID.getBeginString().getValue() << "\","
-  << "\"" << m_sessionID.getSenderCompID().getValue() << "\","
-  << "\"" << m_sessionID.getTargetCompID().getValue() << "\","
-  << "\"" << m_sessionID.getSessionQualifier() << "\","
-  << msgSeqNum << ","
-  << "\"" << msgCopy << "\")";
-
-  delete [] msgCopy;
-
-  MySQLQuery query( queryString.str() );
   if( !m_pConnection->execute(query) )
   {
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message=\"" << msg << "\" WHERE "
-    << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-    << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-    << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-    << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\" and "
-    << "msgseqnum=" << msgSeqNum;
-    MySQLQuery query2( queryString2.str() );
+    MySQLQuery query2( "UPDATE messages SET message=? WHERE "
+                       + std::string( SESSION_KEY ) + " and msgseqnum=?" );
+    query2.addParameter( msg );
+    addSessionParameters( query2 );
+    query2.addParameter( IntConvertor::convert( msgSeqNum ) );
     if( !m_pConnection->execute(query2) )
       query2.throwException();
   }
   return true;
 }
 
+void MySQLStore::setBatch( const MessageBatch& batch )
+throw ( IOException )
+{
+  MessageBatch::const_iterator i = batch.begin();
+  while( i != batch.end() )
+  {
+    MessageBatch::const_iterator first = i;
+    int rows = MySQLQuery::batchRows( (int)( batch.end() - i ), m_batchSize );
+    std::stringstream queryString;
+    queryString << "INSERT INTO messages "
+    << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+    << "VALUES ";
+    for( int row = 0; row < rows; ++row, ++i )
+      queryString << ( row ? ",(?,?,?,?,?,?)" : "(?,?,?,?,?,?)" );
+
+    MySQLQuery query( queryString.str() );
+    for( MessageBatch::const_iterator j = first; j != i; ++j )
+    {
+      addSessionParameters( query );
+      query.addParameter( IntConvertor::convert( j->first ) );
+      query.addParameter( *j->second );
+    }
+
+    // a message stored before makes the INSERT fail, set replaces it
+    if( !m_pConnection->execute(query) )
+    {
+      for( ; first != i; ++first )
+        set( first->first, *first->second );
+    }
+  }
+}
+
+void MySQLStore::addSessionParameters( MySQLQuery& query ) const
+{
+  query.addParameter( m_sessionID.getBeginString().getValue() );
+  query.addParameter( m_sessionID.getSenderCompID().getValue() );
+  query.addParameter( m_sessionID.getTargetCompID().getValue() );
+  query.addParameter( m_sessionID.getSessionQualifier() );
+}
+
 void MySQLStore::get( int begin, int end,
                       std::vector < std::string > & result ) const
 throw ( IOException )
@@ -225,6 +263,40 @@ throw ( IOException )
     result.push_back( query.getValue( row, 0 ) );
 }
 
+void MySQLStore::forEach( int begin, int end,
+                          StoredMessageCallback& callback ) const
+throw ( IOException )
+{
+  // one ordered range query per batch, each starting after the last row
+  // of the one before, so the connection is free during the callbacks
+  std::string message;
+  while ( begin <= end )
+  {
+    std::stringstream queryString;
+    queryString << "SELECT msgseqnum, message FROM messages WHERE "
+    << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
+    << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
+    << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
+    << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\" and "
+    << "msgseqnum>=" << begin << " and " << "msgseqnum<=" << end << " "
+    << "ORDER BY msgseqnum LIMIT " << (int)FOR_EACH_BATCH;
+
+    MySQLQuery query( queryString.str() );
+    if( !m_pConnection->execute(query) )
+      query.throwException();
+
+    int rows = query.rows();
+    for( int row = 0; row < rows; row++ )
+    {
+      begin = atol( query.getValue( row, 0 ) ) + 1;
+      message = query.getValue( row, 1 );
+      callback.onMessage( message );
+    }
+    if( rows < FOR_EACH_BATCH )
+      break;
+  }
+}
+
 int MySQLStore::getNextSenderMsgSeqNum() const throw ( IOException )
 {
   return m_cache.getNextSenderMsgSeqNum();
@@ -237,13 +309,10 @@ int MySQLStore::getNextTargetMsgSeqNum() const throw ( IOException )
 
 void MySQLStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-  MySQLQuery query( queryString.str() );
+  MySQLQuery query( "UPDATE sessions SET outgoing_seqnum=? WHERE "
+                    + std::string( SESSION_KEY ) );
+  query.addParameter( IntConvertor::convert( value ) );
+  addSessionParameters( query );
   if( !m_pConnection->execute(query) )
     query.throwException();
   m_cache.setNextSenderMsgSeqNum( value );
@@ -251,20 +320,32 @@ void MySQLStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 
 void MySQLStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
+  MySQLQuery query( "UPDATE sessions SET incoming_seqnum=? WHERE "
+                    + std::string( SESSION_KEY ) );
+  query.addParameter( IntConvertor::convert( value ) );
+  addSessionParameters( query );
 
-  MySQLQuery query( queryString.str() );
   if( !m_pConnection->execute(query) )
     query.throwException();
 
   m_cache.setNextTargetMsgSeqNum( value );
 }
 
+void MySQLStore::setNextMsgSeqNums( int sender, int target ) throw ( IOException )
+{
+  MySQLQuery query( "UPDATE sessions SET outgoing_seqnum=?, incoming_seqnum=? WHERE "
+                    + std::string( SESSION_KEY ) );
+  query.addParameter( IntConvertor::convert( sender ) );
+  query.addParameter( IntConvertor::convert( target ) );
+  addSessionParameters( query );
+
+  if( !m_pConnection->execute(query) )
+    query.throwException();
+
+  m_cache.setNextSenderMsgSeqNum( sender );
+  m_cache.setNextTargetMsgSeqNum( target );
+}
+
 void MySQLStore::incrNextSenderMsgSeqNum() throw ( IOException )
 {
   m_cache.incrNextSenderMsgSeqNum();
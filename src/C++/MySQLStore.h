@@ -49,6 +49,7 @@ public:
   static const std::string DEFAULT_PASSWORD;
   static const std::string DEFAULT_HOST;
   static const short DEFAULT_PORT;
+  enum { DEFAULT_BATCH_SIZE = 100 };
 
   MySQLStoreFactory( const SessionSettings& settings )
 : m_settings( settings ), m_useSettings( true ), m_useDictionary( false ) 
@@ -114,12 +115,15 @@ public:
   ~MySQLStore();
 
   bool set( int, const std::string& ) throw ( IOException );
+  void setBatch( const MessageBatch& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  void forEach( int, int, StoredMessageCallback& ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException );
   int getNextTargetMsgSeqNum() const throw ( IOException );
   void setNextSenderMsgSeqNum( int value ) throw ( IOException );
   void setNextTargetMsgSeqNum( int value ) throw ( IOException );
+  void setNextMsgSeqNums( int sender, int target ) throw ( IOException );
   void incrNextSenderMsgSeqNum() throw ( IOException );
   void incrNextTargetMsgSeqNum() throw ( IOException );
 
@@ -128,13 +132,20 @@ public:
   void reset() throw ( IOException );
   void refresh() throw ( IOException );
 
+  /// Most messages written by one INSERT in setBatch, up to
+  /// MySQLQuery::MAX_BATCH_ROWS
+  void setBatchSize( int value )
+  { m_batchSize = value > 0 ? value : 1; }
+
 private:
   void populateCache();
+  void addSessionParameters( MySQLQuery& ) const;
 
   MemoryStore m_cache;
   MySQLConnection* m_pConnection;
   MySQLConnectionPool* m_pConnectionPool;
   SessionID m_sessionID;
+  int m_batchSize;
 };
 }
 
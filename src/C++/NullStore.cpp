@@ -44,6 +44,12 @@ throw( IOException )
   return true;
 }
 
+bool NullStore::set( int msgSeqNum, const char* data, size_t size )
+throw( IOException )
+{
+  return true;
+}
+
 void NullStore::get( int begin, int end,
                        std::vector < std::string > & messages ) const
 throw( IOException )
@@ -34,23 +34,26 @@ bool Parser::extractLength( int& length, std::string::size_type& pos,
                             const std::string& buffer )
 throw( MessageParseError )
 {
-  if( !buffer.size() ) return false;
+  return extractLength( length, pos, buffer, 0 );
+}
+
+bool Parser::extractLength( int& length, std::string::size_type& pos,
+                            const std::string& buffer,
+                            std::string::size_type start )
+throw( MessageParseError )
+{
+  if( buffer.size() <= start ) return false;
 
-  std::string::size_type startPos = buffer.find( "\0019=", 0 );
+  std::string::size_type startPos = buffer.find( "\0019=", start );
   if( startPos == std::string::npos ) return false;
   startPos += 3;
   std::string::size_type endPos = buffer.find( "\001", startPos );
   if( endPos == std::string::npos ) return false;
 
-  std::string strLength( buffer, startPos, endPos - startPos );
-
-  try
-  {
-    length = IntConvertor::convert( strLength );
-    if( length < 0 ) throw MessageParseError();
-  }
-  catch( FieldConvertError& )
-  { throw MessageParseError(); }
+  if( !IntConvertor::convert( buffer.begin() + startPos,
+                              buffer.begin() + endPos, length )
+      || length < 0 )
+    throw MessageParseError();
 
   pos = endPos + 1;
   return true;
@@ -59,45 +62,63 @@ throw( MessageParseError )
 bool Parser::readFixMessage( std::string& str )
 throw( MessageParseError )
 {
-  std::string::size_type pos = 0;
+  const char* data = 0;
+  std::string::size_type length = 0;
 
-  if( m_buffer.length() < 2 ) return false;
-  pos = m_buffer.find( "8=" );
-  if( pos == std::string::npos ) return false;
-  m_buffer.erase( 0, pos );
+  if( !readFixMessage( data, length ) )
+    return false;
 
-  int length = 0;
+  str.assign( data, length );
+  return true;
+}
 
-  try
+bool Parser::readFixMessage( const char*& data, std::string::size_type& length )
+throw( MessageParseError )
+{
+  std::string::size_type pos = 0;
+
+  if( !m_bodyEnd )
   {
-    if( extractLength(length, pos, m_buffer) )
+    if( m_buffer.length() < m_pos + 2 ) return false;
+    pos = m_buffer.find( "8=", m_pos );
+    if( pos == std::string::npos )
     {
-      pos += length;
-      if( m_buffer.size() < pos )
-        return false;
+      // keep a trailing '8' which may start the next message
+      m_pos = m_buffer.length() - 1;
+      return false;
+    }
+    m_pos = pos;
 
-      pos = m_buffer.find( "\00110=", pos-1 );
-      if( pos == std::string::npos ) return false;
-      pos += 4;
-      pos = m_buffer.find( "\001", pos );
-      if( pos == std::string::npos ) return false;
-      pos += 1;
+    int bodyLength = 0;
 
-      str.assign( m_buffer, 0, pos );
-      m_buffer.erase( 0, pos );
-      return true;
+    try
+    {
+      if( !extractLength(bodyLength, pos, m_buffer, m_pos) )
+        return false;
+    }
+    catch( MessageParseError& e )
+    {
+      m_pos = m_buffer.length();
+      throw e;
     }
-  }
-  catch( MessageParseError& e )
-  {
-    if( length > 0 )
-      m_buffer.erase( 0, pos + length );
-    else
-      m_buffer.erase();
 
-    throw e;
+    m_bodyEnd = pos + bodyLength;
   }
 
-  return false;
+  if( m_buffer.size() < m_bodyEnd )
+    return false;
+
+  pos = m_buffer.find( "\00110=", m_bodyEnd - 1 );
+  if( pos == std::string::npos ) return false;
+  pos += 4;
+  pos = m_buffer.find( "\001", pos );
+  if( pos == std::string::npos ) return false;
+  pos += 1;
+
+  data = m_buffer.data() + m_pos;
+  length = pos - m_pos;
+  m_pos = pos;
+  m_bodyEnd = 0;
+  return true;
 }
 }
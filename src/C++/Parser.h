@@ -32,11 +32,17 @@
 
 namespace FIX
 {
-/// Parses %FIX messages off an input stream.
+/**
+ * Parses %FIX messages off an input stream.
+ *
+ * Data that has been read is not removed from the buffer one message at a
+ * time.  A cursor is moved past each message instead and the consumed data
+ * is dropped once, when more data is added to the stream.
+ */
 class Parser
 {
 public:
-  Parser() {}
+  Parser() : m_pos( 0 ), m_bodyEnd( 0 ) {}
   ~Parser() {}
 
   bool extractLength( int& length, std::string::size_type& pos,
@@ -44,14 +50,33 @@ public:
   throw ( MessageParseError );
   bool readFixMessage( std::string& str )
   throw ( MessageParseError );
+  /// Read a message without copying it, valid until the stream is added to
+  bool readFixMessage( const char*& data, std::string::size_type& length )
+  throw ( MessageParseError );
 
   void addToStream( const char* str, size_t len )
-  { m_buffer.append( str, len ); }
+  { compact(); m_buffer.append( str, len ); }
   void addToStream( const std::string& str )
-  { m_buffer.append( str ); }
+  { compact(); m_buffer.append( str ); }
 
 private:
+  bool extractLength( int& length, std::string::size_type& pos,
+                      const std::string& buffer, std::string::size_type start )
+  throw ( MessageParseError );
+
+  void compact()
+  {
+    if( !m_pos ) return;
+    m_buffer.erase( 0, m_pos );
+    if( m_bodyEnd ) m_bodyEnd -= m_pos;
+    m_pos = 0;
+  }
+
   std::string m_buffer;
+  /// Start of the data that has not been read yet
+  std::string::size_type m_pos;
+  /// End of the body of a partially received message, 0 if not known yet
+  std::string::size_type m_bodyEnd;
 };
 }
 #endif //FIX_PARSER_H
@@ -36,6 +36,8 @@
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
 #include "Mutex.h"
+#include <map>
+#include <vector>
 
 namespace FIX
 {
@@ -43,7 +45,7 @@ class PostgreSQLQuery
 {
 public:
   PostgreSQLQuery( const std::string& query ) 
-  : m_result( 0 ), m_query( query ) 
+  : m_result( 0 ), m_status( PGRES_FATAL_ERROR ), m_query( query ) 
   {}
 
   ~PostgreSQLQuery()
@@ -68,6 +70,30 @@ public:
     return success();
   }
 
+  /// Set the value of the next $n placeholder, a query with parameters
+  /// is run as a statement prepared on its connection
+  void addParameter( const std::string& value )
+  { m_parameters.push_back( value ); }
+
+  const std::string& text() const
+  { return m_query; }
+
+  int parameters() const
+  { return (int)m_parameters.size(); }
+
+  bool execute( PGconn* pConnection, const std::string& statement )
+  {
+    std::vector<const char*> values( m_parameters.size() );
+    for( size_t i = 0; i < m_parameters.size(); ++i )
+      values[ i ] = m_parameters[ i ].c_str();
+
+    if( m_result ) PQclear( m_result );
+    m_result = PQexecPrepared( pConnection, statement.c_str(), parameters(),
+                               &values[ 0 ], 0, 0, 0 );
+    m_status = PQresultStatus( m_result );
+    return success();
+  }
+
   bool success()
   {
     return m_status == PGRES_TUPLES_OK
@@ -99,6 +125,7 @@ private:
   PGresult* m_result;
   ExecStatusType m_status;
   std::string m_query; 
+  std::vector<std::string> m_parameters;
 };
 
 class PostgreSQLConnection
@@ -146,10 +173,43 @@ public:
   bool execute( PostgreSQLQuery& pQuery )
   {
     Locker locker( m_mutex );
-    return pQuery.execute( m_pConnection );
+    if( !pQuery.parameters() )
+      return pQuery.execute( m_pConnection );
+
+    // statements live as long as the connection, so a lost one is
+    // reset and the statement prepared again on the new connection
+    for( int retry = 0; retry <= 1; ++retry )
+    {
+      const std::string* pStatement = prepare( pQuery );
+      if( pStatement && pQuery.execute( m_pConnection, *pStatement ) )
+        return true;
+      if( PQstatus( m_pConnection ) == CONNECTION_OK )
+        return false;
+      PQreset( m_pConnection );
+      m_statements.clear();
+    }
+    return false;
   }
 
 private:
+  /// Name of the statement prepared for the text of a query, queries of
+  /// every session using the connection share it
+  const std::string* prepare( const PostgreSQLQuery& query )
+  {
+    Statements::iterator i = m_statements.find( query.text() );
+    if( i != m_statements.end() )
+      return &i->second;
+
+    std::string name = "quickfix_" + IntConvertor::convert( (int)m_statements.size() );
+    PGresult* pResult = PQprepare( m_pConnection, name.c_str(), query.text().c_str(),
+                                   query.parameters(), 0 );
+    bool prepared = PQresultStatus( pResult ) == PGRES_COMMAND_OK;
+    PQclear( pResult );
+    if( !prepared )
+      return 0;
+    return &( m_statements[ query.text() ] = name );
+  }
+
   void connect()
   {
     short port = m_connectionID.getPort();
@@ -161,8 +221,12 @@ private:
       throw ConfigError( "Unable to connect to database" );
   }
 
+  /// Statement names by query text
+  typedef std::map < std::string, std::string > Statements;
+
   PGconn* m_pConnection;
   DatabaseConnectionID m_connectionID;
+  Statements m_statements;
   Mutex m_mutex;
 };
 
@@ -82,10 +82,15 @@ void PostgreSQLLog::init()
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
+  m_pendingRows = 0;
+  m_firstPending = 0;
+  m_batchSize = PostgreSQLLogFactory::DEFAULT_BATCH_SIZE;
+  m_flushInterval = PostgreSQLLogFactory::DEFAULT_FLUSH_INTERVAL;
 }
 
 PostgreSQLLog::~PostgreSQLLog()
 {
+  flush();
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -177,6 +182,12 @@ void PostgreSQLLogFactory::initLog( const Dictionary& settings, PostgreSQLLog& l
 
   try { log.setEventTable( settings.getString( POSTGRESQL_LOG_EVENT_TABLE ) ); }
   catch( ConfigError& ) {}
+
+  try { log.setBatchSize( settings.getInt( POSTGRESQL_LOG_BATCH_SIZE ) ); }
+  catch( ConfigError& ) {}
+
+  try { log.setFlushInterval( settings.getInt( POSTGRESQL_LOG_FLUSH_INTERVAL ) ); }
+  catch( ConfigError& ) {}
 }
 
 void PostgreSQLLogFactory::destroy( Log* pLog )
@@ -186,6 +197,11 @@ void PostgreSQLLogFactory::destroy( Log* pLog )
 
 void PostgreSQLLog::clear()
 {
+  // rows still waiting would only be deleted again
+  Locker l( m_mutex );
+  m_pending.clear();
+  m_pendingRows = 0;
+
   std::stringstream whereClause;
 
   whereClause << "WHERE ";
@@ -226,6 +242,7 @@ void PostgreSQLLog::clear()
 
 void PostgreSQLLog::backup()
 {
+  flush();
 }
 
 void PostgreSQLLog::insert( const std::string& table, const std::string value )
@@ -238,37 +255,73 @@ void PostgreSQLLog::insert( const std::string& table, const std::string value )
   char sqlTime[ 24 ];
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%003d",
            year, month, day, hour, minute, second, millis );
-  
-  char* valueCopy = new char[ (value.size() * 2) + 1 ];
-  PQescapeString( valueCopy, value.c_str(), value.size() );
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "'" << sqlTime << "',";
+  Locker l( m_mutex );
+  std::vector<std::string>& rows = m_pending[ table ];
+  rows.push_back( sqlTime );
+  rows.push_back( value );
+
+  long now = process_milliseconds();
+  if( !m_pendingRows++ )
+    m_firstPending = now;
+  if( m_pendingRows >= m_batchSize || now - m_firstPending >= m_flushInterval )
+    flush();
+}
 
+void PostgreSQLLog::onTimer()
+{
+  Locker l( m_mutex );
+  if( m_pendingRows && process_milliseconds() - m_firstPending >= m_flushInterval )
+    flush();
+}
+
+void PostgreSQLLog::flush()
+{
+  Locker l( m_mutex );
+  // the session columns are the first parameters, the time and text of
+  // each row follow them
+  std::string session = "NULL, NULL, NULL, NULL";
+  int keys = 0;
   if( m_pSessionID )
   {
-    queryString
-    << "'" << m_pSessionID->getBeginString().getValue() << "',"
-    << "'" << m_pSessionID->getSenderCompID().getValue() << "',"
-    << "'" << m_pSessionID->getTargetCompID().getValue() << "',";
-    if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
-    else
-      queryString << "'" << m_pSessionID->getSessionQualifier() << "',";
+    keys = m_pSessionID->getSessionQualifier().empty() ? 3 : 4;
+    session = keys == 3 ? "$1, $2, $3, NULL" : "$1, $2, $3, $4";
   }
-  else
+
+  PendingRows::iterator i;
+  for( i = m_pending.begin(); i != m_pending.end(); ++i )
   {
-    queryString << "NULL, NULL, NULL, NULL, ";
+    std::vector<std::string>& rows = i->second;
+    if( rows.empty() )
+      continue;
+
+    std::stringstream queryString;
+    queryString << "INSERT INTO " << i->first << " "
+    << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+    << "VALUES ";
+    for( size_t row = 0; row < rows.size(); row += 2 )
+    {
+      if( row ) queryString << ",";
+      queryString << "($" << keys + row + 1 << ", " << session
+                  << ", $" << keys + row + 2 << ")";
+    }
+
+    PostgreSQLQuery query( queryString.str() );
+    if( m_pSessionID )
+    {
+      query.addParameter( m_pSessionID->getBeginString().getValue() );
+      query.addParameter( m_pSessionID->getSenderCompID().getValue() );
+      query.addParameter( m_pSessionID->getTargetCompID().getValue() );
+      if( keys == 4 )
+        query.addParameter( m_pSessionID->getSessionQualifier() );
+    }
+    for( size_t row = 0; row < rows.size(); ++row )
+      query.addParameter( rows[ row ] );
+
+    m_pConnection->execute( query );
+    rows.clear();
   }
-
-  queryString << "'" << valueCopy << "')";
-  delete [] valueCopy;
-
-  PostgreSQLQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  m_pendingRows = 0;
 }
 
 } // namespace FIX
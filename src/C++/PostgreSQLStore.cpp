@@ -43,9 +43,16 @@ const std::string PostgreSQLStoreFactory::DEFAULT_PASSWORD = "";
 const std::string PostgreSQLStoreFactory::DEFAULT_HOST = "localhost";
 const short PostgreSQLStoreFactory::DEFAULT_PORT = 0;
 
+/// Rows of the session, its key is the first four parameters
+static const char* SESSION_KEY =
+  "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4";
+
 PostgreSQLStore::PostgreSQLStore
 ( const SessionID& s, const DatabaseConnectionID& d, PostgreSQLConnectionPool* p )
-: m_pConnectionPool( p ), m_sessionID( s )
+: m_pConnectionPool( p ), m_sessionID( s ),
+  m_batchSize( PostgreSQLStoreFactory::DEFAULT_BATCH_SIZE ),
+  m_foldSenderMsgSeqNum( false ), m_lastMsgSeqNum( 0 ),
+  m_writtenSenderMsgSeqNum( 0 )
 {
   m_pConnection = m_pConnectionPool->create( d );
   populateCache();
@@ -54,7 +61,10 @@ PostgreSQLStore::PostgreSQLStore
 PostgreSQLStore::PostgreSQLStore
 ( const SessionID& s, const std::string& database, const std::string& user,
   const std::string& password, const std::string& host, short port )
-  : m_pConnectionPool( 0 ), m_sessionID( s )
+  : m_pConnectionPool( 0 ), m_sessionID( s ),
+    m_batchSize( PostgreSQLStoreFactory::DEFAULT_BATCH_SIZE ),
+    m_foldSenderMsgSeqNum( false ), m_lastMsgSeqNum( 0 ),
+    m_writtenSenderMsgSeqNum( 0 )
 {
   m_pConnection = new PostgreSQLConnection( database, user, password, host, port );
   populateCache();
@@ -158,7 +168,12 @@ MessageStore* PostgreSQLStoreFactory::create( const SessionID& s, const Dictiona
   catch( ConfigError& ) {}
 
   DatabaseConnectionID id( database, user, password, host, port );
-  return new PostgreSQLStore( s, id, m_connectionPoolPtr.get() );
+  PostgreSQLStore* pStore = new PostgreSQLStore( s, id, m_connectionPoolPtr.get() );
+
+  try { pStore->setBatchSize( settings.getInt( POSTGRESQL_STORE_BATCH_SIZE ) ); }
+  catch( ConfigError& ) {}
+
+  return pStore;
 }
 
 void PostgreSQLStoreFactory::destroy( MessageStore* pStore )
@@ -169,33 +184,41 @@ void PostgreSQLStoreFactory::destroy( MessageStore* pStore )
 bool PostgreSQLStore::set( int msgSeqNum, const std::string& msg )
 throw ( IOException )
 {
-  char* msgCopy = new char[ (msg.size() * 2) + 1 ];
-  PQescapeString( msgCopy, msg.c_str(), msg.size() );
+  // a message taking the next sender sequence number writes the number
+  // after it in the same statement, so incrementing needs no query
+  bool withSeqNum = m_foldSenderMsgSeqNum
+    && msgSeqNum == m_cache.getNextSenderMsgSeqNum();
+  std::string queryString =
+    "INSERT INTO messages "
+    "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+    "VALUES ($1,$2,$3,$4,$5,$6)";
+  if( withSeqNum )
+  {
+    queryString = "WITH seqnums AS (UPDATE sessions SET outgoing_seqnum=$7 WHERE "
+      + std::string( SESSION_KEY ) + ") " + queryString;
+  }
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "'" << m_sessionID.getBeginString().getValue() << "',"
-  << "'" << m_sessionID.getSenderCompID().getValue() << "',"
-  << "'" << m_sessionID.getTargetCompID().getValue() << "',"
-  << "'" << m_sessionID.getSessionQualifier() << "',"
-  << msgSeqNum << ","
-  << "'" << msgCopy << "')";
-
-  delete [] msgCopy;
+  PostgreSQLQuery query( queryString );
+  addSessionParameters( query );
+  query.addParameter( IntConvertor::convert( msgSeqNum ) );
+  query.addParameter( msg );
+  if( withSeqNum )
+    query.addParameter( IntConvertor::convert( msgSeqNum + 1 ) );
 
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  m_lastMsgSeqNum = msgSeqNum;
+  m_writtenSenderMsgSeqNum = 0;
+  if( m_pConnection->execute(query) )
   {
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message='" << msg << "' WHERE "
-    << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-    << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-    << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-    << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-    << "msgseqnum=" << msgSeqNum;
-    PostgreSQLQuery query2( queryString2.str() );
+    if( withSeqNum )
+      m_writtenSenderMsgSeqNum = msgSeqNum + 1;
+  }
+  else
+  {
+    PostgreSQLQuery query2( "UPDATE messages SET message=$6 WHERE "
+                            + std::string( SESSION_KEY ) + " and msgseqnum=$5" );
+    addSessionParameters( query2 );
+    query2.addParameter( IntConvertor::convert( msgSeqNum ) );
+    query2.addParameter( msg );
     if( !m_pConnection->execute(query2) )
       query2.throwException();
   }
@@ -203,21 +226,63 @@ throw ( IOException )
   return true;
 }
 
+void PostgreSQLStore::setBatch( const MessageBatch& batch )
+throw ( IOException )
+{
+  MessageBatch::const_iterator i = batch.begin();
+  while( i != batch.end() )
+  {
+    MessageBatch::const_iterator first = i;
+    std::stringstream queryString;
+    queryString << "INSERT INTO messages "
+    << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+    << "VALUES ";
+
+    // the statement differs only by its number of rows, the session
+    // key is shared by all of them
+    for( int row = 0; i != batch.end() && row < m_batchSize; ++i, ++row )
+    {
+      if( row ) queryString << ",";
+      queryString << "($1,$2,$3,$4,$" << 5 + row * 2 << ",$" << 6 + row * 2 << ")";
+    }
+
+    PostgreSQLQuery query( queryString.str() );
+    addSessionParameters( query );
+    for( MessageBatch::const_iterator j = first; j != i; ++j )
+    {
+      query.addParameter( IntConvertor::convert( j->first ) );
+      query.addParameter( *j->second );
+    }
+
+    // a message stored before makes the INSERT fail, set replaces it
+    if( !m_pConnection->execute(query) )
+    {
+      for( ; first != i; ++first )
+        set( first->first, *first->second );
+    }
+  }
+}
+
+void PostgreSQLStore::addSessionParameters( PostgreSQLQuery& query ) const
+{
+  query.addParameter( m_sessionID.getBeginString().getValue() );
+  query.addParameter( m_sessionID.getSenderCompID().getValue() );
+  query.addParameter( m_sessionID.getTargetCompID().getValue() );
+  query.addParameter( m_sessionID.getSessionQualifier() );
+}
+
 void PostgreSQLStore::get( int begin, int end,
                       std::vector < std::string > & result ) const
 throw ( IOException )
 {
   result.clear();
-  std::stringstream queryString;
-  queryString << "SELECT message FROM messages WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-  << "msgseqnum>=" << begin << " and " << "msgseqnum<=" << end << " "
-  << "ORDER BY msgseqnum";
+  PostgreSQLQuery query( "SELECT message FROM messages WHERE "
+                         + std::string( SESSION_KEY ) + " and "
+                         "msgseqnum>=$5 and msgseqnum<=$6 ORDER BY msgseqnum" );
+  addSessionParameters( query );
+  query.addParameter( IntConvertor::convert( begin ) );
+  query.addParameter( IntConvertor::convert( end ) );
 
-  PostgreSQLQuery query( queryString.str() );
   if( !m_pConnection->execute(query) )
     query.throwException();
 
@@ -226,6 +291,40 @@ throw ( IOException )
     result.push_back( query.getValue( row, 0 ) );
 }
 
+void PostgreSQLStore::forEach( int begin, int end,
+                               StoredMessageCallback& callback ) const
+throw ( IOException )
+{
+  // one ordered range query per batch, each starting after the last row
+  // of the one before, so the connection is free during the callbacks
+  std::stringstream queryString;
+  queryString << "SELECT msgseqnum, message FROM messages WHERE "
+  << SESSION_KEY << " and msgseqnum>=$5 and msgseqnum<=$6 "
+  << "ORDER BY msgseqnum LIMIT " << (int)FOR_EACH_BATCH;
+
+  std::string message;
+  while ( begin <= end )
+  {
+    PostgreSQLQuery query( queryString.str() );
+    addSessionParameters( query );
+    query.addParameter( IntConvertor::convert( begin ) );
+    query.addParameter( IntConvertor::convert( end ) );
+
+    if( !m_pConnection->execute(query) )
+      query.throwException();
+
+    int rows = query.rows();
+    for( int row = 0; row < rows; row++ )
+    {
+      begin = atol( query.getValue( row, 0 ) ) + 1;
+      message = query.getValue( row, 1 );
+      callback.onMessage( message );
+    }
+    if( rows < FOR_EACH_BATCH )
+      break;
+  }
+}
+
 int PostgreSQLStore::getNextSenderMsgSeqNum() const throw ( IOException )
 {
   return m_cache.getNextSenderMsgSeqNum();
@@ -238,14 +337,11 @@ int PostgreSQLStore::getNextTargetMsgSeqNum() const throw ( IOException )
 
 void PostgreSQLStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
+  PostgreSQLQuery query( "UPDATE sessions SET outgoing_seqnum=$5 WHERE "
+                         + std::string( SESSION_KEY ) );
+  addSessionParameters( query );
+  query.addParameter( IntConvertor::convert( value ) );
 
-  PostgreSQLQuery query( queryString.str() );
   if( !m_pConnection->execute(query) )
     query.throwException();
 
@@ -254,24 +350,44 @@ void PostgreSQLStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 
 void PostgreSQLStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
+  PostgreSQLQuery query( "UPDATE sessions SET incoming_seqnum=$5 WHERE "
+                         + std::string( SESSION_KEY ) );
+  addSessionParameters( query );
+  query.addParameter( IntConvertor::convert( value ) );
 
-  PostgreSQLQuery query( queryString.str() );
   if( !m_pConnection->execute(query) )
     query.throwException();
 
   m_cache.setNextTargetMsgSeqNum( value );
 }
 
+void PostgreSQLStore::setNextMsgSeqNums( int sender, int target ) throw ( IOException )
+{
+  PostgreSQLQuery query( "UPDATE sessions SET outgoing_seqnum=$5, incoming_seqnum=$6 WHERE "
+                         + std::string( SESSION_KEY ) );
+  addSessionParameters( query );
+  query.addParameter( IntConvertor::convert( sender ) );
+  query.addParameter( IntConvertor::convert( target ) );
+
+  if( !m_pConnection->execute(query) )
+    query.throwException();
+
+  m_cache.setNextSenderMsgSeqNum( sender );
+  m_cache.setNextTargetMsgSeqNum( target );
+}
+
 void PostgreSQLStore::incrNextSenderMsgSeqNum() throw ( IOException )
 {
-  m_cache.incrNextSenderMsgSeqNum();
-  setNextSenderMsgSeqNum( m_cache.getNextSenderMsgSeqNum() );
+  // the number is written before returning, unless the message that
+  // took it already wrote it
+  int next = m_cache.getNextSenderMsgSeqNum() + 1;
+  if( m_lastMsgSeqNum == next - 1 )
+    m_foldSenderMsgSeqNum = true;
+  if( m_writtenSenderMsgSeqNum == next )
+    m_cache.setNextSenderMsgSeqNum( next );
+  else
+    setNextSenderMsgSeqNum( next );
+  m_writtenSenderMsgSeqNum = 0;
 }
 
 void PostgreSQLStore::incrNextTargetMsgSeqNum() throw ( IOException )
@@ -48,6 +48,7 @@ public:
   static const std::string DEFAULT_PASSWORD;
   static const std::string DEFAULT_HOST;
   static const short DEFAULT_PORT;
+  enum { DEFAULT_BATCH_SIZE = 100 };
 
   PostgreSQLStoreFactory( const SessionSettings& settings )
 : m_settings( settings ), m_useSettings( true ), m_useDictionary( false ) 
@@ -113,12 +114,15 @@ public:
   ~PostgreSQLStore();
 
   bool set( int, const std::string& ) throw ( IOException );
+  void setBatch( const MessageBatch& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  void forEach( int, int, StoredMessageCallback& ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException );
   int getNextTargetMsgSeqNum() const throw ( IOException );
   void setNextSenderMsgSeqNum( int value ) throw ( IOException );
   void setNextTargetMsgSeqNum( int value ) throw ( IOException );
+  void setNextMsgSeqNums( int sender, int target ) throw ( IOException );
   void incrNextSenderMsgSeqNum() throw ( IOException );
   void incrNextTargetMsgSeqNum() throw ( IOException );
 
@@ -127,13 +131,27 @@ public:
   void reset() throw ( IOException );
   void refresh() throw ( IOException );
 
+  /// Most messages written by one INSERT in setBatch
+  void setBatchSize( int value )
+  { m_batchSize = value > 0 ? value : 1; }
+
 private:
   void populateCache();
+  void addSessionParameters( PostgreSQLQuery& ) const;
 
   MemoryStore m_cache;
   PostgreSQLConnection* m_pConnection;
   PostgreSQLConnectionPool* m_pConnectionPool;
   SessionID m_sessionID;
+  int m_batchSize;
+  /// Set once a message is stored before the number it took is used up,
+  /// from then on the number that follows is written along with the
+  /// message rather than by a query of its own
+  bool m_foldSenderMsgSeqNum;
+  /// Number of the last message stored
+  int m_lastMsgSeqNum;
+  /// Next sender sequence number written along with that message
+  int m_writtenSenderMsgSeqNum;
 };
 }
 
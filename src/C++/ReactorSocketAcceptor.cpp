@@ -0,0 +1,225 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "ReactorSocketAcceptor.h"
+#include "Session.h"
+#include "Settings.h"
+#include "Utility.h"
+#include "Exceptions.h"
+
+namespace FIX
+{
+ReactorSocketAcceptor::ReactorSocketAcceptor( Application& application,
+                                              MessageStoreFactory& factory,
+                                              const SessionSettings& settings )
+throw( ConfigError )
+: Acceptor( application, factory, settings ),
+  m_pMonitor( 0 ) {}
+
+ReactorSocketAcceptor::ReactorSocketAcceptor( Application& application,
+                                              MessageStoreFactory& factory,
+                                              const SessionSettings& settings,
+                                              LogFactory& logFactory )
+throw( ConfigError )
+: Acceptor( application, factory, settings, logFactory ),
+  m_pMonitor( 0 ) {}
+
+ReactorSocketAcceptor::~ReactorSocketAcceptor()
+{
+  close();
+}
+
+void ReactorSocketAcceptor::onConfigure( const SessionSettings& s )
+throw ( ConfigError )
+{
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    settings.getInt( SOCKET_ACCEPT_PORT );
+    if( settings.has(SOCKET_REUSE_ADDRESS) )
+      settings.getBool( SOCKET_REUSE_ADDRESS );
+    if( settings.has(SOCKET_NODELAY) )
+      settings.getBool( SOCKET_NODELAY );
+  }
+
+  const Dictionary& dict = s.get();
+  SocketMonitor::parseType( dict );
+  if( dict.has(REACTOR_THREADS) && dict.getInt(REACTOR_THREADS) < 1 )
+    throw ConfigError( std::string(REACTOR_THREADS) + " must be positive" );
+  if( dict.has(REACTOR_THREAD_AFFINITY) )
+    dict.getBool( REACTOR_THREAD_AFFINITY );
+}
+
+void ReactorSocketAcceptor::onInitialize( const SessionSettings& s )
+throw ( RuntimeError )
+{
+  close();
+
+  const Dictionary& dict = s.get();
+  SocketMonitor::Type type = SocketMonitor::parseType( dict );
+  const int threads = dict.has( REACTOR_THREADS ) ?
+    dict.getInt( REACTOR_THREADS ) : process_cpus();
+  const bool affinity = dict.has( REACTOR_THREAD_AFFINITY ) ?
+    dict.getBool( REACTOR_THREAD_AFFINITY ) : false;
+
+  m_pMonitor = new SocketMonitor( 1, type );
+  for( int thread = 0; thread < threads; ++thread )
+  {
+    m_reactors.push_back( new SocketReactor
+      ( *this, type, affinity ? thread % process_cpus() : -1 ) );
+  }
+
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i = sessions.begin();
+  for( ; i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    short port = (short)settings.getInt( SOCKET_ACCEPT_PORT );
+
+    const bool reuseAddress = settings.has( SOCKET_REUSE_ADDRESS ) ?
+      settings.getBool( SOCKET_REUSE_ADDRESS ) : true;
+
+    const bool noDelay = settings.has( SOCKET_NODELAY ) ?
+      settings.getBool( SOCKET_NODELAY ) : false;
+
+    const int sendBufSize = settings.has( SOCKET_SEND_BUFFER_SIZE ) ?
+      settings.getInt( SOCKET_SEND_BUFFER_SIZE ) : 0;
+
+    const int rcvBufSize = settings.has( SOCKET_RECEIVE_BUFFER_SIZE ) ?
+      settings.getInt( SOCKET_RECEIVE_BUFFER_SIZE ) : 0;
+
+    m_portToSessions[port].insert( *i );
+    if( m_portToSessions[port].size() > 1 )
+      continue;
+
+    int socket = socket_createAcceptor( port, reuseAddress );
+    if( socket < 0 )
+    {
+      SocketException e;
+      throw RuntimeError( "Unable to create, bind, or listen to port "
+                         + IntConvertor::convert( (unsigned short)port ) + " (" + e.what() + ")" );
+    }
+
+    m_socketToInfo[socket] = SocketInfo( port, noDelay, sendBufSize, rcvBufSize );
+    m_pMonitor->addRead( socket );
+  }
+}
+
+void ReactorSocketAcceptor::onStart()
+{
+  while ( !isStopped() && m_pMonitor )
+    m_pMonitor->block( *this );
+}
+
+bool ReactorSocketAcceptor::onPoll( double timeout )
+{
+  if( !m_pMonitor || isStopped() )
+    return false;
+
+  m_pMonitor->block( *this, true, timeout );
+  return true;
+}
+
+void ReactorSocketAcceptor::onStop()
+{
+  Reactors::iterator i;
+  for( i = m_reactors.begin(); i != m_reactors.end(); ++i )
+    (*i)->stop();
+}
+
+void ReactorSocketAcceptor::close()
+{
+  Reactors::iterator i;
+  for( i = m_reactors.begin(); i != m_reactors.end(); ++i )
+    delete *i;
+  m_reactors.clear();
+
+  // the monitor closes the listening sockets
+  delete m_pMonitor;
+  m_pMonitor = 0;
+  m_socketToInfo.clear();
+  m_portToSessions.clear();
+}
+
+void ReactorSocketAcceptor::onConnect( SocketMonitor&, int )
+{
+}
+
+void ReactorSocketAcceptor::onEvent( SocketMonitor&, int a )
+{
+  SocketToInfo::iterator i = m_socketToInfo.find( a );
+  if( i == m_socketToInfo.end() ) return;
+  const SocketInfo& info = i->second;
+
+  // accept everything that is waiting, reconnects tend to come in bursts
+  int s = 0;
+  while( socket_isValid( s = socket_accept( a ) ) )
+  {
+    if( info.m_noDelay )
+      socket_setsockopt( s, TCP_NODELAY );
+    if( info.m_sendBufSize )
+      socket_setsockopt( s, SO_SNDBUF, info.m_sendBufSize );
+    if( info.m_rcvBufSize )
+      socket_setsockopt( s, SO_RCVBUF, info.m_rcvBufSize );
+
+    SocketReactor* pReactor = m_reactors.front();
+    Reactors::iterator j;
+    for( j = m_reactors.begin(); j != m_reactors.end(); ++j )
+    {
+      if( (*j)->size() < pReactor->size() )
+        pReactor = *j;
+    }
+
+    std::stringstream stream;
+    stream << "Accepted connection from " << socket_peername( s ) << " on port " << info.m_port;
+    if( getLog() )
+      getLog()->onEvent( stream.str() );
+
+    pReactor->add( new SocketConnection
+      ( s, m_portToSessions[info.m_port], &pReactor->getMonitor(),
+        getSendBatch() ) );
+  }
+}
+
+void ReactorSocketAcceptor::onWrite( SocketMonitor&, int )
+{
+}
+
+void ReactorSocketAcceptor::onError( SocketMonitor&, int )
+{
+}
+
+void ReactorSocketAcceptor::onError( SocketMonitor& )
+{
+}
+
+bool ReactorSocketAcceptor::onData( SocketReactor& reactor,
+                                    SocketConnection& connection )
+{
+  return connection.read( *this, reactor.getMonitor() );
+}
+}
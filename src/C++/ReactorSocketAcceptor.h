@@ -0,0 +1,101 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_REACTORSOCKETACCEPTOR_H
+#define FIX_REACTORSOCKETACCEPTOR_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Acceptor.h"
+#include "SocketMonitor.h"
+#include "SocketReactor.h"
+
+namespace FIX
+{
+/**
+ * Socket implementation of Acceptor that spreads its connections over
+ * a pool of event loop threads.
+ *
+ * The acceptor's own thread only accepts connections and hands each one
+ * to the SocketReactor with the fewest connections, which then parses
+ * its messages and drives its session. The number of event loops is set
+ * with ReactorThreads and defaults to the number of processors, with
+ * ReactorThreadAffinity each of them is pinned to a processor of its own.
+ */
+class ReactorSocketAcceptor : public Acceptor, SocketMonitor::Strategy,
+                              SocketReactor::Strategy
+{
+public:
+  ReactorSocketAcceptor( Application&, MessageStoreFactory&,
+                         const SessionSettings& ) throw( ConfigError );
+  ReactorSocketAcceptor( Application&, MessageStoreFactory&,
+                         const SessionSettings&, LogFactory& ) throw( ConfigError );
+
+  virtual ~ReactorSocketAcceptor();
+
+private:
+  struct SocketInfo
+  {
+    SocketInfo()
+    : m_port( 0 ), m_noDelay( false ), m_sendBufSize( 0 ), m_rcvBufSize( 0 ) {}
+    SocketInfo( int port, bool noDelay, int sendBufSize, int rcvBufSize )
+    : m_port( port ), m_noDelay( noDelay ),
+      m_sendBufSize( sendBufSize ), m_rcvBufSize( rcvBufSize ) {}
+
+    int m_port;
+    bool m_noDelay;
+    int m_sendBufSize;
+    int m_rcvBufSize;
+  };
+
+  typedef std::set < SessionID > Sessions;
+  typedef std::map < int, Sessions > PortToSessions;
+  typedef std::map < int, SocketInfo > SocketToInfo;
+  typedef std::vector < SocketReactor* > Reactors;
+
+  void onConfigure( const SessionSettings& ) throw ( ConfigError );
+  void onInitialize( const SessionSettings& ) throw ( RuntimeError );
+
+  void onStart();
+  bool onPoll( double timeout );
+  void onStop();
+
+  void close();
+
+  void onConnect( SocketMonitor&, int );
+  void onEvent( SocketMonitor&, int );
+  void onWrite( SocketMonitor&, int );
+  void onError( SocketMonitor&, int );
+  void onError( SocketMonitor& );
+
+  bool onData( SocketReactor&, SocketConnection& );
+
+  SocketMonitor* m_pMonitor;
+  SocketToInfo m_socketToInfo;
+  PortToSessions m_portToSessions;
+  Reactors m_reactors;
+};
+/*! @} */
+}
+
+#endif //FIX_REACTORSOCKETACCEPTOR_H
@@ -0,0 +1,237 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "ReactorSocketInitiator.h"
+#include "Session.h"
+#include "Settings.h"
+
+namespace FIX
+{
+ReactorSocketInitiator::ReactorSocketInitiator( Application& application,
+                                                MessageStoreFactory& factory,
+                                                const SessionSettings& settings )
+throw( ConfigError )
+: Initiator( application, factory, settings ),
+  m_lastConnect( 0 ), m_reconnectInterval( 30 ), m_noDelay( false ),
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 )
+{
+}
+
+ReactorSocketInitiator::ReactorSocketInitiator( Application& application,
+                                                MessageStoreFactory& factory,
+                                                const SessionSettings& settings,
+                                                LogFactory& logFactory )
+throw( ConfigError )
+: Initiator( application, factory, settings, logFactory ),
+  m_lastConnect( 0 ), m_reconnectInterval( 30 ), m_noDelay( false ),
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 )
+{
+}
+
+ReactorSocketInitiator::~ReactorSocketInitiator()
+{
+  close();
+}
+
+void ReactorSocketInitiator::onConfigure( const SessionSettings& s )
+throw ( ConfigError )
+{
+  const Dictionary& dict = s.get();
+
+  if( dict.has( RECONNECT_INTERVAL ) )
+    m_reconnectInterval = dict.getInt( RECONNECT_INTERVAL );
+  if( dict.has( SOCKET_NODELAY ) )
+    m_noDelay = dict.getBool( SOCKET_NODELAY );
+  if( dict.has( SOCKET_SEND_BUFFER_SIZE ) )
+    m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
+  if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
+    m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+
+  SocketMonitor::parseType( dict );
+  if( dict.has(REACTOR_THREADS) && dict.getInt(REACTOR_THREADS) < 1 )
+    throw ConfigError( std::string(REACTOR_THREADS) + " must be positive" );
+  if( dict.has(REACTOR_THREAD_AFFINITY) )
+    dict.getBool( REACTOR_THREAD_AFFINITY );
+}
+
+void ReactorSocketInitiator::onInitialize( const SessionSettings& s )
+throw ( RuntimeError )
+{
+  close();
+
+  const Dictionary& dict = s.get();
+  SocketMonitor::Type type = SocketMonitor::parseType( dict );
+  const int threads = dict.has( REACTOR_THREADS ) ?
+    dict.getInt( REACTOR_THREADS ) : process_cpus();
+  const bool affinity = dict.has( REACTOR_THREAD_AFFINITY ) ?
+    dict.getBool( REACTOR_THREAD_AFFINITY ) : false;
+
+  for( int thread = 0; thread < threads; ++thread )
+  {
+    m_reactors.push_back( new SocketReactor
+      ( *this, type, affinity ? thread % process_cpus() : -1 ) );
+  }
+
+  // a session always reconnects through the same reactor
+  std::set<SessionID> sessions = getSessions();
+  std::set<SessionID>::iterator i = sessions.begin();
+  for( int session = 0; i != sessions.end(); ++i, ++session )
+    m_sessionToReactor[ *i ] = m_reactors[ session % m_reactors.size() ];
+}
+
+void ReactorSocketInitiator::onStart()
+{
+  connect();
+
+  while ( !isStopped() )
+  {
+    process_sleep( 1 );
+    onTimeout();
+  }
+}
+
+bool ReactorSocketInitiator::onPoll( double timeout )
+{
+  if( isStopped() )
+    return false;
+
+  onTimeout();
+  return true;
+}
+
+void ReactorSocketInitiator::onStop()
+{
+  Reactors::iterator i;
+  for( i = m_reactors.begin(); i != m_reactors.end(); ++i )
+    (*i)->stop();
+}
+
+void ReactorSocketInitiator::doConnect( const SessionID& s, const Dictionary& d )
+{
+  try
+  {
+    std::string address;
+    short port = 0;
+    Session* session = Session::lookupSession( s );
+    if( !session->isSessionTime(UtcTimeStamp()) ) return;
+
+    SessionToReactor::iterator i = m_sessionToReactor.find( s );
+    if( i == m_sessionToReactor.end() ) return;
+    SocketReactor* pReactor = i->second;
+
+    Log* log = session->getLog();
+
+    getHost( s, d, address, port );
+
+    int socket = socket_createConnector();
+    if( socket < 0 ) return;
+    if( m_noDelay )
+      socket_setsockopt( socket, TCP_NODELAY );
+    if( m_sendBufSize )
+      socket_setsockopt( socket, SO_SNDBUF, m_sendBufSize );
+    if( m_rcvBufSize )
+      socket_setsockopt( socket, SO_RCVBUF, m_rcvBufSize );
+
+    log->onEvent( "Connecting to " + address + " on port " + IntConvertor::convert((unsigned short)port) );
+    setPending( s );
+
+    pReactor->connect( new SocketConnection
+      ( *this, s, socket, &pReactor->getMonitor() ), address, port );
+  }
+  catch ( std::exception& ) {}
+}
+
+void ReactorSocketInitiator::onTimeout()
+{
+  time_t now;
+  ::time( &now );
+
+  if ( (now - m_lastConnect) >= m_reconnectInterval )
+  {
+    connect();
+    m_lastConnect = now;
+  }
+}
+
+void ReactorSocketInitiator::close()
+{
+  Reactors::iterator i;
+  for( i = m_reactors.begin(); i != m_reactors.end(); ++i )
+    delete *i;
+  m_reactors.clear();
+  m_sessionToReactor.clear();
+}
+
+void ReactorSocketInitiator::onConnect( SocketReactor&,
+                                        SocketConnection& connection )
+{
+  setConnected( connection.getSession()->getSessionID() );
+  connection.onTimeout();
+}
+
+bool ReactorSocketInitiator::onData( SocketReactor& reactor,
+                                     SocketConnection& connection )
+{
+  return connection.read( reactor.getMonitor() );
+}
+
+void ReactorSocketInitiator::onDisconnect( SocketReactor&,
+                                           SocketConnection& connection )
+{
+  Session* pSession = connection.getSession();
+  if( pSession )
+    setDisconnected( pSession->getSessionID() );
+}
+
+void ReactorSocketInitiator::getHost( const SessionID& s, const Dictionary& d,
+                                      std::string& address, short& port )
+{
+  int num = 0;
+  SessionToHostNum::iterator i = m_sessionToHostNum.find( s );
+  if ( i != m_sessionToHostNum.end() ) num = i->second;
+
+  std::stringstream hostStream;
+  hostStream << SOCKET_CONNECT_HOST << num;
+  std::string hostString = hostStream.str();
+
+  std::stringstream portStream;
+  portStream << SOCKET_CONNECT_PORT << num;
+  std::string portString = portStream.str();
+
+  if( d.has(hostString) && d.has(portString) )
+  {
+    address = d.getString( hostString );
+    port = ( short ) d.getInt( portString );
+  }
+  else
+  {
+    num = 0;
+    address = d.getString( SOCKET_CONNECT_HOST );
+    port = ( short ) d.getInt( SOCKET_CONNECT_PORT );
+  }
+
+  m_sessionToHostNum[ s ] = ++num;
+}
+}
@@ -0,0 +1,87 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_REACTORSOCKETINITIATOR_H
+#define FIX_REACTORSOCKETINITIATOR_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Initiator.h"
+#include "SocketReactor.h"
+
+namespace FIX
+{
+/**
+ * Socket implementation of Initiator that spreads its sessions over
+ * a pool of event loop threads.
+ *
+ * Every session is assigned to one SocketReactor, which makes its
+ * connections and drives it from then on. The initiator's own thread
+ * only decides when to reconnect. The pool is configured like the one
+ * of ReactorSocketAcceptor.
+ */
+class ReactorSocketInitiator : public Initiator, SocketReactor::Strategy
+{
+public:
+  ReactorSocketInitiator( Application&, MessageStoreFactory&,
+                          const SessionSettings& ) throw( ConfigError );
+  ReactorSocketInitiator( Application&, MessageStoreFactory&,
+                          const SessionSettings&, LogFactory& ) throw( ConfigError );
+
+  virtual ~ReactorSocketInitiator();
+
+private:
+  typedef std::vector < SocketReactor* > Reactors;
+  typedef std::map < SessionID, SocketReactor* > SessionToReactor;
+  typedef std::map < SessionID, int > SessionToHostNum;
+
+  void onConfigure( const SessionSettings& ) throw ( ConfigError );
+  void onInitialize( const SessionSettings& ) throw ( RuntimeError );
+
+  void onStart();
+  bool onPoll( double timeout );
+  void onStop();
+
+  void doConnect( const SessionID&, const Dictionary& d );
+  void onTimeout();
+  void close();
+
+  void onConnect( SocketReactor&, SocketConnection& );
+  bool onData( SocketReactor&, SocketConnection& );
+  void onDisconnect( SocketReactor&, SocketConnection& );
+
+  void getHost( const SessionID&, const Dictionary&, std::string&, short& );
+
+  Reactors m_reactors;
+  SessionToReactor m_sessionToReactor;
+  SessionToHostNum m_sessionToHostNum;
+  time_t m_lastConnect;
+  int m_reconnectInterval;
+  bool m_noDelay;
+  int m_sendBufSize;
+  int m_rcvBufSize;
+};
+/*! @} */
+}
+
+#endif //FIX_REACTORSOCKETINITIATOR_H
@@ -26,17 +26,71 @@
 #pragma warning( disable : 4503 4355 4786 4290 )
 #endif
 
+#include "SessionSettings.h"
+#include "FieldConvertors.h"
+#include "Utility.h"
 #include <string>
 
 namespace FIX
 {
+  /// Limits on how many queued messages a transport writes with one call.
+  struct SendBatch
+  {
+    SendBatch()
+    : m_maxBytes( 65536 ), m_maxMessages( 64 ), m_cork( false ) {}
+
+    /// Read from the SendBatchBytes, SendBatchMessages and SocketCork settings
+    static SendBatch parse( const Dictionary& settings ) throw( ConfigError )
+    {
+      SendBatch batch;
+      if( settings.has( SEND_BATCH_BYTES ) )
+      {
+        int bytes = settings.getInt( SEND_BATCH_BYTES );
+        if( bytes <= 0 )
+          throw ConfigError( std::string(SEND_BATCH_BYTES) + " must be positive" );
+        batch.m_maxBytes = bytes;
+      }
+      if( settings.has( SEND_BATCH_MESSAGES ) )
+      {
+        int messages = settings.getInt( SEND_BATCH_MESSAGES );
+        if( messages <= 0 || (size_t)messages > SOCKET_SENDV_MAX )
+          throw ConfigError( std::string(SEND_BATCH_MESSAGES) + " must be between 1 and "
+                             + IntConvertor::convert( (int)SOCKET_SENDV_MAX ) );
+        batch.m_maxMessages = messages;
+      }
+      if( settings.has( SOCKET_CORK ) )
+        batch.m_cork = settings.getBool( SOCKET_CORK );
+      return batch;
+    }
+
+    /// A message longer than this still goes out, on its own
+    size_t m_maxBytes;
+    size_t m_maxMessages;
+    /// Flag every write but the last of a burst so the stack fills segments
+    bool m_cork;
+  };
+
   /// Interface implements sending on and disconnecting a transport.
   class Responder
   {
   public:
     virtual ~Responder() {}
     virtual bool send( const std::string& ) = 0;
+    /// Send several messages, each starting at its offset into its
+    /// string, transports that can write them together override this
+    virtual bool send( const std::string* messages,
+                       const size_t* offsets, size_t count )
+    {
+      for( size_t i = 0; i < count; ++i )
+      {
+        if( !send( offsets[i] ? messages[i].substr( offsets[i] ) : messages[i] ) )
+          return false;
+      }
+      return true;
+    }
     virtual void disconnect() = 0;
+    /// Session state changed outside of the transport's own thread
+    virtual void wakeup() {}
   };
 }
 
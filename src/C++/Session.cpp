@@ -24,16 +24,124 @@
 #endif
 
 #include "Session.h"
+#include "MessagePool.h"
 #include "Values.h"
+#include "AtomicCount.h"
 #include <algorithm>
 #include <iostream>
 
 namespace FIX
 {
-Session::Sessions Session::s_sessions;
+struct SessionHandle::Entry
+{
+  Entry( const SessionID& id ) : sessionID( id ), pSession( 0 ) {}
+
+  const SessionID sessionID;
+  Session* volatile pSession;
+};
+
+/**
+ * Sessions by SessionID, looked up without taking a lock.
+ *
+ * An open addressing hash table of entries that are never removed, an
+ * entry without a session is used again when its session comes back.
+ * Changes are made under Session::s_mutex and published with release
+ * stores.  A table that fills up is replaced by one twice its size, the
+ * old one is kept since readers may still be probing it.
+ */
+struct Session::Registry
+{
+  struct Table
+  {
+    explicit Table( size_t capacity )
+    : mask( capacity - 1 ),
+      slots( new SessionHandle::Entry* volatile[ capacity ]() ) {}
+    ~Table() { delete [] slots; }
+
+    size_t mask;
+    SessionHandle::Entry* volatile* slots;
+  };
+
+  Registry()
+  {
+    Table* pFirst = new Table( 64 );
+    tables.push_back( pFirst );
+    pTable = pFirst;
+  }
+
+  ~Registry()
+  {
+    for( size_t i = 0; i < tables.size(); ++i )
+      delete tables[ i ];
+    for( size_t i = 0; i < entries.size(); ++i )
+      delete entries[ i ];
+  }
+
+  SessionHandle::Entry* find( const SessionID& sessionID ) const
+  {
+    const Table* pCurrent = atomic_load_acquire( pTable );
+    for( size_t i = sessionID.getHash() & pCurrent->mask;;
+         i = ( i + 1 ) & pCurrent->mask )
+    {
+      SessionHandle::Entry* pEntry = atomic_load_acquire( pCurrent->slots[ i ] );
+      if( !pEntry || pEntry->sessionID == sessionID )
+        return pEntry;
+    }
+  }
+
+  /// Must be called with Session::s_mutex held
+  SessionHandle::Entry* insert( const SessionID& sessionID )
+  {
+    SessionHandle::Entry* pEntry = find( sessionID );
+    if( pEntry )
+      return pEntry;
+
+    pEntry = new SessionHandle::Entry( sessionID );
+    entries.push_back( pEntry );
+
+    // keep the table at most half full so probes stay short
+    if( 2 * entries.size() > pTable->mask + 1 )
+    {
+      Table* pLarger = new Table( 2 * ( pTable->mask + 1 ) );
+      for( size_t i = 0; i < entries.size(); ++i )
+        place( *pLarger, entries[ i ] );
+      tables.push_back( pLarger );
+      atomic_store_release( pTable, pLarger );
+    }
+    else
+      place( *pTable, pEntry );
+
+    return pEntry;
+  }
+
+  static void place( Table& table, SessionHandle::Entry* pEntry )
+  {
+    size_t i = pEntry->sessionID.getHash() & table.mask;
+    while( table.slots[ i ] )
+      i = ( i + 1 ) & table.mask;
+    atomic_store_release( table.slots[ i ], pEntry );
+  }
+
+  Table* volatile pTable;
+  std::vector<Table*> tables;
+  std::vector<SessionHandle::Entry*> entries;
+};
+
 Session::SessionIDs Session::s_sessionIDs;
 Session::Sessions Session::s_registered;
 Mutex Session::s_mutex;
+Session::Registry Session::s_registry;
+
+Session* SessionHandle::getSession() const
+{
+  return m_pEntry ? atomic_load_acquire( m_pEntry->pSession ) : 0;
+}
+
+const SessionID& SessionHandle::getSessionID() const
+{
+  static const SessionID empty;
+  return m_pEntry ? m_pEntry->sessionID : empty;
+}
 
 #define LOGEX( method ) try { method; } catch( std::exception& e ) \
   { m_state.onEvent( e.what() ); }
@@ -60,11 +168,18 @@ Session::Session( Application& application,
   m_refreshOnLogon( false ),
   m_millisecondsInTimeStamp( true ),
   m_persistMessages( true ),
+  m_resendToApp( true ),
   m_validateLengthAndChecksum( true ),
   m_dataDictionaryProvider( dataDictionaryProvider ),
   m_messageStoreFactory( messageStoreFactory ),
   m_pLogFactory( pLogFactory ),
-  m_pResponder( 0 )
+  m_pResponder( 0 ),
+  m_pendingWrites( false ),
+  m_flushing( false ),
+  m_numbered( 0 ),
+  m_epoch( 0 ),
+  m_tickets( 0 ),
+  m_stored( 0 )
 {
   m_state.heartBtInt( heartBtInt );
   m_state.initiate( heartBtInt != 0 );
@@ -83,6 +198,10 @@ Session::Session( Application& application,
 Session::~Session()
 {
   removeSession( *this );
+  for ( OutboundQueue::iterator i = m_outbound.begin(); i != m_outbound.end(); ++i )
+    delete *i;
+  for ( size_t i = 0; i < m_freeOutbound.size(); ++i )
+    delete m_freeOutbound[ i ];
   m_messageStoreFactory.destroy( m_state.store() );
   if ( m_pLogFactory && m_state.log() )
     m_pLogFactory->destroy( m_state.log() );
@@ -90,17 +209,20 @@ Session::~Session()
 
 void Session::insertSendingTime( Header& header )
 {
-  UtcTimeStamp now;
-  bool showMilliseconds = false;
-  if( m_sessionID.getBeginString() == BeginString_FIXT11 )
-    showMilliseconds = true;
-  else
-    showMilliseconds = m_sessionID.getBeginString() >= BeginString_FIX42;
+  insertSendingTime( header, UtcTimeStamp() );
+}
 
-  header.setField( SendingTime(now, showMilliseconds && m_millisecondsInTimeStamp) );
+void Session::insertSendingTime( Header& header, const UtcTimeStamp& now )
+{
+  header.setField( SendingTime(now, showMilliseconds()) );
 }
 
 void Session::insertOrigSendingTime( Header& header, const UtcTimeStamp& when )
+{
+  header.setField( OrigSendingTime(when, showMilliseconds()) );
+}
+
+bool Session::showMilliseconds()
 {
   bool showMilliseconds = false;
   if( m_sessionID.getBeginString() == BeginString_FIXT11 )
@@ -108,7 +230,7 @@ void Session::insertOrigSendingTime( Header& header, const UtcTimeStamp& when )
   else
     showMilliseconds = m_sessionID.getBeginString() >= BeginString_FIX42;
 
-  header.setField( OrigSendingTime(when, showMilliseconds && m_millisecondsInTimeStamp) );
+  return showMilliseconds && m_millisecondsInTimeStamp;
 }
 
 void Session::fill( Header& header )
@@ -118,8 +240,8 @@ void Session::fill( Header& header )
   header.setField( m_sessionID.getBeginString() );
   header.setField( m_sessionID.getSenderCompID() );
   header.setField( m_sessionID.getTargetCompID() );
-  header.setField( MsgSeqNum( getExpectedSenderNum() ) );
-  insertSendingTime( header );
+  header.setField( MsgSeqNum( nextSenderMsgSeqNum() ) );
+  insertSendingTime( header, now );
 }
 
 void Session::next()
@@ -131,6 +253,12 @@ void Session::next( const UtcTimeStamp& timeStamp )
 {
   try
   {
+    {
+      Locker l( m_mutex );
+      m_state.onTimer();
+      m_pendingWrites = m_state.hasPendingWrites();
+    }
+
     if ( !checkSessionTime(timeStamp) )
       { reset(); return; }
 
@@ -155,7 +283,7 @@ void Session::next( const UtcTimeStamp& timeStamp )
         generateLogon();
         m_state.onEvent( "Initiated logon request" );
       }
-      else if ( m_state.alreadySentLogon() && m_state.logonTimedOut() )
+      else if ( m_state.alreadySentLogon() && m_state.logonTimedOut( timeStamp ) )
       {
         m_state.onEvent( "Timed out waiting for logon response" );
         disconnect();
@@ -165,28 +293,28 @@ void Session::next( const UtcTimeStamp& timeStamp )
 
     if ( m_state.heartBtInt() == 0 ) return ;
 
-    if ( m_state.logoutTimedOut() )
+    if ( m_state.logoutTimedOut( timeStamp ) )
     {
       m_state.onEvent( "Timed out waiting for logout response" );
       disconnect();
     }
 
-    if ( m_state.withinHeartBeat() ) return ;
+    if ( m_state.withinHeartBeat( timeStamp ) ) return ;
 
-    if ( m_state.timedOut() )
+    if ( m_state.timedOut( timeStamp ) )
     {
       m_state.onEvent( "Timed out waiting for heartbeat" );
       disconnect();
     }
     else
     {
-      if ( m_state.needTestRequest() )
+      if ( m_state.needTestRequest( timeStamp ) )
       {
         generateTestRequest( "TEST" );
         m_state.testRequest( m_state.testRequest() + 1 );
         m_state.onEvent( "Sent test request TEST" );
       }
-      else if ( m_state.needHeartbeat() )
+      else if ( m_state.needHeartbeat( timeStamp ) )
       {
         generateHeartbeat();
       }
@@ -230,7 +358,7 @@ void Session::nextLogon( const Message& logon, const UtcTimeStamp& timeStamp )
   if( m_state.receivedReset() )
   {
     m_state.onEvent( "Logon contains ResetSeqNumFlag=Y, reseting sequence numbers to 1" );
-    if( !m_state.sentReset() ) m_state.reset();
+    if( !m_state.sentReset() ) resetStore();
   }
 
   if( m_state.shouldSendLogon() && !m_state.receivedReset() )
@@ -241,7 +369,7 @@ void Session::nextLogon( const Message& logon, const UtcTimeStamp& timeStamp )
   }
 
   if( !m_state.initiate() && m_resetOnLogon )
-    m_state.reset();
+    resetStore();
 
   if( !verify( logon, false, true ) )
     return;
@@ -305,7 +433,7 @@ void Session::nextLogout( const Message& logout, const UtcTimeStamp& timeStamp )
     m_state.onEvent( "Received logout response" );
 
   m_state.incrNextTargetMsgSeqNum();
-  if ( m_resetOnLogout ) m_state.reset();
+  if ( m_resetOnLogout ) resetStore();
   disconnect();
 }
 
@@ -341,11 +469,97 @@ void Session::nextSequenceReset( const Message& sequenceReset, const UtcTimeStam
   }
 }
 
+/// Resends the messages of a ResendRequest as the store passes them on
+struct Session::Resender : public StoredMessageCallback
+{
+  Resender( Session& s, int beginSeqNo )
+  : session( s ), begin( 0 ), current( beginSeqNo ), last( 0 ), count( 0 ),
+    start( 0 ), msg( *message ) {}
+
+  void onMessage( const std::string& stored );
+
+  Session& session;
+  /// Start of the gap not filled yet, zero if there is none
+  int begin;
+  int current;
+  int last;
+  int count;
+  std::string msgType;
+  std::string messageString;
+  /// Where the message begins in messageString
+  std::string::size_type start;
+  std::string sendingTime;
+  PooledMessage message;
+  Message& msg;
+};
+
+void Session::Resender::onMessage( const std::string& stored )
+{
+  int msgSeqNum = 0;
+  if ( !Message::readHeader( stored, msgType, msgSeqNum ) )
+    return;
+
+  if( (current != msgSeqNum) && !begin )
+    begin = current;
+
+  bool resent = false;
+  if ( !Message::isAdminMsgType( msgType ) )
+  {
+    if ( session.m_resendToApp )
+    {
+      try
+      {
+        session.parseStored( stored, msg );
+        if ( session.resend( msg ) )
+        {
+          start = msg.toBuffer( messageString );
+          resent = true;
+        }
+      }
+      catch ( InvalidMessage& e )
+      {
+        session.m_state.onEvent( "Unable to resend message "
+                                 + IntConvertor::convert( msgSeqNum )
+                                 + ": " + e.what() );
+      }
+    }
+    else
+    {
+      if ( sendingTime.empty() )
+        sendingTime = UtcTimeStampConvertor::convert
+          ( UtcTimeStamp(), session.showMilliseconds() );
+      resent = Message::toPossDup( stored, sendingTime, messageString, start );
+    }
+  }
+
+  // admin messages and those not resent are covered by one gap fill
+  if ( resent )
+  {
+    if ( begin ) session.generateSequenceReset( begin, msgSeqNum );
+    session.send( messageString, start );
+    session.m_state.onEvent( "Resending Message: "
+                             + IntConvertor::convert( msgSeqNum ) );
+    begin = 0;
+  }
+  else
+  { if ( !begin ) begin = msgSeqNum; }
+  current = msgSeqNum + 1;
+  last = msgSeqNum;
+
+  // written a batch at a time instead of queueing the whole range
+  if ( ++count % MessageStore::FOR_EACH_BATCH == 0 )
+  {
+    session.writeQueued();
+    sendingTime.clear();
+  }
+}
+
 void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStamp& timeStamp )
 {
   if ( !verify( resendRequest, false, false ) ) return ;
 
   Locker l( m_mutex );
+  waitForStored();
 
   BeginSeqNo beginSeqNo;
   EndSeqNo endSeqNo;
@@ -372,81 +586,54 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
     return;
   }
 
-  std::vector < std::string > messages;
-  m_state.get( beginSeqNo, endSeqNo, messages );
+  Resender resender( *this, beginSeqNo );
+  m_state.forEach( beginSeqNo, endSeqNo, resender );
+  writeQueued();
 
-  std::vector < std::string > ::iterator i;
-  MsgSeqNum msgSeqNum(0);
-  MsgType msgType;
-  int begin = 0;
-  int current = beginSeqNo;
-  std::string messageString;
-  Message msg;
+  int begin = resender.begin;
+  int last = resender.last;
+  if ( endSeqNo > last && !begin )
+    begin = resender.current;
 
-  for ( i = messages.begin(); i != messages.end(); ++i )
+  if ( begin )
   {
-    const DataDictionary& sessionDD = 
-      m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
-
-    if( m_sessionID.isFIXT() )
+    int end = last + 1;
+    if ( endSeqNo > last )
     {
-      msg.setStringHeader(*i);
-      ApplVerID applVerID;
-      if( !msg.getHeader().getFieldIfSet(applVerID) )
-        applVerID = m_senderDefaultApplVerID;
-
-      const DataDictionary& applicationDD =
-        m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
-      msg = Message( *i, sessionDD, applicationDD, m_validateLengthAndChecksum );
-    }
-    else
-    {
-      msg = Message( *i, sessionDD, m_validateLengthAndChecksum );
+      end = endSeqNo + 1;
+      int next = m_state.getNextSenderMsgSeqNum();
+      if( end > next )
+        end = next;
     }
+    generateSequenceReset( begin, end );
+  }
 
+  MsgSeqNum msgSeqNum;
+  resendRequest.getHeader().getField( msgSeqNum );
+  if( !isTargetTooHigh(msgSeqNum) && !isTargetTooLow(msgSeqNum) )
+    m_state.incrNextTargetMsgSeqNum();
+}
 
-    msg.getHeader().getField( msgSeqNum );
-    msg.getHeader().getField( msgType );
-
-    if( (current != msgSeqNum) && !begin )
-      begin = current;
+void Session::parseStored( const std::string& string, Message& message )
+{
+  const DataDictionary& sessionDD = 
+    m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
 
-    if ( Message::isAdminMsgType( msgType ) )
-    {
-      if ( !begin ) begin = msgSeqNum;
-    }
-    else
-    {
-      if ( resend( msg ) )
-      {
-        if ( begin ) generateSequenceReset( begin, msgSeqNum );
-        send( msg.toString(messageString) );
-        m_state.onEvent( "Resending Message: "
-                         + IntConvertor::convert( msgSeqNum ) );
-        begin = 0;
-      }
-      else
-      { if ( !begin ) begin = msgSeqNum; }
-    }
-    current = msgSeqNum + 1;
-  }
-  if ( begin )
+  if( m_sessionID.isFIXT() )
   {
-    generateSequenceReset( begin, msgSeqNum + 1 );
+    message.setStringHeader(string);
+    ApplVerID applVerID;
+    if( !message.getHeader().getFieldIfSet(applVerID) )
+      applVerID = m_senderDefaultApplVerID;
+
+    const DataDictionary& applicationDD =
+      m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
+    message.setString( string, sessionDD, applicationDD, m_validateLengthAndChecksum );
   }
-
-  if ( endSeqNo > msgSeqNum )
+  else
   {
-    endSeqNo = EndSeqNo(endSeqNo + 1);
-    int next = m_state.getNextSenderMsgSeqNum();
-    if( endSeqNo > next )
-      endSeqNo = EndSeqNo(next);
-    generateSequenceReset( beginSeqNo, endSeqNo );
+    message.setString( string, m_validateLengthAndChecksum, &sessionDD );
   }
-
-  resendRequest.getHeader().getField( msgSeqNum );
-  if( !isTargetTooHigh(msgSeqNum) && !isTargetTooLow(msgSeqNum) )
-    m_state.incrNextTargetMsgSeqNum();
 }
 
 bool Session::send( Message& message )
@@ -458,97 +645,351 @@ bool Session::send( Message& message )
 
 bool Session::sendRaw( Message& message, int num )
 {
-  Locker l( m_mutex );
+  bool result = enqueue( message, num );
+  flush();
+  return result;
+}
+
+bool Session::enqueue( Message& message, int num )
+{
+  Outbound* pOutbound = 0;
 
-  try
   {
-    Header& header = message.getHeader();
+    Locker l( m_mutex );
 
-    MsgType msgType;
-    header.getFieldIfSet(msgType);
+    try
+    {
+      Header& header = message.getHeader();
 
-    fill( header );
-    std::string messageString;
+      MsgType msgType;
+      header.getFieldIfSet(msgType);
 
-    if ( num )
-      header.setField( MsgSeqNum( num ) );
+      fill( header );
 
-    if ( Message::isAdminMsgType( msgType ) )
-    {
-      m_application.toAdmin( message, m_sessionID );
+      if ( num )
+        header.setField( MsgSeqNum( num ) );
 
-      if( msgType == "A" && !m_state.receivedReset() )
+      bool send = false;
+      if ( Message::isAdminMsgType( msgType ) )
       {
-        ResetSeqNumFlag resetSeqNumFlag( false );
-        message.getFieldIfSet(resetSeqNumFlag);
+        m_application.toAdmin( message, m_sessionID );
 
-        if( resetSeqNumFlag )
+        if( msgType == "A" && !m_state.receivedReset() )
         {
-          m_state.reset();
-          message.getHeader().setField( MsgSeqNum(getExpectedSenderNum()) );
+          ResetSeqNumFlag resetSeqNumFlag( false );
+          message.getFieldIfSet(resetSeqNumFlag);
+
+          if( resetSeqNumFlag )
+          {
+            resetStore();
+            message.getHeader().setField( MsgSeqNum(nextSenderMsgSeqNum()) );
+          }
+          m_state.sentReset( resetSeqNumFlag );
         }
-        m_state.sentReset( resetSeqNumFlag );
+
+        send = msgType == "A" || msgType == "5"
+               || msgType == "2" || msgType == "4"
+               || isLoggedOn();
       }
+      else
+      {
+        // do not send application messages if they will just be cleared
+        if( !isLoggedOn() && shouldSendReset() )
+          return false;
 
-      message.toString( messageString );
+        try
+        {
+          m_application.toApp( message, m_sessionID );
+        }
+        catch ( DoNotSend& ) { return false; }
 
-      if( !num )
-        persist( message, messageString );
+        send = isLoggedOn();
+      }
 
-      if (
-        msgType == "A" || msgType == "5"
-        || msgType == "2" || msgType == "4"
-        || isLoggedOn() )
+      send = send && m_pResponder;
+      if ( num )
+      {
+        if ( !send )
+          return true;
+        pOutbound = sequence( num, send );
+      }
+      else
       {
-        send( messageString );
+        // the number is taken here and used up once the message is stored
+        Locker storeLocker( m_storeMutex );
+        int msgSeqNum = m_state.getNextSenderMsgSeqNum() + m_numbered++;
+        header.setField( MsgSeqNum( msgSeqNum ) );
+        pOutbound = sequence( msgSeqNum, send );
+        pOutbound->numbered = true;
+        pOutbound->epoch = m_epoch;
+        pOutbound->ticket = m_tickets++;
       }
     }
-    else
+    catch ( IOException& e )
     {
-      // do not send application messages if they will just be cleared
-      if( !isLoggedOn() && shouldSendReset() )
-        return false;
+      m_state.onEvent( e.what() );
+      return false;
+    }
+  }
+
+  // encoded without the session lock, flush waits until it is ready
+  bool result = true;
+  try
+  {
+    pOutbound->start = message.toBuffer( pOutbound->message );
+  }
+  catch ( ... )
+  {
+    if ( pOutbound->numbered )
+      store( *pOutbound, false );
+    pOutbound->send = false;
+    atomic_store_release( pOutbound->ready, 1L );
+    throw;
+  }
+  if ( pOutbound->numbered )
+    result = store( *pOutbound, true );
+  atomic_store_release( pOutbound->ready, 1L );
+  return result;
+}
+
+bool Session::store( Outbound& message, bool encoded )
+{
+  // numbered messages are stored in the order they took their numbers,
+  // a message that is not stored is not sent and gives its number back
+  while ( atomic_load_acquire( m_stored ) != message.ticket )
+    process_sleep( 0 );
 
+  bool stored = false;
+  {
+    Locker l( m_storeMutex );
+    if ( message.epoch == m_epoch )
+    {
       try
       {
-        m_application.toApp( message, m_sessionID );
-        message.toString( messageString );
-
-        if( !num )
-          persist( message, messageString );
+        if ( encoded && m_persistMessages )
+          m_state.set( message.msgSeqNum,
+                       message.message.data() + message.start,
+                       message.message.size() - message.start );
+        if ( encoded )
+        {
+          m_state.incrNextSenderMsgSeqNum();
+          --m_numbered;
+          stored = true;
+        }
+      }
+      catch ( IOException& e )
+      {
+        m_state.onEvent( e.what() );
+      }
 
-        if ( isLoggedOn() )
-          send( messageString );
+      // the numbers taken after this one are given back with it
+      if ( !stored )
+      {
+        ++m_epoch;
+        m_numbered = 0;
       }
-      catch ( DoNotSend& ) { return false; }
     }
-
-    return true;
   }
-  catch ( IOException& e )
+
+  if ( !stored )
+    message.send = false;
+  atomic_store_release( m_stored, message.ticket + 1 );
+  return stored;
+}
+
+int Session::nextSenderMsgSeqNum()
+{
+  // counts the numbers taken by messages that are not stored yet
+  Locker l( m_storeMutex );
+  return m_state.getNextSenderMsgSeqNum() + m_numbered;
+}
+
+Session::Outbound* Session::sequence( int msgSeqNum, bool send )
+{
+  // called with m_mutex held, so messages are queued in sequence order
+  Outbound* pOutbound = 0;
+  if ( m_freeOutbound.empty() )
+    pOutbound = new Outbound;
+  else
   {
-    m_state.onEvent( e.what() );
-    return false;
+    pOutbound = m_freeOutbound.back();
+    m_freeOutbound.pop_back();
   }
+
+  pOutbound->msgSeqNum = msgSeqNum;
+  pOutbound->send = send;
+  pOutbound->numbered = false;
+  pOutbound->ready = 0;
+  m_outbound.push_back( pOutbound );
+  return pOutbound;
 }
 
-bool Session::send( const std::string& string )
+bool Session::send( const std::string& string, std::string::size_type start )
 {
+  // called with m_mutex held, the message is written by flush
   if ( !m_pResponder ) return false;
-  m_state.onOutgoing( string );
-  return m_pResponder->send( string );
+
+  Outbound* pOutbound = sequence( 0, true );
+  pOutbound->message.assign( string );
+  pOutbound->start = start;
+  pOutbound->ready = 1;
+  return true;
+}
+
+void Session::flush()
+{
+  m_mutex.lock();
+
+  // a thread already writing picks up whatever is queued behind it
+  if ( m_flushing )
+  {
+    m_mutex.unlock();
+    return;
+  }
+  m_flushing = true;
+
+  // a message still being encoded holds back the ones behind it, its
+  // sender flushes them once it is done
+  while ( !m_outbound.empty()
+          && atomic_load_acquire( m_outbound.front()->ready ) )
+  {
+    do
+    {
+      m_writing.push_back( m_outbound.front() );
+      m_outbound.pop_front();
+    }
+    while ( !m_outbound.empty()
+            && atomic_load_acquire( m_outbound.front()->ready ) );
+
+    // take the send lock before letting other senders in so that
+    // nothing written by disconnect can overtake this batch
+    m_sendMutex.lock();
+    m_mutex.unlock();
+
+    try
+    {
+      write( m_writing );
+    }
+    catch ( ... )
+    {
+      m_sendMutex.unlock();
+      m_mutex.lock();
+      m_freeOutbound.insert( m_freeOutbound.end(), m_writing.begin(), m_writing.end() );
+      m_writing.clear();
+      m_flushing = false;
+      m_mutex.unlock();
+      throw;
+    }
+
+    m_sendMutex.unlock();
+    m_mutex.lock();
+    m_freeOutbound.insert( m_freeOutbound.end(), m_writing.begin(), m_writing.end() );
+    m_writing.clear();
+  }
+
+  m_flushing = false;
+
+  // the timer has to run while the store holds back writes
+  if( !m_pendingWrites && m_state.hasPendingWrites() )
+  {
+    m_pendingWrites = true;
+    wakeup();
+  }
+
+  m_mutex.unlock();
+}
+
+void Session::write( const std::vector<Outbound*>& outbound )
+{
+  // called with m_sendMutex held, messages were stored by their senders
+  size_t count = 0;
+  for ( size_t i = 0; i < outbound.size(); ++i )
+  {
+    Outbound& message = *outbound[ i ];
+    if ( !message.send || !m_pResponder )
+      continue;
+
+    if ( count == m_writeBuffer.size() )
+    {
+      m_writeBuffer.push_back( std::string() );
+      m_writeOffsets.push_back( 0 );
+    }
+    m_writeOffsets[ count ] = message.start;
+    m_writeBuffer[ count++ ].swap( message.message );
+  }
+
+  if ( !count ) return;
+
+  for ( size_t i = 0; i < count; ++i )
+  {
+    const std::string& string = m_writeBuffer[ i ];
+    m_state.onOutgoing( string.data() + m_writeOffsets[ i ],
+                        string.size() - m_writeOffsets[ i ] );
+  }
+  m_pResponder->send( &m_writeBuffer[ 0 ], &m_writeOffsets[ 0 ], count );
+}
+
+void Session::writeQueued()
+{
+  // called with m_mutex held, so unlike flush it cannot leave the queue
+  // to a thread that is flushing, that thread's batch was taken off the
+  // queue first and is written first since it holds m_sendMutex
+  waitForStored();
+  Locker sendLocker( m_sendMutex );
+  m_queued.assign( m_outbound.begin(), m_outbound.end() );
+  m_outbound.clear();
+
+  try
+  {
+    write( m_queued );
+  }
+  catch ( ... )
+  {
+    m_freeOutbound.insert( m_freeOutbound.end(), m_queued.begin(), m_queued.end() );
+    m_queued.clear();
+    throw;
+  }
+  m_freeOutbound.insert( m_freeOutbound.end(), m_queued.begin(), m_queued.end() );
+  m_queued.clear();
+}
+
+void Session::waitForStored()
+{
+  // called with m_mutex held, so that a resend request finds every
+  // message that took a number, their senders do not need m_mutex
+  for ( OutboundQueue::iterator i = m_outbound.begin(); i != m_outbound.end(); ++i )
+  {
+    while ( !atomic_load_acquire( (*i)->ready ) )
+      process_sleep( 0 );
+  }
+}
+
+void Session::resetStore() throw ( IOException )
+{
+  // messages numbered before the reset are neither stored nor sent after it
+  Locker l( m_mutex );
+  Locker storeLocker( m_storeMutex );
+  ++m_epoch;
+  m_numbered = 0;
+  m_state.reset();
 }
 
 void Session::disconnect()
 {
   Locker l(m_mutex);
 
-  if ( m_pResponder )
   {
-    m_state.onEvent( "Disconnecting" );
+    // whatever took a number before the disconnect is written first
+    writeQueued();
+    Locker sendLocker( m_sendMutex );
 
-    m_pResponder->disconnect();
-    m_pResponder = 0;
+    if ( m_pResponder )
+    {
+      m_state.onEvent( "Disconnecting" );
+
+      m_pResponder->disconnect();
+      m_pResponder = 0;
+    }
   }
 
   if ( m_state.receivedLogon() || m_state.sentLogon() )
@@ -564,7 +1005,7 @@ void Session::disconnect()
   m_state.clearQueue();
   m_state.logoutReason();
   if ( m_resetOnDisconnect )
-    m_state.reset();
+    resetStore();
 
   m_state.resendRange( 0, 0 );
 }
@@ -589,16 +1030,6 @@ bool Session::resend( Message& message )
   { return false; }
 }
 
-void Session::persist( const Message& message,  const std::string& messageString ) 
-throw ( IOException )
-{
-  MsgSeqNum msgSeqNum;
-  message.getHeader().getField( msgSeqNum );
-  if( m_persistMessages )
-    m_state.set( msgSeqNum, messageString );
-  m_state.incrNextSenderMsgSeqNum();
-}
-
 void Session::generateLogon()
 {
   Message logon;
@@ -610,7 +1041,7 @@ void Session::generateLogon()
   if( m_refreshOnLogon )
     refresh();
   if( m_resetOnLogon )
-    m_state.reset();
+    resetStore();
   if( shouldSendReset() )
     logon.setField( ResetSeqNumFlag(true) );
 
@@ -1017,7 +1448,7 @@ bool Session::shouldSendReset()
     && ( m_resetOnLogon || 
          m_resetOnLogout || 
          m_resetOnDisconnect )
-    && ( getExpectedSenderNum() == 1 )
+    && ( nextSenderMsgSeqNum() == 1 )
     && ( getExpectedTargetNum() == 1 );
 }
 
@@ -1171,26 +1602,69 @@ bool Session::nextQueued( int num, const UtcTimeStamp& timeStamp )
   return false;
 }
 
+int Session::getNextTimeout( const UtcTimeStamp& timeStamp )
+{
+  // logging on and out is timed in whole seconds, as is a disabled session
+  // and a store holding back writes
+  if( !isEnabled() || !isLoggedOn() || m_state.sentLogout()
+      || m_state.hasPendingWrites() )
+    return 1;
+
+  int result = m_sessionTime.getTimeToChange( timeStamp );
+  int logonTime = m_logonTime.getTimeToChange( timeStamp );
+  if( logonTime < result ) result = logonTime;
+  if( m_state.heartBtInt() != 0 )
+  {
+    int heartBeat = m_state.timeToHeartBeat( timeStamp );
+    if( heartBeat < result ) result = heartBeat;
+  }
+  return result > 1 ? result : 1;
+}
+
+void Session::wakeup()
+{
+  Locker l( m_mutex );
+  if( m_pResponder )
+    m_pResponder->wakeup();
+}
+
 void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool queued )
 {
+  next( msg.data(), msg.size(), timeStamp, queued );
+}
+
+void Session::next( const char* data, std::string::size_type length,
+                    const UtcTimeStamp& timeStamp, bool queued )
+{
+  // the message copies the buffer first, the copy is what gets logged
+  PooledMessage message;
+  bool logged = false;
   try
   {
-    m_state.onIncoming( msg );
     const DataDictionary& sessionDD = 
       m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
+    DataDictionary::FieldValidation fieldValidation;
     if( m_sessionID.isFIXT() )
     {
       const DataDictionary& applicationDD =
         m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID);
-      next( Message( msg, sessionDD, applicationDD, m_validateLengthAndChecksum ), timeStamp, queued );
+      message->setString( data, length, sessionDD, applicationDD,
+                          m_validateLengthAndChecksum, &fieldValidation );
     }
     else
     {
-      next( Message( msg, sessionDD, m_validateLengthAndChecksum ), timeStamp, queued );
+      message->setString( data, length, m_validateLengthAndChecksum,
+                          &sessionDD, &sessionDD, &fieldValidation );
     }
+    m_state.onIncoming( message->getRawString() );
+    logged = true;
+    next( *message, timeStamp, queued, &fieldValidation );
   }
   catch( InvalidMessage& e )
   {
+    const std::string& msg = message->getRawString();
+    if( !logged )
+      m_state.onIncoming( msg );
     m_state.onEvent( e.what() );
 
     try
@@ -1206,6 +1680,12 @@ void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool
 }
 
 void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool queued )
+{
+  next( message, timeStamp, queued, 0 );
+}
+
+void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool queued,
+                    const DataDictionary::FieldValidation* pFieldValidation )
 {
   const Header& header = message.getHeader();
 
@@ -1245,11 +1725,13 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
       header.getFieldIfSet(applVerID);
       const DataDictionary& applicationDataDictionary = 
         m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
-      DataDictionary::validate( message, &sessionDataDictionary, &applicationDataDictionary );
+      DataDictionary::validate( message, &sessionDataDictionary,
+                                &applicationDataDictionary, pFieldValidation );
     }
     else
     {
-      sessionDataDictionary.validate( message );
+      DataDictionary::validate( message, &sessionDataDictionary,
+                                &sessionDataDictionary, pFieldValidation );
     }
 
     if ( msgType == MsgType_Logon )
@@ -1263,7 +1745,10 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
     else if ( msgType == MsgType_Logout )
       nextLogout( message, timeStamp );
     else if ( msgType == MsgType_ResendRequest )
+    {
       nextResendRequest( message,timeStamp );
+      flush();
+    }
     else if ( msgType == MsgType_Reject )
       nextReject( message, timeStamp );
     else
@@ -1368,6 +1853,15 @@ throw( SessionNotFound )
   return pSession->send( message );
 }
 
+bool Session::sendToTarget( Message& message, const SessionHandle& handle )
+throw( SessionNotFound )
+{
+  Session* pSession = handle.getSession();
+  if ( !pSession ) throw SessionNotFound();
+  message.setSessionID( pSession->getSessionID() );
+  return pSession->send( message );
+}
+
 bool Session::sendToTarget
 ( Message& message,
   const SenderCompID& senderCompID,
@@ -1391,23 +1885,29 @@ throw( SessionNotFound )
 
 std::set<SessionID> Session::getSessions()
 {
+  Locker locker( s_mutex );
   return s_sessionIDs;
 }
 
 bool Session::doesSessionExist( const SessionID& sessionID )
 {
-  Locker locker( s_mutex );
-  return s_sessions.end() != s_sessions.find( sessionID );
+  return lookupSession( sessionID ) != 0;
 }
 
 Session* Session::lookupSession( const SessionID& sessionID )
 {
+  SessionHandle::Entry* pEntry = s_registry.find( sessionID );
+  return pEntry ? atomic_load_acquire( pEntry->pSession ) : 0;
+}
+
+SessionHandle Session::getSessionHandle( const SessionID& sessionID )
+{
+  SessionHandle::Entry* pEntry = s_registry.find( sessionID );
+  if( pEntry )
+    return SessionHandle( pEntry );
+
   Locker locker( s_mutex );
-  Sessions::iterator find = s_sessions.find( sessionID );
-  if ( find != s_sessions.end() )
-    return find->second;
-  else
-    return 0;
+  return SessionHandle( s_registry.insert( sessionID ) );
 }
 
 Session* Session::lookupSession( const std::string& string, bool reverse )
@@ -1460,27 +1960,29 @@ void Session::unregisterSession( const SessionID& sessionID )
 size_t Session::numSessions()
 {
   Locker locker( s_mutex );
-  return s_sessions.size();
+  return s_sessionIDs.size();
 }
 
 bool Session::addSession( Session& s )
 {
   Locker locker( s_mutex );
-  Sessions::iterator it = s_sessions.find( s.m_sessionID );
-  if ( it == s_sessions.end() )
-  {
-    s_sessions[ s.m_sessionID ] = &s;
-    s_sessionIDs.insert( s.m_sessionID );
-    return true;
-  }
-  else
+  SessionHandle::Entry* pEntry = s_registry.insert( s.m_sessionID );
+  if ( pEntry->pSession )
     return false;
+
+  atomic_store_release( pEntry->pSession, &s );
+  s_sessionIDs.insert( s.m_sessionID );
+  return true;
 }
 
 void Session::removeSession( Session& s )
 {
   Locker locker( s_mutex );
-  s_sessions.erase( s.m_sessionID );
+  SessionHandle::Entry* pEntry = s_registry.find( s.m_sessionID );
+  if ( !pEntry || pEntry->pSession != &s )
+    return;
+
+  atomic_store_release( pEntry->pSession, (Session*)0 );
   s_sessionIDs.erase( s.m_sessionID );
   s_registered.erase( s.m_sessionID );
 }
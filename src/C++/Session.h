@@ -38,9 +38,43 @@
 #include <utility>
 #include <map>
 #include <queue>
+#include <deque>
+#include <vector>
 
 namespace FIX
 {
+class Session;
+
+/**
+ * Stable reference to whatever session is registered for a SessionID.
+ *
+ * A handle stays valid for the life of the process, also while its
+ * session does not exist.  Applications can keep one per counterparty
+ * and send through it without looking the session up again.
+ */
+class SessionHandle
+{
+public:
+  SessionHandle() : m_pEntry( 0 ) {}
+
+  /// Current session of the handle, 0 if there is none
+  Session* getSession() const;
+  const SessionID& getSessionID() const;
+
+  bool operator==( const SessionHandle& rhs ) const
+  { return m_pEntry == rhs.m_pEntry; }
+  bool operator!=( const SessionHandle& rhs ) const
+  { return m_pEntry != rhs.m_pEntry; }
+
+private:
+  friend class Session;
+  struct Entry;
+
+  explicit SessionHandle( Entry* pEntry ) : m_pEntry( pEntry ) {}
+
+  Entry* m_pEntry;
+};
+
 /// Maintains the state and implements the logic of a %FIX %session.
 class Session
 {
@@ -53,9 +87,9 @@ public:
   virtual ~Session();
 
   void logon() 
-  { m_state.enabled( true ); m_state.logoutReason( "" ); }
+  { m_state.enabled( true ); m_state.logoutReason( "" ); wakeup(); }
   void logout( const std::string& reason = "" ) 
-  { m_state.enabled( false ); m_state.logoutReason( reason ); }
+  { m_state.enabled( false ); m_state.logoutReason( reason ); wakeup(); }
   bool isEnabled() 
   { return m_state.enabled(); }
 
@@ -64,7 +98,7 @@ public:
   bool receivedLogon() { return m_state.receivedLogon(); }
   bool isLoggedOn() { return receivedLogon() && sentLogon(); }
   void reset() throw( IOException ) 
-  { generateLogout(); disconnect(); m_state.reset(); }
+  { generateLogout(); disconnect(); resetStore(); }
   void refresh() throw( IOException )
   { m_state.refresh(); }
   void setNextSenderMsgSeqNum( int num ) throw( IOException )
@@ -94,11 +128,15 @@ public:
                             const std::string& targetCompID,
                             const std::string& qualifier = "" )
   throw( SessionNotFound );
+  static bool sendToTarget( Message& message, const SessionHandle& handle )
+  throw( SessionNotFound );
 
   static std::set<SessionID> getSessions();
   static bool doesSessionExist( const SessionID& );
   static Session* lookupSession( const SessionID& );
   static Session* lookupSession( const std::string&, bool reverse = false );
+  /// Handle for the session of a SessionID, whether it exists yet or not
+  static SessionHandle getSessionHandle( const SessionID& );
   static bool isSessionRegistered( const SessionID& );
   static Session* registerSession( const SessionID& );
   static void unregisterSession( const SessionID& );
@@ -189,6 +227,11 @@ public:
   void setPersistMessages ( bool value )
     { m_persistMessages = value; }
 
+  bool getResendToApp()
+    { return m_resendToApp; }
+  void setResendToApp ( bool value )
+    { m_resendToApp = value; }
+
   bool getValidateLengthAndChecksum()
     { return m_validateLengthAndChecksum; }
   void setValidateLengthAndChecksum ( bool value )
@@ -198,13 +241,19 @@ public:
   {
     if( !checkSessionTime(UtcTimeStamp()) )
       reset();
+    Locker l( m_sendMutex );
     m_pResponder = pR;
   }
 
   bool send( Message& );
   void next();
   void next( const UtcTimeStamp& timeStamp );
+  /// Seconds until next() may have something to do, at least one
+  int getNextTimeout( const UtcTimeStamp& timeStamp );
   void next( const std::string&, const UtcTimeStamp& timeStamp, bool queued = false );
+  /// Process a message framed in a buffer that only has to be valid during the call
+  void next( const char* data, std::string::size_type length,
+             const UtcTimeStamp& timeStamp, bool queued = false );
   void next( const Message&, const UtcTimeStamp& timeStamp, bool queued = false );
   void disconnect();
 
@@ -221,14 +270,43 @@ private:
   static bool addSession( Session& );
   static void removeSession( Session& );
 
-  bool send( const std::string& );
+  /// Outgoing message, sequenced under m_mutex and encoded and stored by
+  /// the thread that sends it, then written in order by flush
+  struct Outbound
+  {
+    /// Encoded message, which begins at start
+    std::string message;
+    std::string::size_type start;
+    int msgSeqNum;
+    bool send;
+    /// Took the next sender number, which is used up once it is stored
+    bool numbered;
+    int epoch;
+    long ticket;
+    volatile long ready;
+  };
+  typedef std::deque < Outbound* > OutboundQueue;
+
+  bool send( const std::string&, std::string::size_type start = 0 );
   bool sendRaw( Message&, int msgSeqNum = 0 );
+  bool enqueue( Message&, int msgSeqNum );
+  Outbound* sequence( int msgSeqNum, bool send );
+  bool store( Outbound&, bool encoded );
+  int nextSenderMsgSeqNum();
+  void flush();
+  void write( const std::vector<Outbound*>& );
+  void wakeup();
   bool resend( Message& message );
-  void persist( const Message&, const std::string& ) throw ( IOException );
+  void parseStored( const std::string&, Message& );
+  void writeQueued();
+  void waitForStored();
+  void resetStore() throw ( IOException );
 
   void insertSendingTime( Header& );
+  void insertSendingTime( Header&, const UtcTimeStamp& );
   void insertOrigSendingTime( Header&,
                               const UtcTimeStamp& when = UtcTimeStamp () );
+  bool showMilliseconds();
   void fill( Header& );
 
   bool isGoodTime( const SendingTime& sendingTime )
@@ -268,6 +346,8 @@ private:
   void doTargetTooHigh( const Message& msg );
   void nextQueued( const UtcTimeStamp& timeStamp );
   bool nextQueued( int num, const UtcTimeStamp& timeStamp );
+  void next( const Message&, const UtcTimeStamp& timeStamp, bool queued,
+             const DataDictionary::FieldValidation* pFieldValidation );
 
   void nextLogon( const Message&, const UtcTimeStamp& timeStamp );
   void nextHeartbeat( const Message&, const UtcTimeStamp& timeStamp );
@@ -315,6 +395,7 @@ private:
   bool m_refreshOnLogon;
   bool m_millisecondsInTimeStamp;
   bool m_persistMessages;
+  bool m_resendToApp;
   bool m_validateLengthAndChecksum;
 
   SessionState m_state;
@@ -322,13 +403,43 @@ private:
   MessageStoreFactory& m_messageStoreFactory;
   LogFactory* m_pLogFactory;
   Responder* m_pResponder;
+  /// The transport was woken up to run the timer for held back writes
+  bool m_pendingWrites;
   Mutex m_mutex;
 
-  static Sessions s_sessions;
+  /// Messages in sequence number order, guarded by m_mutex
+  OutboundQueue m_outbound;
+  /// Written messages kept so that their buffers are reused
+  std::vector<Outbound*> m_freeOutbound;
+  /// Batch being written by the thread that set m_flushing
+  std::vector<Outbound*> m_writing;
+  /// Messages written by writeQueued with m_mutex held
+  std::vector<Outbound*> m_queued;
+  /// Encoded messages of a batch handed to the responder
+  std::vector<std::string> m_writeBuffer;
+  std::vector<size_t> m_writeOffsets;
+  bool m_flushing;
+  /// Held while writing messages, always taken after m_mutex
+  Mutex m_sendMutex;
+  /// Guards the numbers below, always taken after m_mutex
+  Mutex m_storeMutex;
+  /// Numbers taken by messages that are not stored yet
+  int m_numbered;
+  /// Advanced when the numbers not stored yet are given back
+  int m_epoch;
+  /// Numbered messages are stored in ticket order
+  long m_tickets;
+  volatile long m_stored;
+
   static SessionIDs s_sessionIDs;
   static Sessions s_registered;
   static Mutex s_mutex;
 
+  struct Registry;
+  static Registry s_registry;
+
+  struct Resender;
+
 };
 }
 
@@ -192,6 +192,8 @@ Session* SessionFactory::create( const SessionID& sessionID,
     pSession->setMillisecondsInTimeStamp( settings.getBool( MILLISECONDS_IN_TIMESTAMP ) );
   if ( settings.has( PERSIST_MESSAGES ) )
     pSession->setPersistMessages( settings.getBool( PERSIST_MESSAGES ) );
+  if ( settings.has( RESEND_TO_APP ) )
+    pSession->setResendToApp( settings.getBool( RESEND_TO_APP ) );
   if ( settings.has( VALIDATE_LENGTH_AND_CHECKSUM ) )
     pSession->setValidateLengthAndChecksum( settings.getBool( VALIDATE_LENGTH_AND_CHECKSUM ) );
    
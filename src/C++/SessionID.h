@@ -32,7 +32,7 @@ class SessionID
 public:
   SessionID()
   {
-    toString(m_frozenString);
+    freeze();
   }
 
   SessionID( const std::string& beginString,
@@ -45,7 +45,7 @@ public:
     m_sessionQualifier( sessionQualifier ),
     m_isFIXT(false)
   {
-    toString(m_frozenString);
+    freeze();
     if( beginString.substr(0, 4) == "FIXT" )
       m_isFIXT = true;
   }
@@ -73,6 +73,12 @@ public:
     return m_frozenString;
   }
 
+  /// Hash of the string representation, computed once
+  size_t getHash() const
+  {
+    return m_hash;
+  }
+
   /// Build from string representation of SessionID
   void fromString( const std::string& str )
   {
@@ -98,7 +104,7 @@ public:
       m_targetCompID = str.substr(second+2, third - second - 2);
       m_sessionQualifier = str.substr(third+1);
     }
-    toString(m_frozenString);
+    freeze();
   }
 
   /// Get a string representation without making a copy
@@ -125,12 +131,25 @@ public:
   }
 
 private:
+  void freeze()
+  {
+    toString(m_frozenString);
+
+    // FNV-1a
+    size_t hash = 2166136261u;
+    std::string::const_iterator i;
+    for( i = m_frozenString.begin(); i != m_frozenString.end(); ++i )
+      hash = ( hash ^ (unsigned char)*i ) * 16777619u;
+    m_hash = hash;
+  }
+
   BeginString m_beginString;
   SenderCompID m_senderCompID;
   TargetCompID m_targetCompID;
   std::string m_sessionQualifier;
   bool m_isFIXT;
   std::string m_frozenString;
+  size_t m_hash;
 };
 /*! @} */
 
@@ -141,7 +160,8 @@ inline bool operator<( const SessionID& lhs, const SessionID& rhs )
 
 inline bool operator==( const SessionID& lhs, const SessionID& rhs )
 {
-  return lhs.toStringFrozen() == rhs.toStringFrozen();
+  return lhs.m_hash == rhs.m_hash
+         && lhs.toStringFrozen() == rhs.toStringFrozen();
 }
 
 inline bool operator!=( const SessionID& lhs, const SessionID& rhs )
@@ -66,6 +66,13 @@ const char SOCKET_CONNECT_PORT[] = "SocketConnectPort";
 const char SOCKET_NODELAY[] = "SocketNodelay";
 const char SOCKET_SEND_BUFFER_SIZE[] = "SendBufferSize";
 const char SOCKET_RECEIVE_BUFFER_SIZE[] = "ReceiveBufferSize";
+const char SOCKET_MONITOR_TYPE[] = "SocketMonitorType";
+const char SOCKET_CORK[] = "SocketCork";
+const char SOCKET_BUSY_POLL[] = "SocketBusyPoll";
+const char SEND_BATCH_BYTES[] = "SendBatchBytes";
+const char SEND_BATCH_MESSAGES[] = "SendBatchMessages";
+const char REACTOR_THREADS[] = "ReactorThreads";
+const char REACTOR_THREAD_AFFINITY[] = "ReactorThreadAffinity";
 const char RECONNECT_INTERVAL[] = "ReconnectInterval";
 const char VALIDATE_LENGTH_AND_CHECKSUM[] = "ValidateLengthAndChecksum";
 const char VALIDATE_FIELDS_OUT_OF_ORDER[] = "ValidateFieldsOutOfOrder";
@@ -74,23 +81,33 @@ const char VALIDATE_USER_DEFINED_FIELDS[] = "ValidateUserDefinedFields";
 const char LOGON_TIMEOUT[] = "LogonTimeout";
 const char LOGOUT_TIMEOUT[] = "LogoutTimeout";
 const char FILE_STORE_PATH[] = "FileStorePath";
+const char MMAP_FILE_STORE_PATH[] = "MmapFileStorePath";
+const char MMAP_FILE_STORE_SEGMENT_SIZE[] = "MmapFileStoreSegmentSize";
+const char MMAP_FILE_STORE_SYNC_COUNT[] = "MmapFileStoreSyncCount";
+const char MMAP_FILE_STORE_SYNC_INTERVAL[] = "MmapFileStoreSyncInterval";
+const char ASYNC_STORE_QUEUE_SIZE[] = "AsyncStoreQueueSize";
+const char ASYNC_STORE_PERSIST_BEFORE_SEND[] = "AsyncStorePersistBeforeSend";
 const char MYSQL_STORE_USECONNECTIONPOOL[] = "MySQLStoreUseConnectionPool";
 const char MYSQL_STORE_DATABASE[] = "MySQLStoreDatabase";
 const char MYSQL_STORE_USER[] = "MySQLStoreUser";
 const char MYSQL_STORE_PASSWORD[] = "MySQLStorePassword";
 const char MYSQL_STORE_HOST[] = "MySQLStoreHost";
 const char MYSQL_STORE_PORT[] = "MySQLStorePort";
+const char MYSQL_STORE_BATCH_SIZE[] = "MySQLStoreBatchSize";
 const char POSTGRESQL_STORE_USECONNECTIONPOOL[] = "PostgreSQLStoreUseConnectionPool";
 const char POSTGRESQL_STORE_DATABASE[] = "PostgreSQLStoreDatabase";
 const char POSTGRESQL_STORE_USER[] = "PostgreSQLStoreUser";
 const char POSTGRESQL_STORE_PASSWORD[] = "PostgreSQLStorePassword";
 const char POSTGRESQL_STORE_HOST[] = "PostgreSQLStoreHost";
 const char POSTGRESQL_STORE_PORT[] = "PostgreSQLStorePort";
+const char POSTGRESQL_STORE_BATCH_SIZE[] = "PostgreSQLStoreBatchSize";
 const char ODBC_STORE_USER[] = "OdbcStoreUser";
 const char ODBC_STORE_PASSWORD[] = "OdbcStorePassword";
 const char ODBC_STORE_CONNECTION_STRING[] = "OdbcStoreConnectionString";
 const char FILE_LOG_PATH[] = "FileLogPath";
 const char FILE_LOG_BACKUP_PATH[] = "FileLogBackupPath";
+const char ASYNC_LOG_QUEUE_SIZE[] = "AsyncLogQueueSize";
+const char ASYNC_LOG_FLUSH_INTERVAL[] = "AsyncLogFlushInterval";
 const char SCREEN_LOG_SHOW_INCOMING[] = "ScreenLogShowIncoming";
 const char SCREEN_LOG_SHOW_OUTGOING[] = "ScreenLogShowOutgoing";
 const char SCREEN_LOG_SHOW_EVENTS[] = "ScreenLogShowEvents";
@@ -103,6 +120,8 @@ const char MYSQL_LOG_PORT[] = "MySQLLogPort";
 const char MYSQL_LOG_INCOMING_TABLE[] = "MySQLLogIncomingTable";
 const char MYSQL_LOG_OUTGOING_TABLE[] = "MySQLLogOutgoingTable";
 const char MYSQL_LOG_EVENT_TABLE[] = "MySQLLogEventTable";
+const char MYSQL_LOG_BATCH_SIZE[] = "MySQLLogBatchSize";
+const char MYSQL_LOG_FLUSH_INTERVAL[] = "MySQLLogFlushInterval";
 const char POSTGRESQL_LOG_USECONNECTIONPOOL[] = "PostgreSQLLogUseConnectionPool";
 const char POSTGRESQL_LOG_DATABASE[] = "PostgreSQLLogDatabase";
 const char POSTGRESQL_LOG_USER[] = "PostgreSQLLogUser";
@@ -112,6 +131,8 @@ const char POSTGRESQL_LOG_PORT[] = "PostgreSQLLogPort";
 const char POSTGRESQL_LOG_INCOMING_TABLE[] = "PostgreSQLLogIncomingTable";
 const char POSTGRESQL_LOG_OUTGOING_TABLE[] = "PostgreSQLLogOutgoingTable";
 const char POSTGRESQL_LOG_EVENT_TABLE[] = "PostgreSQLLogEventTable";
+const char POSTGRESQL_LOG_BATCH_SIZE[] = "PostgreSQLLogBatchSize";
+const char POSTGRESQL_LOG_FLUSH_INTERVAL[] = "PostgreSQLLogFlushInterval";
 const char ODBC_LOG_USER[] = "OdbcLogUser";
 const char ODBC_LOG_PASSWORD[] = "OdbcLogPassword";
 const char ODBC_LOG_CONNECTION_STRING[] = "OdbcLogConnectionString";
@@ -125,6 +146,7 @@ const char REFRESH_ON_LOGON[] = "RefreshOnLogon";
 const char MILLISECONDS_IN_TIMESTAMP[] = "MillisecondsInTimeStamp";
 const char HTTP_ACCEPT_PORT[] = "HttpAcceptPort";
 const char PERSIST_MESSAGES[] = "PersistMessages";
+const char RESEND_TO_APP[] = "ResendToApp";
 
 /// Container for setting dictionaries mapped to sessions.
 class SessionSettings
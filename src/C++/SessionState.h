@@ -30,6 +30,7 @@
 #include "MessageStore.h"
 #include "Log.h"
 #include "Mutex.h"
+#include <math.h>
 
 namespace FIX
 {
@@ -114,38 +115,46 @@ public:
 
   bool shouldSendLogon() const { return initiate() && !sentLogon(); }
   bool alreadySentLogon() const { return initiate() && sentLogon(); }
-  bool logonTimedOut() const
+  bool logonTimedOut( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return now - lastReceivedTime() >= logonTimeout();
   }
-  bool logoutTimedOut() const
+  bool logoutTimedOut( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return sentLogout() && ( ( now - lastSentTime() ) >= logoutTimeout() );
   }
-  bool withinHeartBeat() const
+  bool withinHeartBeat( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( ( now - lastSentTime() ) < heartBtInt() ) &&
            ( ( now - lastReceivedTime() ) < heartBtInt() );
   }
-  bool timedOut() const
+  bool timedOut( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( now - lastReceivedTime() ) >= ( 2.4 * ( double ) heartBtInt() );
   }
-  bool needHeartbeat() const
+  bool needHeartbeat( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( ( now - lastSentTime() ) >= heartBtInt() ) && !testRequest();
   }
-  bool needTestRequest() const
+  bool needTestRequest( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( now - lastReceivedTime() ) >=
            ( ( 1.2 * ( ( double ) testRequest() + 1 ) ) * ( double ) heartBtInt() );
   }
+  /// Seconds until one of the heartbeat checks above can change
+  int timeToHeartBeat( const UtcTimeStamp& now ) const
+  {
+    int sent = now - lastSentTime();
+    int received = now - lastReceivedTime();
+    double interval = ( double ) heartBtInt();
+
+    int result = heartBtInt() - sent;
+    int request = ( int ) ceil( 1.2 * ( ( double ) testRequest() + 1 ) * interval ) - received;
+    int timeout = ( int ) ceil( 2.4 * interval ) - received;
+    if( request < result ) result = request;
+    if( timeout < result ) result = timeout;
+    return result;
+  }
 
   std::string logoutReason() const 
   { Locker l( m_mutex ); return m_logoutReason; }
@@ -171,9 +180,28 @@ public:
 
   bool set( int s, const std::string& m ) throw ( IOException )
   { Locker l( m_mutex ); return m_pStore->set( s, m ); }
+  bool set( int s, const char* d, size_t n ) throw ( IOException )
+  { Locker l( m_mutex ); return m_pStore->set( s, d, n ); }
   void get( int b, int e, std::vector < std::string > &m ) const
   throw ( IOException )
   { Locker l( m_mutex ); m_pStore->get( b, e, m ); }
+  /// Messages are copied out a batch at a time under the lock and handed
+  /// to the callback without it, so a resend does not hold up the store
+  void forEach( int b, int e, StoredMessageCallback& c ) const
+  throw ( IOException )
+  {
+    Batch batch;
+    for ( int begin = b; begin <= e; begin += FOR_EACH_BATCH )
+    {
+      int end = begin + FOR_EACH_BATCH - 1;
+      if ( end > e || end < begin ) end = e;
+      batch.size = 0;
+      { Locker l( m_mutex ); m_pStore->forEach( begin, end, batch ); }
+      for ( size_t i = 0; i < batch.size; ++i )
+        c.onMessage( batch.messages[ i ] );
+      if ( end == e ) break;
+    }
+  }
   int getNextSenderMsgSeqNum() const throw ( IOException )
   { Locker l( m_mutex ); return m_pStore->getNextSenderMsgSeqNum(); }
   int getNextTargetMsgSeqNum() const throw ( IOException )
@@ -192,6 +220,19 @@ public:
   { Locker l( m_mutex ); m_pStore->reset(); }
   void refresh() throw ( IOException )
   { Locker l( m_mutex ); m_pStore->refresh(); }
+  /// Whether the store or the log holds back writes
+  bool hasPendingWrites() const throw ( IOException )
+  {
+    Locker l( m_mutex );
+    return ( m_pLog && m_pLog->hasPendingWrites() )
+      || m_pStore->hasPendingWrites();
+  }
+  void onTimer() throw ( IOException )
+  {
+    Locker l( m_mutex );
+    if ( m_pLog ) m_pLog->onTimer();
+    m_pStore->onTimer();
+  }
 
   void clear()
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->clear(); }
@@ -201,10 +242,29 @@ public:
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onIncoming( string ); }
   void onOutgoing( const std::string& string )
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onOutgoing( string ); }
+  void onOutgoing( const char* data, size_t size )
+  { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onOutgoing( data, size ); }
   void onEvent( const std::string& string )
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onEvent( string ); }
 
 private:
+  /// Copies of stored messages, strings keep their capacity between batches
+  struct Batch : public StoredMessageCallback
+  {
+    Batch() : size( 0 ) {}
+    void onMessage( const std::string& message )
+    {
+      if ( size == messages.size() )
+        messages.push_back( message );
+      else
+        messages[ size ].assign( message );
+      ++size;
+    }
+
+    std::vector < std::string > messages;
+    size_t size;
+  };
+
   bool m_enabled;
   bool m_receivedLogon;
   bool m_sentLogout;
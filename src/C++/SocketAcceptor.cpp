@@ -67,6 +67,8 @@ throw ( ConfigError )
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
   }
+
+  SocketMonitor::parseType( s.get() );
 }
 
 void SocketAcceptor::onInitialize( const SessionSettings& s )
@@ -76,7 +78,7 @@ throw ( RuntimeError )
 
   try
   {
-    m_pServer = new SocketServer( 1 );
+    m_pServer = new SocketServer( 1, SocketMonitor::parseType( s.get() ) );
 
     std::set<SessionID> sessions = s.getSessions();
     std::set<SessionID>::iterator i = sessions.begin();
@@ -170,7 +172,10 @@ void SocketAcceptor::onConnect( SocketServer& server, int a, int s )
   if ( i != m_connections.end() ) return;
   int port = server.socketToPort( a );
   Sessions sessions = m_portToSessions[port];
-  m_connections[ s ] = new SocketConnection( s, sessions, &server.getMonitor() );
+  SocketConnection* pConnection = new SocketConnection
+    ( s, sessions, &server.getMonitor(), getSendBatch() );
+  m_connections[ s ] = pConnection;
+  pConnection->awaitLogon();
 
   std::stringstream stream;
   stream << "Accepted connection from " << socket_peername( s ) << " on port " << port;
@@ -184,6 +189,7 @@ void SocketAcceptor::onWrite( SocketServer& server, int s )
   SocketConnections::iterator i = m_connections.find( s );
   if ( i == m_connections.end() ) return ;
   SocketConnection* pSocketConnection = i->second;
+  pSocketConnection->processWakeup();
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
 }
@@ -215,8 +221,5 @@ void SocketAcceptor::onError( SocketServer& )
 
 void SocketAcceptor::onTimeout( SocketServer& )
 {
-  SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
-    i->second->onTimeout();
 }
 }
@@ -33,23 +33,21 @@
 namespace FIX
 {
 SocketConnection::SocketConnection( int s, Sessions sessions,
-                                    SocketMonitor* pMonitor )
-: m_socket( s ), m_sendLength( 0 ),
-  m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor )
+                                    SocketMonitor* pMonitor,
+                                    const SendBatch& batch )
+: m_socket( s ), m_sendLength( 0 ), m_sendBatch( batch ),
+  m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor ),
+  m_wakeup( 0 )
 {
-  FD_ZERO( &m_fds );
-  FD_SET( m_socket, &m_fds );
 }
 
-SocketConnection::SocketConnection( SocketInitiator& i,
+SocketConnection::SocketConnection( Initiator& i,
                                     const SessionID& sessionID, int s,
                                     SocketMonitor* pMonitor )
-: m_socket( s ), m_sendLength( 0 ),
+: m_socket( s ), m_sendLength( 0 ), m_sendBatch( i.getSendBatch() ),
   m_pSession( i.getSession( sessionID, *this ) ),
-  m_pMonitor( pMonitor ) 
+  m_pMonitor( pMonitor ), m_wakeup( 0 )
 {
-  FD_ZERO( &m_fds );
-  FD_SET( m_socket, &m_fds );
   m_sessions.insert( sessionID );
 }
 
@@ -60,12 +58,28 @@ SocketConnection::~SocketConnection()
 }
 
 bool SocketConnection::send( const std::string& msg )
+{
+  size_t offset = 0;
+  return send( &msg, &offset, 1 );
+}
+
+bool SocketConnection::send( const std::string* messages,
+                             const size_t* offsets, size_t count )
 {
   Locker l( m_mutex );
 
-  m_sendQueue.push_back( msg );
+  bool wasEmpty = m_sendQueue.empty();
+  for( size_t i = 0; i < count; ++i )
+  {
+    m_sendQueue.push_back( std::string() );
+    m_sendQueue.back().assign( messages[i], offsets[i], std::string::npos );
+  }
+
+  // the monitor only has to watch for the socket becoming writable
+  // once the queue starts backing up
   processQueue();
-  signal();
+  if( wasEmpty && !m_sendQueue.empty() )
+    m_pMonitor->signal( m_socket );
   return true;
 }
 
@@ -73,28 +87,65 @@ bool SocketConnection::processQueue()
 {
   Locker l( m_mutex );
 
-  if( !m_sendQueue.size() ) return true;
+  // the socket is non-blocking, so send until it is full or the queue
+  // is empty, a monitor that is edge triggered will not report it again
+  while( m_sendQueue.size() )
+  {
+    // an empty message would make the batch send nothing at all
+    if( m_sendQueue.front().length() == m_sendLength )
+    {
+      m_sendQueue.pop_front();
+      m_sendLength = 0;
+      continue;
+    }
+
+    size_t count = 0;
+    size_t bytes = 0;
+    unsigned offset = m_sendLength;
+    Queue::const_iterator i = m_sendQueue.begin();
+    for( ; i != m_sendQueue.end() && count < m_sendBatch.m_maxMessages; ++i )
+    {
+      size_t length = i->length() - offset;
+      if( count && bytes + length > m_sendBatch.m_maxBytes )
+        break;
 
-  struct timeval timeout = { 0, 0 };
-  fd_set writeset = m_fds;
-  if( select( 1 + m_socket, 0, &writeset, 0, &timeout ) <= 0 )
-    return false;
-    
-  const std::string& msg = m_sendQueue.front();
+      m_sendBuffers[ count ] = i->c_str() + offset;
+      m_sendLengths[ count ] = length;
+      bytes += length;
+      offset = 0;
+      ++count;
+    }
 
-  size_t result = socket_send
-    ( m_socket, msg.c_str() + m_sendLength, msg.length() - m_sendLength );
+    bool more = m_sendBatch.m_cork && i != m_sendQueue.end();
+    ssize_t result = socket_sendv
+      ( m_socket, m_sendBuffers, m_sendLengths, count, more );
 
-  if( result > 0 )
-    m_sendLength += result;
+    if( result < 0 && socket_interrupted() )
+      continue;
+    if( result <= 0 )
+      return false;
 
-  if( m_sendLength == msg.length() )
-  {
-    m_sendLength = 0;
-    m_sendQueue.pop_front();
+    // the last message written to may only be partly sent
+    size_t sent = result;
+    while( sent )
+    {
+      size_t remaining = m_sendQueue.front().length() - m_sendLength;
+      if( sent < remaining )
+      {
+        m_sendLength += (unsigned)sent;
+        break;
+      }
+
+      sent -= remaining;
+      m_sendLength = 0;
+      m_sendQueue.pop_front();
+    }
+
+    if( (size_t)result < bytes )
+      return false;
   }
 
-  return !m_sendQueue.size();
+  return true;
 }
 
 void SocketConnection::disconnect()
@@ -103,14 +154,32 @@ void SocketConnection::disconnect()
     m_pMonitor->drop( m_socket );
 }
 
+void SocketConnection::wakeup()
+{
+  atomic_store_release( m_wakeup, 1L );
+  if ( m_pMonitor )
+    m_pMonitor->signal( m_socket );
+}
+
+void SocketConnection::processWakeup()
+{
+  if ( atomic_load_acquire( m_wakeup ) )
+    onTimeout();
+}
+
 bool SocketConnection::read( SocketConnector& s )
+{
+  return read( s.getMonitor() );
+}
+
+bool SocketConnection::read( SocketMonitor& s )
 {
   if ( !m_pSession ) return false;
 
   try
   {
     readFromSocket();
-    readMessages( s.getMonitor() );
+    readMessages( s );
   }
   catch( SocketRecvFailed& e )
   {
@@ -121,25 +190,21 @@ bool SocketConnection::read( SocketConnector& s )
 }
 
 bool SocketConnection::read( SocketAcceptor& a, SocketServer& s )
+{
+  return read( a, s.getMonitor() );
+}
+
+bool SocketConnection::read( Acceptor& a, SocketMonitor& s )
 {
   std::string msg;
   try
   {
     if ( !m_pSession )
     {
-      struct timeval timeout = { 1, 0 };
-      fd_set readset = m_fds;
-
-      while( !readMessage( msg ) )
-      {
-        int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
-        if( result > 0 )
-          readFromSocket();
-        else if( result == 0 )
-          return false;
-        else if( result < 0 )
-          return false;
-      }
+      // wait for the next event if the logon has not fully arrived yet
+      readFromSocket();
+      if( !readMessage( msg ) )
+        return true;
 
       m_pSession = Session::lookupSession( msg, true );
       if( !isValidSession() )
@@ -157,17 +222,19 @@ bool SocketConnection::read( SocketAcceptor& a, SocketServer& s )
         m_pSession->next( msg, UtcTimeStamp() );
       if( !m_pSession )
       {
-        s.getMonitor().drop( m_socket );
+        s.drop( m_socket );
         return false;
       }
 
       Session::registerSession( m_pSession->getSessionID() );
+      // messages that arrived along with the logon
+      readMessages( s );
       return true;
     }
     else
     {
       readFromSocket();
-      readMessages( s.getMonitor() );
+      readMessages( s );
       return true;
     }
   }
@@ -175,11 +242,11 @@ bool SocketConnection::read( SocketAcceptor& a, SocketServer& s )
   {
     if( m_pSession )
       m_pSession->getLog()->onEvent( e.what() );
-    s.getMonitor().drop( m_socket );
+    s.drop( m_socket );
   }
   catch ( InvalidMessage& )
   {
-    s.getMonitor().drop( m_socket );
+    s.drop( m_socket );
   }
   return false;
 }
@@ -197,9 +264,21 @@ bool SocketConnection::isValidSession()
 void SocketConnection::readFromSocket()
 throw( SocketRecvFailed )
 {
-  ssize_t size = recv( m_socket, m_buffer, sizeof(m_buffer), 0 );
-  if( size <= 0 ) throw SocketRecvFailed( size );
-  m_parser.addToStream( m_buffer, size );
+  // a short read means the socket has been drained, which an edge
+  // triggered monitor needs before it reports the socket again
+  for( ;; )
+  {
+    ssize_t size = recv( m_socket, m_buffer, sizeof(m_buffer), 0 );
+    if( size <= 0 )
+    {
+      // a signal does not drain the socket, the read is repeated
+      if( size < 0 && socket_interrupted() ) continue;
+      if( size < 0 && socket_wouldblock() ) return;
+      throw SocketRecvFailed( size );
+    }
+    m_parser.addToStream( m_buffer, size );
+    if( size < (ssize_t)sizeof(m_buffer) ) return;
+  }
 }
 
 bool SocketConnection::readMessage( std::string& msg )
@@ -212,16 +291,32 @@ bool SocketConnection::readMessage( std::string& msg )
   return true;
 }
 
+bool SocketConnection::readMessage( const char*& data, std::string::size_type& length )
+{
+  try
+  {
+    return m_parser.readFixMessage( data, length );
+  }
+  catch ( MessageParseError& ) {}
+  length = 0;
+  return true;
+}
+
 void SocketConnection::readMessages( SocketMonitor& s )
 {
   if( !m_pSession ) return;
 
-  std::string msg;
-  while( readMessage( msg ) )
+  // messages framed from the same read are dispatched as one batch
+  // sharing a receive time, each is read in place from the parser
+  const char* data = 0;
+  std::string::size_type length = 0;
+  UtcTimeStamp now;
+  while( readMessage( data, length ) )
   {
+    if( !length ) continue;
     try
     {
-      m_pSession->next( msg, UtcTimeStamp() );
+      m_pSession->next( data, length, now );
     }
     catch ( InvalidMessage& )
     {
@@ -229,10 +324,48 @@ void SocketConnection::readMessages( SocketMonitor& s )
         s.drop( m_socket );
     }
   }
+
+  schedule( now );
 }
 
 void SocketConnection::onTimeout()
 {
-  if ( m_pSession ) m_pSession->next();
+  next( UtcTimeStamp() );
+}
+
+void SocketConnection::awaitLogon()
+{
+  if ( m_pMonitor )
+    m_pMonitor->getTimers().schedule( *this, 1000L * LOGON_TIMEOUT );
+}
+
+void SocketConnection::onTimer( TimerWheel& timers )
+{
+  // the logon never fully arrived, which a half open connection
+  // would otherwise keep waiting for
+  if ( !m_pSession )
+  {
+    if ( m_pMonitor )
+      m_pMonitor->drop( m_socket );
+    return;
+  }
+  next( timers.getTime() );
+}
+
+void SocketConnection::next( const UtcTimeStamp& now )
+{
+  atomic_store_release( m_wakeup, 0L );
+  if ( !m_pSession ) return;
+
+  m_pSession->next( now );
+  schedule( now );
+}
+
+void SocketConnection::schedule( const UtcTimeStamp& now )
+{
+  if ( !m_pSession || !m_pMonitor ) return;
+
+  long timeout = 1000L * m_pSession->getNextTimeout( now );
+  m_pMonitor->getTimers().schedule( *this, timeout );
 }
 } // namespace FIX
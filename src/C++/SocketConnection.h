@@ -32,24 +32,33 @@
 #include "SocketMonitor.h"
 #include "Utility.h"
 #include "Mutex.h"
+#include "AtomicCount.h"
 #include <set>
 
 namespace FIX
 {
+class Acceptor;
+class Initiator;
 class SocketAcceptor;
 class SocketServer;
 class SocketConnector;
-class SocketInitiator;
 class Session;
 
-/// Encapsulates a socket file descriptor (single-threaded).
-class SocketConnection : Responder
+/**
+ * Encapsulates a socket file descriptor (single-threaded).
+ *
+ * Instead of being polled, the session is run by a timer on the
+ * monitor's TimerWheel that is set for the session's next deadline
+ * whenever it has run or messages have arrived.
+ */
+class SocketConnection : Responder, TimerWheel::Timer
 {
 public:
   typedef std::set<SessionID> Sessions;
 
-  SocketConnection( int s, Sessions sessions, SocketMonitor* pMonitor );
-  SocketConnection( SocketInitiator&, const SessionID&, int, SocketMonitor* );
+  SocketConnection( int s, Sessions sessions, SocketMonitor* pMonitor,
+                    const SendBatch& batch = SendBatch() );
+  SocketConnection( Initiator&, const SessionID&, int, SocketMonitor* );
   virtual ~SocketConnection();
 
   int getSocket() const { return m_socket; }
@@ -57,6 +66,11 @@ public:
 
   bool read( SocketConnector& s );
   bool read( SocketAcceptor&, SocketServer& );
+  /// Read from a connection whose session is known
+  bool read( SocketMonitor& );
+  /// Read from an accepted connection, looking up its session on logon
+  bool read( Acceptor&, SocketMonitor& );
+  /// Write as much of the send queue as the socket takes, true if it is empty
   bool processQueue();
 
   void signal()
@@ -74,17 +88,32 @@ public:
   }
 
   void onTimeout();
+  /// Drop an accepted connection unless it logs on within LOGON_TIMEOUT
+  /// seconds, called by the thread that runs the monitor
+  void awaitLogon();
+  /// Run the session if another thread has asked for it
+  void processWakeup();
 
 private:
   typedef std::deque<std::string, ALLOCATOR<std::string> >
     Queue;
 
+  enum { LOGON_TIMEOUT = 10 };
+
   bool isValidSession();
   void readFromSocket() throw( SocketRecvFailed );
   bool readMessage( std::string& msg );
+  bool readMessage( const char*& data, std::string::size_type& length );
   void readMessages( SocketMonitor& s );
   bool send( const std::string& );
+  bool send( const std::string* messages,
+             const size_t* offsets, size_t count );
   void disconnect();
+  void wakeup();
+
+  void onTimer( TimerWheel& );
+  void next( const UtcTimeStamp& );
+  void schedule( const UtcTimeStamp& );
 
   int m_socket;
   char m_buffer[BUFSIZ];
@@ -92,11 +121,15 @@ private:
   Parser m_parser;
   Queue m_sendQueue;
   unsigned m_sendLength;
+  SendBatch m_sendBatch;
+  /// Messages gathered for one socket_sendv
+  const char* m_sendBuffers[ SOCKET_SENDV_MAX ];
+  size_t m_sendLengths[ SOCKET_SENDV_MAX ];
   Sessions m_sessions;
   Session* m_pSession;
   SocketMonitor* m_pMonitor;
   Mutex m_mutex;
-  fd_set m_fds;
+  long volatile m_wakeup;
 };
 }
 
@@ -79,8 +79,8 @@ private:
   SocketConnector::Strategy& m_strategy;
 };
 
-SocketConnector::SocketConnector( int timeout )
-: m_monitor( timeout ) {}
+SocketConnector::SocketConnector( int timeout, SocketMonitor::Type type )
+: m_monitor( timeout, type ) {}
 
 int SocketConnector::connect( const std::string& address, int port, bool noDelay,
                               int sendBufSize, int rcvBufSize )
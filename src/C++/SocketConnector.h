@@ -37,7 +37,8 @@ class SocketConnector
 public:
   class Strategy;
 
-  SocketConnector( int timeout = 0 );
+  SocketConnector( int timeout = 0,
+                   SocketMonitor::Type type = SocketMonitor::SELECT );
 
   int connect( const std::string& address, int port, bool noDelay, 
                int sendBufSize, int rcvBufSize );
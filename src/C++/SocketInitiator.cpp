@@ -34,7 +34,8 @@ SocketInitiator::SocketInitiator( Application& application,
                                   const SessionSettings& settings )
 throw( ConfigError )
 : Initiator( application, factory, settings ),
-  m_connector( 1 ), m_lastConnect( 0 ),
+  m_connector( 1, SocketMonitor::parseType( settings.get() ) ),
+  m_lastConnect( 0 ),
   m_reconnectInterval( 30 ), m_noDelay( false ), m_sendBufSize( 0 ),
   m_rcvBufSize( 0 ) 
 {
@@ -46,7 +47,8 @@ SocketInitiator::SocketInitiator( Application& application,
                                   LogFactory& logFactory )
 throw( ConfigError )
 : Initiator( application, factory, settings, logFactory ),
-  m_connector( 1 ), m_lastConnect( 0 ),
+  m_connector( 1, SocketMonitor::parseType( settings.get() ) ),
+  m_lastConnect( 0 ),
   m_reconnectInterval( 30 ), m_noDelay( false ), m_sendBufSize( 0 ),
   m_rcvBufSize( 0 )
 {
@@ -168,6 +170,7 @@ void SocketInitiator::onWrite( SocketConnector& connector, int s )
   SocketConnections::iterator i = m_connections.find( s );
   if ( i == m_connections.end() ) return ;
   SocketConnection* pSocketConnection = i->second;
+  pSocketConnection->processWakeup();
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
 }
@@ -222,10 +225,6 @@ void SocketInitiator::onTimeout( SocketConnector& )
     connect();
     m_lastConnect = now;
   }
-
-  SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
-    i->second->onTimeout();
 }
 
 void SocketInitiator::getHost( const SessionID& s, const Dictionary& d,
@@ -24,16 +24,22 @@
 #endif
 
 #include "SocketMonitor.h"
+#include "SessionSettings.h"
 #include "Utility.h"
 #include <exception>
 #include <set>
 #include <algorithm>
 #include <iostream>
 
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif
+
 namespace FIX
 {
-SocketMonitor::SocketMonitor( int timeout )
-: m_timeout( timeout )
+SocketMonitor::SocketMonitor( int timeout, Type type )
+: m_type( SELECT ), m_timeout( timeout ), m_deadline( process_milliseconds() ),
+  m_epoll( -1 )
 {
   socket_init();
 
@@ -44,10 +50,15 @@ SocketMonitor::SocketMonitor( int timeout )
   socket_setnonblock( m_interrupt );
   m_readSockets.insert( m_interrupt );
 
-  m_timeval.tv_sec = 0;
-  m_timeval.tv_usec = 0;
-#ifndef SELECT_DECREMENTS_TIME
-  m_ticks = clock();
+#ifdef HAVE_SYS_EPOLL_H
+  if( type == EPOLL )
+  {
+    m_epoll = epoll_create( 1 );
+    if( m_epoll < 0 )
+      throw RuntimeError( "Unable to create epoll instance" );
+    m_type = EPOLL;
+    watch( m_interrupt, EPOLL_CTL_ADD, EPOLLIN );
+  }
 #endif
 }
 
@@ -59,9 +70,30 @@ SocketMonitor::~SocketMonitor()
   }
 
   socket_close( m_signal );
+#ifdef HAVE_SYS_EPOLL_H
+  if( m_epoll >= 0 )
+    close( m_epoll );
+#endif
   socket_term();
 }
 
+SocketMonitor::Type SocketMonitor::parseType( const Dictionary& settings )
+throw( ConfigError )
+{
+  if( !settings.has( SOCKET_MONITOR_TYPE ) )
+    return SELECT;
+
+  std::string type = settings.getString( SOCKET_MONITOR_TYPE, true );
+  if( type == "SELECT" )
+    return SELECT;
+#ifdef HAVE_SYS_EPOLL_H
+  if( type == "EPOLL" )
+    return EPOLL;
+#endif
+  throw ConfigError( std::string(SOCKET_MONITOR_TYPE)
+                     + " " + type + " is not supported" );
+}
+
 bool SocketMonitor::addConnect( int s )
 {
   socket_setnonblock( s );
@@ -69,6 +101,10 @@ bool SocketMonitor::addConnect( int s )
   if( i != m_connectSockets.end() ) return false;
 
   m_connectSockets.insert( s );
+#ifdef HAVE_SYS_EPOLL_H
+  if( m_epoll >= 0 )
+    watch( s, EPOLL_CTL_ADD, EPOLLOUT | EPOLLET );
+#endif
   return true;
 }
 
@@ -79,6 +115,18 @@ bool SocketMonitor::addRead( int s )
   if( i != m_readSockets.end() ) return false;
 
   m_readSockets.insert( s );
+#ifdef HAVE_SYS_EPOLL_H
+  // a listening socket only accepts one connection per event, connected
+  // sockets are read until they would block
+  if( m_epoll >= 0 )
+  {
+    int listening = 0;
+    socklen_t length = sizeof(listening);
+    getsockopt( s, SOL_SOCKET, SO_ACCEPTCONN, (char*)&listening, &length );
+    watch( s, EPOLL_CTL_ADD,
+           listening ? EPOLLIN : EPOLLIN | EPOLLRDHUP | EPOLLET );
+  }
+#endif
   return true;
 }
 
@@ -92,6 +140,10 @@ bool SocketMonitor::addWrite( int s )
   if( i != m_writeSockets.end() ) return false;
 
   m_writeSockets.insert( s );
+#ifdef HAVE_SYS_EPOLL_H
+  if( m_epoll >= 0 )
+    watch( s, EPOLL_CTL_MOD, EPOLLIN | EPOLLRDHUP | EPOLLOUT | EPOLLET );
+#endif
   return true;
 }
 
@@ -110,43 +162,43 @@ bool SocketMonitor::drop( int s )
     m_writeSockets.erase( s );
     m_connectSockets.erase( s );
     m_dropped.push( s );
+#ifdef HAVE_SYS_EPOLL_H
+    // closing took the socket out of the epoll set but events for it
+    // may still be waiting to be processed
+    if( m_epoll >= 0 )
+      m_closed.insert( s );
+#endif
     return true;
   }
   return false;
 }
 
-inline timeval* SocketMonitor::getTimeval( bool poll, double timeout )
+long SocketMonitor::getTimeout( bool poll, long now )
 {
-  if ( poll )
+  if( poll )
+    return 0;
+
+  // timeouts are reported every m_timeout seconds no matter how busy the
+  // sockets are or how many timers come due in between
+  long timeout = -1;
+  if( m_timeout )
   {
-    m_timeval.tv_sec = 0;
-    m_timeval.tv_usec = 0;
-    return &m_timeval;
+    if( now - m_deadline >= 0 )
+      m_deadline = now + m_timeout * 1000;
+    timeout = m_deadline - now;
   }
 
-  timeout = m_timeout;
+  long timerTimeout = m_timers.getTimeout( now );
+  if( timerTimeout >= 0 && ( timeout < 0 || timerTimeout < timeout ) )
+    timeout = timerTimeout;
+  return timeout;
+}
 
-  if ( !timeout )
-    return 0;
-#ifdef SELECT_MODIFIES_TIMEVAL
-  if ( !m_timeval.tv_sec && !m_timeval.tv_usec && timeout )
-    m_timeval.tv_sec = timeout;
-  return &m_timeval;
-#else
-double elapsed = ( double ) ( clock() - m_ticks ) / ( double ) CLOCKS_PER_SEC;
-  if ( elapsed >= timeout || elapsed == 0.0 )
-  {
-    m_ticks = clock();
-    m_timeval.tv_sec = 0;
-    m_timeval.tv_usec = (timeout * 1000000);
-  }
-  else
-  {
-    m_timeval.tv_sec = 0;
-    m_timeval.tv_usec = ( ( timeout - elapsed ) * 1000000 );
-  }
-  return &m_timeval;
-#endif
+bool SocketMonitor::isTimedOut( bool poll, int result )
+{
+  if( poll )
+    return result == 0;
+  return m_timeout && process_milliseconds() - m_deadline >= 0;
 }
 
 bool SocketMonitor::sleepIfEmpty( bool poll )
@@ -170,12 +222,22 @@ void SocketMonitor::signal( int socket )
   socket_send( m_signal, (char*)&socket, sizeof(socket) );
 }
 
+void SocketMonitor::interrupt()
+{
+  // no socket is signaled, but block wakes up to look
+  signal( -1 );
+}
+
 void SocketMonitor::unsignal( int s )
 {
   Sockets::iterator i = m_writeSockets.find( s );
   if( i == m_writeSockets.end() ) return;
 
   m_writeSockets.erase( s );
+#ifdef HAVE_SYS_EPOLL_H
+  if( m_epoll >= 0 && m_readSockets.find(s) != m_readSockets.end() )
+    watch( s, EPOLL_CTL_MOD, EPOLLIN | EPOLLRDHUP | EPOLLET );
+#endif
 }
 
 void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
@@ -188,6 +250,14 @@ void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
       return ;
   }
 
+#ifdef HAVE_SYS_EPOLL_H
+  if( m_epoll >= 0 )
+  {
+    blockEpoll( strategy, poll );
+    return;
+  }
+#endif
+
   fd_set readSet;
   FD_ZERO( &readSet );
   buildSet( m_readSockets, readSet );
@@ -205,23 +275,34 @@ void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
     return;
   }
 
-  int result = select( FD_SETSIZE, &readSet, &writeSet, &exceptSet, getTimeval(poll, timeout) );
-
-  if ( result == 0 )
+  // wake up for the next timer, but leave the periodic timeout running
+  long wait = getTimeout( poll, process_milliseconds() );
+  timeval waitval;
+  timeval* pTimeval = 0;
+  if( wait >= 0 )
   {
-    strategy.onTimeout( *this );
-    return;
+    waitval.tv_sec = wait / 1000;
+    waitval.tv_usec = ( wait % 1000 ) * 1000;
+    pTimeval = &waitval;
   }
-  else if ( result > 0 )
+
+  int result = select( FD_SETSIZE, &readSet, &writeSet, &exceptSet, pTimeval );
+  m_timers.expire( process_milliseconds() );
+
+  if ( result > 0 )
   {
     processExceptSet( strategy, exceptSet );
     processWriteSet( strategy, writeSet );
     processReadSet( strategy, readSet );
   }
-  else
+  else if ( result < 0 )
   {
     strategy.onError( *this );
+    return;
   }
+
+  if( isTimedOut( poll, result ) )
+    strategy.onTimeout( *this );
 }
 
 void SocketMonitor::processReadSet( Strategy& strategy, fd_set& readSet )
@@ -332,4 +413,81 @@ void SocketMonitor::buildSet( const Sockets& sockets, fd_set& watchSet )
     FD_SET( *iter, &watchSet );
   }
 }
+
+#ifdef HAVE_SYS_EPOLL_H
+void SocketMonitor::watch( int s, int operation, unsigned events )
+{
+  epoll_event event;
+  event.events = events;
+  event.data.u64 = 0;
+  event.data.fd = s;
+  epoll_ctl( m_epoll, operation, s, &event );
+}
+
+void SocketMonitor::blockEpoll( Strategy& strategy, bool poll )
+{
+  m_closed.clear();
+
+  // sockets that do not fit are reported by the next wait
+  epoll_event events[ 256 ];
+  long timeout = getTimeout( poll, process_milliseconds() );
+
+  int result = epoll_wait( m_epoll, events, 256, (int)timeout );
+  m_timers.expire( process_milliseconds() );
+
+  if( result < 0 )
+  {
+    if( errno != EINTR )
+      strategy.onError( *this );
+    return;
+  }
+
+  for( int i = 0; i < result; ++i )
+    processEvent( strategy, events[i].data.fd, events[i].events );
+
+  if( isTimedOut( poll, result ) )
+    strategy.onTimeout( *this );
+}
+
+void SocketMonitor::processEvent( Strategy& strategy, int s, unsigned events )
+{
+  if( s == m_interrupt )
+  {
+    int socket = 0;
+    while( recv( s, (char*)&socket, sizeof(socket), 0 ) == sizeof(socket) )
+      addWrite( socket );
+    return;
+  }
+
+  if( m_closed.find(s) != m_closed.end() )
+    return;
+
+  if( m_connectSockets.find(s) != m_connectSockets.end() )
+  {
+    if( events & (EPOLLERR | EPOLLHUP) )
+    {
+      strategy.onError( *this, s );
+      return;
+    }
+    m_connectSockets.erase( s );
+    m_readSockets.insert( s );
+    watch( s, EPOLL_CTL_MOD, EPOLLIN | EPOLLRDHUP | EPOLLET );
+    strategy.onConnect( *this, s );
+    return;
+  }
+
+  if( (events & EPOLLOUT)
+      && m_writeSockets.find(s) != m_writeSockets.end() )
+  {
+    strategy.onWrite( *this, s );
+  }
+
+  if( (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+      && m_closed.find(s) == m_closed.end()
+      && m_readSockets.find(s) != m_readSockets.end() )
+  {
+    strategy.onEvent( *this, s );
+  }
+}
+#endif
 }
@@ -37,19 +37,37 @@ typedef int socklen_t;
 #include <arpa/inet.h>
 #endif
 
+#include "Exceptions.h"
+#include "TimerWheel.h"
+
 #include <set>
 #include <queue>
 #include <time.h>
 
 namespace FIX
 {
-/// Monitors events on a collection of sockets.
+class Dictionary;
+
+/**
+ * Monitors events on a collection of sockets.
+ *
+ * By default the monitor waits with select. Where epoll is available it
+ * can use that instead, so that a wakeup only costs as much as the number
+ * of sockets that are ready. Listening sockets added with addRead are
+ * then watched level triggered, connected sockets are watched edge
+ * triggered, and writability is only watched while a socket is signaled.
+ *
+ * Timers scheduled on getTimers() are fired by block as well, which then
+ * waits no longer than until the next one is due.
+ */
 class SocketMonitor
 {
 public:
   class Strategy;
 
-  SocketMonitor( int timeout = 0 );
+  enum Type { SELECT, EPOLL };
+
+  SocketMonitor( int timeout = 0, Type type = SELECT );
   virtual ~SocketMonitor();
 
   bool addConnect( int socket );
@@ -58,11 +76,27 @@ public:
   bool drop( int socket );
   void signal( int socket );
   void unsignal( int socket );
+  /// Make a call to block return, may be called from any thread
+  void interrupt();
   void block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
 
   size_t numSockets() 
   { return m_readSockets.size() - 1; }
 
+  /// Dropped sockets not yet reported by block
+  size_t numDropped() const
+  { return m_dropped.size(); }
+
+  Type getType() const
+  { return m_type; }
+
+  /// Timers fired by block on the monitor's thread
+  TimerWheel& getTimers()
+  { return m_timers; }
+
+  /// Type named by the SocketMonitorType setting, SELECT if it is missing
+  static Type parseType( const Dictionary& ) throw( ConfigError );
+
 private:
   typedef std::set < int > Sockets;
   typedef std::queue < int > Queue;
@@ -71,18 +105,25 @@ private:
   bool bind();
   bool listen();
   void buildSet( const Sockets&, fd_set& );
-  inline timeval* getTimeval( bool poll, double timeout );
+  /// Milliseconds to wait for the periodic timeout or the next timer,
+  /// -1 to wait for sockets only
+  long getTimeout( bool poll, long now );
+  /// The wait ended with the periodic timeout due
+  bool isTimedOut( bool poll, int result );
   inline bool sleepIfEmpty( bool poll );
 
   void processReadSet( Strategy&, fd_set& );
   void processWriteSet( Strategy&, fd_set& );
   void processExceptSet( Strategy&, fd_set& );
 
+  void watch( int socket, int operation, unsigned events );
+  void blockEpoll( Strategy&, bool poll );
+  void processEvent( Strategy&, int socket, unsigned events );
+
+  Type m_type;
   int m_timeout;
-  timeval m_timeval;
-#ifndef SELECT_DECREMENTS_TIME
-  clock_t m_ticks;
-#endif
+  /// When the periodic timeout is due next
+  long m_deadline;
 
   int m_signal;
   int m_interrupt;
@@ -91,6 +132,12 @@ private:
   Sockets m_writeSockets;
   Queue m_dropped;
 
+  int m_epoll;
+  /// Sockets dropped since the last wait
+  Sockets m_closed;
+
+  TimerWheel m_timers;
+
 public:
   class Strategy
   {
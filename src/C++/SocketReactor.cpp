@@ -0,0 +1,187 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SocketReactor.h"
+#include "Session.h"
+
+namespace FIX
+{
+SocketReactor::SocketReactor( Strategy& strategy, SocketMonitor::Type type,
+                              int cpu )
+throw ( RuntimeError )
+: m_strategy( strategy ), m_monitor( 0, type ), m_cpu( cpu ),
+  m_size( 0 ), m_stop( false )
+{
+  if( !thread_spawn( &reactorThread, this, m_thread ) )
+    throw RuntimeError( "Unable to spawn thread" );
+}
+
+SocketReactor::~SocketReactor()
+{
+  stop();
+
+  PendingConnections::iterator i;
+  for( i = m_pending.begin(); i != m_pending.end(); ++i )
+  {
+    socket_close( i->m_pConnection->getSocket() );
+    delete i->m_pConnection;
+  }
+}
+
+void SocketReactor::add( SocketConnection* pConnection )
+{
+  handOff( Pending( pConnection, "", 0 ) );
+}
+
+void SocketReactor::connect( SocketConnection* pConnection,
+                             const std::string& address, int port )
+{
+  handOff( Pending( pConnection, address, port ) );
+}
+
+void SocketReactor::stop()
+{
+  if( m_stop ) return;
+
+  m_stop = true;
+  m_monitor.interrupt();
+  thread_join( m_thread );
+}
+
+void SocketReactor::handOff( const Pending& pending )
+{
+  {
+    Locker l( m_mutex );
+    m_pending.push_back( pending );
+  }
+  ++m_size;
+  m_monitor.interrupt();
+}
+
+void SocketReactor::addPending()
+{
+  PendingConnections pending;
+  {
+    Locker l( m_mutex );
+    if( m_pending.empty() ) return;
+    pending.swap( m_pending );
+  }
+
+  PendingConnections::iterator i;
+  for( i = pending.begin(); i != pending.end(); ++i )
+  {
+    SocketConnection* pConnection = i->m_pConnection;
+    int s = pConnection->getSocket();
+    m_connections[ s ] = pConnection;
+
+    if( i->m_port )
+    {
+      m_connecting[ s ] = pConnection;
+      m_monitor.addConnect( s );
+      socket_connect( s, i->m_address.c_str(), i->m_port );
+    }
+    else
+    {
+      m_monitor.addRead( s );
+      pConnection->awaitLogon();
+    }
+  }
+}
+
+void SocketReactor::run()
+{
+  if( m_cpu >= 0 )
+    thread_setaffinity( m_cpu );
+
+  while( !m_stop )
+  {
+    m_monitor.block( *this );
+    // a socket that was just closed may come back from an accept, it is
+    // only safe to add once the monitor has reported the drop
+    if( !m_monitor.numDropped() )
+      addPending();
+  }
+
+  SocketConnections connections = m_connections;
+  SocketConnections::iterator i;
+  for( i = connections.begin(); i != connections.end(); ++i )
+    onError( m_monitor, i->first );
+}
+
+THREAD_PROC SocketReactor::reactorThread( void* p )
+{
+  SocketReactor* pReactor = static_cast < SocketReactor* > ( p );
+  pReactor->run();
+  return 0;
+}
+
+void SocketReactor::onConnect( SocketMonitor&, int s )
+{
+  SocketConnections::iterator i = m_connecting.find( s );
+  if( i == m_connecting.end() ) return;
+  SocketConnection* pConnection = i->second;
+  m_connecting.erase( i );
+  m_strategy.onConnect( *this, *pConnection );
+}
+
+void SocketReactor::onEvent( SocketMonitor& monitor, int s )
+{
+  SocketConnections::iterator i = m_connections.find( s );
+  if( i == m_connections.end() ) return;
+  if( !m_strategy.onData( *this, *i->second ) )
+    onError( monitor, s );
+}
+
+void SocketReactor::onWrite( SocketMonitor&, int s )
+{
+  SocketConnections::iterator i = m_connections.find( s );
+  if( i == m_connections.end() ) return;
+  SocketConnection* pConnection = i->second;
+  pConnection->processWakeup();
+  if( pConnection->processQueue() )
+    pConnection->unsignal();
+}
+
+void SocketReactor::onError( SocketMonitor& monitor, int s )
+{
+  SocketConnections::iterator i = m_connections.find( s );
+  if( i == m_connections.end() ) return;
+  SocketConnection* pConnection = i->second;
+
+  m_strategy.onDisconnect( *this, *pConnection );
+  Session* pSession = pConnection->getSession();
+  if( pSession ) pSession->disconnect();
+  monitor.drop( s );
+
+  delete pConnection;
+  m_connections.erase( s );
+  m_connecting.erase( s );
+  --m_size;
+}
+
+void SocketReactor::onError( SocketMonitor& )
+{
+}
+}
@@ -0,0 +1,123 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SOCKETREACTOR_H
+#define FIX_SOCKETREACTOR_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "SocketMonitor.h"
+#include "SocketConnection.h"
+#include "AtomicCount.h"
+#include "Mutex.h"
+#include "Utility.h"
+#include <map>
+#include <vector>
+#include <string>
+
+namespace FIX
+{
+/**
+ * Event loop thread that owns a share of the connections of an
+ * acceptor or initiator.
+ *
+ * Connections are handed to a reactor from any thread. From then on
+ * the reactor's thread alone reads them and drives their sessions, so
+ * sessions on different reactors never contend with each other. An idle
+ * reactor sleeps until the earliest deadline among its sessions.
+ */
+class SocketReactor : SocketMonitor::Strategy
+{
+public:
+  class Strategy;
+
+  /// Start an event loop, pinned to cpu unless it is negative
+  SocketReactor( Strategy& strategy, SocketMonitor::Type type, int cpu = -1 )
+  throw ( RuntimeError );
+  ~SocketReactor();
+
+  /// Take over an accepted connection
+  void add( SocketConnection* );
+  /// Take over a connection and connect it to address and port
+  void connect( SocketConnection*, const std::string& address, int port );
+  /// Stop the event loop and disconnect all connections
+  void stop();
+
+  /// Number of connections owned by the reactor
+  long size() const { return m_size; }
+  SocketMonitor& getMonitor() { return m_monitor; }
+
+private:
+  struct Pending
+  {
+    Pending( SocketConnection* pConnection, const std::string& address, int port )
+    : m_pConnection( pConnection ), m_address( address ), m_port( port ) {}
+
+    SocketConnection* m_pConnection;
+    std::string m_address;
+    int m_port;
+  };
+
+  typedef std::map < int, SocketConnection* > SocketConnections;
+  typedef std::vector < Pending > PendingConnections;
+
+  void handOff( const Pending& );
+  void addPending();
+  void run();
+  static THREAD_PROC reactorThread( void* p );
+
+  void onConnect( SocketMonitor&, int socket );
+  void onEvent( SocketMonitor&, int socket );
+  void onWrite( SocketMonitor&, int socket );
+  void onError( SocketMonitor&, int socket );
+  void onError( SocketMonitor& );
+
+  Strategy& m_strategy;
+  SocketMonitor m_monitor;
+  SocketConnections m_connections;
+  SocketConnections m_connecting;
+  int m_cpu;
+
+  Mutex m_mutex;
+  PendingConnections m_pending;
+  atomic_count m_size;
+  volatile bool m_stop;
+  thread_id m_thread;
+
+public:
+  /// Handles the events of the connections owned by a reactor.
+  class Strategy
+  {
+  public:
+    virtual ~Strategy() {}
+    /// Called once a connection handed over with connect is connected
+    virtual void onConnect( SocketReactor&, SocketConnection& ) {}
+    /// Called when there is data to read, return false to disconnect
+    virtual bool onData( SocketReactor&, SocketConnection& ) = 0;
+    /// Called before a connection is disconnected and deleted
+    virtual void onDisconnect( SocketReactor&, SocketConnection& ) {}
+  };
+};
+}
+
+#endif //FIX_SOCKETREACTOR_H
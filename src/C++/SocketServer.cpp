@@ -91,8 +91,8 @@ private:
   SocketServer::Strategy& m_strategy;
 };
 
-SocketServer::SocketServer( int timeout )
-: m_monitor( timeout ) {}
+SocketServer::SocketServer( int timeout, SocketMonitor::Type type )
+: m_monitor( timeout, type ) {}
 
 int SocketServer::add( int port, bool reuse, bool noDelay, 
                        int sendBufSize, int rcvBufSize )
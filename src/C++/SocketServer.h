@@ -58,7 +58,8 @@ class SocketServer
 public:
   class Strategy;
 
-  SocketServer( int timeout = 0 );
+  SocketServer( int timeout = 0,
+                SocketMonitor::Type type = SocketMonitor::SELECT );
 
   int add( int port, bool reuse = false, bool noDelay = false, 
            int sendBufSize = 0, int rcvBufSize = 0 ) throw( SocketException& );
@@ -0,0 +1,93 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SPSCQUEUE_H
+#define FIX_SPSCQUEUE_H
+
+#include "AtomicCount.h"
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Bounded queue for exactly one producing and one consuming thread.
+ *
+ * Elements are addressed by ever increasing positions. The producer fills
+ * the element at writePosition() and makes it visible with publish(), the
+ * consumer reads the elements up to writePosition() and hands them back
+ * with release(). Elements are reused rather than destroyed, so strings
+ * keep their capacity, and neither side takes a lock.
+ */
+template < typename T > class SpscQueue
+{
+public:
+  /// The capacity is rounded up to a power of two
+  explicit SpscQueue( size_t capacity )
+  : m_mask( 0 ), m_readPosition( 0 ), m_writePosition( 0 )
+  {
+    size_t size = 1;
+    while( size < capacity ) size <<= 1;
+    m_items.resize( size );
+    m_mask = size - 1;
+  }
+
+  size_t capacity() const
+  { return m_items.size(); }
+
+  size_t readPosition() const
+  { return atomic_load_acquire( m_readPosition ); }
+
+  size_t writePosition() const
+  { return atomic_load_acquire( m_writePosition ); }
+
+  bool empty() const
+  { return readPosition() == writePosition(); }
+
+  /// Only meaningful to the producer
+  bool full() const
+  { return m_writePosition - readPosition() >= m_items.size(); }
+
+  T& at( size_t position )
+  { return m_items[ position & m_mask ]; }
+
+  const T& at( size_t position ) const
+  { return m_items[ position & m_mask ]; }
+
+  /// Make the elements before position visible to the consumer
+  void publish( size_t position )
+  { atomic_store_release( m_writePosition, position ); }
+
+  /// Give the elements before position back to the producer
+  void release( size_t position )
+  { atomic_store_release( m_readPosition, position ); }
+
+private:
+  SpscQueue( const SpscQueue& );
+  SpscQueue& operator=( const SpscQueue& );
+
+  std::vector < T > m_items;
+  size_t m_mask;
+  volatile size_t m_readPosition;
+  volatile size_t m_writePosition;
+};
+}
+
+#endif
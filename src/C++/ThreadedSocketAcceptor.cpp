@@ -33,7 +33,7 @@ ThreadedSocketAcceptor::ThreadedSocketAcceptor(
   Application& application,
   MessageStoreFactory& factory,
   const SessionSettings& settings ) throw( ConfigError )
-: Acceptor( application, factory, settings )
+: Acceptor( application, factory, settings ), m_busyPoll( 0 )
 { socket_init(); }
 
 ThreadedSocketAcceptor::ThreadedSocketAcceptor(
@@ -41,7 +41,7 @@ ThreadedSocketAcceptor::ThreadedSocketAcceptor(
   MessageStoreFactory& factory,
   const SessionSettings& settings,
   LogFactory& logFactory ) throw( ConfigError )
-: Acceptor( application, factory, settings, logFactory )
+: Acceptor( application, factory, settings, logFactory ), m_busyPoll( 0 )
 { 
   socket_init(); 
 }
@@ -65,6 +65,14 @@ throw ( ConfigError )
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
   }
+
+  const Dictionary& dict = s.get();
+  if( dict.has( SOCKET_BUSY_POLL ) )
+  {
+    m_busyPoll = dict.getInt( SOCKET_BUSY_POLL );
+    if( m_busyPoll < 0 )
+      throw ConfigError( std::string(SOCKET_BUSY_POLL) + " must not be negative" );
+  }
 }
 
 void ThreadedSocketAcceptor::onInitialize( const SessionSettings& s )
@@ -213,7 +221,8 @@ THREAD_PROC ThreadedSocketAcceptor::socketAcceptorThread( void* p )
 
     ThreadedSocketConnection * pConnection =
       new ThreadedSocketConnection
-        ( socket, sessions, pAcceptor->getLog() );
+        ( socket, sessions, pAcceptor->getLog(), pAcceptor->getSendBatch() );
+    pConnection->setBusyPoll( pAcceptor->m_busyPoll );
 
     ConnectionThreadInfo* info = new ConnectionThreadInfo( pAcceptor, pConnection );
 
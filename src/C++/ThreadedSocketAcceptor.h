@@ -90,6 +90,8 @@ private:
   PortToSessions m_portToSessions;
   SocketToPort m_socketToPort;
   SocketToThread m_threads;
+  /// SocketBusyPoll of the default settings
+  int m_busyPoll;
   Mutex m_mutex;
 };
 /*! @} */
@@ -32,10 +32,12 @@
 namespace FIX
 {
 ThreadedSocketConnection::ThreadedSocketConnection
-( int s, Sessions sessions, Log* pLog )
-: m_socket( s ), m_pLog( pLog ),
+( int s, Sessions sessions, Log* pLog, const SendBatch& batch )
+: m_socket( s ), m_buffer( BUFSIZ ), m_busyPoll( 0 ),
+  m_pLog( pLog ), m_sendBatch( batch ),
   m_sessions( sessions ), m_pSession( 0 ),
-  m_disconnect( false )
+  m_disconnect( false ), m_nextTimeout( 0 ),
+  m_wakeups( 0 ), m_handledWakeups( 0 )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -44,11 +46,13 @@ ThreadedSocketConnection::ThreadedSocketConnection
 ThreadedSocketConnection::ThreadedSocketConnection
 ( const SessionID& sessionID, int s,
   const std::string& address, short port, 
-  Log* pLog )
-  : m_socket( s ), m_address( address ), m_port( port ),
-    m_pLog( pLog ),
+  Log* pLog, const SendBatch& batch )
+  : m_socket( s ), m_buffer( BUFSIZ ), m_busyPoll( 0 ),
+    m_address( address ), m_port( port ),
+    m_pLog( pLog ), m_sendBatch( batch ),
     m_pSession( Session::lookupSession( sessionID ) ),
-    m_disconnect( false )
+    m_disconnect( false ), m_nextTimeout( 0 ),
+    m_wakeups( 0 ), m_handledWakeups( 0 )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -66,12 +70,64 @@ ThreadedSocketConnection::~ThreadedSocketConnection()
 
 bool ThreadedSocketConnection::send( const std::string& msg )
 {
-  int totalSent = 0;
-  while(totalSent < (int)msg.length())
+  size_t offset = 0;
+  return send( &msg, &offset, 1 );
+}
+
+bool ThreadedSocketConnection::send( const std::string* messages,
+                                     const size_t* offsets, size_t count )
+{
+  // position of the first byte not yet sent
+  size_t first = 0;
+  size_t offset = count ? offsets[ 0 ] : 0;
+
+  while( first < count )
   {
-    ssize_t sent = socket_send( m_socket, msg.c_str() + totalSent, msg.length() );
-    if(sent < 0) return false;
-    totalSent += sent;
+    // sendmsg returns 0 for a batch without any bytes, which would
+    // not move past a message that is empty
+    if( messages[ first ].length() == offset )
+    {
+      if( ++first < count )
+        offset = offsets[ first ];
+      continue;
+    }
+
+    size_t buffers = 0;
+    size_t bytes = 0;
+    size_t i = first;
+    for( ; i < count && buffers < m_sendBatch.m_maxMessages; ++i )
+    {
+      size_t start = i == first ? offset : offsets[i];
+      size_t length = messages[i].length() - start;
+      if( buffers && bytes + length > m_sendBatch.m_maxBytes )
+        break;
+
+      m_sendBuffers[ buffers ] = messages[i].c_str() + start;
+      m_sendLengths[ buffers ] = length;
+      bytes += length;
+      ++buffers;
+    }
+
+    bool more = m_sendBatch.m_cork && i < count;
+    ssize_t result = socket_sendv
+      ( m_socket, m_sendBuffers, m_sendLengths, buffers, more );
+    if( result < 0 && socket_interrupted() ) continue;
+    if( result <= 0 ) return false;
+
+    size_t sent = result;
+    while( sent )
+    {
+      size_t remaining = messages[ first ].length() - offset;
+      if( sent < remaining )
+      {
+        offset += sent;
+        break;
+      }
+
+      sent -= remaining;
+      if( ++first < count )
+        offset = offsets[ first ];
+    }
   }
 
   return true;
@@ -88,30 +144,61 @@ void ThreadedSocketConnection::disconnect()
   socket_close( m_socket );
 }
 
-bool ThreadedSocketConnection::read()
+void ThreadedSocketConnection::wakeup()
+{
+  ++m_wakeups;
+}
+
+void ThreadedSocketConnection::setBusyPoll( int microseconds )
 {
-  struct timeval timeout = { 1, 0 };
-  fd_set readset = m_fds;
+  m_busyPoll = microseconds;
+  if( m_busyPoll )
+    socket_setbusypoll( m_socket, m_busyPoll );
+}
 
+bool ThreadedSocketConnection::read()
+{
   try
   {
-    // Wait for input (1 second timeout)
-    int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
-
-    if( result > 0 ) // Something to read
+    // a connection under load finds data waiting and skips the select,
+    // a connection configured to busy poll keeps looking for a while
+    bool received = receive();
+    if( !received && m_busyPoll )
     {
-      // We can read without blocking
-      ssize_t size = recv( m_socket, m_buffer, sizeof(m_buffer), 0 );
-      if ( size <= 0 ) { throw SocketRecvFailed( size ); }
-      m_parser.addToStream( m_buffer, size );
+      long long deadline = process_nanoseconds() + 1000LL * m_busyPoll;
+      while( !received && process_nanoseconds() - deadline < 0 )
+        received = receive();
     }
-    else if( result == 0 && m_pSession ) // Timeout
-    {
-      m_pSession->next();
-    }
-    else if( result < 0 ) // Error
+
+    if( !received )
     {
-      throw SocketRecvFailed( result );
+      struct timeval timeout = { 1, 0 };
+      fd_set readset = m_fds;
+
+      // Wait for input (1 second timeout)
+      int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
+
+      if( result > 0 ) // Something to read
+      {
+        receive();
+      }
+      else if( result == 0 && m_pSession ) // Timeout
+      {
+        // the session is only run once it has something to do
+        long now = process_milliseconds();
+        long wakeups = m_wakeups;
+        if( wakeups != m_handledWakeups || now - m_nextTimeout >= 0 )
+        {
+          m_handledWakeups = wakeups;
+          UtcTimeStamp timeStamp;
+          m_pSession->next( timeStamp );
+          m_nextTimeout = now + 1000L * m_pSession->getNextTimeout( timeStamp );
+        }
+      }
+      else if( result < 0 ) // Error
+      {
+        throw SocketRecvFailed( result );
+      }
     }
 
     processStream();
@@ -136,30 +223,70 @@ bool ThreadedSocketConnection::read()
   }
 }
 
-bool ThreadedSocketConnection::readMessage( std::string& msg )
+bool ThreadedSocketConnection::receive()
+throw( SocketRecvFailed )
+{
+  // drain what has arrived, a read that fills the buffer probably left
+  // more behind so the buffer grows to take it in fewer calls next time,
+  // and it is given back a half at a time once reads are small again
+  bool received = false;
+  for( ;; )
+  {
+    ssize_t size = socket_recv_nowait( m_socket, &m_buffer[0], m_buffer.size() );
+    if( size <= 0 )
+    {
+      if( size < 0 && socket_interrupted() ) continue;
+      if( size < 0 && socket_wouldblock() ) return received;
+      throw SocketRecvFailed( size );
+    }
+
+    m_parser.addToStream( &m_buffer[0], size );
+    received = true;
+    if( (size_t)size < m_buffer.size() )
+    {
+      if( m_buffer.size() > BUFSIZ && (size_t)size < m_buffer.size() / 4 )
+        std::vector<char>( m_buffer.size() / 2 ).swap( m_buffer );
+      return true;
+    }
+    if( m_buffer.size() >= MAX_BUFFER )
+      return true;
+    m_buffer.resize( m_buffer.size() * 2 );
+  }
+}
+
+bool ThreadedSocketConnection::readMessage( const char*& data,
+                                            std::string::size_type& length )
 throw( SocketRecvFailed )
 {
   try
   {
-    return m_parser.readFixMessage( msg );
+    return m_parser.readFixMessage( data, length );
   }
   catch ( MessageParseError& ) {}
+  length = 0;
   return true;
 }
 
 void ThreadedSocketConnection::processStream()
 {
-  std::string msg;
-  while( readMessage(msg) )
+  // messages framed from the same read are dispatched as one batch
+  // sharing a receive time, each is read in place from the parser
+  const char* data = 0;
+  std::string::size_type length = 0;
+  UtcTimeStamp now;
+  bool received = false;
+  while( readMessage( data, length ) )
   {
+    if ( !length ) continue;
     if ( !m_pSession )
     {
-      if ( !setSession( msg ) )
+      if ( !setSession( std::string( data, length ) ) )
       { disconnect(); continue; }
     }
     try
     {
-      m_pSession->next( msg, UtcTimeStamp() );
+      received = true;
+      m_pSession->next( data, length, now );
     }
     catch( InvalidMessage& )
     {
@@ -170,6 +297,12 @@ void ThreadedSocketConnection::processStream()
       }
     }
   }
+
+  if( received )
+  {
+    m_nextTimeout =
+      process_milliseconds() + 1000L * m_pSession->getNextTimeout( now );
+  }
 }
 
 bool ThreadedSocketConnection::setSession( const std::string& msg )
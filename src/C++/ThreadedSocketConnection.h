@@ -28,9 +28,11 @@
 
 #include "Parser.h"
 #include "Responder.h"
+#include "AtomicCount.h"
 #include "SessionID.h"
 #include <set>
 #include <map>
+#include <vector>
 
 namespace FIX
 {
@@ -46,10 +48,11 @@ class ThreadedSocketConnection : Responder
 public:
   typedef std::set<SessionID> Sessions;
 
-  ThreadedSocketConnection( int s, Sessions sessions, Log* pLog );
+  ThreadedSocketConnection( int s, Sessions sessions, Log* pLog,
+                            const SendBatch& batch = SendBatch() );
   ThreadedSocketConnection( const SessionID&, int s, 
                             const std::string& address, short port, 
-                            Log* pLog );
+                            Log* pLog, const SendBatch& batch = SendBatch() );
   virtual ~ThreadedSocketConnection() ;
 
   Session* getSession() const { return m_pSession; }
@@ -57,25 +60,44 @@ public:
   bool connect();
   void disconnect();
   bool read();
+  /// Spin on the socket for up to this many microseconds before blocking
+  void setBusyPoll( int microseconds );
 
 private:
-  bool readMessage( std::string& msg ) throw( SocketRecvFailed );
+  bool receive() throw( SocketRecvFailed );
+  bool readMessage( const char*& data, std::string::size_type& length )
+  throw( SocketRecvFailed );
   void processStream();
   bool send( const std::string& );
+  bool send( const std::string* messages,
+             const size_t* offsets, size_t count );
   bool setSession( const std::string& msg );
+  void wakeup();
 
   int m_socket;
-  char m_buffer[BUFSIZ];
+  /// Grows while reads fill it, up to MAX_BUFFER, and shrinks back to
+  /// BUFSIZ while they use less than a quarter of it
+  std::vector<char> m_buffer;
+  enum { MAX_BUFFER = 65536 };
+  int m_busyPoll;
 
   std::string m_address;
   int m_port;
 
   Log* m_pLog;
   Parser m_parser;
+  SendBatch m_sendBatch;
+  /// Messages gathered for one socket_sendv
+  const char* m_sendBuffers[ SOCKET_SENDV_MAX ];
+  size_t m_sendLengths[ SOCKET_SENDV_MAX ];
   Sessions m_sessions;
   Session* m_pSession;
   bool m_disconnect;
   fd_set m_fds;
+  /// Time from process_milliseconds when the session is next due
+  long m_nextTimeout;
+  atomic_count m_wakeups;
+  long m_handledWakeups;
 };
 }
 
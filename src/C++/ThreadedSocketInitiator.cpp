@@ -35,7 +35,7 @@ ThreadedSocketInitiator::ThreadedSocketInitiator(
   const SessionSettings& settings ) throw( ConfigError )
 : Initiator( application, factory, settings ),
   m_lastConnect( 0 ), m_reconnectInterval( 30 ), m_noDelay( false ), 
-  m_sendBufSize( 0 ), m_rcvBufSize( 0 ) 
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_busyPoll( 0 )
 { 
   socket_init(); 
 }
@@ -47,7 +47,7 @@ ThreadedSocketInitiator::ThreadedSocketInitiator(
   LogFactory& logFactory ) throw( ConfigError )
 : Initiator( application, factory, settings, logFactory ),
   m_lastConnect( 0 ), m_reconnectInterval( 30 ), m_noDelay( false ), 
-  m_sendBufSize( 0 ), m_rcvBufSize( 0 ) 
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_busyPoll( 0 )
 { 
   socket_init(); 
 }
@@ -70,6 +70,12 @@ throw ( ConfigError )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SOCKET_BUSY_POLL ) )
+  {
+    m_busyPoll = dict.getInt( SOCKET_BUSY_POLL );
+    if( m_busyPoll < 0 )
+      throw ConfigError( std::string(SOCKET_BUSY_POLL) + " must not be negative" );
+  }
 }
 
 void ThreadedSocketInitiator::onInitialize( const SessionSettings& s )
@@ -155,7 +161,9 @@ void ThreadedSocketInitiator::doConnect( const SessionID& s, const Dictionary& d
     log->onEvent( "Connecting to " + address + " on port " + IntConvertor::convert((unsigned short)port) );
 
     ThreadedSocketConnection* pConnection =
-      new ThreadedSocketConnection( s, socket, address, port, getLog() );
+      new ThreadedSocketConnection
+        ( s, socket, address, port, getLog(), getSendBatch() );
+    pConnection->setBusyPoll( m_busyPoll );
 
     ThreadPair* pair = new ThreadPair( this, pConnection );
 
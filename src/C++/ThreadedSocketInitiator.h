@@ -75,6 +75,7 @@ private:
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  int m_busyPoll;
   SocketToThread m_threads;
   Mutex m_mutex;
 };
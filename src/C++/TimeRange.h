@@ -237,7 +237,41 @@ public:
     return isInSameRange( (DateTime)time1, (DateTime)time2 );
   }
 
+  /// Seconds until the time of day of the start or the end comes round,
+  /// the range can not change before that
+  int getTimeToChange( const UtcTimeStamp& now )
+  {
+    if( m_useLocalTime )
+    {
+      // a daylight saving change moves local times by up to an hour
+      int result = getTimeToChange( LocalTimeStamp( now.getTimeT() ) );
+      return result < 3600 ? result : 3600;
+    }
+
+    return getTimeToChange( (const DateTime&)now );
+  }
+
 private:
+  int getTimeToChange( const DateTime& now )
+  {
+    int start = secondsBetween( now, m_startTime );
+    int end = secondsBetween( now, m_endTime );
+    return start < end ? start : end;
+  }
+
+  static int secondsOfDay( const DateTime& time )
+  {
+    return time.getHour() * 3600 + time.getMinute() * 60 + time.getSecond();
+  }
+
+  static int secondsBetween( const DateTime& now, const DateTime& time )
+  {
+    int result = ( secondsOfDay( time ) - secondsOfDay( now )
+                   + DateTime::SECONDS_PER_DAY ) % DateTime::SECONDS_PER_DAY;
+    // the end second itself is still in range
+    return result ? result : 1;
+  }
+
   bool isInSameRange( const DateTime& time1, const DateTime& time2 )
   {
     if( m_startDay < 0 && m_endDay < 0 )
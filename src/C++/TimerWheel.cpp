@@ -0,0 +1,231 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "TimerWheel.h"
+#include "Utility.h"
+
+namespace FIX
+{
+TimerWheel::TimerWheel()
+: m_now( process_milliseconds() ), m_size( 0 )
+{
+  for( int slot = 0; slot <= EXPIRED; ++slot )
+    m_slots[ slot ] = 0;
+  for( int level = 0; level < LEVELS; ++level )
+    m_occupied[ level ] = 0;
+}
+
+TimerWheel::~TimerWheel()
+{
+  for( int slot = 0; slot <= EXPIRED; ++slot )
+  {
+    for( Timer* pTimer = m_slots[ slot ]; pTimer; pTimer = pTimer->m_pNext )
+      pTimer->m_pWheel = 0;
+  }
+}
+
+void TimerWheel::schedule( Timer& timer, long milliseconds )
+{
+  if( timer.m_pWheel )
+    timer.m_pWheel->cancel( timer );
+
+  timer.m_deadline = m_now + ( milliseconds > 0 ? milliseconds : 0 );
+  timer.m_pWheel = this;
+  ++m_size;
+  place( timer );
+}
+
+void TimerWheel::cancel( Timer& timer )
+{
+  if( timer.m_pWheel != this )
+    return;
+
+  unlink( timer );
+  timer.m_pWheel = 0;
+  --m_size;
+}
+
+int TimerWheel::expire( long now )
+{
+  int fired = 0;
+
+  while( now - m_now > 0 )
+  {
+    long tick = m_now + 1;
+    if( !m_size )
+    {
+      m_now = now;
+      break;
+    }
+
+    // below the lowest level that holds timers nothing can happen
+    // until that level moves on to its next slot
+    int lowest = 0;
+    while( lowest < LEVELS - 1 && !m_occupied[ lowest ] )
+      ++lowest;
+    if( lowest > 0 || !m_occupied[0] )
+    {
+      int shift = SLOT_BITS * ( lowest ? lowest : 1 );
+      tick = ( (m_now >> shift) + 1 ) << shift;
+      if( tick - now > 0 )
+      {
+        m_now = now;
+        break;
+      }
+    }
+
+    // timers are placed relative to the tick being processed
+    m_now = tick - 1;
+    for( int level = LEVELS - 1; level > 0; --level )
+    {
+      long mask = ( 1L << (SLOT_BITS * level) ) - 1;
+      if( (tick & mask) == 0 )
+        cascade( level, (int)( (tick >> (SLOT_BITS * level)) & MASK ) );
+    }
+    m_now = tick;
+
+    int slot = (int)( tick & MASK );
+    Timer* pTimer = m_slots[ slot ];
+    if( !pTimer )
+      continue;
+
+    // timers rescheduled while firing go to a later tick
+    m_slots[ slot ] = 0;
+    m_occupied[0] &= ~( 1u << slot );
+    m_slots[ EXPIRED ] = pTimer;
+    for( ; pTimer; pTimer = pTimer->m_pNext )
+      pTimer->m_slot = EXPIRED;
+
+    while( (pTimer = m_slots[ EXPIRED ]) )
+    {
+      if( !fired++ )
+        m_time.setCurrent();
+      cancel( *pTimer );
+      pTimer->onTimer( *this );
+    }
+  }
+
+  return fired;
+}
+
+long TimerWheel::getTimeout( long now ) const
+{
+  if( !m_size )
+    return -1;
+
+  // the start of the first block holding a timer is as early as it can
+  // be due, waking up then at worst moves it down a level
+  long base = m_now + 1;
+  long earliest = 0;
+  bool found = false;
+  for( int level = 0; level < LEVELS; ++level )
+  {
+    if( !m_occupied[ level ] )
+      continue;
+
+    int shift = SLOT_BITS * level;
+    long first = ( base + (1L << shift) - 1 ) >> shift;
+    for( long block = first; block < first + SLOTS; ++block )
+    {
+      if( m_occupied[ level ] & ( 1u << (block & MASK) ) )
+      {
+        long start = block << shift;
+        if( !found || start - earliest < 0 )
+          earliest = start;
+        found = true;
+        break;
+      }
+    }
+  }
+
+  if( !found )
+    return 0;
+  long timeout = earliest - now;
+  return timeout > 0 ? timeout : 0;
+}
+
+void TimerWheel::place( Timer& timer )
+{
+  long base = m_now + 1;
+  long deadline = timer.m_deadline;
+  if( deadline - base < 0 )
+    deadline = base;
+
+  // timers beyond the last level wait in it and are placed again
+  long range = 1L << ( SLOT_BITS * LEVELS );
+  if( deadline - base >= range )
+    deadline = base + range - 1;
+
+  long delta = deadline - base;
+  int level = 0;
+  while( level < LEVELS - 1 && delta >= (1L << (SLOT_BITS * (level + 1))) )
+    ++level;
+
+  int index = (int)( (deadline >> (SLOT_BITS * level)) & MASK );
+  link( timer, level * SLOTS + index );
+}
+
+void TimerWheel::cascade( int level, int index )
+{
+  int slot = level * SLOTS + index;
+  Timer* pTimer = m_slots[ slot ];
+  m_slots[ slot ] = 0;
+  m_occupied[ level ] &= ~( 1u << index );
+
+  while( pTimer )
+  {
+    Timer* pNext = pTimer->m_pNext;
+    place( *pTimer );
+    pTimer = pNext;
+  }
+}
+
+void TimerWheel::link( Timer& timer, int slot )
+{
+  timer.m_slot = slot;
+  timer.m_pPrev = 0;
+  timer.m_pNext = m_slots[ slot ];
+  if( timer.m_pNext )
+    timer.m_pNext->m_pPrev = &timer;
+  m_slots[ slot ] = &timer;
+  if( slot < EXPIRED )
+    m_occupied[ slot / SLOTS ] |= 1u << ( slot & MASK );
+}
+
+void TimerWheel::unlink( Timer& timer )
+{
+  int slot = timer.m_slot;
+  if( timer.m_pPrev )
+    timer.m_pPrev->m_pNext = timer.m_pNext;
+  else
+    m_slots[ slot ] = timer.m_pNext;
+  if( timer.m_pNext )
+    timer.m_pNext->m_pPrev = timer.m_pPrev;
+  timer.m_pNext = timer.m_pPrev = 0;
+
+  if( slot < EXPIRED && !m_slots[ slot ] )
+    m_occupied[ slot / SLOTS ] &= ~( 1u << ( slot & MASK ) );
+}
+}
@@ -0,0 +1,115 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_TIMERWHEEL_H
+#define FIX_TIMERWHEEL_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "FieldTypes.h"
+#include <stddef.h>
+
+namespace FIX
+{
+/**
+ * Hierarchical timing wheel with millisecond ticks.
+ *
+ * Scheduling and cancelling a timer take constant time no matter how
+ * many timers there are. Timers due within the next few milliseconds
+ * sit in the slots of the first level, later ones in coarser levels
+ * that are moved down a level as their time comes closer. Timers are
+ * intrusive, a Timer is its own list node and is taken out of its wheel
+ * when it is destroyed.
+ *
+ * A wheel is not thread safe, it belongs to the thread that expires it.
+ */
+class TimerWheel
+{
+public:
+  class Timer
+  {
+  public:
+    Timer()
+    : m_pWheel( 0 ), m_pNext( 0 ), m_pPrev( 0 ), m_deadline( 0 ), m_slot( 0 ) {}
+    virtual ~Timer()
+    { if( m_pWheel ) m_pWheel->cancel( *this ); }
+
+    bool isScheduled() const { return m_pWheel != 0; }
+
+    /// Called by TimerWheel::expire once the timer is due
+    virtual void onTimer( TimerWheel& ) = 0;
+
+  private:
+    Timer( const Timer& );
+    Timer& operator=( const Timer& );
+
+    friend class TimerWheel;
+    TimerWheel* m_pWheel;
+    Timer* m_pNext;
+    Timer* m_pPrev;
+    long m_deadline;
+    int m_slot;
+  };
+
+  TimerWheel();
+  ~TimerWheel();
+
+  /// Fire the timer in milliseconds, replacing a previous schedule
+  void schedule( Timer&, long milliseconds );
+  void cancel( Timer& );
+
+  /// Fire all timers that are due by now, returns how many fired
+  int expire( long now );
+  /// Milliseconds from now until a timer may be due, -1 if there are none
+  long getTimeout( long now ) const;
+
+  /// Time the wheel has been expired up to
+  long getNow() const { return m_now; }
+  /// Clock read once for all the timers fired by the same expire
+  const UtcTimeStamp& getTime() const { return m_time; }
+  size_t size() const { return m_size; }
+
+private:
+  enum
+  {
+    LEVELS = 5,
+    SLOT_BITS = 5,
+    SLOTS = 1 << SLOT_BITS,
+    MASK = SLOTS - 1,
+    EXPIRED = LEVELS * SLOTS
+  };
+
+  void place( Timer& );
+  void cascade( int level, int index );
+  void link( Timer&, int slot );
+  void unlink( Timer& );
+
+  Timer* m_slots[ EXPIRED + 1 ];
+  unsigned m_occupied[ LEVELS ];
+  long m_now;
+  size_t m_size;
+  UtcTimeStamp m_time;
+};
+}
+
+#endif //FIX_TIMERWHEEL_H
@@ -29,6 +29,9 @@
 #include <stropts.h>
 #include <sys/conf.h>
 #endif
+#ifdef HAVE_PTHREAD_SETAFFINITY_NP
+#include <sched.h>
+#endif
 #include <string.h>
 #include <math.h>
 #include <stdio.h>
@@ -155,6 +158,46 @@ ssize_t socket_send( int s, const char* msg, size_t length )
   return send( s, msg, length, 0 );
 }
 
+ssize_t socket_sendv( int s, const char* const* buffers,
+                      const size_t* lengths, size_t count, bool more )
+{
+  if( count > SOCKET_SENDV_MAX )
+    count = SOCKET_SENDV_MAX;
+
+#ifdef _MSC_VER
+  WSABUF vectors[ SOCKET_SENDV_MAX ];
+  for( size_t i = 0; i < count; ++i )
+  {
+    vectors[i].buf = const_cast<char*>( buffers[i] );
+    vectors[i].len = (ULONG)lengths[i];
+  }
+
+  DWORD sent = 0;
+  if( WSASend( s, vectors, (DWORD)count, &sent, 0, 0, 0 ) != 0 )
+    return -1;
+  return (ssize_t)sent;
+#else
+  struct iovec vectors[ SOCKET_SENDV_MAX ];
+  for( size_t i = 0; i < count; ++i )
+  {
+    vectors[i].iov_base = const_cast<char*>( buffers[i] );
+    vectors[i].iov_len = lengths[i];
+  }
+
+  struct msghdr header;
+  memset( &header, 0, sizeof(header) );
+  header.msg_iov = vectors;
+  header.msg_iovlen = count;
+
+  int flags = 0;
+#ifdef MSG_MORE
+  if( more )
+    flags |= MSG_MORE;
+#endif
+  return sendmsg( s, &header, flags );
+#endif
+}
+
 void socket_close( int s )
 {
   shutdown( s, 2 );
@@ -177,12 +220,56 @@ bool socket_fionread( int s, int& bytes )
 #endif
 }
 
+ssize_t socket_recv_nowait( int s, char* buffer, size_t length )
+{
+#ifdef _MSC_VER
+  int bytes = 0;
+  if( !socket_fionread( s, bytes ) )
+    return -1;
+  if( !bytes )
+  {
+    WSASetLastError( WSAEWOULDBLOCK );
+    return -1;
+  }
+  return recv( s, buffer, (int)length, 0 );
+#else
+  return recv( s, buffer, length, MSG_DONTWAIT );
+#endif
+}
+
+int socket_setbusypoll( int s, int microseconds )
+{
+#ifdef SO_BUSY_POLL
+  return socket_setsockopt( s, SO_BUSY_POLL, microseconds );
+#else
+  return -1;
+#endif
+}
+
 bool socket_disconnected( int s )
 {
   char byte;
   return ::recv (s, &byte, sizeof (byte), MSG_PEEK) <= 0;
 }
 
+bool socket_wouldblock()
+{
+#ifdef _MSC_VER
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+bool socket_interrupted()
+{
+#ifdef _MSC_VER
+  return WSAGetLastError() == WSAEINTR;
+#else
+  return errno == EINTR;
+#endif
+}
+
 int socket_setsockopt( int s, int opt )
 {
 #ifdef _MSC_VER
@@ -391,6 +478,25 @@ tm time_localtime( const time_t* t)
 #endif
 }
 
+long long time_nanoseconds()
+{
+#ifdef _MSC_VER
+  // file times count 100 nanoseconds since 1601
+  FILETIME now;
+  GetSystemTimeAsFileTime( &now );
+  long long ticks = ( (long long)now.dwHighDateTime << 32 ) | now.dwLowDateTime;
+  return ( ticks - 116444736000000000LL ) * 100;
+#elif defined(CLOCK_REALTIME)
+  timespec now;
+  clock_gettime( CLOCK_REALTIME, &now );
+  return (long long)now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+  timeval now;
+  gettimeofday( &now, 0 );
+  return (long long)now.tv_sec * 1000000000 + now.tv_usec * 1000LL;
+#endif
+}
+
 bool thread_spawn( THREAD_START_ROUTINE func, void* var, thread_id& thread )
 {
 #ifdef _MSC_VER
@@ -441,6 +547,50 @@ thread_id thread_self()
 #endif
 }
 
+bool thread_setaffinity( int cpu )
+{
+#ifdef _MSC_VER
+  return SetThreadAffinityMask( GetCurrentThread(), (DWORD_PTR)1 << cpu ) != 0;
+#elif defined(HAVE_PTHREAD_SETAFFINITY_NP)
+  cpu_set_t cpus;
+  CPU_ZERO( &cpus );
+  CPU_SET( cpu, &cpus );
+  return pthread_setaffinity_np( pthread_self(), sizeof(cpus), &cpus ) == 0;
+#else
+  return false;
+#endif
+}
+
+bool thread_key_create( thread_key& key, THREAD_KEY_DESTRUCTOR destructor )
+{
+#ifdef _MSC_VER
+  // fiber local storage calls the destructor when a thread exits,
+  // thread local storage does not
+  key = FlsAlloc( destructor );
+  return key != FLS_OUT_OF_INDEXES;
+#else
+  return pthread_key_create( &key, destructor ) == 0;
+#endif
+}
+
+void* thread_key_get( thread_key key )
+{
+#ifdef _MSC_VER
+  return FlsGetValue( key );
+#else
+  return pthread_getspecific( key );
+#endif
+}
+
+void thread_key_set( thread_key key, void* value )
+{
+#ifdef _MSC_VER
+  FlsSetValue( key, value );
+#else
+  pthread_setspecific( key, value );
+#endif
+}
+
 void process_sleep( double s )
 {
 #ifdef _MSC_VER
@@ -455,6 +605,52 @@ void process_sleep( double s )
 #endif
 }
 
+int process_cpus()
+{
+#ifdef _MSC_VER
+  SYSTEM_INFO info;
+  GetSystemInfo( &info );
+  return info.dwNumberOfProcessors;
+#else
+  long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+  return cpus > 0 ? (int)cpus : 1;
+#endif
+}
+
+long process_milliseconds()
+{
+#ifdef _MSC_VER
+  return (long)GetTickCount();
+#elif defined(CLOCK_MONOTONIC)
+  timespec now;
+  clock_gettime( CLOCK_MONOTONIC, &now );
+  return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#else
+  timeval now;
+  gettimeofday( &now, 0 );
+  return now.tv_sec * 1000 + now.tv_usec / 1000;
+#endif
+}
+
+long long process_nanoseconds()
+{
+#ifdef _MSC_VER
+  LARGE_INTEGER now, frequency;
+  QueryPerformanceCounter( &now );
+  QueryPerformanceFrequency( &frequency );
+  return now.QuadPart / frequency.QuadPart * 1000000000
+    + now.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+  timespec now;
+  clock_gettime( CLOCK_MONOTONIC, &now );
+  return (long long)now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+  timeval now;
+  gettimeofday( &now, 0 );
+  return (long long)now.tv_sec * 1000000000 + now.tv_usec * 1000LL;
+#endif
+}
+
 std::string file_separator()
 {
 #ifdef _MSC_VER
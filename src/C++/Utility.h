@@ -73,6 +73,7 @@ typedef int ssize_t;
 /////////////////////////////////////////////
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/ioctl.h>
 #include <sys/time.h>
 #include <sys/stat.h>
@@ -124,9 +125,24 @@ int socket_createConnector();
 int socket_connect( int s, const char* address, int port );
 int socket_accept( int s );
 ssize_t socket_send( int s, const char* msg, size_t length );
+/// Most buffers socket_sendv writes in one call
+const size_t SOCKET_SENDV_MAX = 256;
+/// Write up to SOCKET_SENDV_MAX buffers with one call, more tells the
+/// stack that further data follows so it can hold back a partial segment
+ssize_t socket_sendv( int s, const char* const* buffers,
+                      const size_t* lengths, size_t count, bool more = false );
 void socket_close( int s );
 bool socket_fionread( int s, int& bytes );
+/// Receive without blocking even on a blocking socket, fails with
+/// socket_wouldblock() when nothing has arrived
+ssize_t socket_recv_nowait( int s, char* buffer, size_t length );
+/// Have the kernel poll the device queue for up to the given number of
+/// microseconds on a blocking read, where SO_BUSY_POLL is supported
+int socket_setbusypoll( int s, int microseconds );
 bool socket_disconnected( int s );
+bool socket_wouldblock();
+/// The last socket call was interrupted by a signal and can be repeated
+bool socket_interrupted();
 int socket_setsockopt( int s, int opt );
 int socket_setsockopt( int s, int opt, int optval );
 int socket_getsockopt( int s, int opt, int& optval );
@@ -149,6 +165,8 @@ std::pair<int, int> socket_createpair();
 
 tm time_gmtime( const time_t* t );
 tm time_localtime( const time_t* t );
+/// Nanoseconds since the epoch from the wall clock
+long long time_nanoseconds();
 
 #ifdef _MSC_VER
 typedef unsigned int (_stdcall THREAD_START_ROUTINE)(void *);
@@ -164,13 +182,64 @@ typedef unsigned thread_id;
 typedef pthread_t thread_id;
 #endif
 
+#ifdef _MSC_VER
+typedef DWORD thread_key;
+typedef void (_stdcall THREAD_KEY_DESTRUCTOR)(void *);
+#define THREAD_KEY_PROC void _stdcall
+#else
+typedef pthread_key_t thread_key;
+typedef void (THREAD_KEY_DESTRUCTOR)(void *);
+#define THREAD_KEY_PROC void
+#endif
+
 bool thread_spawn( THREAD_START_ROUTINE func, void* var, thread_id& thread );
 bool thread_spawn( THREAD_START_ROUTINE func, void* var );
 void thread_join( thread_id thread );
 void thread_detach( thread_id thread );
 thread_id thread_self();
+bool thread_setaffinity( int cpu );
+/// Create a slot with a value per thread, destroyed when a thread exits
+bool thread_key_create( thread_key& key, THREAD_KEY_DESTRUCTOR destructor );
+void* thread_key_get( thread_key key );
+void thread_key_set( thread_key key, void* value );
+
+/// An object per thread, created on first use and deleted when the
+/// thread exits
+template < typename T > class ThreadLocal
+{
+public:
+  ThreadLocal()
+  : m_valid( thread_key_create( m_key, &destroy ) ) {}
+
+  /// Object of the calling thread, 0 if there is none
+  T* get()
+  {
+    // used before static initialization has created the key
+    if( !m_valid ) return 0;
+
+    T* pObject = static_cast < T* > ( thread_key_get( m_key ) );
+    if( !pObject )
+    {
+      pObject = new T;
+      thread_key_set( m_key, pObject );
+    }
+    return pObject;
+  }
+
+private:
+  static THREAD_KEY_PROC destroy( void* p )
+  { delete static_cast < T* > ( p ); }
+
+  thread_key m_key;
+  bool m_valid;
+};
 
 void process_sleep( double s );
+int process_cpus();
+/// Milliseconds from a clock that is never set back
+long process_milliseconds();
+/// Nanoseconds from a clock that is never set back, for short intervals
+long long process_nanoseconds();
 
 std::string file_separator();
 void file_mkdir( const char* path );
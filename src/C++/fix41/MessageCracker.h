@@ -158,184 +158,137 @@ public:
   {
     const std::string& msgTypeValue 
       = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    if( msgTypeValue == "0" )
-      onMessage( (const Heartbeat&)message, sessionID );
-    else
-    if( msgTypeValue == "1" )
-      onMessage( (const TestRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "2" )
-      onMessage( (const ResendRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "3" )
-      onMessage( (const Reject&)message, sessionID );
-    else
-    if( msgTypeValue == "4" )
-      onMessage( (const SequenceReset&)message, sessionID );
-    else
-    if( msgTypeValue == "5" )
-      onMessage( (const Logout&)message, sessionID );
-    else
-    if( msgTypeValue == "6" )
-      onMessage( (const IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (const Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (const ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (const OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "A" )
-      onMessage( (const Logon&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (const News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (const Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (const NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (const NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (const OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (const OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (const OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (const Allocation&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (const ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (const ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (const ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (const ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (const AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (const DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (const QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (const Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (const SettlementInstructions&)message, sessionID );
-    else onMessage( message, sessionID );
+
+    switch( FIX::Message::msgTypeKey( msgTypeValue ) )
+    {
+    case '0':
+      onMessage( (const Heartbeat&)message, sessionID ); break;
+    case '1':
+      onMessage( (const TestRequest&)message, sessionID ); break;
+    case '2':
+      onMessage( (const ResendRequest&)message, sessionID ); break;
+    case '3':
+      onMessage( (const Reject&)message, sessionID ); break;
+    case '4':
+      onMessage( (const SequenceReset&)message, sessionID ); break;
+    case '5':
+      onMessage( (const Logout&)message, sessionID ); break;
+    case '6':
+      onMessage( (const IOI&)message, sessionID ); break;
+    case '7':
+      onMessage( (const Advertisement&)message, sessionID ); break;
+    case '8':
+      onMessage( (const ExecutionReport&)message, sessionID ); break;
+    case '9':
+      onMessage( (const OrderCancelReject&)message, sessionID ); break;
+    case 'A':
+      onMessage( (const Logon&)message, sessionID ); break;
+    case 'B':
+      onMessage( (const News&)message, sessionID ); break;
+    case 'C':
+      onMessage( (const Email&)message, sessionID ); break;
+    case 'D':
+      onMessage( (const NewOrderSingle&)message, sessionID ); break;
+    case 'E':
+      onMessage( (const NewOrderList&)message, sessionID ); break;
+    case 'F':
+      onMessage( (const OrderCancelRequest&)message, sessionID ); break;
+    case 'G':
+      onMessage( (const OrderCancelReplaceRequest&)message, sessionID ); break;
+    case 'H':
+      onMessage( (const OrderStatusRequest&)message, sessionID ); break;
+    case 'J':
+      onMessage( (const Allocation&)message, sessionID ); break;
+    case 'K':
+      onMessage( (const ListCancelRequest&)message, sessionID ); break;
+    case 'L':
+      onMessage( (const ListExecute&)message, sessionID ); break;
+    case 'M':
+      onMessage( (const ListStatusRequest&)message, sessionID ); break;
+    case 'N':
+      onMessage( (const ListStatus&)message, sessionID ); break;
+    case 'P':
+      onMessage( (const AllocationInstructionAck&)message, sessionID ); break;
+    case 'Q':
+      onMessage( (const DontKnowTrade&)message, sessionID ); break;
+    case 'R':
+      onMessage( (const QuoteRequest&)message, sessionID ); break;
+    case 'S':
+      onMessage( (const Quote&)message, sessionID ); break;
+    case 'T':
+      onMessage( (const SettlementInstructions&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
-void crack( Message& message, 
-            const FIX::SessionID& sessionID )
+  void crack( Message& message, 
+              const FIX::SessionID& sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    if( msgTypeValue == "0" )
-      onMessage( (Heartbeat&)message, sessionID );
-    else
-    if( msgTypeValue == "1" )
-      onMessage( (TestRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "2" )
-      onMessage( (ResendRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "3" )
-      onMessage( (Reject&)message, sessionID );
-    else
-    if( msgTypeValue == "4" )
-      onMessage( (SequenceReset&)message, sessionID );
-    else
-    if( msgTypeValue == "5" )
-      onMessage( (Logout&)message, sessionID );
-    else
-    if( msgTypeValue == "6" )
-      onMessage( (IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "A" )
-      onMessage( (Logon&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (Allocation&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (SettlementInstructions&)message, sessionID );
-    else onMessage( message, sessionID );
+    const std::string& msgTypeValue 
+      = message.getHeader().getField( FIX::FIELD::MsgType );
+
+    switch( FIX::Message::msgTypeKey( msgTypeValue ) )
+    {
+    case '0':
+      onMessage( (Heartbeat&)message, sessionID ); break;
+    case '1':
+      onMessage( (TestRequest&)message, sessionID ); break;
+    case '2':
+      onMessage( (ResendRequest&)message, sessionID ); break;
+    case '3':
+      onMessage( (Reject&)message, sessionID ); break;
+    case '4':
+      onMessage( (SequenceReset&)message, sessionID ); break;
+    case '5':
+      onMessage( (Logout&)message, sessionID ); break;
+    case '6':
+      onMessage( (IOI&)message, sessionID ); break;
+    case '7':
+      onMessage( (Advertisement&)message, sessionID ); break;
+    case '8':
+      onMessage( (ExecutionReport&)message, sessionID ); break;
+    case '9':
+      onMessage( (OrderCancelReject&)message, sessionID ); break;
+    case 'A':
+      onMessage( (Logon&)message, sessionID ); break;
+    case 'B':
+      onMessage( (News&)message, sessionID ); break;
+    case 'C':
+      onMessage( (Email&)message, sessionID ); break;
+    case 'D':
+      onMessage( (NewOrderSingle&)message, sessionID ); break;
+    case 'E':
+      onMessage( (NewOrderList&)message, sessionID ); break;
+    case 'F':
+      onMessage( (OrderCancelRequest&)message, sessionID ); break;
+    case 'G':
+      onMessage( (OrderCancelReplaceRequest&)message, sessionID ); break;
+    case 'H':
+      onMessage( (OrderStatusRequest&)message, sessionID ); break;
+    case 'J':
+      onMessage( (Allocation&)message, sessionID ); break;
+    case 'K':
+      onMessage( (ListCancelRequest&)message, sessionID ); break;
+    case 'L':
+      onMessage( (ListExecute&)message, sessionID ); break;
+    case 'M':
+      onMessage( (ListStatusRequest&)message, sessionID ); break;
+    case 'N':
+      onMessage( (ListStatus&)message, sessionID ); break;
+    case 'P':
+      onMessage( (AllocationInstructionAck&)message, sessionID ); break;
+    case 'Q':
+      onMessage( (DontKnowTrade&)message, sessionID ); break;
+    case 'R':
+      onMessage( (QuoteRequest&)message, sessionID ); break;
+    case 'S':
+      onMessage( (Quote&)message, sessionID ); break;
+    case 'T':
+      onMessage( (SettlementInstructions&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
 
   };
@@ -0,0 +1,1808 @@
+#ifndef FIX42_FIXEDEXECUTIONREPORT_H
+#define FIX42_FIXEDEXECUTIONREPORT_H
+
+#include "FixedMessage.h"
+
+namespace FIX42
+{
+
+  class FixedExecutionReport
+  {
+  public:
+    class NoContraBrokers
+    {
+    public:
+      NoContraBrokers()
+      : m_ContraTradeQty(),
+        m_ContraTradeTime(),
+        m_ContraTradeTimeMilliseconds() {}
+
+      bool isSetContraBroker() const { return m_present.test( 0 ); }
+      const std::string& getContraBroker() const
+      {
+        if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::ContraBroker );
+        return m_ContraBroker;
+      }
+      void setContraBroker( const std::string& value )
+      { m_ContraBroker = value; m_present.set( 0 ); }
+      void removeContraBroker() { m_present.reset( 0 ); }
+
+      bool isSetContraTrader() const { return m_present.test( 1 ); }
+      const std::string& getContraTrader() const
+      {
+        if( !m_present.test( 1 ) ) throw FIX::FieldNotFound( FIX::FIELD::ContraTrader );
+        return m_ContraTrader;
+      }
+      void setContraTrader( const std::string& value )
+      { m_ContraTrader = value; m_present.set( 1 ); }
+      void removeContraTrader() { m_present.reset( 1 ); }
+
+      bool isSetContraTradeQty() const { return m_present.test( 2 ); }
+      double getContraTradeQty() const
+      {
+        if( !m_present.test( 2 ) ) throw FIX::FieldNotFound( FIX::FIELD::ContraTradeQty );
+        return m_ContraTradeQty;
+      }
+      void setContraTradeQty( double value )
+      { m_ContraTradeQty = value; m_present.set( 2 ); }
+      void removeContraTradeQty() { m_present.reset( 2 ); }
+
+      bool isSetContraTradeTime() const { return m_present.test( 3 ); }
+      FIX::UtcTimeStamp getContraTradeTime() const
+      {
+        if( !m_present.test( 3 ) ) throw FIX::FieldNotFound( FIX::FIELD::ContraTradeTime );
+        return FIX::UtcTimeStamp( m_ContraTradeTime );
+      }
+      void setContraTradeTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+      { m_ContraTradeTime = value; m_ContraTradeTimeMilliseconds = showMilliseconds; m_present.set( 3 ); }
+      void removeContraTradeTime() { m_present.reset( 3 ); }
+
+      void clear()
+      {
+        m_present.clear();
+      }
+
+      bool setField( int tag, FIX::FixedParser& parser )
+      {
+        switch( tag )
+        {
+        case FIX::FIELD::ContraBroker:
+          parser.get( m_ContraBroker );
+          m_present.set( 0 );
+          return true;
+        case FIX::FIELD::ContraTrader:
+          parser.get( m_ContraTrader );
+          m_present.set( 1 );
+          return true;
+        case FIX::FIELD::ContraTradeQty:
+          parser.get( m_ContraTradeQty );
+          m_present.set( 2 );
+          return true;
+        case FIX::FIELD::ContraTradeTime:
+          parser.get( m_ContraTradeTime, m_ContraTradeTimeMilliseconds );
+          m_present.set( 3 );
+          return true;
+        default:
+          return false;
+        }
+      }
+
+      void write( std::string& string ) const
+      {
+        if( m_present.test( 0 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::ContraBroker, m_ContraBroker );
+        if( m_present.test( 1 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::ContraTrader, m_ContraTrader );
+        if( m_present.test( 2 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::ContraTradeQty, m_ContraTradeQty );
+        if( m_present.test( 3 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::ContraTradeTime, m_ContraTradeTime, m_ContraTradeTimeMilliseconds );
+      }
+
+    private:
+      FIX::FixedPresence< 4 > m_present;
+      std::string m_ContraBroker;
+      std::string m_ContraTrader;
+      double m_ContraTradeQty;
+      FIX::DateTime m_ContraTradeTime;
+      bool m_ContraTradeTimeMilliseconds;
+    };
+
+    FixedExecutionReport()
+    : m_ExecTransType(),
+      m_ExecType(),
+      m_OrdStatus(),
+      m_OrdRejReason(),
+      m_ExecRestatementReason(),
+      m_SettlmntTyp(),
+      m_MaturityDay(),
+      m_PutOrCall(),
+      m_StrikePrice(),
+      m_OptAttribute(),
+      m_ContractMultiplier(),
+      m_CouponRate(),
+      m_EncodedIssuerLen(),
+      m_EncodedSecurityDescLen(),
+      m_Side(),
+      m_OrderQty(),
+      m_CashOrderQty(),
+      m_OrdType(),
+      m_Price(),
+      m_StopPx(),
+      m_PegDifference(),
+      m_DiscretionInst(),
+      m_DiscretionOffset(),
+      m_SolicitedFlag(),
+      m_TimeInForce(),
+      m_EffectiveTime(),
+      m_EffectiveTimeMilliseconds(),
+      m_ExpireTime(),
+      m_ExpireTimeMilliseconds(),
+      m_Rule80A(),
+      m_LastShares(),
+      m_LastPx(),
+      m_LastSpotRate(),
+      m_LastForwardPoints(),
+      m_LastCapacity(),
+      m_LeavesQty(),
+      m_CumQty(),
+      m_AvgPx(),
+      m_DayOrderQty(),
+      m_DayCumQty(),
+      m_DayAvgPx(),
+      m_GTBookingInst(),
+      m_TransactTime(),
+      m_TransactTimeMilliseconds(),
+      m_ReportToExch(),
+      m_Commission(),
+      m_CommType(),
+      m_GrossTradeAmt(),
+      m_SettlCurrAmt(),
+      m_SettlCurrFxRate(),
+      m_SettlCurrFxRateCalc(),
+      m_HandlInst(),
+      m_MinQty(),
+      m_MaxFloor(),
+      m_OpenClose(),
+      m_MaxShow(),
+      m_EncodedTextLen(),
+      m_OrderQty2(),
+      m_MultiLegReportingType() {}
+    static FIX::MsgType MsgType() { return FIX::MsgType("8"); }
+
+    FixedHeader& getHeader() { return m_header; }
+    const FixedHeader& getHeader() const { return m_header; }
+    FixedTrailer& getTrailer() { return m_trailer; }
+    const FixedTrailer& getTrailer() const { return m_trailer; }
+
+    bool isSetOrderID() const { return m_present.test( 0 ); }
+    const std::string& getOrderID() const
+    {
+      if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrderID );
+      return m_OrderID;
+    }
+    void setOrderID( const std::string& value )
+    { m_OrderID = value; m_present.set( 0 ); }
+    void removeOrderID() { m_present.reset( 0 ); }
+
+    bool isSetSecondaryOrderID() const { return m_present.test( 1 ); }
+    const std::string& getSecondaryOrderID() const
+    {
+      if( !m_present.test( 1 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecondaryOrderID );
+      return m_SecondaryOrderID;
+    }
+    void setSecondaryOrderID( const std::string& value )
+    { m_SecondaryOrderID = value; m_present.set( 1 ); }
+    void removeSecondaryOrderID() { m_present.reset( 1 ); }
+
+    bool isSetClOrdID() const { return m_present.test( 2 ); }
+    const std::string& getClOrdID() const
+    {
+      if( !m_present.test( 2 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClOrdID );
+      return m_ClOrdID;
+    }
+    void setClOrdID( const std::string& value )
+    { m_ClOrdID = value; m_present.set( 2 ); }
+    void removeClOrdID() { m_present.reset( 2 ); }
+
+    bool isSetOrigClOrdID() const { return m_present.test( 3 ); }
+    const std::string& getOrigClOrdID() const
+    {
+      if( !m_present.test( 3 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrigClOrdID );
+      return m_OrigClOrdID;
+    }
+    void setOrigClOrdID( const std::string& value )
+    { m_OrigClOrdID = value; m_present.set( 3 ); }
+    void removeOrigClOrdID() { m_present.reset( 3 ); }
+
+    bool isSetClientID() const { return m_present.test( 4 ); }
+    const std::string& getClientID() const
+    {
+      if( !m_present.test( 4 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClientID );
+      return m_ClientID;
+    }
+    void setClientID( const std::string& value )
+    { m_ClientID = value; m_present.set( 4 ); }
+    void removeClientID() { m_present.reset( 4 ); }
+
+    bool isSetExecBroker() const { return m_present.test( 5 ); }
+    const std::string& getExecBroker() const
+    {
+      if( !m_present.test( 5 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecBroker );
+      return m_ExecBroker;
+    }
+    void setExecBroker( const std::string& value )
+    { m_ExecBroker = value; m_present.set( 5 ); }
+    void removeExecBroker() { m_present.reset( 5 ); }
+
+    bool isSetListID() const { return m_present.test( 6 ); }
+    const std::string& getListID() const
+    {
+      if( !m_present.test( 6 ) ) throw FIX::FieldNotFound( FIX::FIELD::ListID );
+      return m_ListID;
+    }
+    void setListID( const std::string& value )
+    { m_ListID = value; m_present.set( 6 ); }
+    void removeListID() { m_present.reset( 6 ); }
+
+    bool isSetExecID() const { return m_present.test( 7 ); }
+    const std::string& getExecID() const
+    {
+      if( !m_present.test( 7 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecID );
+      return m_ExecID;
+    }
+    void setExecID( const std::string& value )
+    { m_ExecID = value; m_present.set( 7 ); }
+    void removeExecID() { m_present.reset( 7 ); }
+
+    bool isSetExecTransType() const { return m_present.test( 8 ); }
+    char getExecTransType() const
+    {
+      if( !m_present.test( 8 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecTransType );
+      return m_ExecTransType;
+    }
+    void setExecTransType( char value )
+    { m_ExecTransType = value; m_present.set( 8 ); }
+    void removeExecTransType() { m_present.reset( 8 ); }
+
+    bool isSetExecRefID() const { return m_present.test( 9 ); }
+    const std::string& getExecRefID() const
+    {
+      if( !m_present.test( 9 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecRefID );
+      return m_ExecRefID;
+    }
+    void setExecRefID( const std::string& value )
+    { m_ExecRefID = value; m_present.set( 9 ); }
+    void removeExecRefID() { m_present.reset( 9 ); }
+
+    bool isSetExecType() const { return m_present.test( 10 ); }
+    char getExecType() const
+    {
+      if( !m_present.test( 10 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecType );
+      return m_ExecType;
+    }
+    void setExecType( char value )
+    { m_ExecType = value; m_present.set( 10 ); }
+    void removeExecType() { m_present.reset( 10 ); }
+
+    bool isSetOrdStatus() const { return m_present.test( 11 ); }
+    char getOrdStatus() const
+    {
+      if( !m_present.test( 11 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrdStatus );
+      return m_OrdStatus;
+    }
+    void setOrdStatus( char value )
+    { m_OrdStatus = value; m_present.set( 11 ); }
+    void removeOrdStatus() { m_present.reset( 11 ); }
+
+    bool isSetOrdRejReason() const { return m_present.test( 12 ); }
+    int getOrdRejReason() const
+    {
+      if( !m_present.test( 12 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrdRejReason );
+      return m_OrdRejReason;
+    }
+    void setOrdRejReason( int value )
+    { m_OrdRejReason = value; m_present.set( 12 ); }
+    void removeOrdRejReason() { m_present.reset( 12 ); }
+
+    bool isSetExecRestatementReason() const { return m_present.test( 13 ); }
+    int getExecRestatementReason() const
+    {
+      if( !m_present.test( 13 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecRestatementReason );
+      return m_ExecRestatementReason;
+    }
+    void setExecRestatementReason( int value )
+    { m_ExecRestatementReason = value; m_present.set( 13 ); }
+    void removeExecRestatementReason() { m_present.reset( 13 ); }
+
+    bool isSetAccount() const { return m_present.test( 14 ); }
+    const std::string& getAccount() const
+    {
+      if( !m_present.test( 14 ) ) throw FIX::FieldNotFound( FIX::FIELD::Account );
+      return m_Account;
+    }
+    void setAccount( const std::string& value )
+    { m_Account = value; m_present.set( 14 ); }
+    void removeAccount() { m_present.reset( 14 ); }
+
+    bool isSetSettlmntTyp() const { return m_present.test( 15 ); }
+    char getSettlmntTyp() const
+    {
+      if( !m_present.test( 15 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlmntTyp );
+      return m_SettlmntTyp;
+    }
+    void setSettlmntTyp( char value )
+    { m_SettlmntTyp = value; m_present.set( 15 ); }
+    void removeSettlmntTyp() { m_present.reset( 15 ); }
+
+    bool isSetFutSettDate() const { return m_present.test( 16 ); }
+    const std::string& getFutSettDate() const
+    {
+      if( !m_present.test( 16 ) ) throw FIX::FieldNotFound( FIX::FIELD::FutSettDate );
+      return m_FutSettDate;
+    }
+    void setFutSettDate( const std::string& value )
+    { m_FutSettDate = value; m_present.set( 16 ); }
+    void removeFutSettDate() { m_present.reset( 16 ); }
+
+    bool isSetSymbol() const { return m_present.test( 17 ); }
+    const std::string& getSymbol() const
+    {
+      if( !m_present.test( 17 ) ) throw FIX::FieldNotFound( FIX::FIELD::Symbol );
+      return m_Symbol;
+    }
+    void setSymbol( const std::string& value )
+    { m_Symbol = value; m_present.set( 17 ); }
+    void removeSymbol() { m_present.reset( 17 ); }
+
+    bool isSetSymbolSfx() const { return m_present.test( 18 ); }
+    const std::string& getSymbolSfx() const
+    {
+      if( !m_present.test( 18 ) ) throw FIX::FieldNotFound( FIX::FIELD::SymbolSfx );
+      return m_SymbolSfx;
+    }
+    void setSymbolSfx( const std::string& value )
+    { m_SymbolSfx = value; m_present.set( 18 ); }
+    void removeSymbolSfx() { m_present.reset( 18 ); }
+
+    bool isSetSecurityID() const { return m_present.test( 19 ); }
+    const std::string& getSecurityID() const
+    {
+      if( !m_present.test( 19 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityID );
+      return m_SecurityID;
+    }
+    void setSecurityID( const std::string& value )
+    { m_SecurityID = value; m_present.set( 19 ); }
+    void removeSecurityID() { m_present.reset( 19 ); }
+
+    bool isSetIDSource() const { return m_present.test( 20 ); }
+    const std::string& getIDSource() const
+    {
+      if( !m_present.test( 20 ) ) throw FIX::FieldNotFound( FIX::FIELD::IDSource );
+      return m_IDSource;
+    }
+    void setIDSource( const std::string& value )
+    { m_IDSource = value; m_present.set( 20 ); }
+    void removeIDSource() { m_present.reset( 20 ); }
+
+    bool isSetSecurityType() const { return m_present.test( 21 ); }
+    const std::string& getSecurityType() const
+    {
+      if( !m_present.test( 21 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityType );
+      return m_SecurityType;
+    }
+    void setSecurityType( const std::string& value )
+    { m_SecurityType = value; m_present.set( 21 ); }
+    void removeSecurityType() { m_present.reset( 21 ); }
+
+    bool isSetMaturityMonthYear() const { return m_present.test( 22 ); }
+    const std::string& getMaturityMonthYear() const
+    {
+      if( !m_present.test( 22 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaturityMonthYear );
+      return m_MaturityMonthYear;
+    }
+    void setMaturityMonthYear( const std::string& value )
+    { m_MaturityMonthYear = value; m_present.set( 22 ); }
+    void removeMaturityMonthYear() { m_present.reset( 22 ); }
+
+    bool isSetMaturityDay() const { return m_present.test( 23 ); }
+    int getMaturityDay() const
+    {
+      if( !m_present.test( 23 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaturityDay );
+      return m_MaturityDay;
+    }
+    void setMaturityDay( int value )
+    { m_MaturityDay = value; m_present.set( 23 ); }
+    void removeMaturityDay() { m_present.reset( 23 ); }
+
+    bool isSetPutOrCall() const { return m_present.test( 24 ); }
+    int getPutOrCall() const
+    {
+      if( !m_present.test( 24 ) ) throw FIX::FieldNotFound( FIX::FIELD::PutOrCall );
+      return m_PutOrCall;
+    }
+    void setPutOrCall( int value )
+    { m_PutOrCall = value; m_present.set( 24 ); }
+    void removePutOrCall() { m_present.reset( 24 ); }
+
+    bool isSetStrikePrice() const { return m_present.test( 25 ); }
+    double getStrikePrice() const
+    {
+      if( !m_present.test( 25 ) ) throw FIX::FieldNotFound( FIX::FIELD::StrikePrice );
+      return m_StrikePrice;
+    }
+    void setStrikePrice( double value )
+    { m_StrikePrice = value; m_present.set( 25 ); }
+    void removeStrikePrice() { m_present.reset( 25 ); }
+
+    bool isSetOptAttribute() const { return m_present.test( 26 ); }
+    char getOptAttribute() const
+    {
+      if( !m_present.test( 26 ) ) throw FIX::FieldNotFound( FIX::FIELD::OptAttribute );
+      return m_OptAttribute;
+    }
+    void setOptAttribute( char value )
+    { m_OptAttribute = value; m_present.set( 26 ); }
+    void removeOptAttribute() { m_present.reset( 26 ); }
+
+    bool isSetContractMultiplier() const { return m_present.test( 27 ); }
+    double getContractMultiplier() const
+    {
+      if( !m_present.test( 27 ) ) throw FIX::FieldNotFound( FIX::FIELD::ContractMultiplier );
+      return m_ContractMultiplier;
+    }
+    void setContractMultiplier( double value )
+    { m_ContractMultiplier = value; m_present.set( 27 ); }
+    void removeContractMultiplier() { m_present.reset( 27 ); }
+
+    bool isSetCouponRate() const { return m_present.test( 28 ); }
+    double getCouponRate() const
+    {
+      if( !m_present.test( 28 ) ) throw FIX::FieldNotFound( FIX::FIELD::CouponRate );
+      return m_CouponRate;
+    }
+    void setCouponRate( double value )
+    { m_CouponRate = value; m_present.set( 28 ); }
+    void removeCouponRate() { m_present.reset( 28 ); }
+
+    bool isSetSecurityExchange() const { return m_present.test( 29 ); }
+    const std::string& getSecurityExchange() const
+    {
+      if( !m_present.test( 29 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityExchange );
+      return m_SecurityExchange;
+    }
+    void setSecurityExchange( const std::string& value )
+    { m_SecurityExchange = value; m_present.set( 29 ); }
+    void removeSecurityExchange() { m_present.reset( 29 ); }
+
+    bool isSetIssuer() const { return m_present.test( 30 ); }
+    const std::string& getIssuer() const
+    {
+      if( !m_present.test( 30 ) ) throw FIX::FieldNotFound( FIX::FIELD::Issuer );
+      return m_Issuer;
+    }
+    void setIssuer( const std::string& value )
+    { m_Issuer = value; m_present.set( 30 ); }
+    void removeIssuer() { m_present.reset( 30 ); }
+
+    bool isSetEncodedIssuerLen() const { return m_present.test( 31 ); }
+    int getEncodedIssuerLen() const
+    {
+      if( !m_present.test( 31 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuerLen );
+      return m_EncodedIssuerLen;
+    }
+    void setEncodedIssuerLen( int value )
+    { m_EncodedIssuerLen = value; m_present.set( 31 ); }
+    void removeEncodedIssuerLen() { m_present.reset( 31 ); }
+
+    bool isSetEncodedIssuer() const { return m_present.test( 32 ); }
+    const std::string& getEncodedIssuer() const
+    {
+      if( !m_present.test( 32 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuer );
+      return m_EncodedIssuer;
+    }
+    void setEncodedIssuer( const std::string& value )
+    { m_EncodedIssuer = value; m_present.set( 32 ); }
+    void removeEncodedIssuer() { m_present.reset( 32 ); }
+
+    bool isSetSecurityDesc() const { return m_present.test( 33 ); }
+    const std::string& getSecurityDesc() const
+    {
+      if( !m_present.test( 33 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityDesc );
+      return m_SecurityDesc;
+    }
+    void setSecurityDesc( const std::string& value )
+    { m_SecurityDesc = value; m_present.set( 33 ); }
+    void removeSecurityDesc() { m_present.reset( 33 ); }
+
+    bool isSetEncodedSecurityDescLen() const { return m_present.test( 34 ); }
+    int getEncodedSecurityDescLen() const
+    {
+      if( !m_present.test( 34 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDescLen );
+      return m_EncodedSecurityDescLen;
+    }
+    void setEncodedSecurityDescLen( int value )
+    { m_EncodedSecurityDescLen = value; m_present.set( 34 ); }
+    void removeEncodedSecurityDescLen() { m_present.reset( 34 ); }
+
+    bool isSetEncodedSecurityDesc() const { return m_present.test( 35 ); }
+    const std::string& getEncodedSecurityDesc() const
+    {
+      if( !m_present.test( 35 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDesc );
+      return m_EncodedSecurityDesc;
+    }
+    void setEncodedSecurityDesc( const std::string& value )
+    { m_EncodedSecurityDesc = value; m_present.set( 35 ); }
+    void removeEncodedSecurityDesc() { m_present.reset( 35 ); }
+
+    bool isSetSide() const { return m_present.test( 36 ); }
+    char getSide() const
+    {
+      if( !m_present.test( 36 ) ) throw FIX::FieldNotFound( FIX::FIELD::Side );
+      return m_Side;
+    }
+    void setSide( char value )
+    { m_Side = value; m_present.set( 36 ); }
+    void removeSide() { m_present.reset( 36 ); }
+
+    bool isSetOrderQty() const { return m_present.test( 37 ); }
+    double getOrderQty() const
+    {
+      if( !m_present.test( 37 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrderQty );
+      return m_OrderQty;
+    }
+    void setOrderQty( double value )
+    { m_OrderQty = value; m_present.set( 37 ); }
+    void removeOrderQty() { m_present.reset( 37 ); }
+
+    bool isSetCashOrderQty() const { return m_present.test( 38 ); }
+    double getCashOrderQty() const
+    {
+      if( !m_present.test( 38 ) ) throw FIX::FieldNotFound( FIX::FIELD::CashOrderQty );
+      return m_CashOrderQty;
+    }
+    void setCashOrderQty( double value )
+    { m_CashOrderQty = value; m_present.set( 38 ); }
+    void removeCashOrderQty() { m_present.reset( 38 ); }
+
+    bool isSetOrdType() const { return m_present.test( 39 ); }
+    char getOrdType() const
+    {
+      if( !m_present.test( 39 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrdType );
+      return m_OrdType;
+    }
+    void setOrdType( char value )
+    { m_OrdType = value; m_present.set( 39 ); }
+    void removeOrdType() { m_present.reset( 39 ); }
+
+    bool isSetPrice() const { return m_present.test( 40 ); }
+    double getPrice() const
+    {
+      if( !m_present.test( 40 ) ) throw FIX::FieldNotFound( FIX::FIELD::Price );
+      return m_Price;
+    }
+    void setPrice( double value )
+    { m_Price = value; m_present.set( 40 ); }
+    void removePrice() { m_present.reset( 40 ); }
+
+    bool isSetStopPx() const { return m_present.test( 41 ); }
+    double getStopPx() const
+    {
+      if( !m_present.test( 41 ) ) throw FIX::FieldNotFound( FIX::FIELD::StopPx );
+      return m_StopPx;
+    }
+    void setStopPx( double value )
+    { m_StopPx = value; m_present.set( 41 ); }
+    void removeStopPx() { m_present.reset( 41 ); }
+
+    bool isSetPegDifference() const { return m_present.test( 42 ); }
+    double getPegDifference() const
+    {
+      if( !m_present.test( 42 ) ) throw FIX::FieldNotFound( FIX::FIELD::PegDifference );
+      return m_PegDifference;
+    }
+    void setPegDifference( double value )
+    { m_PegDifference = value; m_present.set( 42 ); }
+    void removePegDifference() { m_present.reset( 42 ); }
+
+    bool isSetDiscretionInst() const { return m_present.test( 43 ); }
+    char getDiscretionInst() const
+    {
+      if( !m_present.test( 43 ) ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionInst );
+      return m_DiscretionInst;
+    }
+    void setDiscretionInst( char value )
+    { m_DiscretionInst = value; m_present.set( 43 ); }
+    void removeDiscretionInst() { m_present.reset( 43 ); }
+
+    bool isSetDiscretionOffset() const { return m_present.test( 44 ); }
+    double getDiscretionOffset() const
+    {
+      if( !m_present.test( 44 ) ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionOffset );
+      return m_DiscretionOffset;
+    }
+    void setDiscretionOffset( double value )
+    { m_DiscretionOffset = value; m_present.set( 44 ); }
+    void removeDiscretionOffset() { m_present.reset( 44 ); }
+
+    bool isSetCurrency() const { return m_present.test( 45 ); }
+    const std::string& getCurrency() const
+    {
+      if( !m_present.test( 45 ) ) throw FIX::FieldNotFound( FIX::FIELD::Currency );
+      return m_Currency;
+    }
+    void setCurrency( const std::string& value )
+    { m_Currency = value; m_present.set( 45 ); }
+    void removeCurrency() { m_present.reset( 45 ); }
+
+    bool isSetComplianceID() const { return m_present.test( 46 ); }
+    const std::string& getComplianceID() const
+    {
+      if( !m_present.test( 46 ) ) throw FIX::FieldNotFound( FIX::FIELD::ComplianceID );
+      return m_ComplianceID;
+    }
+    void setComplianceID( const std::string& value )
+    { m_ComplianceID = value; m_present.set( 46 ); }
+    void removeComplianceID() { m_present.reset( 46 ); }
+
+    bool isSetSolicitedFlag() const { return m_present.test( 47 ); }
+    bool getSolicitedFlag() const
+    {
+      if( !m_present.test( 47 ) ) throw FIX::FieldNotFound( FIX::FIELD::SolicitedFlag );
+      return m_SolicitedFlag;
+    }
+    void setSolicitedFlag( bool value )
+    { m_SolicitedFlag = value; m_present.set( 47 ); }
+    void removeSolicitedFlag() { m_present.reset( 47 ); }
+
+    bool isSetTimeInForce() const { return m_present.test( 48 ); }
+    char getTimeInForce() const
+    {
+      if( !m_present.test( 48 ) ) throw FIX::FieldNotFound( FIX::FIELD::TimeInForce );
+      return m_TimeInForce;
+    }
+    void setTimeInForce( char value )
+    { m_TimeInForce = value; m_present.set( 48 ); }
+    void removeTimeInForce() { m_present.reset( 48 ); }
+
+    bool isSetEffectiveTime() const { return m_present.test( 49 ); }
+    FIX::UtcTimeStamp getEffectiveTime() const
+    {
+      if( !m_present.test( 49 ) ) throw FIX::FieldNotFound( FIX::FIELD::EffectiveTime );
+      return FIX::UtcTimeStamp( m_EffectiveTime );
+    }
+    void setEffectiveTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_EffectiveTime = value; m_EffectiveTimeMilliseconds = showMilliseconds; m_present.set( 49 ); }
+    void removeEffectiveTime() { m_present.reset( 49 ); }
+
+    bool isSetExpireDate() const { return m_present.test( 50 ); }
+    const std::string& getExpireDate() const
+    {
+      if( !m_present.test( 50 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExpireDate );
+      return m_ExpireDate;
+    }
+    void setExpireDate( const std::string& value )
+    { m_ExpireDate = value; m_present.set( 50 ); }
+    void removeExpireDate() { m_present.reset( 50 ); }
+
+    bool isSetExpireTime() const { return m_present.test( 51 ); }
+    FIX::UtcTimeStamp getExpireTime() const
+    {
+      if( !m_present.test( 51 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExpireTime );
+      return FIX::UtcTimeStamp( m_ExpireTime );
+    }
+    void setExpireTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_ExpireTime = value; m_ExpireTimeMilliseconds = showMilliseconds; m_present.set( 51 ); }
+    void removeExpireTime() { m_present.reset( 51 ); }
+
+    bool isSetExecInst() const { return m_present.test( 52 ); }
+    const std::string& getExecInst() const
+    {
+      if( !m_present.test( 52 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecInst );
+      return m_ExecInst;
+    }
+    void setExecInst( const std::string& value )
+    { m_ExecInst = value; m_present.set( 52 ); }
+    void removeExecInst() { m_present.reset( 52 ); }
+
+    bool isSetRule80A() const { return m_present.test( 53 ); }
+    char getRule80A() const
+    {
+      if( !m_present.test( 53 ) ) throw FIX::FieldNotFound( FIX::FIELD::Rule80A );
+      return m_Rule80A;
+    }
+    void setRule80A( char value )
+    { m_Rule80A = value; m_present.set( 53 ); }
+    void removeRule80A() { m_present.reset( 53 ); }
+
+    bool isSetLastShares() const { return m_present.test( 54 ); }
+    double getLastShares() const
+    {
+      if( !m_present.test( 54 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastShares );
+      return m_LastShares;
+    }
+    void setLastShares( double value )
+    { m_LastShares = value; m_present.set( 54 ); }
+    void removeLastShares() { m_present.reset( 54 ); }
+
+    bool isSetLastPx() const { return m_present.test( 55 ); }
+    double getLastPx() const
+    {
+      if( !m_present.test( 55 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastPx );
+      return m_LastPx;
+    }
+    void setLastPx( double value )
+    { m_LastPx = value; m_present.set( 55 ); }
+    void removeLastPx() { m_present.reset( 55 ); }
+
+    bool isSetLastSpotRate() const { return m_present.test( 56 ); }
+    double getLastSpotRate() const
+    {
+      if( !m_present.test( 56 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastSpotRate );
+      return m_LastSpotRate;
+    }
+    void setLastSpotRate( double value )
+    { m_LastSpotRate = value; m_present.set( 56 ); }
+    void removeLastSpotRate() { m_present.reset( 56 ); }
+
+    bool isSetLastForwardPoints() const { return m_present.test( 57 ); }
+    double getLastForwardPoints() const
+    {
+      if( !m_present.test( 57 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastForwardPoints );
+      return m_LastForwardPoints;
+    }
+    void setLastForwardPoints( double value )
+    { m_LastForwardPoints = value; m_present.set( 57 ); }
+    void removeLastForwardPoints() { m_present.reset( 57 ); }
+
+    bool isSetLastMkt() const { return m_present.test( 58 ); }
+    const std::string& getLastMkt() const
+    {
+      if( !m_present.test( 58 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastMkt );
+      return m_LastMkt;
+    }
+    void setLastMkt( const std::string& value )
+    { m_LastMkt = value; m_present.set( 58 ); }
+    void removeLastMkt() { m_present.reset( 58 ); }
+
+    bool isSetTradingSessionID() const { return m_present.test( 59 ); }
+    const std::string& getTradingSessionID() const
+    {
+      if( !m_present.test( 59 ) ) throw FIX::FieldNotFound( FIX::FIELD::TradingSessionID );
+      return m_TradingSessionID;
+    }
+    void setTradingSessionID( const std::string& value )
+    { m_TradingSessionID = value; m_present.set( 59 ); }
+    void removeTradingSessionID() { m_present.reset( 59 ); }
+
+    bool isSetLastCapacity() const { return m_present.test( 60 ); }
+    char getLastCapacity() const
+    {
+      if( !m_present.test( 60 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastCapacity );
+      return m_LastCapacity;
+    }
+    void setLastCapacity( char value )
+    { m_LastCapacity = value; m_present.set( 60 ); }
+    void removeLastCapacity() { m_present.reset( 60 ); }
+
+    bool isSetLeavesQty() const { return m_present.test( 61 ); }
+    double getLeavesQty() const
+    {
+      if( !m_present.test( 61 ) ) throw FIX::FieldNotFound( FIX::FIELD::LeavesQty );
+      return m_LeavesQty;
+    }
+    void setLeavesQty( double value )
+    { m_LeavesQty = value; m_present.set( 61 ); }
+    void removeLeavesQty() { m_present.reset( 61 ); }
+
+    bool isSetCumQty() const { return m_present.test( 62 ); }
+    double getCumQty() const
+    {
+      if( !m_present.test( 62 ) ) throw FIX::FieldNotFound( FIX::FIELD::CumQty );
+      return m_CumQty;
+    }
+    void setCumQty( double value )
+    { m_CumQty = value; m_present.set( 62 ); }
+    void removeCumQty() { m_present.reset( 62 ); }
+
+    bool isSetAvgPx() const { return m_present.test( 63 ); }
+    double getAvgPx() const
+    {
+      if( !m_present.test( 63 ) ) throw FIX::FieldNotFound( FIX::FIELD::AvgPx );
+      return m_AvgPx;
+    }
+    void setAvgPx( double value )
+    { m_AvgPx = value; m_present.set( 63 ); }
+    void removeAvgPx() { m_present.reset( 63 ); }
+
+    bool isSetDayOrderQty() const { return m_present.test( 64 ); }
+    double getDayOrderQty() const
+    {
+      if( !m_present.test( 64 ) ) throw FIX::FieldNotFound( FIX::FIELD::DayOrderQty );
+      return m_DayOrderQty;
+    }
+    void setDayOrderQty( double value )
+    { m_DayOrderQty = value; m_present.set( 64 ); }
+    void removeDayOrderQty() { m_present.reset( 64 ); }
+
+    bool isSetDayCumQty() const { return m_present.test( 65 ); }
+    double getDayCumQty() const
+    {
+      if( !m_present.test( 65 ) ) throw FIX::FieldNotFound( FIX::FIELD::DayCumQty );
+      return m_DayCumQty;
+    }
+    void setDayCumQty( double value )
+    { m_DayCumQty = value; m_present.set( 65 ); }
+    void removeDayCumQty() { m_present.reset( 65 ); }
+
+    bool isSetDayAvgPx() const { return m_present.test( 66 ); }
+    double getDayAvgPx() const
+    {
+      if( !m_present.test( 66 ) ) throw FIX::FieldNotFound( FIX::FIELD::DayAvgPx );
+      return m_DayAvgPx;
+    }
+    void setDayAvgPx( double value )
+    { m_DayAvgPx = value; m_present.set( 66 ); }
+    void removeDayAvgPx() { m_present.reset( 66 ); }
+
+    bool isSetGTBookingInst() const { return m_present.test( 67 ); }
+    int getGTBookingInst() const
+    {
+      if( !m_present.test( 67 ) ) throw FIX::FieldNotFound( FIX::FIELD::GTBookingInst );
+      return m_GTBookingInst;
+    }
+    void setGTBookingInst( int value )
+    { m_GTBookingInst = value; m_present.set( 67 ); }
+    void removeGTBookingInst() { m_present.reset( 67 ); }
+
+    bool isSetTradeDate() const { return m_present.test( 68 ); }
+    const std::string& getTradeDate() const
+    {
+      if( !m_present.test( 68 ) ) throw FIX::FieldNotFound( FIX::FIELD::TradeDate );
+      return m_TradeDate;
+    }
+    void setTradeDate( const std::string& value )
+    { m_TradeDate = value; m_present.set( 68 ); }
+    void removeTradeDate() { m_present.reset( 68 ); }
+
+    bool isSetTransactTime() const { return m_present.test( 69 ); }
+    FIX::UtcTimeStamp getTransactTime() const
+    {
+      if( !m_present.test( 69 ) ) throw FIX::FieldNotFound( FIX::FIELD::TransactTime );
+      return FIX::UtcTimeStamp( m_TransactTime );
+    }
+    void setTransactTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_TransactTime = value; m_TransactTimeMilliseconds = showMilliseconds; m_present.set( 69 ); }
+    void removeTransactTime() { m_present.reset( 69 ); }
+
+    bool isSetReportToExch() const { return m_present.test( 70 ); }
+    bool getReportToExch() const
+    {
+      if( !m_present.test( 70 ) ) throw FIX::FieldNotFound( FIX::FIELD::ReportToExch );
+      return m_ReportToExch;
+    }
+    void setReportToExch( bool value )
+    { m_ReportToExch = value; m_present.set( 70 ); }
+    void removeReportToExch() { m_present.reset( 70 ); }
+
+    bool isSetCommission() const { return m_present.test( 71 ); }
+    double getCommission() const
+    {
+      if( !m_present.test( 71 ) ) throw FIX::FieldNotFound( FIX::FIELD::Commission );
+      return m_Commission;
+    }
+    void setCommission( double value )
+    { m_Commission = value; m_present.set( 71 ); }
+    void removeCommission() { m_present.reset( 71 ); }
+
+    bool isSetCommType() const { return m_present.test( 72 ); }
+    char getCommType() const
+    {
+      if( !m_present.test( 72 ) ) throw FIX::FieldNotFound( FIX::FIELD::CommType );
+      return m_CommType;
+    }
+    void setCommType( char value )
+    { m_CommType = value; m_present.set( 72 ); }
+    void removeCommType() { m_present.reset( 72 ); }
+
+    bool isSetGrossTradeAmt() const { return m_present.test( 73 ); }
+    double getGrossTradeAmt() const
+    {
+      if( !m_present.test( 73 ) ) throw FIX::FieldNotFound( FIX::FIELD::GrossTradeAmt );
+      return m_GrossTradeAmt;
+    }
+    void setGrossTradeAmt( double value )
+    { m_GrossTradeAmt = value; m_present.set( 73 ); }
+    void removeGrossTradeAmt() { m_present.reset( 73 ); }
+
+    bool isSetSettlCurrAmt() const { return m_present.test( 74 ); }
+    double getSettlCurrAmt() const
+    {
+      if( !m_present.test( 74 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrAmt );
+      return m_SettlCurrAmt;
+    }
+    void setSettlCurrAmt( double value )
+    { m_SettlCurrAmt = value; m_present.set( 74 ); }
+    void removeSettlCurrAmt() { m_present.reset( 74 ); }
+
+    bool isSetSettlCurrency() const { return m_present.test( 75 ); }
+    const std::string& getSettlCurrency() const
+    {
+      if( !m_present.test( 75 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrency );
+      return m_SettlCurrency;
+    }
+    void setSettlCurrency( const std::string& value )
+    { m_SettlCurrency = value; m_present.set( 75 ); }
+    void removeSettlCurrency() { m_present.reset( 75 ); }
+
+    bool isSetSettlCurrFxRate() const { return m_present.test( 76 ); }
+    double getSettlCurrFxRate() const
+    {
+      if( !m_present.test( 76 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrFxRate );
+      return m_SettlCurrFxRate;
+    }
+    void setSettlCurrFxRate( double value )
+    { m_SettlCurrFxRate = value; m_present.set( 76 ); }
+    void removeSettlCurrFxRate() { m_present.reset( 76 ); }
+
+    bool isSetSettlCurrFxRateCalc() const { return m_present.test( 77 ); }
+    char getSettlCurrFxRateCalc() const
+    {
+      if( !m_present.test( 77 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrFxRateCalc );
+      return m_SettlCurrFxRateCalc;
+    }
+    void setSettlCurrFxRateCalc( char value )
+    { m_SettlCurrFxRateCalc = value; m_present.set( 77 ); }
+    void removeSettlCurrFxRateCalc() { m_present.reset( 77 ); }
+
+    bool isSetHandlInst() const { return m_present.test( 78 ); }
+    char getHandlInst() const
+    {
+      if( !m_present.test( 78 ) ) throw FIX::FieldNotFound( FIX::FIELD::HandlInst );
+      return m_HandlInst;
+    }
+    void setHandlInst( char value )
+    { m_HandlInst = value; m_present.set( 78 ); }
+    void removeHandlInst() { m_present.reset( 78 ); }
+
+    bool isSetMinQty() const { return m_present.test( 79 ); }
+    double getMinQty() const
+    {
+      if( !m_present.test( 79 ) ) throw FIX::FieldNotFound( FIX::FIELD::MinQty );
+      return m_MinQty;
+    }
+    void setMinQty( double value )
+    { m_MinQty = value; m_present.set( 79 ); }
+    void removeMinQty() { m_present.reset( 79 ); }
+
+    bool isSetMaxFloor() const { return m_present.test( 80 ); }
+    double getMaxFloor() const
+    {
+      if( !m_present.test( 80 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaxFloor );
+      return m_MaxFloor;
+    }
+    void setMaxFloor( double value )
+    { m_MaxFloor = value; m_present.set( 80 ); }
+    void removeMaxFloor() { m_present.reset( 80 ); }
+
+    bool isSetOpenClose() const { return m_present.test( 81 ); }
+    char getOpenClose() const
+    {
+      if( !m_present.test( 81 ) ) throw FIX::FieldNotFound( FIX::FIELD::OpenClose );
+      return m_OpenClose;
+    }
+    void setOpenClose( char value )
+    { m_OpenClose = value; m_present.set( 81 ); }
+    void removeOpenClose() { m_present.reset( 81 ); }
+
+    bool isSetMaxShow() const { return m_present.test( 82 ); }
+    double getMaxShow() const
+    {
+      if( !m_present.test( 82 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaxShow );
+      return m_MaxShow;
+    }
+    void setMaxShow( double value )
+    { m_MaxShow = value; m_present.set( 82 ); }
+    void removeMaxShow() { m_present.reset( 82 ); }
+
+    bool isSetText() const { return m_present.test( 83 ); }
+    const std::string& getText() const
+    {
+      if( !m_present.test( 83 ) ) throw FIX::FieldNotFound( FIX::FIELD::Text );
+      return m_Text;
+    }
+    void setText( const std::string& value )
+    { m_Text = value; m_present.set( 83 ); }
+    void removeText() { m_present.reset( 83 ); }
+
+    bool isSetEncodedTextLen() const { return m_present.test( 84 ); }
+    int getEncodedTextLen() const
+    {
+      if( !m_present.test( 84 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedTextLen );
+      return m_EncodedTextLen;
+    }
+    void setEncodedTextLen( int value )
+    { m_EncodedTextLen = value; m_present.set( 84 ); }
+    void removeEncodedTextLen() { m_present.reset( 84 ); }
+
+    bool isSetEncodedText() const { return m_present.test( 85 ); }
+    const std::string& getEncodedText() const
+    {
+      if( !m_present.test( 85 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedText );
+      return m_EncodedText;
+    }
+    void setEncodedText( const std::string& value )
+    { m_EncodedText = value; m_present.set( 85 ); }
+    void removeEncodedText() { m_present.reset( 85 ); }
+
+    bool isSetFutSettDate2() const { return m_present.test( 86 ); }
+    const std::string& getFutSettDate2() const
+    {
+      if( !m_present.test( 86 ) ) throw FIX::FieldNotFound( FIX::FIELD::FutSettDate2 );
+      return m_FutSettDate2;
+    }
+    void setFutSettDate2( const std::string& value )
+    { m_FutSettDate2 = value; m_present.set( 86 ); }
+    void removeFutSettDate2() { m_present.reset( 86 ); }
+
+    bool isSetOrderQty2() const { return m_present.test( 87 ); }
+    double getOrderQty2() const
+    {
+      if( !m_present.test( 87 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrderQty2 );
+      return m_OrderQty2;
+    }
+    void setOrderQty2( double value )
+    { m_OrderQty2 = value; m_present.set( 87 ); }
+    void removeOrderQty2() { m_present.reset( 87 ); }
+
+    bool isSetClearingFirm() const { return m_present.test( 88 ); }
+    const std::string& getClearingFirm() const
+    {
+      if( !m_present.test( 88 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClearingFirm );
+      return m_ClearingFirm;
+    }
+    void setClearingFirm( const std::string& value )
+    { m_ClearingFirm = value; m_present.set( 88 ); }
+    void removeClearingFirm() { m_present.reset( 88 ); }
+
+    bool isSetClearingAccount() const { return m_present.test( 89 ); }
+    const std::string& getClearingAccount() const
+    {
+      if( !m_present.test( 89 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClearingAccount );
+      return m_ClearingAccount;
+    }
+    void setClearingAccount( const std::string& value )
+    { m_ClearingAccount = value; m_present.set( 89 ); }
+    void removeClearingAccount() { m_present.reset( 89 ); }
+
+    bool isSetMultiLegReportingType() const { return m_present.test( 90 ); }
+    char getMultiLegReportingType() const
+    {
+      if( !m_present.test( 90 ) ) throw FIX::FieldNotFound( FIX::FIELD::MultiLegReportingType );
+      return m_MultiLegReportingType;
+    }
+    void setMultiLegReportingType( char value )
+    { m_MultiLegReportingType = value; m_present.set( 90 ); }
+    void removeMultiLegReportingType() { m_present.reset( 90 ); }
+
+    FIX::FixedGroup< NoContraBrokers, 4 >& getNoContraBrokers() { return m_NoContraBrokers; }
+    const FIX::FixedGroup< NoContraBrokers, 4 >& getNoContraBrokers() const { return m_NoContraBrokers; }
+
+    void clear()
+    {
+      m_header.clear();
+      m_trailer.clear();
+      m_present.clear();
+      m_NoContraBrokers.clear();
+    }
+
+    std::string toString() const
+    {
+      std::string string;
+      return toString( string );
+    }
+
+    std::string& toString( std::string& string ) const
+    {
+      std::string::size_type length
+        = FIX::FixedWriter::begin( string, "FIX.4.2", "8" );
+      m_header.write( string );
+      write( string );
+      m_trailer.write( string );
+      FIX::FixedWriter::end( string, length );
+      return string;
+    }
+
+    void setString( const std::string& string, bool validate = true )
+    {
+      FIX::FixedParser parser( string );
+      parser.begin( "FIX.4.2", "8" );
+      clear();
+
+      int tag = 0;
+      while( parser.next( tag ) && tag != FIX::FIELD::CheckSum )
+      {
+        if( !m_header.setField( tag, parser )
+            && !setField( tag, parser )
+            && !m_trailer.setField( tag, parser ) )
+          throw FIX::TagNotDefinedForMessage( tag );
+      }
+
+      if( validate )
+        parser.end( tag );
+    }
+
+    bool setField( int tag, FIX::FixedParser& parser )
+    {
+      switch( tag )
+      {
+      case FIX::FIELD::OrderID:
+        parser.get( m_OrderID );
+        m_present.set( 0 );
+        return true;
+      case FIX::FIELD::SecondaryOrderID:
+        parser.get( m_SecondaryOrderID );
+        m_present.set( 1 );
+        return true;
+      case FIX::FIELD::ClOrdID:
+        parser.get( m_ClOrdID );
+        m_present.set( 2 );
+        return true;
+      case FIX::FIELD::OrigClOrdID:
+        parser.get( m_OrigClOrdID );
+        m_present.set( 3 );
+        return true;
+      case FIX::FIELD::ClientID:
+        parser.get( m_ClientID );
+        m_present.set( 4 );
+        return true;
+      case FIX::FIELD::ExecBroker:
+        parser.get( m_ExecBroker );
+        m_present.set( 5 );
+        return true;
+      case FIX::FIELD::ListID:
+        parser.get( m_ListID );
+        m_present.set( 6 );
+        return true;
+      case FIX::FIELD::ExecID:
+        parser.get( m_ExecID );
+        m_present.set( 7 );
+        return true;
+      case FIX::FIELD::ExecTransType:
+        parser.get( m_ExecTransType );
+        m_present.set( 8 );
+        return true;
+      case FIX::FIELD::ExecRefID:
+        parser.get( m_ExecRefID );
+        m_present.set( 9 );
+        return true;
+      case FIX::FIELD::ExecType:
+        parser.get( m_ExecType );
+        m_present.set( 10 );
+        return true;
+      case FIX::FIELD::OrdStatus:
+        parser.get( m_OrdStatus );
+        m_present.set( 11 );
+        return true;
+      case FIX::FIELD::OrdRejReason:
+        parser.get( m_OrdRejReason );
+        m_present.set( 12 );
+        return true;
+      case FIX::FIELD::ExecRestatementReason:
+        parser.get( m_ExecRestatementReason );
+        m_present.set( 13 );
+        return true;
+      case FIX::FIELD::Account:
+        parser.get( m_Account );
+        m_present.set( 14 );
+        return true;
+      case FIX::FIELD::SettlmntTyp:
+        parser.get( m_SettlmntTyp );
+        m_present.set( 15 );
+        return true;
+      case FIX::FIELD::FutSettDate:
+        parser.get( m_FutSettDate );
+        m_present.set( 16 );
+        return true;
+      case FIX::FIELD::Symbol:
+        parser.get( m_Symbol );
+        m_present.set( 17 );
+        return true;
+      case FIX::FIELD::SymbolSfx:
+        parser.get( m_SymbolSfx );
+        m_present.set( 18 );
+        return true;
+      case FIX::FIELD::SecurityID:
+        parser.get( m_SecurityID );
+        m_present.set( 19 );
+        return true;
+      case FIX::FIELD::IDSource:
+        parser.get( m_IDSource );
+        m_present.set( 20 );
+        return true;
+      case FIX::FIELD::SecurityType:
+        parser.get( m_SecurityType );
+        m_present.set( 21 );
+        return true;
+      case FIX::FIELD::MaturityMonthYear:
+        parser.get( m_MaturityMonthYear );
+        m_present.set( 22 );
+        return true;
+      case FIX::FIELD::MaturityDay:
+        parser.get( m_MaturityDay );
+        m_present.set( 23 );
+        return true;
+      case FIX::FIELD::PutOrCall:
+        parser.get( m_PutOrCall );
+        m_present.set( 24 );
+        return true;
+      case FIX::FIELD::StrikePrice:
+        parser.get( m_StrikePrice );
+        m_present.set( 25 );
+        return true;
+      case FIX::FIELD::OptAttribute:
+        parser.get( m_OptAttribute );
+        m_present.set( 26 );
+        return true;
+      case FIX::FIELD::ContractMultiplier:
+        parser.get( m_ContractMultiplier );
+        m_present.set( 27 );
+        return true;
+      case FIX::FIELD::CouponRate:
+        parser.get( m_CouponRate );
+        m_present.set( 28 );
+        return true;
+      case FIX::FIELD::SecurityExchange:
+        parser.get( m_SecurityExchange );
+        m_present.set( 29 );
+        return true;
+      case FIX::FIELD::Issuer:
+        parser.get( m_Issuer );
+        m_present.set( 30 );
+        return true;
+      case FIX::FIELD::EncodedIssuerLen:
+        parser.get( m_EncodedIssuerLen );
+        parser.setDataLength( m_EncodedIssuerLen );
+        m_present.set( 31 );
+        return true;
+      case FIX::FIELD::EncodedIssuer:
+        parser.get( m_EncodedIssuer );
+        m_present.set( 32 );
+        return true;
+      case FIX::FIELD::SecurityDesc:
+        parser.get( m_SecurityDesc );
+        m_present.set( 33 );
+        return true;
+      case FIX::FIELD::EncodedSecurityDescLen:
+        parser.get( m_EncodedSecurityDescLen );
+        parser.setDataLength( m_EncodedSecurityDescLen );
+        m_present.set( 34 );
+        return true;
+      case FIX::FIELD::EncodedSecurityDesc:
+        parser.get( m_EncodedSecurityDesc );
+        m_present.set( 35 );
+        return true;
+      case FIX::FIELD::Side:
+        parser.get( m_Side );
+        m_present.set( 36 );
+        return true;
+      case FIX::FIELD::OrderQty:
+        parser.get( m_OrderQty );
+        m_present.set( 37 );
+        return true;
+      case FIX::FIELD::CashOrderQty:
+        parser.get( m_CashOrderQty );
+        m_present.set( 38 );
+        return true;
+      case FIX::FIELD::OrdType:
+        parser.get( m_OrdType );
+        m_present.set( 39 );
+        return true;
+      case FIX::FIELD::Price:
+        parser.get( m_Price );
+        m_present.set( 40 );
+        return true;
+      case FIX::FIELD::StopPx:
+        parser.get( m_StopPx );
+        m_present.set( 41 );
+        return true;
+      case FIX::FIELD::PegDifference:
+        parser.get( m_PegDifference );
+        m_present.set( 42 );
+        return true;
+      case FIX::FIELD::DiscretionInst:
+        parser.get( m_DiscretionInst );
+        m_present.set( 43 );
+        return true;
+      case FIX::FIELD::DiscretionOffset:
+        parser.get( m_DiscretionOffset );
+        m_present.set( 44 );
+        return true;
+      case FIX::FIELD::Currency:
+        parser.get( m_Currency );
+        m_present.set( 45 );
+        return true;
+      case FIX::FIELD::ComplianceID:
+        parser.get( m_ComplianceID );
+        m_present.set( 46 );
+        return true;
+      case FIX::FIELD::SolicitedFlag:
+        parser.get( m_SolicitedFlag );
+        m_present.set( 47 );
+        return true;
+      case FIX::FIELD::TimeInForce:
+        parser.get( m_TimeInForce );
+        m_present.set( 48 );
+        return true;
+      case FIX::FIELD::EffectiveTime:
+        parser.get( m_EffectiveTime, m_EffectiveTimeMilliseconds );
+        m_present.set( 49 );
+        return true;
+      case FIX::FIELD::ExpireDate:
+        parser.get( m_ExpireDate );
+        m_present.set( 50 );
+        return true;
+      case FIX::FIELD::ExpireTime:
+        parser.get( m_ExpireTime, m_ExpireTimeMilliseconds );
+        m_present.set( 51 );
+        return true;
+      case FIX::FIELD::ExecInst:
+        parser.get( m_ExecInst );
+        m_present.set( 52 );
+        return true;
+      case FIX::FIELD::Rule80A:
+        parser.get( m_Rule80A );
+        m_present.set( 53 );
+        return true;
+      case FIX::FIELD::LastShares:
+        parser.get( m_LastShares );
+        m_present.set( 54 );
+        return true;
+      case FIX::FIELD::LastPx:
+        parser.get( m_LastPx );
+        m_present.set( 55 );
+        return true;
+      case FIX::FIELD::LastSpotRate:
+        parser.get( m_LastSpotRate );
+        m_present.set( 56 );
+        return true;
+      case FIX::FIELD::LastForwardPoints:
+        parser.get( m_LastForwardPoints );
+        m_present.set( 57 );
+        return true;
+      case FIX::FIELD::LastMkt:
+        parser.get( m_LastMkt );
+        m_present.set( 58 );
+        return true;
+      case FIX::FIELD::TradingSessionID:
+        parser.get( m_TradingSessionID );
+        m_present.set( 59 );
+        return true;
+      case FIX::FIELD::LastCapacity:
+        parser.get( m_LastCapacity );
+        m_present.set( 60 );
+        return true;
+      case FIX::FIELD::LeavesQty:
+        parser.get( m_LeavesQty );
+        m_present.set( 61 );
+        return true;
+      case FIX::FIELD::CumQty:
+        parser.get( m_CumQty );
+        m_present.set( 62 );
+        return true;
+      case FIX::FIELD::AvgPx:
+        parser.get( m_AvgPx );
+        m_present.set( 63 );
+        return true;
+      case FIX::FIELD::DayOrderQty:
+        parser.get( m_DayOrderQty );
+        m_present.set( 64 );
+        return true;
+      case FIX::FIELD::DayCumQty:
+        parser.get( m_DayCumQty );
+        m_present.set( 65 );
+        return true;
+      case FIX::FIELD::DayAvgPx:
+        parser.get( m_DayAvgPx );
+        m_present.set( 66 );
+        return true;
+      case FIX::FIELD::GTBookingInst:
+        parser.get( m_GTBookingInst );
+        m_present.set( 67 );
+        return true;
+      case FIX::FIELD::TradeDate:
+        parser.get( m_TradeDate );
+        m_present.set( 68 );
+        return true;
+      case FIX::FIELD::TransactTime:
+        parser.get( m_TransactTime, m_TransactTimeMilliseconds );
+        m_present.set( 69 );
+        return true;
+      case FIX::FIELD::ReportToExch:
+        parser.get( m_ReportToExch );
+        m_present.set( 70 );
+        return true;
+      case FIX::FIELD::Commission:
+        parser.get( m_Commission );
+        m_present.set( 71 );
+        return true;
+      case FIX::FIELD::CommType:
+        parser.get( m_CommType );
+        m_present.set( 72 );
+        return true;
+      case FIX::FIELD::GrossTradeAmt:
+        parser.get( m_GrossTradeAmt );
+        m_present.set( 73 );
+        return true;
+      case FIX::FIELD::SettlCurrAmt:
+        parser.get( m_SettlCurrAmt );
+        m_present.set( 74 );
+        return true;
+      case FIX::FIELD::SettlCurrency:
+        parser.get( m_SettlCurrency );
+        m_present.set( 75 );
+        return true;
+      case FIX::FIELD::SettlCurrFxRate:
+        parser.get( m_SettlCurrFxRate );
+        m_present.set( 76 );
+        return true;
+      case FIX::FIELD::SettlCurrFxRateCalc:
+        parser.get( m_SettlCurrFxRateCalc );
+        m_present.set( 77 );
+        return true;
+      case FIX::FIELD::HandlInst:
+        parser.get( m_HandlInst );
+        m_present.set( 78 );
+        return true;
+      case FIX::FIELD::MinQty:
+        parser.get( m_MinQty );
+        m_present.set( 79 );
+        return true;
+      case FIX::FIELD::MaxFloor:
+        parser.get( m_MaxFloor );
+        m_present.set( 80 );
+        return true;
+      case FIX::FIELD::OpenClose:
+        parser.get( m_OpenClose );
+        m_present.set( 81 );
+        return true;
+      case FIX::FIELD::MaxShow:
+        parser.get( m_MaxShow );
+        m_present.set( 82 );
+        return true;
+      case FIX::FIELD::Text:
+        parser.get( m_Text );
+        m_present.set( 83 );
+        return true;
+      case FIX::FIELD::EncodedTextLen:
+        parser.get( m_EncodedTextLen );
+        parser.setDataLength( m_EncodedTextLen );
+        m_present.set( 84 );
+        return true;
+      case FIX::FIELD::EncodedText:
+        parser.get( m_EncodedText );
+        m_present.set( 85 );
+        return true;
+      case FIX::FIELD::FutSettDate2:
+        parser.get( m_FutSettDate2 );
+        m_present.set( 86 );
+        return true;
+      case FIX::FIELD::OrderQty2:
+        parser.get( m_OrderQty2 );
+        m_present.set( 87 );
+        return true;
+      case FIX::FIELD::ClearingFirm:
+        parser.get( m_ClearingFirm );
+        m_present.set( 88 );
+        return true;
+      case FIX::FIELD::ClearingAccount:
+        parser.get( m_ClearingAccount );
+        m_present.set( 89 );
+        return true;
+      case FIX::FIELD::MultiLegReportingType:
+        parser.get( m_MultiLegReportingType );
+        m_present.set( 90 );
+        return true;
+      case FIX::FIELD::NoContraBrokers:
+        {
+          int count = 0;
+          parser.get( count );
+          m_NoContraBrokers.read( parser, FIX::FIELD::NoContraBrokers, FIX::FIELD::ContraBroker, count );
+        }
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    void write( std::string& string ) const
+    {
+      if( m_present.test( 14 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Account, m_Account );
+      if( m_present.test( 63 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::AvgPx, m_AvgPx );
+      if( m_present.test( 2 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClOrdID, m_ClOrdID );
+      if( m_present.test( 71 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Commission, m_Commission );
+      if( m_present.test( 72 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CommType, m_CommType );
+      if( m_present.test( 62 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CumQty, m_CumQty );
+      if( m_present.test( 45 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Currency, m_Currency );
+      if( m_present.test( 7 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecID, m_ExecID );
+      if( m_present.test( 52 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecInst, m_ExecInst );
+      if( m_present.test( 9 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecRefID, m_ExecRefID );
+      if( m_present.test( 8 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecTransType, m_ExecTransType );
+      if( m_present.test( 78 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::HandlInst, m_HandlInst );
+      if( m_present.test( 20 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::IDSource, m_IDSource );
+      if( m_present.test( 60 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastCapacity, m_LastCapacity );
+      if( m_present.test( 58 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastMkt, m_LastMkt );
+      if( m_present.test( 55 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastPx, m_LastPx );
+      if( m_present.test( 54 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastShares, m_LastShares );
+      if( m_present.test( 0 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrderID, m_OrderID );
+      if( m_present.test( 37 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrderQty, m_OrderQty );
+      if( m_present.test( 11 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrdStatus, m_OrdStatus );
+      if( m_present.test( 39 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrdType, m_OrdType );
+      if( m_present.test( 3 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrigClOrdID, m_OrigClOrdID );
+      if( m_present.test( 40 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Price, m_Price );
+      if( m_present.test( 53 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Rule80A, m_Rule80A );
+      if( m_present.test( 19 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityID, m_SecurityID );
+      if( m_present.test( 36 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Side, m_Side );
+      if( m_present.test( 17 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Symbol, m_Symbol );
+      if( m_present.test( 83 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Text, m_Text );
+      if( m_present.test( 48 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TimeInForce, m_TimeInForce );
+      if( m_present.test( 69 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TransactTime, m_TransactTime, m_TransactTimeMilliseconds );
+      if( m_present.test( 15 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlmntTyp, m_SettlmntTyp );
+      if( m_present.test( 16 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::FutSettDate, m_FutSettDate );
+      if( m_present.test( 18 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SymbolSfx, m_SymbolSfx );
+      if( m_present.test( 6 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ListID, m_ListID );
+      if( m_present.test( 68 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TradeDate, m_TradeDate );
+      if( m_present.test( 5 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecBroker, m_ExecBroker );
+      if( m_present.test( 81 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OpenClose, m_OpenClose );
+      if( m_present.test( 41 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::StopPx, m_StopPx );
+      if( m_present.test( 12 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrdRejReason, m_OrdRejReason );
+      if( m_present.test( 30 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Issuer, m_Issuer );
+      if( m_present.test( 33 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityDesc, m_SecurityDesc );
+      if( m_present.test( 4 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClientID, m_ClientID );
+      if( m_present.test( 79 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MinQty, m_MinQty );
+      if( m_present.test( 80 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaxFloor, m_MaxFloor );
+      if( m_present.test( 70 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ReportToExch, m_ReportToExch );
+      if( m_present.test( 74 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlCurrAmt, m_SettlCurrAmt );
+      if( m_present.test( 75 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlCurrency, m_SettlCurrency );
+      if( m_present.test( 51 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExpireTime, m_ExpireTime, m_ExpireTimeMilliseconds );
+      if( m_present.test( 10 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecType, m_ExecType );
+      if( m_present.test( 61 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LeavesQty, m_LeavesQty );
+      if( m_present.test( 38 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CashOrderQty, m_CashOrderQty );
+      if( m_present.test( 76 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlCurrFxRate, m_SettlCurrFxRate );
+      if( m_present.test( 77 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlCurrFxRateCalc, m_SettlCurrFxRateCalc );
+      if( m_present.test( 21 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityType, m_SecurityType );
+      if( m_present.test( 49 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EffectiveTime, m_EffectiveTime, m_EffectiveTimeMilliseconds );
+      if( m_present.test( 87 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrderQty2, m_OrderQty2 );
+      if( m_present.test( 86 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::FutSettDate2, m_FutSettDate2 );
+      if( m_present.test( 56 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastSpotRate, m_LastSpotRate );
+      if( m_present.test( 57 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastForwardPoints, m_LastForwardPoints );
+      if( m_present.test( 1 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecondaryOrderID, m_SecondaryOrderID );
+      if( m_present.test( 22 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaturityMonthYear, m_MaturityMonthYear );
+      if( m_present.test( 24 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PutOrCall, m_PutOrCall );
+      if( m_present.test( 25 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::StrikePrice, m_StrikePrice );
+      if( m_present.test( 23 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaturityDay, m_MaturityDay );
+      if( m_present.test( 26 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OptAttribute, m_OptAttribute );
+      if( m_present.test( 29 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityExchange, m_SecurityExchange );
+      if( m_present.test( 82 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaxShow, m_MaxShow );
+      if( m_present.test( 42 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PegDifference, m_PegDifference );
+      if( m_present.test( 28 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CouponRate, m_CouponRate );
+      if( m_present.test( 27 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ContractMultiplier, m_ContractMultiplier );
+      if( m_present.test( 59 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TradingSessionID, m_TradingSessionID );
+      if( m_present.test( 31 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedIssuerLen, m_EncodedIssuerLen );
+      if( m_present.test( 32 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedIssuer, m_EncodedIssuer );
+      if( m_present.test( 34 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedSecurityDescLen, m_EncodedSecurityDescLen );
+      if( m_present.test( 35 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedSecurityDesc, m_EncodedSecurityDesc );
+      if( m_present.test( 84 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedTextLen, m_EncodedTextLen );
+      if( m_present.test( 85 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedText, m_EncodedText );
+      if( m_present.test( 46 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ComplianceID, m_ComplianceID );
+      if( m_present.test( 47 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SolicitedFlag, m_SolicitedFlag );
+      if( m_present.test( 13 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecRestatementReason, m_ExecRestatementReason );
+      if( m_present.test( 73 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::GrossTradeAmt, m_GrossTradeAmt );
+      m_NoContraBrokers.write( string, FIX::FIELD::NoContraBrokers );
+      if( m_present.test( 43 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DiscretionInst, m_DiscretionInst );
+      if( m_present.test( 44 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DiscretionOffset, m_DiscretionOffset );
+      if( m_present.test( 64 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DayOrderQty, m_DayOrderQty );
+      if( m_present.test( 65 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DayCumQty, m_DayCumQty );
+      if( m_present.test( 66 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DayAvgPx, m_DayAvgPx );
+      if( m_present.test( 67 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::GTBookingInst, m_GTBookingInst );
+      if( m_present.test( 50 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExpireDate, m_ExpireDate );
+      if( m_present.test( 88 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClearingFirm, m_ClearingFirm );
+      if( m_present.test( 89 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClearingAccount, m_ClearingAccount );
+      if( m_present.test( 90 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MultiLegReportingType, m_MultiLegReportingType );
+    }
+
+  private:
+    FixedHeader m_header;
+    FixedTrailer m_trailer;
+    FIX::FixedPresence< 91 > m_present;
+    std::string m_OrderID;
+    std::string m_SecondaryOrderID;
+    std::string m_ClOrdID;
+    std::string m_OrigClOrdID;
+    std::string m_ClientID;
+    std::string m_ExecBroker;
+    std::string m_ListID;
+    std::string m_ExecID;
+    char m_ExecTransType;
+    std::string m_ExecRefID;
+    char m_ExecType;
+    char m_OrdStatus;
+    int m_OrdRejReason;
+    int m_ExecRestatementReason;
+    std::string m_Account;
+    char m_SettlmntTyp;
+    std::string m_FutSettDate;
+    std::string m_Symbol;
+    std::string m_SymbolSfx;
+    std::string m_SecurityID;
+    std::string m_IDSource;
+    std::string m_SecurityType;
+    std::string m_MaturityMonthYear;
+    int m_MaturityDay;
+    int m_PutOrCall;
+    double m_StrikePrice;
+    char m_OptAttribute;
+    double m_ContractMultiplier;
+    double m_CouponRate;
+    std::string m_SecurityExchange;
+    std::string m_Issuer;
+    int m_EncodedIssuerLen;
+    std::string m_EncodedIssuer;
+    std::string m_SecurityDesc;
+    int m_EncodedSecurityDescLen;
+    std::string m_EncodedSecurityDesc;
+    char m_Side;
+    double m_OrderQty;
+    double m_CashOrderQty;
+    char m_OrdType;
+    double m_Price;
+    double m_StopPx;
+    double m_PegDifference;
+    char m_DiscretionInst;
+    double m_DiscretionOffset;
+    std::string m_Currency;
+    std::string m_ComplianceID;
+    bool m_SolicitedFlag;
+    char m_TimeInForce;
+    FIX::DateTime m_EffectiveTime;
+    bool m_EffectiveTimeMilliseconds;
+    std::string m_ExpireDate;
+    FIX::DateTime m_ExpireTime;
+    bool m_ExpireTimeMilliseconds;
+    std::string m_ExecInst;
+    char m_Rule80A;
+    double m_LastShares;
+    double m_LastPx;
+    double m_LastSpotRate;
+    double m_LastForwardPoints;
+    std::string m_LastMkt;
+    std::string m_TradingSessionID;
+    char m_LastCapacity;
+    double m_LeavesQty;
+    double m_CumQty;
+    double m_AvgPx;
+    double m_DayOrderQty;
+    double m_DayCumQty;
+    double m_DayAvgPx;
+    int m_GTBookingInst;
+    std::string m_TradeDate;
+    FIX::DateTime m_TransactTime;
+    bool m_TransactTimeMilliseconds;
+    bool m_ReportToExch;
+    double m_Commission;
+    char m_CommType;
+    double m_GrossTradeAmt;
+    double m_SettlCurrAmt;
+    std::string m_SettlCurrency;
+    double m_SettlCurrFxRate;
+    char m_SettlCurrFxRateCalc;
+    char m_HandlInst;
+    double m_MinQty;
+    double m_MaxFloor;
+    char m_OpenClose;
+    double m_MaxShow;
+    std::string m_Text;
+    int m_EncodedTextLen;
+    std::string m_EncodedText;
+    std::string m_FutSettDate2;
+    double m_OrderQty2;
+    std::string m_ClearingFirm;
+    std::string m_ClearingAccount;
+    char m_MultiLegReportingType;
+    FIX::FixedGroup< NoContraBrokers, 4 > m_NoContraBrokers;
+  };
+
+}
+
+#endif
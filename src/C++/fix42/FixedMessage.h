@@ -0,0 +1,524 @@
+#ifndef FIX42_FIXEDMESSAGE_H
+#define FIX42_FIXEDMESSAGE_H
+
+#include "../FixedMessage.h"
+
+namespace FIX42
+{
+  class FixedHeader
+  {
+  public:
+    FixedHeader()
+    : m_SecureDataLen(),
+      m_MsgSeqNum(),
+      m_PossDupFlag(),
+      m_PossResend(),
+      m_SendingTime(),
+      m_SendingTimeMilliseconds(),
+      m_OrigSendingTime(),
+      m_OrigSendingTimeMilliseconds(),
+      m_XmlDataLen(),
+      m_LastMsgSeqNumProcessed(),
+      m_OnBehalfOfSendingTime(),
+      m_OnBehalfOfSendingTimeMilliseconds() {}
+
+    bool isSetSenderCompID() const { return m_present.test( 0 ); }
+    const std::string& getSenderCompID() const
+    {
+      if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::SenderCompID );
+      return m_SenderCompID;
+    }
+    void setSenderCompID( const std::string& value )
+    { m_SenderCompID = value; m_present.set( 0 ); }
+    void removeSenderCompID() { m_present.reset( 0 ); }
+
+    bool isSetTargetCompID() const { return m_present.test( 1 ); }
+    const std::string& getTargetCompID() const
+    {
+      if( !m_present.test( 1 ) ) throw FIX::FieldNotFound( FIX::FIELD::TargetCompID );
+      return m_TargetCompID;
+    }
+    void setTargetCompID( const std::string& value )
+    { m_TargetCompID = value; m_present.set( 1 ); }
+    void removeTargetCompID() { m_present.reset( 1 ); }
+
+    bool isSetOnBehalfOfCompID() const { return m_present.test( 2 ); }
+    const std::string& getOnBehalfOfCompID() const
+    {
+      if( !m_present.test( 2 ) ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfCompID );
+      return m_OnBehalfOfCompID;
+    }
+    void setOnBehalfOfCompID( const std::string& value )
+    { m_OnBehalfOfCompID = value; m_present.set( 2 ); }
+    void removeOnBehalfOfCompID() { m_present.reset( 2 ); }
+
+    bool isSetDeliverToCompID() const { return m_present.test( 3 ); }
+    const std::string& getDeliverToCompID() const
+    {
+      if( !m_present.test( 3 ) ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToCompID );
+      return m_DeliverToCompID;
+    }
+    void setDeliverToCompID( const std::string& value )
+    { m_DeliverToCompID = value; m_present.set( 3 ); }
+    void removeDeliverToCompID() { m_present.reset( 3 ); }
+
+    bool isSetSecureDataLen() const { return m_present.test( 4 ); }
+    int getSecureDataLen() const
+    {
+      if( !m_present.test( 4 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecureDataLen );
+      return m_SecureDataLen;
+    }
+    void setSecureDataLen( int value )
+    { m_SecureDataLen = value; m_present.set( 4 ); }
+    void removeSecureDataLen() { m_present.reset( 4 ); }
+
+    bool isSetSecureData() const { return m_present.test( 5 ); }
+    const std::string& getSecureData() const
+    {
+      if( !m_present.test( 5 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecureData );
+      return m_SecureData;
+    }
+    void setSecureData( const std::string& value )
+    { m_SecureData = value; m_present.set( 5 ); }
+    void removeSecureData() { m_present.reset( 5 ); }
+
+    bool isSetMsgSeqNum() const { return m_present.test( 6 ); }
+    int getMsgSeqNum() const
+    {
+      if( !m_present.test( 6 ) ) throw FIX::FieldNotFound( FIX::FIELD::MsgSeqNum );
+      return m_MsgSeqNum;
+    }
+    void setMsgSeqNum( int value )
+    { m_MsgSeqNum = value; m_present.set( 6 ); }
+    void removeMsgSeqNum() { m_present.reset( 6 ); }
+
+    bool isSetSenderSubID() const { return m_present.test( 7 ); }
+    const std::string& getSenderSubID() const
+    {
+      if( !m_present.test( 7 ) ) throw FIX::FieldNotFound( FIX::FIELD::SenderSubID );
+      return m_SenderSubID;
+    }
+    void setSenderSubID( const std::string& value )
+    { m_SenderSubID = value; m_present.set( 7 ); }
+    void removeSenderSubID() { m_present.reset( 7 ); }
+
+    bool isSetSenderLocationID() const { return m_present.test( 8 ); }
+    const std::string& getSenderLocationID() const
+    {
+      if( !m_present.test( 8 ) ) throw FIX::FieldNotFound( FIX::FIELD::SenderLocationID );
+      return m_SenderLocationID;
+    }
+    void setSenderLocationID( const std::string& value )
+    { m_SenderLocationID = value; m_present.set( 8 ); }
+    void removeSenderLocationID() { m_present.reset( 8 ); }
+
+    bool isSetTargetSubID() const { return m_present.test( 9 ); }
+    const std::string& getTargetSubID() const
+    {
+      if( !m_present.test( 9 ) ) throw FIX::FieldNotFound( FIX::FIELD::TargetSubID );
+      return m_TargetSubID;
+    }
+    void setTargetSubID( const std::string& value )
+    { m_TargetSubID = value; m_present.set( 9 ); }
+    void removeTargetSubID() { m_present.reset( 9 ); }
+
+    bool isSetTargetLocationID() const { return m_present.test( 10 ); }
+    const std::string& getTargetLocationID() const
+    {
+      if( !m_present.test( 10 ) ) throw FIX::FieldNotFound( FIX::FIELD::TargetLocationID );
+      return m_TargetLocationID;
+    }
+    void setTargetLocationID( const std::string& value )
+    { m_TargetLocationID = value; m_present.set( 10 ); }
+    void removeTargetLocationID() { m_present.reset( 10 ); }
+
+    bool isSetOnBehalfOfSubID() const { return m_present.test( 11 ); }
+    const std::string& getOnBehalfOfSubID() const
+    {
+      if( !m_present.test( 11 ) ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfSubID );
+      return m_OnBehalfOfSubID;
+    }
+    void setOnBehalfOfSubID( const std::string& value )
+    { m_OnBehalfOfSubID = value; m_present.set( 11 ); }
+    void removeOnBehalfOfSubID() { m_present.reset( 11 ); }
+
+    bool isSetOnBehalfOfLocationID() const { return m_present.test( 12 ); }
+    const std::string& getOnBehalfOfLocationID() const
+    {
+      if( !m_present.test( 12 ) ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfLocationID );
+      return m_OnBehalfOfLocationID;
+    }
+    void setOnBehalfOfLocationID( const std::string& value )
+    { m_OnBehalfOfLocationID = value; m_present.set( 12 ); }
+    void removeOnBehalfOfLocationID() { m_present.reset( 12 ); }
+
+    bool isSetDeliverToSubID() const { return m_present.test( 13 ); }
+    const std::string& getDeliverToSubID() const
+    {
+      if( !m_present.test( 13 ) ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToSubID );
+      return m_DeliverToSubID;
+    }
+    void setDeliverToSubID( const std::string& value )
+    { m_DeliverToSubID = value; m_present.set( 13 ); }
+    void removeDeliverToSubID() { m_present.reset( 13 ); }
+
+    bool isSetDeliverToLocationID() const { return m_present.test( 14 ); }
+    const std::string& getDeliverToLocationID() const
+    {
+      if( !m_present.test( 14 ) ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToLocationID );
+      return m_DeliverToLocationID;
+    }
+    void setDeliverToLocationID( const std::string& value )
+    { m_DeliverToLocationID = value; m_present.set( 14 ); }
+    void removeDeliverToLocationID() { m_present.reset( 14 ); }
+
+    bool isSetPossDupFlag() const { return m_present.test( 15 ); }
+    bool getPossDupFlag() const
+    {
+      if( !m_present.test( 15 ) ) throw FIX::FieldNotFound( FIX::FIELD::PossDupFlag );
+      return m_PossDupFlag;
+    }
+    void setPossDupFlag( bool value )
+    { m_PossDupFlag = value; m_present.set( 15 ); }
+    void removePossDupFlag() { m_present.reset( 15 ); }
+
+    bool isSetPossResend() const { return m_present.test( 16 ); }
+    bool getPossResend() const
+    {
+      if( !m_present.test( 16 ) ) throw FIX::FieldNotFound( FIX::FIELD::PossResend );
+      return m_PossResend;
+    }
+    void setPossResend( bool value )
+    { m_PossResend = value; m_present.set( 16 ); }
+    void removePossResend() { m_present.reset( 16 ); }
+
+    bool isSetSendingTime() const { return m_present.test( 17 ); }
+    FIX::UtcTimeStamp getSendingTime() const
+    {
+      if( !m_present.test( 17 ) ) throw FIX::FieldNotFound( FIX::FIELD::SendingTime );
+      return FIX::UtcTimeStamp( m_SendingTime );
+    }
+    void setSendingTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_SendingTime = value; m_SendingTimeMilliseconds = showMilliseconds; m_present.set( 17 ); }
+    void removeSendingTime() { m_present.reset( 17 ); }
+
+    bool isSetOrigSendingTime() const { return m_present.test( 18 ); }
+    FIX::UtcTimeStamp getOrigSendingTime() const
+    {
+      if( !m_present.test( 18 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrigSendingTime );
+      return FIX::UtcTimeStamp( m_OrigSendingTime );
+    }
+    void setOrigSendingTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_OrigSendingTime = value; m_OrigSendingTimeMilliseconds = showMilliseconds; m_present.set( 18 ); }
+    void removeOrigSendingTime() { m_present.reset( 18 ); }
+
+    bool isSetXmlDataLen() const { return m_present.test( 19 ); }
+    int getXmlDataLen() const
+    {
+      if( !m_present.test( 19 ) ) throw FIX::FieldNotFound( FIX::FIELD::XmlDataLen );
+      return m_XmlDataLen;
+    }
+    void setXmlDataLen( int value )
+    { m_XmlDataLen = value; m_present.set( 19 ); }
+    void removeXmlDataLen() { m_present.reset( 19 ); }
+
+    bool isSetXmlData() const { return m_present.test( 20 ); }
+    const std::string& getXmlData() const
+    {
+      if( !m_present.test( 20 ) ) throw FIX::FieldNotFound( FIX::FIELD::XmlData );
+      return m_XmlData;
+    }
+    void setXmlData( const std::string& value )
+    { m_XmlData = value; m_present.set( 20 ); }
+    void removeXmlData() { m_present.reset( 20 ); }
+
+    bool isSetMessageEncoding() const { return m_present.test( 21 ); }
+    const std::string& getMessageEncoding() const
+    {
+      if( !m_present.test( 21 ) ) throw FIX::FieldNotFound( FIX::FIELD::MessageEncoding );
+      return m_MessageEncoding;
+    }
+    void setMessageEncoding( const std::string& value )
+    { m_MessageEncoding = value; m_present.set( 21 ); }
+    void removeMessageEncoding() { m_present.reset( 21 ); }
+
+    bool isSetLastMsgSeqNumProcessed() const { return m_present.test( 22 ); }
+    int getLastMsgSeqNumProcessed() const
+    {
+      if( !m_present.test( 22 ) ) throw FIX::FieldNotFound( FIX::FIELD::LastMsgSeqNumProcessed );
+      return m_LastMsgSeqNumProcessed;
+    }
+    void setLastMsgSeqNumProcessed( int value )
+    { m_LastMsgSeqNumProcessed = value; m_present.set( 22 ); }
+    void removeLastMsgSeqNumProcessed() { m_present.reset( 22 ); }
+
+    bool isSetOnBehalfOfSendingTime() const { return m_present.test( 23 ); }
+    FIX::UtcTimeStamp getOnBehalfOfSendingTime() const
+    {
+      if( !m_present.test( 23 ) ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfSendingTime );
+      return FIX::UtcTimeStamp( m_OnBehalfOfSendingTime );
+    }
+    void setOnBehalfOfSendingTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_OnBehalfOfSendingTime = value; m_OnBehalfOfSendingTimeMilliseconds = showMilliseconds; m_present.set( 23 ); }
+    void removeOnBehalfOfSendingTime() { m_present.reset( 23 ); }
+
+    void clear()
+    {
+      m_present.clear();
+    }
+
+    bool setField( int tag, FIX::FixedParser& parser )
+    {
+      switch( tag )
+      {
+      case FIX::FIELD::SenderCompID:
+        parser.get( m_SenderCompID );
+        m_present.set( 0 );
+        return true;
+      case FIX::FIELD::TargetCompID:
+        parser.get( m_TargetCompID );
+        m_present.set( 1 );
+        return true;
+      case FIX::FIELD::OnBehalfOfCompID:
+        parser.get( m_OnBehalfOfCompID );
+        m_present.set( 2 );
+        return true;
+      case FIX::FIELD::DeliverToCompID:
+        parser.get( m_DeliverToCompID );
+        m_present.set( 3 );
+        return true;
+      case FIX::FIELD::SecureDataLen:
+        parser.get( m_SecureDataLen );
+        parser.setDataLength( m_SecureDataLen );
+        m_present.set( 4 );
+        return true;
+      case FIX::FIELD::SecureData:
+        parser.get( m_SecureData );
+        m_present.set( 5 );
+        return true;
+      case FIX::FIELD::MsgSeqNum:
+        parser.get( m_MsgSeqNum );
+        m_present.set( 6 );
+        return true;
+      case FIX::FIELD::SenderSubID:
+        parser.get( m_SenderSubID );
+        m_present.set( 7 );
+        return true;
+      case FIX::FIELD::SenderLocationID:
+        parser.get( m_SenderLocationID );
+        m_present.set( 8 );
+        return true;
+      case FIX::FIELD::TargetSubID:
+        parser.get( m_TargetSubID );
+        m_present.set( 9 );
+        return true;
+      case FIX::FIELD::TargetLocationID:
+        parser.get( m_TargetLocationID );
+        m_present.set( 10 );
+        return true;
+      case FIX::FIELD::OnBehalfOfSubID:
+        parser.get( m_OnBehalfOfSubID );
+        m_present.set( 11 );
+        return true;
+      case FIX::FIELD::OnBehalfOfLocationID:
+        parser.get( m_OnBehalfOfLocationID );
+        m_present.set( 12 );
+        return true;
+      case FIX::FIELD::DeliverToSubID:
+        parser.get( m_DeliverToSubID );
+        m_present.set( 13 );
+        return true;
+      case FIX::FIELD::DeliverToLocationID:
+        parser.get( m_DeliverToLocationID );
+        m_present.set( 14 );
+        return true;
+      case FIX::FIELD::PossDupFlag:
+        parser.get( m_PossDupFlag );
+        m_present.set( 15 );
+        return true;
+      case FIX::FIELD::PossResend:
+        parser.get( m_PossResend );
+        m_present.set( 16 );
+        return true;
+      case FIX::FIELD::SendingTime:
+        parser.get( m_SendingTime, m_SendingTimeMilliseconds );
+        m_present.set( 17 );
+        return true;
+      case FIX::FIELD::OrigSendingTime:
+        parser.get( m_OrigSendingTime, m_OrigSendingTimeMilliseconds );
+        m_present.set( 18 );
+        return true;
+      case FIX::FIELD::XmlDataLen:
+        parser.get( m_XmlDataLen );
+        parser.setDataLength( m_XmlDataLen );
+        m_present.set( 19 );
+        return true;
+      case FIX::FIELD::XmlData:
+        parser.get( m_XmlData );
+        m_present.set( 20 );
+        return true;
+      case FIX::FIELD::MessageEncoding:
+        parser.get( m_MessageEncoding );
+        m_present.set( 21 );
+        return true;
+      case FIX::FIELD::LastMsgSeqNumProcessed:
+        parser.get( m_LastMsgSeqNumProcessed );
+        m_present.set( 22 );
+        return true;
+      case FIX::FIELD::OnBehalfOfSendingTime:
+        parser.get( m_OnBehalfOfSendingTime, m_OnBehalfOfSendingTimeMilliseconds );
+        m_present.set( 23 );
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    void write( std::string& string ) const
+    {
+      if( m_present.test( 6 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MsgSeqNum, m_MsgSeqNum );
+      if( m_present.test( 15 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PossDupFlag, m_PossDupFlag );
+      if( m_present.test( 0 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SenderCompID, m_SenderCompID );
+      if( m_present.test( 7 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SenderSubID, m_SenderSubID );
+      if( m_present.test( 17 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SendingTime, m_SendingTime, m_SendingTimeMilliseconds );
+      if( m_present.test( 1 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TargetCompID, m_TargetCompID );
+      if( m_present.test( 9 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TargetSubID, m_TargetSubID );
+      if( m_present.test( 4 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecureDataLen, m_SecureDataLen );
+      if( m_present.test( 5 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecureData, m_SecureData );
+      if( m_present.test( 16 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PossResend, m_PossResend );
+      if( m_present.test( 2 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OnBehalfOfCompID, m_OnBehalfOfCompID );
+      if( m_present.test( 11 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OnBehalfOfSubID, m_OnBehalfOfSubID );
+      if( m_present.test( 18 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrigSendingTime, m_OrigSendingTime, m_OrigSendingTimeMilliseconds );
+      if( m_present.test( 3 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DeliverToCompID, m_DeliverToCompID );
+      if( m_present.test( 13 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DeliverToSubID, m_DeliverToSubID );
+      if( m_present.test( 8 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SenderLocationID, m_SenderLocationID );
+      if( m_present.test( 10 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TargetLocationID, m_TargetLocationID );
+      if( m_present.test( 12 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OnBehalfOfLocationID, m_OnBehalfOfLocationID );
+      if( m_present.test( 14 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DeliverToLocationID, m_DeliverToLocationID );
+      if( m_present.test( 19 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::XmlDataLen, m_XmlDataLen );
+      if( m_present.test( 20 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::XmlData, m_XmlData );
+      if( m_present.test( 21 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MessageEncoding, m_MessageEncoding );
+      if( m_present.test( 22 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LastMsgSeqNumProcessed, m_LastMsgSeqNumProcessed );
+      if( m_present.test( 23 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OnBehalfOfSendingTime, m_OnBehalfOfSendingTime, m_OnBehalfOfSendingTimeMilliseconds );
+    }
+
+  private:
+    FIX::FixedPresence< 24 > m_present;
+    std::string m_SenderCompID;
+    std::string m_TargetCompID;
+    std::string m_OnBehalfOfCompID;
+    std::string m_DeliverToCompID;
+    int m_SecureDataLen;
+    std::string m_SecureData;
+    int m_MsgSeqNum;
+    std::string m_SenderSubID;
+    std::string m_SenderLocationID;
+    std::string m_TargetSubID;
+    std::string m_TargetLocationID;
+    std::string m_OnBehalfOfSubID;
+    std::string m_OnBehalfOfLocationID;
+    std::string m_DeliverToSubID;
+    std::string m_DeliverToLocationID;
+    bool m_PossDupFlag;
+    bool m_PossResend;
+    FIX::DateTime m_SendingTime;
+    bool m_SendingTimeMilliseconds;
+    FIX::DateTime m_OrigSendingTime;
+    bool m_OrigSendingTimeMilliseconds;
+    int m_XmlDataLen;
+    std::string m_XmlData;
+    std::string m_MessageEncoding;
+    int m_LastMsgSeqNumProcessed;
+    FIX::DateTime m_OnBehalfOfSendingTime;
+    bool m_OnBehalfOfSendingTimeMilliseconds;
+  };
+
+  class FixedTrailer
+  {
+  public:
+    FixedTrailer()
+    : m_SignatureLength() {}
+
+    bool isSetSignatureLength() const { return m_present.test( 0 ); }
+    int getSignatureLength() const
+    {
+      if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::SignatureLength );
+      return m_SignatureLength;
+    }
+    void setSignatureLength( int value )
+    { m_SignatureLength = value; m_present.set( 0 ); }
+    void removeSignatureLength() { m_present.reset( 0 ); }
+
+    bool isSetSignature() const { return m_present.test( 1 ); }
+    const std::string& getSignature() const
+    {
+      if( !m_present.test( 1 ) ) throw FIX::FieldNotFound( FIX::FIELD::Signature );
+      return m_Signature;
+    }
+    void setSignature( const std::string& value )
+    { m_Signature = value; m_present.set( 1 ); }
+    void removeSignature() { m_present.reset( 1 ); }
+
+    void clear()
+    {
+      m_present.clear();
+    }
+
+    bool setField( int tag, FIX::FixedParser& parser )
+    {
+      switch( tag )
+      {
+      case FIX::FIELD::SignatureLength:
+        parser.get( m_SignatureLength );
+        parser.setDataLength( m_SignatureLength );
+        m_present.set( 0 );
+        return true;
+      case FIX::FIELD::Signature:
+        parser.get( m_Signature );
+        m_present.set( 1 );
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    void write( std::string& string ) const
+    {
+      if( m_present.test( 1 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Signature, m_Signature );
+      if( m_present.test( 0 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SignatureLength, m_SignatureLength );
+    }
+
+  private:
+    FIX::FixedPresence< 2 > m_present;
+    int m_SignatureLength;
+    std::string m_Signature;
+  };
+}
+
+#endif
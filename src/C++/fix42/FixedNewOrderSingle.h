@@ -0,0 +1,1438 @@
+#ifndef FIX42_FIXEDNEWORDERSINGLE_H
+#define FIX42_FIXEDNEWORDERSINGLE_H
+
+#include "FixedMessage.h"
+
+namespace FIX42
+{
+
+  class FixedNewOrderSingle
+  {
+  public:
+    class NoAllocs
+    {
+    public:
+      NoAllocs()
+      : m_AllocShares() {}
+
+      bool isSetAllocAccount() const { return m_present.test( 0 ); }
+      const std::string& getAllocAccount() const
+      {
+        if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::AllocAccount );
+        return m_AllocAccount;
+      }
+      void setAllocAccount( const std::string& value )
+      { m_AllocAccount = value; m_present.set( 0 ); }
+      void removeAllocAccount() { m_present.reset( 0 ); }
+
+      bool isSetAllocShares() const { return m_present.test( 1 ); }
+      double getAllocShares() const
+      {
+        if( !m_present.test( 1 ) ) throw FIX::FieldNotFound( FIX::FIELD::AllocShares );
+        return m_AllocShares;
+      }
+      void setAllocShares( double value )
+      { m_AllocShares = value; m_present.set( 1 ); }
+      void removeAllocShares() { m_present.reset( 1 ); }
+
+      void clear()
+      {
+        m_present.clear();
+      }
+
+      bool setField( int tag, FIX::FixedParser& parser )
+      {
+        switch( tag )
+        {
+        case FIX::FIELD::AllocAccount:
+          parser.get( m_AllocAccount );
+          m_present.set( 0 );
+          return true;
+        case FIX::FIELD::AllocShares:
+          parser.get( m_AllocShares );
+          m_present.set( 1 );
+          return true;
+        default:
+          return false;
+        }
+      }
+
+      void write( std::string& string ) const
+      {
+        if( m_present.test( 0 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::AllocAccount, m_AllocAccount );
+        if( m_present.test( 1 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::AllocShares, m_AllocShares );
+      }
+
+    private:
+      FIX::FixedPresence< 2 > m_present;
+      std::string m_AllocAccount;
+      double m_AllocShares;
+    };
+
+    class NoTradingSessions
+    {
+    public:
+      NoTradingSessions() {}
+
+      bool isSetTradingSessionID() const { return m_present.test( 0 ); }
+      const std::string& getTradingSessionID() const
+      {
+        if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::TradingSessionID );
+        return m_TradingSessionID;
+      }
+      void setTradingSessionID( const std::string& value )
+      { m_TradingSessionID = value; m_present.set( 0 ); }
+      void removeTradingSessionID() { m_present.reset( 0 ); }
+
+      void clear()
+      {
+        m_present.clear();
+      }
+
+      bool setField( int tag, FIX::FixedParser& parser )
+      {
+        switch( tag )
+        {
+        case FIX::FIELD::TradingSessionID:
+          parser.get( m_TradingSessionID );
+          m_present.set( 0 );
+          return true;
+        default:
+          return false;
+        }
+      }
+
+      void write( std::string& string ) const
+      {
+        if( m_present.test( 0 ) )
+          FIX::FixedWriter::field( string, FIX::FIELD::TradingSessionID, m_TradingSessionID );
+      }
+
+    private:
+      FIX::FixedPresence< 1 > m_present;
+      std::string m_TradingSessionID;
+    };
+
+    FixedNewOrderSingle()
+    : m_SettlmntTyp(),
+      m_HandlInst(),
+      m_MinQty(),
+      m_MaxFloor(),
+      m_ProcessCode(),
+      m_MaturityDay(),
+      m_PutOrCall(),
+      m_StrikePrice(),
+      m_OptAttribute(),
+      m_ContractMultiplier(),
+      m_CouponRate(),
+      m_EncodedIssuerLen(),
+      m_EncodedSecurityDescLen(),
+      m_PrevClosePx(),
+      m_Side(),
+      m_LocateReqd(),
+      m_TransactTime(),
+      m_TransactTimeMilliseconds(),
+      m_OrderQty(),
+      m_CashOrderQty(),
+      m_OrdType(),
+      m_Price(),
+      m_StopPx(),
+      m_SolicitedFlag(),
+      m_TimeInForce(),
+      m_EffectiveTime(),
+      m_EffectiveTimeMilliseconds(),
+      m_ExpireTime(),
+      m_ExpireTimeMilliseconds(),
+      m_GTBookingInst(),
+      m_Commission(),
+      m_CommType(),
+      m_Rule80A(),
+      m_ForexReq(),
+      m_EncodedTextLen(),
+      m_OrderQty2(),
+      m_OpenClose(),
+      m_CoveredOrUncovered(),
+      m_CustomerOrFirm(),
+      m_MaxShow(),
+      m_PegDifference(),
+      m_DiscretionInst(),
+      m_DiscretionOffset() {}
+    static FIX::MsgType MsgType() { return FIX::MsgType("D"); }
+
+    FixedHeader& getHeader() { return m_header; }
+    const FixedHeader& getHeader() const { return m_header; }
+    FixedTrailer& getTrailer() { return m_trailer; }
+    const FixedTrailer& getTrailer() const { return m_trailer; }
+
+    bool isSetClOrdID() const { return m_present.test( 0 ); }
+    const std::string& getClOrdID() const
+    {
+      if( !m_present.test( 0 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClOrdID );
+      return m_ClOrdID;
+    }
+    void setClOrdID( const std::string& value )
+    { m_ClOrdID = value; m_present.set( 0 ); }
+    void removeClOrdID() { m_present.reset( 0 ); }
+
+    bool isSetClientID() const { return m_present.test( 1 ); }
+    const std::string& getClientID() const
+    {
+      if( !m_present.test( 1 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClientID );
+      return m_ClientID;
+    }
+    void setClientID( const std::string& value )
+    { m_ClientID = value; m_present.set( 1 ); }
+    void removeClientID() { m_present.reset( 1 ); }
+
+    bool isSetExecBroker() const { return m_present.test( 2 ); }
+    const std::string& getExecBroker() const
+    {
+      if( !m_present.test( 2 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecBroker );
+      return m_ExecBroker;
+    }
+    void setExecBroker( const std::string& value )
+    { m_ExecBroker = value; m_present.set( 2 ); }
+    void removeExecBroker() { m_present.reset( 2 ); }
+
+    bool isSetAccount() const { return m_present.test( 3 ); }
+    const std::string& getAccount() const
+    {
+      if( !m_present.test( 3 ) ) throw FIX::FieldNotFound( FIX::FIELD::Account );
+      return m_Account;
+    }
+    void setAccount( const std::string& value )
+    { m_Account = value; m_present.set( 3 ); }
+    void removeAccount() { m_present.reset( 3 ); }
+
+    bool isSetSettlmntTyp() const { return m_present.test( 4 ); }
+    char getSettlmntTyp() const
+    {
+      if( !m_present.test( 4 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlmntTyp );
+      return m_SettlmntTyp;
+    }
+    void setSettlmntTyp( char value )
+    { m_SettlmntTyp = value; m_present.set( 4 ); }
+    void removeSettlmntTyp() { m_present.reset( 4 ); }
+
+    bool isSetFutSettDate() const { return m_present.test( 5 ); }
+    const std::string& getFutSettDate() const
+    {
+      if( !m_present.test( 5 ) ) throw FIX::FieldNotFound( FIX::FIELD::FutSettDate );
+      return m_FutSettDate;
+    }
+    void setFutSettDate( const std::string& value )
+    { m_FutSettDate = value; m_present.set( 5 ); }
+    void removeFutSettDate() { m_present.reset( 5 ); }
+
+    bool isSetHandlInst() const { return m_present.test( 6 ); }
+    char getHandlInst() const
+    {
+      if( !m_present.test( 6 ) ) throw FIX::FieldNotFound( FIX::FIELD::HandlInst );
+      return m_HandlInst;
+    }
+    void setHandlInst( char value )
+    { m_HandlInst = value; m_present.set( 6 ); }
+    void removeHandlInst() { m_present.reset( 6 ); }
+
+    bool isSetExecInst() const { return m_present.test( 7 ); }
+    const std::string& getExecInst() const
+    {
+      if( !m_present.test( 7 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExecInst );
+      return m_ExecInst;
+    }
+    void setExecInst( const std::string& value )
+    { m_ExecInst = value; m_present.set( 7 ); }
+    void removeExecInst() { m_present.reset( 7 ); }
+
+    bool isSetMinQty() const { return m_present.test( 8 ); }
+    double getMinQty() const
+    {
+      if( !m_present.test( 8 ) ) throw FIX::FieldNotFound( FIX::FIELD::MinQty );
+      return m_MinQty;
+    }
+    void setMinQty( double value )
+    { m_MinQty = value; m_present.set( 8 ); }
+    void removeMinQty() { m_present.reset( 8 ); }
+
+    bool isSetMaxFloor() const { return m_present.test( 9 ); }
+    double getMaxFloor() const
+    {
+      if( !m_present.test( 9 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaxFloor );
+      return m_MaxFloor;
+    }
+    void setMaxFloor( double value )
+    { m_MaxFloor = value; m_present.set( 9 ); }
+    void removeMaxFloor() { m_present.reset( 9 ); }
+
+    bool isSetExDestination() const { return m_present.test( 10 ); }
+    const std::string& getExDestination() const
+    {
+      if( !m_present.test( 10 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExDestination );
+      return m_ExDestination;
+    }
+    void setExDestination( const std::string& value )
+    { m_ExDestination = value; m_present.set( 10 ); }
+    void removeExDestination() { m_present.reset( 10 ); }
+
+    bool isSetProcessCode() const { return m_present.test( 11 ); }
+    char getProcessCode() const
+    {
+      if( !m_present.test( 11 ) ) throw FIX::FieldNotFound( FIX::FIELD::ProcessCode );
+      return m_ProcessCode;
+    }
+    void setProcessCode( char value )
+    { m_ProcessCode = value; m_present.set( 11 ); }
+    void removeProcessCode() { m_present.reset( 11 ); }
+
+    bool isSetSymbol() const { return m_present.test( 12 ); }
+    const std::string& getSymbol() const
+    {
+      if( !m_present.test( 12 ) ) throw FIX::FieldNotFound( FIX::FIELD::Symbol );
+      return m_Symbol;
+    }
+    void setSymbol( const std::string& value )
+    { m_Symbol = value; m_present.set( 12 ); }
+    void removeSymbol() { m_present.reset( 12 ); }
+
+    bool isSetSymbolSfx() const { return m_present.test( 13 ); }
+    const std::string& getSymbolSfx() const
+    {
+      if( !m_present.test( 13 ) ) throw FIX::FieldNotFound( FIX::FIELD::SymbolSfx );
+      return m_SymbolSfx;
+    }
+    void setSymbolSfx( const std::string& value )
+    { m_SymbolSfx = value; m_present.set( 13 ); }
+    void removeSymbolSfx() { m_present.reset( 13 ); }
+
+    bool isSetSecurityID() const { return m_present.test( 14 ); }
+    const std::string& getSecurityID() const
+    {
+      if( !m_present.test( 14 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityID );
+      return m_SecurityID;
+    }
+    void setSecurityID( const std::string& value )
+    { m_SecurityID = value; m_present.set( 14 ); }
+    void removeSecurityID() { m_present.reset( 14 ); }
+
+    bool isSetIDSource() const { return m_present.test( 15 ); }
+    const std::string& getIDSource() const
+    {
+      if( !m_present.test( 15 ) ) throw FIX::FieldNotFound( FIX::FIELD::IDSource );
+      return m_IDSource;
+    }
+    void setIDSource( const std::string& value )
+    { m_IDSource = value; m_present.set( 15 ); }
+    void removeIDSource() { m_present.reset( 15 ); }
+
+    bool isSetSecurityType() const { return m_present.test( 16 ); }
+    const std::string& getSecurityType() const
+    {
+      if( !m_present.test( 16 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityType );
+      return m_SecurityType;
+    }
+    void setSecurityType( const std::string& value )
+    { m_SecurityType = value; m_present.set( 16 ); }
+    void removeSecurityType() { m_present.reset( 16 ); }
+
+    bool isSetMaturityMonthYear() const { return m_present.test( 17 ); }
+    const std::string& getMaturityMonthYear() const
+    {
+      if( !m_present.test( 17 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaturityMonthYear );
+      return m_MaturityMonthYear;
+    }
+    void setMaturityMonthYear( const std::string& value )
+    { m_MaturityMonthYear = value; m_present.set( 17 ); }
+    void removeMaturityMonthYear() { m_present.reset( 17 ); }
+
+    bool isSetMaturityDay() const { return m_present.test( 18 ); }
+    int getMaturityDay() const
+    {
+      if( !m_present.test( 18 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaturityDay );
+      return m_MaturityDay;
+    }
+    void setMaturityDay( int value )
+    { m_MaturityDay = value; m_present.set( 18 ); }
+    void removeMaturityDay() { m_present.reset( 18 ); }
+
+    bool isSetPutOrCall() const { return m_present.test( 19 ); }
+    int getPutOrCall() const
+    {
+      if( !m_present.test( 19 ) ) throw FIX::FieldNotFound( FIX::FIELD::PutOrCall );
+      return m_PutOrCall;
+    }
+    void setPutOrCall( int value )
+    { m_PutOrCall = value; m_present.set( 19 ); }
+    void removePutOrCall() { m_present.reset( 19 ); }
+
+    bool isSetStrikePrice() const { return m_present.test( 20 ); }
+    double getStrikePrice() const
+    {
+      if( !m_present.test( 20 ) ) throw FIX::FieldNotFound( FIX::FIELD::StrikePrice );
+      return m_StrikePrice;
+    }
+    void setStrikePrice( double value )
+    { m_StrikePrice = value; m_present.set( 20 ); }
+    void removeStrikePrice() { m_present.reset( 20 ); }
+
+    bool isSetOptAttribute() const { return m_present.test( 21 ); }
+    char getOptAttribute() const
+    {
+      if( !m_present.test( 21 ) ) throw FIX::FieldNotFound( FIX::FIELD::OptAttribute );
+      return m_OptAttribute;
+    }
+    void setOptAttribute( char value )
+    { m_OptAttribute = value; m_present.set( 21 ); }
+    void removeOptAttribute() { m_present.reset( 21 ); }
+
+    bool isSetContractMultiplier() const { return m_present.test( 22 ); }
+    double getContractMultiplier() const
+    {
+      if( !m_present.test( 22 ) ) throw FIX::FieldNotFound( FIX::FIELD::ContractMultiplier );
+      return m_ContractMultiplier;
+    }
+    void setContractMultiplier( double value )
+    { m_ContractMultiplier = value; m_present.set( 22 ); }
+    void removeContractMultiplier() { m_present.reset( 22 ); }
+
+    bool isSetCouponRate() const { return m_present.test( 23 ); }
+    double getCouponRate() const
+    {
+      if( !m_present.test( 23 ) ) throw FIX::FieldNotFound( FIX::FIELD::CouponRate );
+      return m_CouponRate;
+    }
+    void setCouponRate( double value )
+    { m_CouponRate = value; m_present.set( 23 ); }
+    void removeCouponRate() { m_present.reset( 23 ); }
+
+    bool isSetSecurityExchange() const { return m_present.test( 24 ); }
+    const std::string& getSecurityExchange() const
+    {
+      if( !m_present.test( 24 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityExchange );
+      return m_SecurityExchange;
+    }
+    void setSecurityExchange( const std::string& value )
+    { m_SecurityExchange = value; m_present.set( 24 ); }
+    void removeSecurityExchange() { m_present.reset( 24 ); }
+
+    bool isSetIssuer() const { return m_present.test( 25 ); }
+    const std::string& getIssuer() const
+    {
+      if( !m_present.test( 25 ) ) throw FIX::FieldNotFound( FIX::FIELD::Issuer );
+      return m_Issuer;
+    }
+    void setIssuer( const std::string& value )
+    { m_Issuer = value; m_present.set( 25 ); }
+    void removeIssuer() { m_present.reset( 25 ); }
+
+    bool isSetEncodedIssuerLen() const { return m_present.test( 26 ); }
+    int getEncodedIssuerLen() const
+    {
+      if( !m_present.test( 26 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuerLen );
+      return m_EncodedIssuerLen;
+    }
+    void setEncodedIssuerLen( int value )
+    { m_EncodedIssuerLen = value; m_present.set( 26 ); }
+    void removeEncodedIssuerLen() { m_present.reset( 26 ); }
+
+    bool isSetEncodedIssuer() const { return m_present.test( 27 ); }
+    const std::string& getEncodedIssuer() const
+    {
+      if( !m_present.test( 27 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuer );
+      return m_EncodedIssuer;
+    }
+    void setEncodedIssuer( const std::string& value )
+    { m_EncodedIssuer = value; m_present.set( 27 ); }
+    void removeEncodedIssuer() { m_present.reset( 27 ); }
+
+    bool isSetSecurityDesc() const { return m_present.test( 28 ); }
+    const std::string& getSecurityDesc() const
+    {
+      if( !m_present.test( 28 ) ) throw FIX::FieldNotFound( FIX::FIELD::SecurityDesc );
+      return m_SecurityDesc;
+    }
+    void setSecurityDesc( const std::string& value )
+    { m_SecurityDesc = value; m_present.set( 28 ); }
+    void removeSecurityDesc() { m_present.reset( 28 ); }
+
+    bool isSetEncodedSecurityDescLen() const { return m_present.test( 29 ); }
+    int getEncodedSecurityDescLen() const
+    {
+      if( !m_present.test( 29 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDescLen );
+      return m_EncodedSecurityDescLen;
+    }
+    void setEncodedSecurityDescLen( int value )
+    { m_EncodedSecurityDescLen = value; m_present.set( 29 ); }
+    void removeEncodedSecurityDescLen() { m_present.reset( 29 ); }
+
+    bool isSetEncodedSecurityDesc() const { return m_present.test( 30 ); }
+    const std::string& getEncodedSecurityDesc() const
+    {
+      if( !m_present.test( 30 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDesc );
+      return m_EncodedSecurityDesc;
+    }
+    void setEncodedSecurityDesc( const std::string& value )
+    { m_EncodedSecurityDesc = value; m_present.set( 30 ); }
+    void removeEncodedSecurityDesc() { m_present.reset( 30 ); }
+
+    bool isSetPrevClosePx() const { return m_present.test( 31 ); }
+    double getPrevClosePx() const
+    {
+      if( !m_present.test( 31 ) ) throw FIX::FieldNotFound( FIX::FIELD::PrevClosePx );
+      return m_PrevClosePx;
+    }
+    void setPrevClosePx( double value )
+    { m_PrevClosePx = value; m_present.set( 31 ); }
+    void removePrevClosePx() { m_present.reset( 31 ); }
+
+    bool isSetSide() const { return m_present.test( 32 ); }
+    char getSide() const
+    {
+      if( !m_present.test( 32 ) ) throw FIX::FieldNotFound( FIX::FIELD::Side );
+      return m_Side;
+    }
+    void setSide( char value )
+    { m_Side = value; m_present.set( 32 ); }
+    void removeSide() { m_present.reset( 32 ); }
+
+    bool isSetLocateReqd() const { return m_present.test( 33 ); }
+    bool getLocateReqd() const
+    {
+      if( !m_present.test( 33 ) ) throw FIX::FieldNotFound( FIX::FIELD::LocateReqd );
+      return m_LocateReqd;
+    }
+    void setLocateReqd( bool value )
+    { m_LocateReqd = value; m_present.set( 33 ); }
+    void removeLocateReqd() { m_present.reset( 33 ); }
+
+    bool isSetTransactTime() const { return m_present.test( 34 ); }
+    FIX::UtcTimeStamp getTransactTime() const
+    {
+      if( !m_present.test( 34 ) ) throw FIX::FieldNotFound( FIX::FIELD::TransactTime );
+      return FIX::UtcTimeStamp( m_TransactTime );
+    }
+    void setTransactTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_TransactTime = value; m_TransactTimeMilliseconds = showMilliseconds; m_present.set( 34 ); }
+    void removeTransactTime() { m_present.reset( 34 ); }
+
+    bool isSetOrderQty() const { return m_present.test( 35 ); }
+    double getOrderQty() const
+    {
+      if( !m_present.test( 35 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrderQty );
+      return m_OrderQty;
+    }
+    void setOrderQty( double value )
+    { m_OrderQty = value; m_present.set( 35 ); }
+    void removeOrderQty() { m_present.reset( 35 ); }
+
+    bool isSetCashOrderQty() const { return m_present.test( 36 ); }
+    double getCashOrderQty() const
+    {
+      if( !m_present.test( 36 ) ) throw FIX::FieldNotFound( FIX::FIELD::CashOrderQty );
+      return m_CashOrderQty;
+    }
+    void setCashOrderQty( double value )
+    { m_CashOrderQty = value; m_present.set( 36 ); }
+    void removeCashOrderQty() { m_present.reset( 36 ); }
+
+    bool isSetOrdType() const { return m_present.test( 37 ); }
+    char getOrdType() const
+    {
+      if( !m_present.test( 37 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrdType );
+      return m_OrdType;
+    }
+    void setOrdType( char value )
+    { m_OrdType = value; m_present.set( 37 ); }
+    void removeOrdType() { m_present.reset( 37 ); }
+
+    bool isSetPrice() const { return m_present.test( 38 ); }
+    double getPrice() const
+    {
+      if( !m_present.test( 38 ) ) throw FIX::FieldNotFound( FIX::FIELD::Price );
+      return m_Price;
+    }
+    void setPrice( double value )
+    { m_Price = value; m_present.set( 38 ); }
+    void removePrice() { m_present.reset( 38 ); }
+
+    bool isSetStopPx() const { return m_present.test( 39 ); }
+    double getStopPx() const
+    {
+      if( !m_present.test( 39 ) ) throw FIX::FieldNotFound( FIX::FIELD::StopPx );
+      return m_StopPx;
+    }
+    void setStopPx( double value )
+    { m_StopPx = value; m_present.set( 39 ); }
+    void removeStopPx() { m_present.reset( 39 ); }
+
+    bool isSetCurrency() const { return m_present.test( 40 ); }
+    const std::string& getCurrency() const
+    {
+      if( !m_present.test( 40 ) ) throw FIX::FieldNotFound( FIX::FIELD::Currency );
+      return m_Currency;
+    }
+    void setCurrency( const std::string& value )
+    { m_Currency = value; m_present.set( 40 ); }
+    void removeCurrency() { m_present.reset( 40 ); }
+
+    bool isSetComplianceID() const { return m_present.test( 41 ); }
+    const std::string& getComplianceID() const
+    {
+      if( !m_present.test( 41 ) ) throw FIX::FieldNotFound( FIX::FIELD::ComplianceID );
+      return m_ComplianceID;
+    }
+    void setComplianceID( const std::string& value )
+    { m_ComplianceID = value; m_present.set( 41 ); }
+    void removeComplianceID() { m_present.reset( 41 ); }
+
+    bool isSetSolicitedFlag() const { return m_present.test( 42 ); }
+    bool getSolicitedFlag() const
+    {
+      if( !m_present.test( 42 ) ) throw FIX::FieldNotFound( FIX::FIELD::SolicitedFlag );
+      return m_SolicitedFlag;
+    }
+    void setSolicitedFlag( bool value )
+    { m_SolicitedFlag = value; m_present.set( 42 ); }
+    void removeSolicitedFlag() { m_present.reset( 42 ); }
+
+    bool isSetIOIid() const { return m_present.test( 43 ); }
+    const std::string& getIOIid() const
+    {
+      if( !m_present.test( 43 ) ) throw FIX::FieldNotFound( FIX::FIELD::IOIid );
+      return m_IOIid;
+    }
+    void setIOIid( const std::string& value )
+    { m_IOIid = value; m_present.set( 43 ); }
+    void removeIOIid() { m_present.reset( 43 ); }
+
+    bool isSetQuoteID() const { return m_present.test( 44 ); }
+    const std::string& getQuoteID() const
+    {
+      if( !m_present.test( 44 ) ) throw FIX::FieldNotFound( FIX::FIELD::QuoteID );
+      return m_QuoteID;
+    }
+    void setQuoteID( const std::string& value )
+    { m_QuoteID = value; m_present.set( 44 ); }
+    void removeQuoteID() { m_present.reset( 44 ); }
+
+    bool isSetTimeInForce() const { return m_present.test( 45 ); }
+    char getTimeInForce() const
+    {
+      if( !m_present.test( 45 ) ) throw FIX::FieldNotFound( FIX::FIELD::TimeInForce );
+      return m_TimeInForce;
+    }
+    void setTimeInForce( char value )
+    { m_TimeInForce = value; m_present.set( 45 ); }
+    void removeTimeInForce() { m_present.reset( 45 ); }
+
+    bool isSetEffectiveTime() const { return m_present.test( 46 ); }
+    FIX::UtcTimeStamp getEffectiveTime() const
+    {
+      if( !m_present.test( 46 ) ) throw FIX::FieldNotFound( FIX::FIELD::EffectiveTime );
+      return FIX::UtcTimeStamp( m_EffectiveTime );
+    }
+    void setEffectiveTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_EffectiveTime = value; m_EffectiveTimeMilliseconds = showMilliseconds; m_present.set( 46 ); }
+    void removeEffectiveTime() { m_present.reset( 46 ); }
+
+    bool isSetExpireDate() const { return m_present.test( 47 ); }
+    const std::string& getExpireDate() const
+    {
+      if( !m_present.test( 47 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExpireDate );
+      return m_ExpireDate;
+    }
+    void setExpireDate( const std::string& value )
+    { m_ExpireDate = value; m_present.set( 47 ); }
+    void removeExpireDate() { m_present.reset( 47 ); }
+
+    bool isSetExpireTime() const { return m_present.test( 48 ); }
+    FIX::UtcTimeStamp getExpireTime() const
+    {
+      if( !m_present.test( 48 ) ) throw FIX::FieldNotFound( FIX::FIELD::ExpireTime );
+      return FIX::UtcTimeStamp( m_ExpireTime );
+    }
+    void setExpireTime( const FIX::UtcTimeStamp& value, bool showMilliseconds = false )
+    { m_ExpireTime = value; m_ExpireTimeMilliseconds = showMilliseconds; m_present.set( 48 ); }
+    void removeExpireTime() { m_present.reset( 48 ); }
+
+    bool isSetGTBookingInst() const { return m_present.test( 49 ); }
+    int getGTBookingInst() const
+    {
+      if( !m_present.test( 49 ) ) throw FIX::FieldNotFound( FIX::FIELD::GTBookingInst );
+      return m_GTBookingInst;
+    }
+    void setGTBookingInst( int value )
+    { m_GTBookingInst = value; m_present.set( 49 ); }
+    void removeGTBookingInst() { m_present.reset( 49 ); }
+
+    bool isSetCommission() const { return m_present.test( 50 ); }
+    double getCommission() const
+    {
+      if( !m_present.test( 50 ) ) throw FIX::FieldNotFound( FIX::FIELD::Commission );
+      return m_Commission;
+    }
+    void setCommission( double value )
+    { m_Commission = value; m_present.set( 50 ); }
+    void removeCommission() { m_present.reset( 50 ); }
+
+    bool isSetCommType() const { return m_present.test( 51 ); }
+    char getCommType() const
+    {
+      if( !m_present.test( 51 ) ) throw FIX::FieldNotFound( FIX::FIELD::CommType );
+      return m_CommType;
+    }
+    void setCommType( char value )
+    { m_CommType = value; m_present.set( 51 ); }
+    void removeCommType() { m_present.reset( 51 ); }
+
+    bool isSetRule80A() const { return m_present.test( 52 ); }
+    char getRule80A() const
+    {
+      if( !m_present.test( 52 ) ) throw FIX::FieldNotFound( FIX::FIELD::Rule80A );
+      return m_Rule80A;
+    }
+    void setRule80A( char value )
+    { m_Rule80A = value; m_present.set( 52 ); }
+    void removeRule80A() { m_present.reset( 52 ); }
+
+    bool isSetForexReq() const { return m_present.test( 53 ); }
+    bool getForexReq() const
+    {
+      if( !m_present.test( 53 ) ) throw FIX::FieldNotFound( FIX::FIELD::ForexReq );
+      return m_ForexReq;
+    }
+    void setForexReq( bool value )
+    { m_ForexReq = value; m_present.set( 53 ); }
+    void removeForexReq() { m_present.reset( 53 ); }
+
+    bool isSetSettlCurrency() const { return m_present.test( 54 ); }
+    const std::string& getSettlCurrency() const
+    {
+      if( !m_present.test( 54 ) ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrency );
+      return m_SettlCurrency;
+    }
+    void setSettlCurrency( const std::string& value )
+    { m_SettlCurrency = value; m_present.set( 54 ); }
+    void removeSettlCurrency() { m_present.reset( 54 ); }
+
+    bool isSetText() const { return m_present.test( 55 ); }
+    const std::string& getText() const
+    {
+      if( !m_present.test( 55 ) ) throw FIX::FieldNotFound( FIX::FIELD::Text );
+      return m_Text;
+    }
+    void setText( const std::string& value )
+    { m_Text = value; m_present.set( 55 ); }
+    void removeText() { m_present.reset( 55 ); }
+
+    bool isSetEncodedTextLen() const { return m_present.test( 56 ); }
+    int getEncodedTextLen() const
+    {
+      if( !m_present.test( 56 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedTextLen );
+      return m_EncodedTextLen;
+    }
+    void setEncodedTextLen( int value )
+    { m_EncodedTextLen = value; m_present.set( 56 ); }
+    void removeEncodedTextLen() { m_present.reset( 56 ); }
+
+    bool isSetEncodedText() const { return m_present.test( 57 ); }
+    const std::string& getEncodedText() const
+    {
+      if( !m_present.test( 57 ) ) throw FIX::FieldNotFound( FIX::FIELD::EncodedText );
+      return m_EncodedText;
+    }
+    void setEncodedText( const std::string& value )
+    { m_EncodedText = value; m_present.set( 57 ); }
+    void removeEncodedText() { m_present.reset( 57 ); }
+
+    bool isSetFutSettDate2() const { return m_present.test( 58 ); }
+    const std::string& getFutSettDate2() const
+    {
+      if( !m_present.test( 58 ) ) throw FIX::FieldNotFound( FIX::FIELD::FutSettDate2 );
+      return m_FutSettDate2;
+    }
+    void setFutSettDate2( const std::string& value )
+    { m_FutSettDate2 = value; m_present.set( 58 ); }
+    void removeFutSettDate2() { m_present.reset( 58 ); }
+
+    bool isSetOrderQty2() const { return m_present.test( 59 ); }
+    double getOrderQty2() const
+    {
+      if( !m_present.test( 59 ) ) throw FIX::FieldNotFound( FIX::FIELD::OrderQty2 );
+      return m_OrderQty2;
+    }
+    void setOrderQty2( double value )
+    { m_OrderQty2 = value; m_present.set( 59 ); }
+    void removeOrderQty2() { m_present.reset( 59 ); }
+
+    bool isSetOpenClose() const { return m_present.test( 60 ); }
+    char getOpenClose() const
+    {
+      if( !m_present.test( 60 ) ) throw FIX::FieldNotFound( FIX::FIELD::OpenClose );
+      return m_OpenClose;
+    }
+    void setOpenClose( char value )
+    { m_OpenClose = value; m_present.set( 60 ); }
+    void removeOpenClose() { m_present.reset( 60 ); }
+
+    bool isSetCoveredOrUncovered() const { return m_present.test( 61 ); }
+    int getCoveredOrUncovered() const
+    {
+      if( !m_present.test( 61 ) ) throw FIX::FieldNotFound( FIX::FIELD::CoveredOrUncovered );
+      return m_CoveredOrUncovered;
+    }
+    void setCoveredOrUncovered( int value )
+    { m_CoveredOrUncovered = value; m_present.set( 61 ); }
+    void removeCoveredOrUncovered() { m_present.reset( 61 ); }
+
+    bool isSetCustomerOrFirm() const { return m_present.test( 62 ); }
+    int getCustomerOrFirm() const
+    {
+      if( !m_present.test( 62 ) ) throw FIX::FieldNotFound( FIX::FIELD::CustomerOrFirm );
+      return m_CustomerOrFirm;
+    }
+    void setCustomerOrFirm( int value )
+    { m_CustomerOrFirm = value; m_present.set( 62 ); }
+    void removeCustomerOrFirm() { m_present.reset( 62 ); }
+
+    bool isSetMaxShow() const { return m_present.test( 63 ); }
+    double getMaxShow() const
+    {
+      if( !m_present.test( 63 ) ) throw FIX::FieldNotFound( FIX::FIELD::MaxShow );
+      return m_MaxShow;
+    }
+    void setMaxShow( double value )
+    { m_MaxShow = value; m_present.set( 63 ); }
+    void removeMaxShow() { m_present.reset( 63 ); }
+
+    bool isSetPegDifference() const { return m_present.test( 64 ); }
+    double getPegDifference() const
+    {
+      if( !m_present.test( 64 ) ) throw FIX::FieldNotFound( FIX::FIELD::PegDifference );
+      return m_PegDifference;
+    }
+    void setPegDifference( double value )
+    { m_PegDifference = value; m_present.set( 64 ); }
+    void removePegDifference() { m_present.reset( 64 ); }
+
+    bool isSetDiscretionInst() const { return m_present.test( 65 ); }
+    char getDiscretionInst() const
+    {
+      if( !m_present.test( 65 ) ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionInst );
+      return m_DiscretionInst;
+    }
+    void setDiscretionInst( char value )
+    { m_DiscretionInst = value; m_present.set( 65 ); }
+    void removeDiscretionInst() { m_present.reset( 65 ); }
+
+    bool isSetDiscretionOffset() const { return m_present.test( 66 ); }
+    double getDiscretionOffset() const
+    {
+      if( !m_present.test( 66 ) ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionOffset );
+      return m_DiscretionOffset;
+    }
+    void setDiscretionOffset( double value )
+    { m_DiscretionOffset = value; m_present.set( 66 ); }
+    void removeDiscretionOffset() { m_present.reset( 66 ); }
+
+    bool isSetClearingFirm() const { return m_present.test( 67 ); }
+    const std::string& getClearingFirm() const
+    {
+      if( !m_present.test( 67 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClearingFirm );
+      return m_ClearingFirm;
+    }
+    void setClearingFirm( const std::string& value )
+    { m_ClearingFirm = value; m_present.set( 67 ); }
+    void removeClearingFirm() { m_present.reset( 67 ); }
+
+    bool isSetClearingAccount() const { return m_present.test( 68 ); }
+    const std::string& getClearingAccount() const
+    {
+      if( !m_present.test( 68 ) ) throw FIX::FieldNotFound( FIX::FIELD::ClearingAccount );
+      return m_ClearingAccount;
+    }
+    void setClearingAccount( const std::string& value )
+    { m_ClearingAccount = value; m_present.set( 68 ); }
+    void removeClearingAccount() { m_present.reset( 68 ); }
+
+    FIX::FixedGroup< NoAllocs, 4 >& getNoAllocs() { return m_NoAllocs; }
+    const FIX::FixedGroup< NoAllocs, 4 >& getNoAllocs() const { return m_NoAllocs; }
+
+    FIX::FixedGroup< NoTradingSessions, 4 >& getNoTradingSessions() { return m_NoTradingSessions; }
+    const FIX::FixedGroup< NoTradingSessions, 4 >& getNoTradingSessions() const { return m_NoTradingSessions; }
+
+    void clear()
+    {
+      m_header.clear();
+      m_trailer.clear();
+      m_present.clear();
+      m_NoAllocs.clear();
+      m_NoTradingSessions.clear();
+    }
+
+    std::string toString() const
+    {
+      std::string string;
+      return toString( string );
+    }
+
+    std::string& toString( std::string& string ) const
+    {
+      std::string::size_type length
+        = FIX::FixedWriter::begin( string, "FIX.4.2", "D" );
+      m_header.write( string );
+      write( string );
+      m_trailer.write( string );
+      FIX::FixedWriter::end( string, length );
+      return string;
+    }
+
+    void setString( const std::string& string, bool validate = true )
+    {
+      FIX::FixedParser parser( string );
+      parser.begin( "FIX.4.2", "D" );
+      clear();
+
+      int tag = 0;
+      while( parser.next( tag ) && tag != FIX::FIELD::CheckSum )
+      {
+        if( !m_header.setField( tag, parser )
+            && !setField( tag, parser )
+            && !m_trailer.setField( tag, parser ) )
+          throw FIX::TagNotDefinedForMessage( tag );
+      }
+
+      if( validate )
+        parser.end( tag );
+    }
+
+    bool setField( int tag, FIX::FixedParser& parser )
+    {
+      switch( tag )
+      {
+      case FIX::FIELD::ClOrdID:
+        parser.get( m_ClOrdID );
+        m_present.set( 0 );
+        return true;
+      case FIX::FIELD::ClientID:
+        parser.get( m_ClientID );
+        m_present.set( 1 );
+        return true;
+      case FIX::FIELD::ExecBroker:
+        parser.get( m_ExecBroker );
+        m_present.set( 2 );
+        return true;
+      case FIX::FIELD::Account:
+        parser.get( m_Account );
+        m_present.set( 3 );
+        return true;
+      case FIX::FIELD::SettlmntTyp:
+        parser.get( m_SettlmntTyp );
+        m_present.set( 4 );
+        return true;
+      case FIX::FIELD::FutSettDate:
+        parser.get( m_FutSettDate );
+        m_present.set( 5 );
+        return true;
+      case FIX::FIELD::HandlInst:
+        parser.get( m_HandlInst );
+        m_present.set( 6 );
+        return true;
+      case FIX::FIELD::ExecInst:
+        parser.get( m_ExecInst );
+        m_present.set( 7 );
+        return true;
+      case FIX::FIELD::MinQty:
+        parser.get( m_MinQty );
+        m_present.set( 8 );
+        return true;
+      case FIX::FIELD::MaxFloor:
+        parser.get( m_MaxFloor );
+        m_present.set( 9 );
+        return true;
+      case FIX::FIELD::ExDestination:
+        parser.get( m_ExDestination );
+        m_present.set( 10 );
+        return true;
+      case FIX::FIELD::ProcessCode:
+        parser.get( m_ProcessCode );
+        m_present.set( 11 );
+        return true;
+      case FIX::FIELD::Symbol:
+        parser.get( m_Symbol );
+        m_present.set( 12 );
+        return true;
+      case FIX::FIELD::SymbolSfx:
+        parser.get( m_SymbolSfx );
+        m_present.set( 13 );
+        return true;
+      case FIX::FIELD::SecurityID:
+        parser.get( m_SecurityID );
+        m_present.set( 14 );
+        return true;
+      case FIX::FIELD::IDSource:
+        parser.get( m_IDSource );
+        m_present.set( 15 );
+        return true;
+      case FIX::FIELD::SecurityType:
+        parser.get( m_SecurityType );
+        m_present.set( 16 );
+        return true;
+      case FIX::FIELD::MaturityMonthYear:
+        parser.get( m_MaturityMonthYear );
+        m_present.set( 17 );
+        return true;
+      case FIX::FIELD::MaturityDay:
+        parser.get( m_MaturityDay );
+        m_present.set( 18 );
+        return true;
+      case FIX::FIELD::PutOrCall:
+        parser.get( m_PutOrCall );
+        m_present.set( 19 );
+        return true;
+      case FIX::FIELD::StrikePrice:
+        parser.get( m_StrikePrice );
+        m_present.set( 20 );
+        return true;
+      case FIX::FIELD::OptAttribute:
+        parser.get( m_OptAttribute );
+        m_present.set( 21 );
+        return true;
+      case FIX::FIELD::ContractMultiplier:
+        parser.get( m_ContractMultiplier );
+        m_present.set( 22 );
+        return true;
+      case FIX::FIELD::CouponRate:
+        parser.get( m_CouponRate );
+        m_present.set( 23 );
+        return true;
+      case FIX::FIELD::SecurityExchange:
+        parser.get( m_SecurityExchange );
+        m_present.set( 24 );
+        return true;
+      case FIX::FIELD::Issuer:
+        parser.get( m_Issuer );
+        m_present.set( 25 );
+        return true;
+      case FIX::FIELD::EncodedIssuerLen:
+        parser.get( m_EncodedIssuerLen );
+        parser.setDataLength( m_EncodedIssuerLen );
+        m_present.set( 26 );
+        return true;
+      case FIX::FIELD::EncodedIssuer:
+        parser.get( m_EncodedIssuer );
+        m_present.set( 27 );
+        return true;
+      case FIX::FIELD::SecurityDesc:
+        parser.get( m_SecurityDesc );
+        m_present.set( 28 );
+        return true;
+      case FIX::FIELD::EncodedSecurityDescLen:
+        parser.get( m_EncodedSecurityDescLen );
+        parser.setDataLength( m_EncodedSecurityDescLen );
+        m_present.set( 29 );
+        return true;
+      case FIX::FIELD::EncodedSecurityDesc:
+        parser.get( m_EncodedSecurityDesc );
+        m_present.set( 30 );
+        return true;
+      case FIX::FIELD::PrevClosePx:
+        parser.get( m_PrevClosePx );
+        m_present.set( 31 );
+        return true;
+      case FIX::FIELD::Side:
+        parser.get( m_Side );
+        m_present.set( 32 );
+        return true;
+      case FIX::FIELD::LocateReqd:
+        parser.get( m_LocateReqd );
+        m_present.set( 33 );
+        return true;
+      case FIX::FIELD::TransactTime:
+        parser.get( m_TransactTime, m_TransactTimeMilliseconds );
+        m_present.set( 34 );
+        return true;
+      case FIX::FIELD::OrderQty:
+        parser.get( m_OrderQty );
+        m_present.set( 35 );
+        return true;
+      case FIX::FIELD::CashOrderQty:
+        parser.get( m_CashOrderQty );
+        m_present.set( 36 );
+        return true;
+      case FIX::FIELD::OrdType:
+        parser.get( m_OrdType );
+        m_present.set( 37 );
+        return true;
+      case FIX::FIELD::Price:
+        parser.get( m_Price );
+        m_present.set( 38 );
+        return true;
+      case FIX::FIELD::StopPx:
+        parser.get( m_StopPx );
+        m_present.set( 39 );
+        return true;
+      case FIX::FIELD::Currency:
+        parser.get( m_Currency );
+        m_present.set( 40 );
+        return true;
+      case FIX::FIELD::ComplianceID:
+        parser.get( m_ComplianceID );
+        m_present.set( 41 );
+        return true;
+      case FIX::FIELD::SolicitedFlag:
+        parser.get( m_SolicitedFlag );
+        m_present.set( 42 );
+        return true;
+      case FIX::FIELD::IOIid:
+        parser.get( m_IOIid );
+        m_present.set( 43 );
+        return true;
+      case FIX::FIELD::QuoteID:
+        parser.get( m_QuoteID );
+        m_present.set( 44 );
+        return true;
+      case FIX::FIELD::TimeInForce:
+        parser.get( m_TimeInForce );
+        m_present.set( 45 );
+        return true;
+      case FIX::FIELD::EffectiveTime:
+        parser.get( m_EffectiveTime, m_EffectiveTimeMilliseconds );
+        m_present.set( 46 );
+        return true;
+      case FIX::FIELD::ExpireDate:
+        parser.get( m_ExpireDate );
+        m_present.set( 47 );
+        return true;
+      case FIX::FIELD::ExpireTime:
+        parser.get( m_ExpireTime, m_ExpireTimeMilliseconds );
+        m_present.set( 48 );
+        return true;
+      case FIX::FIELD::GTBookingInst:
+        parser.get( m_GTBookingInst );
+        m_present.set( 49 );
+        return true;
+      case FIX::FIELD::Commission:
+        parser.get( m_Commission );
+        m_present.set( 50 );
+        return true;
+      case FIX::FIELD::CommType:
+        parser.get( m_CommType );
+        m_present.set( 51 );
+        return true;
+      case FIX::FIELD::Rule80A:
+        parser.get( m_Rule80A );
+        m_present.set( 52 );
+        return true;
+      case FIX::FIELD::ForexReq:
+        parser.get( m_ForexReq );
+        m_present.set( 53 );
+        return true;
+      case FIX::FIELD::SettlCurrency:
+        parser.get( m_SettlCurrency );
+        m_present.set( 54 );
+        return true;
+      case FIX::FIELD::Text:
+        parser.get( m_Text );
+        m_present.set( 55 );
+        return true;
+      case FIX::FIELD::EncodedTextLen:
+        parser.get( m_EncodedTextLen );
+        parser.setDataLength( m_EncodedTextLen );
+        m_present.set( 56 );
+        return true;
+      case FIX::FIELD::EncodedText:
+        parser.get( m_EncodedText );
+        m_present.set( 57 );
+        return true;
+      case FIX::FIELD::FutSettDate2:
+        parser.get( m_FutSettDate2 );
+        m_present.set( 58 );
+        return true;
+      case FIX::FIELD::OrderQty2:
+        parser.get( m_OrderQty2 );
+        m_present.set( 59 );
+        return true;
+      case FIX::FIELD::OpenClose:
+        parser.get( m_OpenClose );
+        m_present.set( 60 );
+        return true;
+      case FIX::FIELD::CoveredOrUncovered:
+        parser.get( m_CoveredOrUncovered );
+        m_present.set( 61 );
+        return true;
+      case FIX::FIELD::CustomerOrFirm:
+        parser.get( m_CustomerOrFirm );
+        m_present.set( 62 );
+        return true;
+      case FIX::FIELD::MaxShow:
+        parser.get( m_MaxShow );
+        m_present.set( 63 );
+        return true;
+      case FIX::FIELD::PegDifference:
+        parser.get( m_PegDifference );
+        m_present.set( 64 );
+        return true;
+      case FIX::FIELD::DiscretionInst:
+        parser.get( m_DiscretionInst );
+        m_present.set( 65 );
+        return true;
+      case FIX::FIELD::DiscretionOffset:
+        parser.get( m_DiscretionOffset );
+        m_present.set( 66 );
+        return true;
+      case FIX::FIELD::ClearingFirm:
+        parser.get( m_ClearingFirm );
+        m_present.set( 67 );
+        return true;
+      case FIX::FIELD::ClearingAccount:
+        parser.get( m_ClearingAccount );
+        m_present.set( 68 );
+        return true;
+      case FIX::FIELD::NoAllocs:
+        {
+          int count = 0;
+          parser.get( count );
+          m_NoAllocs.read( parser, FIX::FIELD::NoAllocs, FIX::FIELD::AllocAccount, count );
+        }
+        return true;
+      case FIX::FIELD::NoTradingSessions:
+        {
+          int count = 0;
+          parser.get( count );
+          m_NoTradingSessions.read( parser, FIX::FIELD::NoTradingSessions, FIX::FIELD::TradingSessionID, count );
+        }
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    void write( std::string& string ) const
+    {
+      if( m_present.test( 3 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Account, m_Account );
+      if( m_present.test( 0 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClOrdID, m_ClOrdID );
+      if( m_present.test( 50 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Commission, m_Commission );
+      if( m_present.test( 51 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CommType, m_CommType );
+      if( m_present.test( 40 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Currency, m_Currency );
+      if( m_present.test( 7 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecInst, m_ExecInst );
+      if( m_present.test( 6 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::HandlInst, m_HandlInst );
+      if( m_present.test( 15 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::IDSource, m_IDSource );
+      if( m_present.test( 43 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::IOIid, m_IOIid );
+      if( m_present.test( 35 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrderQty, m_OrderQty );
+      if( m_present.test( 37 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrdType, m_OrdType );
+      if( m_present.test( 38 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Price, m_Price );
+      if( m_present.test( 52 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Rule80A, m_Rule80A );
+      if( m_present.test( 14 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityID, m_SecurityID );
+      if( m_present.test( 32 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Side, m_Side );
+      if( m_present.test( 12 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Symbol, m_Symbol );
+      if( m_present.test( 55 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Text, m_Text );
+      if( m_present.test( 45 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TimeInForce, m_TimeInForce );
+      if( m_present.test( 34 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::TransactTime, m_TransactTime, m_TransactTimeMilliseconds );
+      if( m_present.test( 4 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlmntTyp, m_SettlmntTyp );
+      if( m_present.test( 5 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::FutSettDate, m_FutSettDate );
+      if( m_present.test( 13 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SymbolSfx, m_SymbolSfx );
+      if( m_present.test( 2 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExecBroker, m_ExecBroker );
+      if( m_present.test( 60 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OpenClose, m_OpenClose );
+      m_NoAllocs.write( string, FIX::FIELD::NoAllocs );
+      if( m_present.test( 11 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ProcessCode, m_ProcessCode );
+      if( m_present.test( 39 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::StopPx, m_StopPx );
+      if( m_present.test( 10 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExDestination, m_ExDestination );
+      if( m_present.test( 25 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::Issuer, m_Issuer );
+      if( m_present.test( 28 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityDesc, m_SecurityDesc );
+      if( m_present.test( 1 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClientID, m_ClientID );
+      if( m_present.test( 8 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MinQty, m_MinQty );
+      if( m_present.test( 9 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaxFloor, m_MaxFloor );
+      if( m_present.test( 33 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::LocateReqd, m_LocateReqd );
+      if( m_present.test( 44 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::QuoteID, m_QuoteID );
+      if( m_present.test( 54 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SettlCurrency, m_SettlCurrency );
+      if( m_present.test( 53 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ForexReq, m_ForexReq );
+      if( m_present.test( 48 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExpireTime, m_ExpireTime, m_ExpireTimeMilliseconds );
+      if( m_present.test( 31 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PrevClosePx, m_PrevClosePx );
+      if( m_present.test( 36 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CashOrderQty, m_CashOrderQty );
+      if( m_present.test( 16 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityType, m_SecurityType );
+      if( m_present.test( 46 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EffectiveTime, m_EffectiveTime, m_EffectiveTimeMilliseconds );
+      if( m_present.test( 59 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OrderQty2, m_OrderQty2 );
+      if( m_present.test( 58 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::FutSettDate2, m_FutSettDate2 );
+      if( m_present.test( 17 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaturityMonthYear, m_MaturityMonthYear );
+      if( m_present.test( 19 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PutOrCall, m_PutOrCall );
+      if( m_present.test( 20 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::StrikePrice, m_StrikePrice );
+      if( m_present.test( 61 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CoveredOrUncovered, m_CoveredOrUncovered );
+      if( m_present.test( 62 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CustomerOrFirm, m_CustomerOrFirm );
+      if( m_present.test( 18 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaturityDay, m_MaturityDay );
+      if( m_present.test( 21 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::OptAttribute, m_OptAttribute );
+      if( m_present.test( 24 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SecurityExchange, m_SecurityExchange );
+      if( m_present.test( 63 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::MaxShow, m_MaxShow );
+      if( m_present.test( 64 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::PegDifference, m_PegDifference );
+      if( m_present.test( 23 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::CouponRate, m_CouponRate );
+      if( m_present.test( 22 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ContractMultiplier, m_ContractMultiplier );
+      if( m_present.test( 26 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedIssuerLen, m_EncodedIssuerLen );
+      if( m_present.test( 27 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedIssuer, m_EncodedIssuer );
+      if( m_present.test( 29 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedSecurityDescLen, m_EncodedSecurityDescLen );
+      if( m_present.test( 30 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedSecurityDesc, m_EncodedSecurityDesc );
+      if( m_present.test( 56 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedTextLen, m_EncodedTextLen );
+      if( m_present.test( 57 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::EncodedText, m_EncodedText );
+      if( m_present.test( 41 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ComplianceID, m_ComplianceID );
+      if( m_present.test( 42 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::SolicitedFlag, m_SolicitedFlag );
+      m_NoTradingSessions.write( string, FIX::FIELD::NoTradingSessions );
+      if( m_present.test( 65 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DiscretionInst, m_DiscretionInst );
+      if( m_present.test( 66 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::DiscretionOffset, m_DiscretionOffset );
+      if( m_present.test( 49 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::GTBookingInst, m_GTBookingInst );
+      if( m_present.test( 47 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ExpireDate, m_ExpireDate );
+      if( m_present.test( 67 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClearingFirm, m_ClearingFirm );
+      if( m_present.test( 68 ) )
+        FIX::FixedWriter::field( string, FIX::FIELD::ClearingAccount, m_ClearingAccount );
+    }
+
+  private:
+    FixedHeader m_header;
+    FixedTrailer m_trailer;
+    FIX::FixedPresence< 69 > m_present;
+    std::string m_ClOrdID;
+    std::string m_ClientID;
+    std::string m_ExecBroker;
+    std::string m_Account;
+    char m_SettlmntTyp;
+    std::string m_FutSettDate;
+    char m_HandlInst;
+    std::string m_ExecInst;
+    double m_MinQty;
+    double m_MaxFloor;
+    std::string m_ExDestination;
+    char m_ProcessCode;
+    std::string m_Symbol;
+    std::string m_SymbolSfx;
+    std::string m_SecurityID;
+    std::string m_IDSource;
+    std::string m_SecurityType;
+    std::string m_MaturityMonthYear;
+    int m_MaturityDay;
+    int m_PutOrCall;
+    double m_StrikePrice;
+    char m_OptAttribute;
+    double m_ContractMultiplier;
+    double m_CouponRate;
+    std::string m_SecurityExchange;
+    std::string m_Issuer;
+    int m_EncodedIssuerLen;
+    std::string m_EncodedIssuer;
+    std::string m_SecurityDesc;
+    int m_EncodedSecurityDescLen;
+    std::string m_EncodedSecurityDesc;
+    double m_PrevClosePx;
+    char m_Side;
+    bool m_LocateReqd;
+    FIX::DateTime m_TransactTime;
+    bool m_TransactTimeMilliseconds;
+    double m_OrderQty;
+    double m_CashOrderQty;
+    char m_OrdType;
+    double m_Price;
+    double m_StopPx;
+    std::string m_Currency;
+    std::string m_ComplianceID;
+    bool m_SolicitedFlag;
+    std::string m_IOIid;
+    std::string m_QuoteID;
+    char m_TimeInForce;
+    FIX::DateTime m_EffectiveTime;
+    bool m_EffectiveTimeMilliseconds;
+    std::string m_ExpireDate;
+    FIX::DateTime m_ExpireTime;
+    bool m_ExpireTimeMilliseconds;
+    int m_GTBookingInst;
+    double m_Commission;
+    char m_CommType;
+    char m_Rule80A;
+    bool m_ForexReq;
+    std::string m_SettlCurrency;
+    std::string m_Text;
+    int m_EncodedTextLen;
+    std::string m_EncodedText;
+    std::string m_FutSettDate2;
+    double m_OrderQty2;
+    char m_OpenClose;
+    int m_CoveredOrUncovered;
+    int m_CustomerOrFirm;
+    double m_MaxShow;
+    double m_PegDifference;
+    char m_DiscretionInst;
+    double m_DiscretionOffset;
+    std::string m_ClearingFirm;
+    std::string m_ClearingAccount;
+    FIX::FixedGroup< NoAllocs, 4 > m_NoAllocs;
+    FIX::FixedGroup< NoTradingSessions, 4 > m_NoTradingSessions;
+  };
+
+}
+
+#endif
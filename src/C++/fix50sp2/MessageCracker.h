@@ -478,664 +478,457 @@ public:
   {
     const std::string& msgTypeValue 
       = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    if( msgTypeValue == "6" )
-      onMessage( (const IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (const Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (const ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (const OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (const News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (const Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (const NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (const NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (const OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (const OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (const OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (const AllocationInstruction&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (const ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (const ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (const ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (const ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (const AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (const DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (const QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (const Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (const SettlementInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "V" )
-      onMessage( (const MarketDataRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "W" )
-      onMessage( (const MarketDataSnapshotFullRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "X" )
-      onMessage( (const MarketDataIncrementalRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "Y" )
-      onMessage( (const MarketDataRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "Z" )
-      onMessage( (const QuoteCancel&)message, sessionID );
-    else
-    if( msgTypeValue == "a" )
-      onMessage( (const QuoteStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "b" )
-      onMessage( (const MassQuoteAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "c" )
-      onMessage( (const SecurityDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "d" )
-      onMessage( (const SecurityDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "e" )
-      onMessage( (const SecurityStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "f" )
-      onMessage( (const SecurityStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "g" )
-      onMessage( (const TradingSessionStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "h" )
-      onMessage( (const TradingSessionStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "i" )
-      onMessage( (const MassQuote&)message, sessionID );
-    else
-    if( msgTypeValue == "j" )
-      onMessage( (const BusinessMessageReject&)message, sessionID );
-    else
-    if( msgTypeValue == "k" )
-      onMessage( (const BidRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "l" )
-      onMessage( (const BidResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "m" )
-      onMessage( (const ListStrikePrice&)message, sessionID );
-    else
-    if( msgTypeValue == "o" )
-      onMessage( (const RegistrationInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "p" )
-      onMessage( (const RegistrationInstructionsResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "q" )
-      onMessage( (const OrderMassCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "r" )
-      onMessage( (const OrderMassCancelReport&)message, sessionID );
-    else
-    if( msgTypeValue == "s" )
-      onMessage( (const NewOrderCross&)message, sessionID );
-    else
-    if( msgTypeValue == "t" )
-      onMessage( (const CrossOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "u" )
-      onMessage( (const CrossOrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "v" )
-      onMessage( (const SecurityTypeRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "w" )
-      onMessage( (const SecurityTypes&)message, sessionID );
-    else
-    if( msgTypeValue == "x" )
-      onMessage( (const SecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "y" )
-      onMessage( (const SecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "z" )
-      onMessage( (const DerivativeSecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AA" )
-      onMessage( (const DerivativeSecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "AB" )
-      onMessage( (const NewOrderMultileg&)message, sessionID );
-    else
-    if( msgTypeValue == "AC" )
-      onMessage( (const MultilegOrderCancelReplace&)message, sessionID );
-    else
-    if( msgTypeValue == "AD" )
-      onMessage( (const TradeCaptureReportRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AE" )
-      onMessage( (const TradeCaptureReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AF" )
-      onMessage( (const OrderMassStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AG" )
-      onMessage( (const QuoteRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "AH" )
-      onMessage( (const RFQRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AI" )
-      onMessage( (const QuoteStatusReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AJ" )
-      onMessage( (const QuoteResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "AK" )
-      onMessage( (const Confirmation&)message, sessionID );
-    else
-    if( msgTypeValue == "AL" )
-      onMessage( (const PositionMaintenanceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AM" )
-      onMessage( (const PositionMaintenanceReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AN" )
-      onMessage( (const RequestForPositions&)message, sessionID );
-    else
-    if( msgTypeValue == "AO" )
-      onMessage( (const RequestForPositionsAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AP" )
-      onMessage( (const PositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AQ" )
-      onMessage( (const TradeCaptureReportRequestAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AR" )
-      onMessage( (const TradeCaptureReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AS" )
-      onMessage( (const AllocationReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AT" )
-      onMessage( (const AllocationReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AU" )
-      onMessage( (const ConfirmationAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AV" )
-      onMessage( (const SettlementInstructionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AW" )
-      onMessage( (const AssignmentReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AX" )
-      onMessage( (const CollateralRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AY" )
-      onMessage( (const CollateralAssignment&)message, sessionID );
-    else
-    if( msgTypeValue == "AZ" )
-      onMessage( (const CollateralResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BA" )
-      onMessage( (const CollateralReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BB" )
-      onMessage( (const CollateralInquiry&)message, sessionID );
-    else
-    if( msgTypeValue == "BC" )
-      onMessage( (const NetworkCounterpartySystemStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BD" )
-      onMessage( (const NetworkCounterpartySystemStatusResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BE" )
-      onMessage( (const UserRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BF" )
-      onMessage( (const UserResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BG" )
-      onMessage( (const CollateralInquiryAck&)message, sessionID );
-    else
-    if( msgTypeValue == "BH" )
-      onMessage( (const ConfirmationRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BO" )
-      onMessage( (const ContraryIntentionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BP" )
-      onMessage( (const SecurityDefinitionUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BK" )
-      onMessage( (const SecurityListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BL" )
-      onMessage( (const AdjustedPositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BM" )
-      onMessage( (const AllocationInstructionAlert&)message, sessionID );
-    else
-    if( msgTypeValue == "BN" )
-      onMessage( (const ExecutionAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "BJ" )
-      onMessage( (const TradingSessionList&)message, sessionID );
-    else
-    if( msgTypeValue == "BI" )
-      onMessage( (const TradingSessionListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BQ" )
-      onMessage( (const SettlementObligationReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BR" )
-      onMessage( (const DerivativeSecurityListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BS" )
-      onMessage( (const TradingSessionListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BT" )
-      onMessage( (const MarketDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BU" )
-      onMessage( (const MarketDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "BV" )
-      onMessage( (const MarketDefinitionUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BW" )
-      onMessage( (const ApplicationMessageRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BX" )
-      onMessage( (const ApplicationMessageRequestAck&)message, sessionID );
-    else
-    if( msgTypeValue == "BY" )
-      onMessage( (const ApplicationMessageReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BZ" )
-      onMessage( (const OrderMassActionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "CA" )
-      onMessage( (const OrderMassActionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "CB" )
-      onMessage( (const UserNotification&)message, sessionID );
-    else
-    if( msgTypeValue == "CC" )
-      onMessage( (const StreamAssignmentRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "CD" )
-      onMessage( (const StreamAssignmentReport&)message, sessionID );
-    else
-    if( msgTypeValue == "CE" )
-      onMessage( (const StreamAssignmentReportACK&)message, sessionID );
-    else onMessage( message, sessionID );
+
+    switch( FIX::Message::msgTypeKey( msgTypeValue ) )
+    {
+    case '6':
+      onMessage( (const IOI&)message, sessionID ); break;
+    case '7':
+      onMessage( (const Advertisement&)message, sessionID ); break;
+    case '8':
+      onMessage( (const ExecutionReport&)message, sessionID ); break;
+    case '9':
+      onMessage( (const OrderCancelReject&)message, sessionID ); break;
+    case 'B':
+      onMessage( (const News&)message, sessionID ); break;
+    case 'C':
+      onMessage( (const Email&)message, sessionID ); break;
+    case 'D':
+      onMessage( (const NewOrderSingle&)message, sessionID ); break;
+    case 'E':
+      onMessage( (const NewOrderList&)message, sessionID ); break;
+    case 'F':
+      onMessage( (const OrderCancelRequest&)message, sessionID ); break;
+    case 'G':
+      onMessage( (const OrderCancelReplaceRequest&)message, sessionID ); break;
+    case 'H':
+      onMessage( (const OrderStatusRequest&)message, sessionID ); break;
+    case 'J':
+      onMessage( (const AllocationInstruction&)message, sessionID ); break;
+    case 'K':
+      onMessage( (const ListCancelRequest&)message, sessionID ); break;
+    case 'L':
+      onMessage( (const ListExecute&)message, sessionID ); break;
+    case 'M':
+      onMessage( (const ListStatusRequest&)message, sessionID ); break;
+    case 'N':
+      onMessage( (const ListStatus&)message, sessionID ); break;
+    case 'P':
+      onMessage( (const AllocationInstructionAck&)message, sessionID ); break;
+    case 'Q':
+      onMessage( (const DontKnowTrade&)message, sessionID ); break;
+    case 'R':
+      onMessage( (const QuoteRequest&)message, sessionID ); break;
+    case 'S':
+      onMessage( (const Quote&)message, sessionID ); break;
+    case 'T':
+      onMessage( (const SettlementInstructions&)message, sessionID ); break;
+    case 'V':
+      onMessage( (const MarketDataRequest&)message, sessionID ); break;
+    case 'W':
+      onMessage( (const MarketDataSnapshotFullRefresh&)message, sessionID ); break;
+    case 'X':
+      onMessage( (const MarketDataIncrementalRefresh&)message, sessionID ); break;
+    case 'Y':
+      onMessage( (const MarketDataRequestReject&)message, sessionID ); break;
+    case 'Z':
+      onMessage( (const QuoteCancel&)message, sessionID ); break;
+    case 'a':
+      onMessage( (const QuoteStatusRequest&)message, sessionID ); break;
+    case 'b':
+      onMessage( (const MassQuoteAcknowledgement&)message, sessionID ); break;
+    case 'c':
+      onMessage( (const SecurityDefinitionRequest&)message, sessionID ); break;
+    case 'd':
+      onMessage( (const SecurityDefinition&)message, sessionID ); break;
+    case 'e':
+      onMessage( (const SecurityStatusRequest&)message, sessionID ); break;
+    case 'f':
+      onMessage( (const SecurityStatus&)message, sessionID ); break;
+    case 'g':
+      onMessage( (const TradingSessionStatusRequest&)message, sessionID ); break;
+    case 'h':
+      onMessage( (const TradingSessionStatus&)message, sessionID ); break;
+    case 'i':
+      onMessage( (const MassQuote&)message, sessionID ); break;
+    case 'j':
+      onMessage( (const BusinessMessageReject&)message, sessionID ); break;
+    case 'k':
+      onMessage( (const BidRequest&)message, sessionID ); break;
+    case 'l':
+      onMessage( (const BidResponse&)message, sessionID ); break;
+    case 'm':
+      onMessage( (const ListStrikePrice&)message, sessionID ); break;
+    case 'o':
+      onMessage( (const RegistrationInstructions&)message, sessionID ); break;
+    case 'p':
+      onMessage( (const RegistrationInstructionsResponse&)message, sessionID ); break;
+    case 'q':
+      onMessage( (const OrderMassCancelRequest&)message, sessionID ); break;
+    case 'r':
+      onMessage( (const OrderMassCancelReport&)message, sessionID ); break;
+    case 's':
+      onMessage( (const NewOrderCross&)message, sessionID ); break;
+    case 't':
+      onMessage( (const CrossOrderCancelReplaceRequest&)message, sessionID ); break;
+    case 'u':
+      onMessage( (const CrossOrderCancelRequest&)message, sessionID ); break;
+    case 'v':
+      onMessage( (const SecurityTypeRequest&)message, sessionID ); break;
+    case 'w':
+      onMessage( (const SecurityTypes&)message, sessionID ); break;
+    case 'x':
+      onMessage( (const SecurityListRequest&)message, sessionID ); break;
+    case 'y':
+      onMessage( (const SecurityList&)message, sessionID ); break;
+    case 'z':
+      onMessage( (const DerivativeSecurityListRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'A':
+      onMessage( (const DerivativeSecurityList&)message, sessionID ); break;
+    case ('A') * 256 + 'B':
+      onMessage( (const NewOrderMultileg&)message, sessionID ); break;
+    case ('A') * 256 + 'C':
+      onMessage( (const MultilegOrderCancelReplace&)message, sessionID ); break;
+    case ('A') * 256 + 'D':
+      onMessage( (const TradeCaptureReportRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'E':
+      onMessage( (const TradeCaptureReport&)message, sessionID ); break;
+    case ('A') * 256 + 'F':
+      onMessage( (const OrderMassStatusRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'G':
+      onMessage( (const QuoteRequestReject&)message, sessionID ); break;
+    case ('A') * 256 + 'H':
+      onMessage( (const RFQRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'I':
+      onMessage( (const QuoteStatusReport&)message, sessionID ); break;
+    case ('A') * 256 + 'J':
+      onMessage( (const QuoteResponse&)message, sessionID ); break;
+    case ('A') * 256 + 'K':
+      onMessage( (const Confirmation&)message, sessionID ); break;
+    case ('A') * 256 + 'L':
+      onMessage( (const PositionMaintenanceRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'M':
+      onMessage( (const PositionMaintenanceReport&)message, sessionID ); break;
+    case ('A') * 256 + 'N':
+      onMessage( (const RequestForPositions&)message, sessionID ); break;
+    case ('A') * 256 + 'O':
+      onMessage( (const RequestForPositionsAck&)message, sessionID ); break;
+    case ('A') * 256 + 'P':
+      onMessage( (const PositionReport&)message, sessionID ); break;
+    case ('A') * 256 + 'Q':
+      onMessage( (const TradeCaptureReportRequestAck&)message, sessionID ); break;
+    case ('A') * 256 + 'R':
+      onMessage( (const TradeCaptureReportAck&)message, sessionID ); break;
+    case ('A') * 256 + 'S':
+      onMessage( (const AllocationReport&)message, sessionID ); break;
+    case ('A') * 256 + 'T':
+      onMessage( (const AllocationReportAck&)message, sessionID ); break;
+    case ('A') * 256 + 'U':
+      onMessage( (const ConfirmationAck&)message, sessionID ); break;
+    case ('A') * 256 + 'V':
+      onMessage( (const SettlementInstructionRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'W':
+      onMessage( (const AssignmentReport&)message, sessionID ); break;
+    case ('A') * 256 + 'X':
+      onMessage( (const CollateralRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'Y':
+      onMessage( (const CollateralAssignment&)message, sessionID ); break;
+    case ('A') * 256 + 'Z':
+      onMessage( (const CollateralResponse&)message, sessionID ); break;
+    case ('B') * 256 + 'A':
+      onMessage( (const CollateralReport&)message, sessionID ); break;
+    case ('B') * 256 + 'B':
+      onMessage( (const CollateralInquiry&)message, sessionID ); break;
+    case ('B') * 256 + 'C':
+      onMessage( (const NetworkCounterpartySystemStatusRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'D':
+      onMessage( (const NetworkCounterpartySystemStatusResponse&)message, sessionID ); break;
+    case ('B') * 256 + 'E':
+      onMessage( (const UserRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'F':
+      onMessage( (const UserResponse&)message, sessionID ); break;
+    case ('B') * 256 + 'G':
+      onMessage( (const CollateralInquiryAck&)message, sessionID ); break;
+    case ('B') * 256 + 'H':
+      onMessage( (const ConfirmationRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'O':
+      onMessage( (const ContraryIntentionReport&)message, sessionID ); break;
+    case ('B') * 256 + 'P':
+      onMessage( (const SecurityDefinitionUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'K':
+      onMessage( (const SecurityListUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'L':
+      onMessage( (const AdjustedPositionReport&)message, sessionID ); break;
+    case ('B') * 256 + 'M':
+      onMessage( (const AllocationInstructionAlert&)message, sessionID ); break;
+    case ('B') * 256 + 'N':
+      onMessage( (const ExecutionAcknowledgement&)message, sessionID ); break;
+    case ('B') * 256 + 'J':
+      onMessage( (const TradingSessionList&)message, sessionID ); break;
+    case ('B') * 256 + 'I':
+      onMessage( (const TradingSessionListRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'Q':
+      onMessage( (const SettlementObligationReport&)message, sessionID ); break;
+    case ('B') * 256 + 'R':
+      onMessage( (const DerivativeSecurityListUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'S':
+      onMessage( (const TradingSessionListUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'T':
+      onMessage( (const MarketDefinitionRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'U':
+      onMessage( (const MarketDefinition&)message, sessionID ); break;
+    case ('B') * 256 + 'V':
+      onMessage( (const MarketDefinitionUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'W':
+      onMessage( (const ApplicationMessageRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'X':
+      onMessage( (const ApplicationMessageRequestAck&)message, sessionID ); break;
+    case ('B') * 256 + 'Y':
+      onMessage( (const ApplicationMessageReport&)message, sessionID ); break;
+    case ('B') * 256 + 'Z':
+      onMessage( (const OrderMassActionReport&)message, sessionID ); break;
+    case ('C') * 256 + 'A':
+      onMessage( (const OrderMassActionRequest&)message, sessionID ); break;
+    case ('C') * 256 + 'B':
+      onMessage( (const UserNotification&)message, sessionID ); break;
+    case ('C') * 256 + 'C':
+      onMessage( (const StreamAssignmentRequest&)message, sessionID ); break;
+    case ('C') * 256 + 'D':
+      onMessage( (const StreamAssignmentReport&)message, sessionID ); break;
+    case ('C') * 256 + 'E':
+      onMessage( (const StreamAssignmentReportACK&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
-void crack( Message& message, 
-            const FIX::SessionID& sessionID )
+  void crack( Message& message, 
+              const FIX::SessionID& sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    if( msgTypeValue == "6" )
-      onMessage( (IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (AllocationInstruction&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (SettlementInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "V" )
-      onMessage( (MarketDataRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "W" )
-      onMessage( (MarketDataSnapshotFullRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "X" )
-      onMessage( (MarketDataIncrementalRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "Y" )
-      onMessage( (MarketDataRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "Z" )
-      onMessage( (QuoteCancel&)message, sessionID );
-    else
-    if( msgTypeValue == "a" )
-      onMessage( (QuoteStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "b" )
-      onMessage( (MassQuoteAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "c" )
-      onMessage( (SecurityDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "d" )
-      onMessage( (SecurityDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "e" )
-      onMessage( (SecurityStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "f" )
-      onMessage( (SecurityStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "g" )
-      onMessage( (TradingSessionStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "h" )
-      onMessage( (TradingSessionStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "i" )
-      onMessage( (MassQuote&)message, sessionID );
-    else
-    if( msgTypeValue == "j" )
-      onMessage( (BusinessMessageReject&)message, sessionID );
-    else
-    if( msgTypeValue == "k" )
-      onMessage( (BidRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "l" )
-      onMessage( (BidResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "m" )
-      onMessage( (ListStrikePrice&)message, sessionID );
-    else
-    if( msgTypeValue == "o" )
-      onMessage( (RegistrationInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "p" )
-      onMessage( (RegistrationInstructionsResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "q" )
-      onMessage( (OrderMassCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "r" )
-      onMessage( (OrderMassCancelReport&)message, sessionID );
-    else
-    if( msgTypeValue == "s" )
-      onMessage( (NewOrderCross&)message, sessionID );
-    else
-    if( msgTypeValue == "t" )
-      onMessage( (CrossOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "u" )
-      onMessage( (CrossOrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "v" )
-      onMessage( (SecurityTypeRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "w" )
-      onMessage( (SecurityTypes&)message, sessionID );
-    else
-    if( msgTypeValue == "x" )
-      onMessage( (SecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "y" )
-      onMessage( (SecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "z" )
-      onMessage( (DerivativeSecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AA" )
-      onMessage( (DerivativeSecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "AB" )
-      onMessage( (NewOrderMultileg&)message, sessionID );
-    else
-    if( msgTypeValue == "AC" )
-      onMessage( (MultilegOrderCancelReplace&)message, sessionID );
-    else
-    if( msgTypeValue == "AD" )
-      onMessage( (TradeCaptureReportRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AE" )
-      onMessage( (TradeCaptureReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AF" )
-      onMessage( (OrderMassStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AG" )
-      onMessage( (QuoteRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "AH" )
-      onMessage( (RFQRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AI" )
-      onMessage( (QuoteStatusReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AJ" )
-      onMessage( (QuoteResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "AK" )
-      onMessage( (Confirmation&)message, sessionID );
-    else
-    if( msgTypeValue == "AL" )
-      onMessage( (PositionMaintenanceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AM" )
-      onMessage( (PositionMaintenanceReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AN" )
-      onMessage( (RequestForPositions&)message, sessionID );
-    else
-    if( msgTypeValue == "AO" )
-      onMessage( (RequestForPositionsAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AP" )
-      onMessage( (PositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AQ" )
-      onMessage( (TradeCaptureReportRequestAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AR" )
-      onMessage( (TradeCaptureReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AS" )
-      onMessage( (AllocationReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AT" )
-      onMessage( (AllocationReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AU" )
-      onMessage( (ConfirmationAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AV" )
-      onMessage( (SettlementInstructionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AW" )
-      onMessage( (AssignmentReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AX" )
-      onMessage( (CollateralRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AY" )
-      onMessage( (CollateralAssignment&)message, sessionID );
-    else
-    if( msgTypeValue == "AZ" )
-      onMessage( (CollateralResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BA" )
-      onMessage( (CollateralReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BB" )
-      onMessage( (CollateralInquiry&)message, sessionID );
-    else
-    if( msgTypeValue == "BC" )
-      onMessage( (NetworkCounterpartySystemStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BD" )
-      onMessage( (NetworkCounterpartySystemStatusResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BE" )
-      onMessage( (UserRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BF" )
-      onMessage( (UserResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BG" )
-      onMessage( (CollateralInquiryAck&)message, sessionID );
-    else
-    if( msgTypeValue == "BH" )
-      onMessage( (ConfirmationRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BO" )
-      onMessage( (ContraryIntentionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BP" )
-      onMessage( (SecurityDefinitionUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BK" )
-      onMessage( (SecurityListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BL" )
-      onMessage( (AdjustedPositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BM" )
-      onMessage( (AllocationInstructionAlert&)message, sessionID );
-    else
-    if( msgTypeValue == "BN" )
-      onMessage( (ExecutionAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "BJ" )
-      onMessage( (TradingSessionList&)message, sessionID );
-    else
-    if( msgTypeValue == "BI" )
-      onMessage( (TradingSessionListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BQ" )
-      onMessage( (SettlementObligationReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BR" )
-      onMessage( (DerivativeSecurityListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BS" )
-      onMessage( (TradingSessionListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BT" )
-      onMessage( (MarketDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BU" )
-      onMessage( (MarketDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "BV" )
-      onMessage( (MarketDefinitionUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BW" )
-      onMessage( (ApplicationMessageRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BX" )
-      onMessage( (ApplicationMessageRequestAck&)message, sessionID );
-    else
-    if( msgTypeValue == "BY" )
-      onMessage( (ApplicationMessageReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BZ" )
-      onMessage( (OrderMassActionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "CA" )
-      onMessage( (OrderMassActionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "CB" )
-      onMessage( (UserNotification&)message, sessionID );
-    else
-    if( msgTypeValue == "CC" )
-      onMessage( (StreamAssignmentRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "CD" )
-      onMessage( (StreamAssignmentReport&)message, sessionID );
-    else
-    if( msgTypeValue == "CE" )
-      onMessage( (StreamAssignmentReportACK&)message, sessionID );
-    else onMessage( message, sessionID );
+    const std::string& msgTypeValue 
+      = message.getHeader().getField( FIX::FIELD::MsgType );
+
+    switch( FIX::Message::msgTypeKey( msgTypeValue ) )
+    {
+    case '6':
+      onMessage( (IOI&)message, sessionID ); break;
+    case '7':
+      onMessage( (Advertisement&)message, sessionID ); break;
+    case '8':
+      onMessage( (ExecutionReport&)message, sessionID ); break;
+    case '9':
+      onMessage( (OrderCancelReject&)message, sessionID ); break;
+    case 'B':
+      onMessage( (News&)message, sessionID ); break;
+    case 'C':
+      onMessage( (Email&)message, sessionID ); break;
+    case 'D':
+      onMessage( (NewOrderSingle&)message, sessionID ); break;
+    case 'E':
+      onMessage( (NewOrderList&)message, sessionID ); break;
+    case 'F':
+      onMessage( (OrderCancelRequest&)message, sessionID ); break;
+    case 'G':
+      onMessage( (OrderCancelReplaceRequest&)message, sessionID ); break;
+    case 'H':
+      onMessage( (OrderStatusRequest&)message, sessionID ); break;
+    case 'J':
+      onMessage( (AllocationInstruction&)message, sessionID ); break;
+    case 'K':
+      onMessage( (ListCancelRequest&)message, sessionID ); break;
+    case 'L':
+      onMessage( (ListExecute&)message, sessionID ); break;
+    case 'M':
+      onMessage( (ListStatusRequest&)message, sessionID ); break;
+    case 'N':
+      onMessage( (ListStatus&)message, sessionID ); break;
+    case 'P':
+      onMessage( (AllocationInstructionAck&)message, sessionID ); break;
+    case 'Q':
+      onMessage( (DontKnowTrade&)message, sessionID ); break;
+    case 'R':
+      onMessage( (QuoteRequest&)message, sessionID ); break;
+    case 'S':
+      onMessage( (Quote&)message, sessionID ); break;
+    case 'T':
+      onMessage( (SettlementInstructions&)message, sessionID ); break;
+    case 'V':
+      onMessage( (MarketDataRequest&)message, sessionID ); break;
+    case 'W':
+      onMessage( (MarketDataSnapshotFullRefresh&)message, sessionID ); break;
+    case 'X':
+      onMessage( (MarketDataIncrementalRefresh&)message, sessionID ); break;
+    case 'Y':
+      onMessage( (MarketDataRequestReject&)message, sessionID ); break;
+    case 'Z':
+      onMessage( (QuoteCancel&)message, sessionID ); break;
+    case 'a':
+      onMessage( (QuoteStatusRequest&)message, sessionID ); break;
+    case 'b':
+      onMessage( (MassQuoteAcknowledgement&)message, sessionID ); break;
+    case 'c':
+      onMessage( (SecurityDefinitionRequest&)message, sessionID ); break;
+    case 'd':
+      onMessage( (SecurityDefinition&)message, sessionID ); break;
+    case 'e':
+      onMessage( (SecurityStatusRequest&)message, sessionID ); break;
+    case 'f':
+      onMessage( (SecurityStatus&)message, sessionID ); break;
+    case 'g':
+      onMessage( (TradingSessionStatusRequest&)message, sessionID ); break;
+    case 'h':
+      onMessage( (TradingSessionStatus&)message, sessionID ); break;
+    case 'i':
+      onMessage( (MassQuote&)message, sessionID ); break;
+    case 'j':
+      onMessage( (BusinessMessageReject&)message, sessionID ); break;
+    case 'k':
+      onMessage( (BidRequest&)message, sessionID ); break;
+    case 'l':
+      onMessage( (BidResponse&)message, sessionID ); break;
+    case 'm':
+      onMessage( (ListStrikePrice&)message, sessionID ); break;
+    case 'o':
+      onMessage( (RegistrationInstructions&)message, sessionID ); break;
+    case 'p':
+      onMessage( (RegistrationInstructionsResponse&)message, sessionID ); break;
+    case 'q':
+      onMessage( (OrderMassCancelRequest&)message, sessionID ); break;
+    case 'r':
+      onMessage( (OrderMassCancelReport&)message, sessionID ); break;
+    case 's':
+      onMessage( (NewOrderCross&)message, sessionID ); break;
+    case 't':
+      onMessage( (CrossOrderCancelReplaceRequest&)message, sessionID ); break;
+    case 'u':
+      onMessage( (CrossOrderCancelRequest&)message, sessionID ); break;
+    case 'v':
+      onMessage( (SecurityTypeRequest&)message, sessionID ); break;
+    case 'w':
+      onMessage( (SecurityTypes&)message, sessionID ); break;
+    case 'x':
+      onMessage( (SecurityListRequest&)message, sessionID ); break;
+    case 'y':
+      onMessage( (SecurityList&)message, sessionID ); break;
+    case 'z':
+      onMessage( (DerivativeSecurityListRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'A':
+      onMessage( (DerivativeSecurityList&)message, sessionID ); break;
+    case ('A') * 256 + 'B':
+      onMessage( (NewOrderMultileg&)message, sessionID ); break;
+    case ('A') * 256 + 'C':
+      onMessage( (MultilegOrderCancelReplace&)message, sessionID ); break;
+    case ('A') * 256 + 'D':
+      onMessage( (TradeCaptureReportRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'E':
+      onMessage( (TradeCaptureReport&)message, sessionID ); break;
+    case ('A') * 256 + 'F':
+      onMessage( (OrderMassStatusRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'G':
+      onMessage( (QuoteRequestReject&)message, sessionID ); break;
+    case ('A') * 256 + 'H':
+      onMessage( (RFQRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'I':
+      onMessage( (QuoteStatusReport&)message, sessionID ); break;
+    case ('A') * 256 + 'J':
+      onMessage( (QuoteResponse&)message, sessionID ); break;
+    case ('A') * 256 + 'K':
+      onMessage( (Confirmation&)message, sessionID ); break;
+    case ('A') * 256 + 'L':
+      onMessage( (PositionMaintenanceRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'M':
+      onMessage( (PositionMaintenanceReport&)message, sessionID ); break;
+    case ('A') * 256 + 'N':
+      onMessage( (RequestForPositions&)message, sessionID ); break;
+    case ('A') * 256 + 'O':
+      onMessage( (RequestForPositionsAck&)message, sessionID ); break;
+    case ('A') * 256 + 'P':
+      onMessage( (PositionReport&)message, sessionID ); break;
+    case ('A') * 256 + 'Q':
+      onMessage( (TradeCaptureReportRequestAck&)message, sessionID ); break;
+    case ('A') * 256 + 'R':
+      onMessage( (TradeCaptureReportAck&)message, sessionID ); break;
+    case ('A') * 256 + 'S':
+      onMessage( (AllocationReport&)message, sessionID ); break;
+    case ('A') * 256 + 'T':
+      onMessage( (AllocationReportAck&)message, sessionID ); break;
+    case ('A') * 256 + 'U':
+      onMessage( (ConfirmationAck&)message, sessionID ); break;
+    case ('A') * 256 + 'V':
+      onMessage( (SettlementInstructionRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'W':
+      onMessage( (AssignmentReport&)message, sessionID ); break;
+    case ('A') * 256 + 'X':
+      onMessage( (CollateralRequest&)message, sessionID ); break;
+    case ('A') * 256 + 'Y':
+      onMessage( (CollateralAssignment&)message, sessionID ); break;
+    case ('A') * 256 + 'Z':
+      onMessage( (CollateralResponse&)message, sessionID ); break;
+    case ('B') * 256 + 'A':
+      onMessage( (CollateralReport&)message, sessionID ); break;
+    case ('B') * 256 + 'B':
+      onMessage( (CollateralInquiry&)message, sessionID ); break;
+    case ('B') * 256 + 'C':
+      onMessage( (NetworkCounterpartySystemStatusRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'D':
+      onMessage( (NetworkCounterpartySystemStatusResponse&)message, sessionID ); break;
+    case ('B') * 256 + 'E':
+      onMessage( (UserRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'F':
+      onMessage( (UserResponse&)message, sessionID ); break;
+    case ('B') * 256 + 'G':
+      onMessage( (CollateralInquiryAck&)message, sessionID ); break;
+    case ('B') * 256 + 'H':
+      onMessage( (ConfirmationRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'O':
+      onMessage( (ContraryIntentionReport&)message, sessionID ); break;
+    case ('B') * 256 + 'P':
+      onMessage( (SecurityDefinitionUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'K':
+      onMessage( (SecurityListUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'L':
+      onMessage( (AdjustedPositionReport&)message, sessionID ); break;
+    case ('B') * 256 + 'M':
+      onMessage( (AllocationInstructionAlert&)message, sessionID ); break;
+    case ('B') * 256 + 'N':
+      onMessage( (ExecutionAcknowledgement&)message, sessionID ); break;
+    case ('B') * 256 + 'J':
+      onMessage( (TradingSessionList&)message, sessionID ); break;
+    case ('B') * 256 + 'I':
+      onMessage( (TradingSessionListRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'Q':
+      onMessage( (SettlementObligationReport&)message, sessionID ); break;
+    case ('B') * 256 + 'R':
+      onMessage( (DerivativeSecurityListUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'S':
+      onMessage( (TradingSessionListUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'T':
+      onMessage( (MarketDefinitionRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'U':
+      onMessage( (MarketDefinition&)message, sessionID ); break;
+    case ('B') * 256 + 'V':
+      onMessage( (MarketDefinitionUpdateReport&)message, sessionID ); break;
+    case ('B') * 256 + 'W':
+      onMessage( (ApplicationMessageRequest&)message, sessionID ); break;
+    case ('B') * 256 + 'X':
+      onMessage( (ApplicationMessageRequestAck&)message, sessionID ); break;
+    case ('B') * 256 + 'Y':
+      onMessage( (ApplicationMessageReport&)message, sessionID ); break;
+    case ('B') * 256 + 'Z':
+      onMessage( (OrderMassActionReport&)message, sessionID ); break;
+    case ('C') * 256 + 'A':
+      onMessage( (OrderMassActionRequest&)message, sessionID ); break;
+    case ('C') * 256 + 'B':
+      onMessage( (UserNotification&)message, sessionID ); break;
+    case ('C') * 256 + 'C':
+      onMessage( (StreamAssignmentRequest&)message, sessionID ); break;
+    case ('C') * 256 + 'D':
+      onMessage( (StreamAssignmentReport&)message, sessionID ); break;
+    case ('C') * 256 + 'E':
+      onMessage( (StreamAssignmentReportACK&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
 
   };
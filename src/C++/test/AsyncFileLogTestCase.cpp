@@ -0,0 +1,145 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <AsyncFileLog.h>
+#include <Utility.h>
+#include <fstream>
+
+using namespace FIX;
+
+SUITE(AsyncFileLogTests)
+{
+
+const char* CURRENT = "log/FIX.4.2-ASYNCLOG-TEST.journal.current.bin";
+const char* BACKUP = "log/backup/FIX.4.2-ASYNCLOG-TEST.journal.backup.1.bin";
+
+std::vector<AsyncFileLog::Record> readJournal( const char* fileName )
+{
+  std::vector<AsyncFileLog::Record> records;
+  std::ifstream journal( fileName, std::ios::in | std::ios::binary );
+  if( !AsyncFileLog::readHeader( journal ) )
+    return records;
+
+  AsyncFileLog::Record record;
+  while( AsyncFileLog::readRecord( journal, record ) )
+    records.push_back( record );
+  return records;
+}
+
+struct asyncFileLogFixture
+{
+  asyncFileLogFixture()
+  : sessionID( BeginString( "FIX.4.2" ), SenderCompID( "ASYNCLOG" ), TargetCompID( "TEST" ) )
+  {
+    file_unlink( CURRENT );
+    file_unlink( BACKUP );
+  }
+
+  ~asyncFileLogFixture()
+  {
+    file_unlink( CURRENT );
+    file_unlink( BACKUP );
+  }
+
+  SessionID sessionID;
+};
+
+TEST_FIXTURE(asyncFileLogFixture, writeJournal)
+{
+  AsyncFileLog object( "log", "log" + file_separator() + "backup", sessionID );
+  CHECK_EQUAL( CURRENT, object.getFileName() );
+
+  object.onEvent( "EVENT1" );
+  object.onIncoming( "INCOMING1" );
+  object.onOutgoing( "OUTGOING1" );
+  object.flush();
+
+  std::vector<AsyncFileLog::Record> records = readJournal( CURRENT );
+  CHECK_EQUAL( 3U, records.size() );
+  if( records.size() != 3 ) return;
+
+  CHECK_EQUAL( AsyncFileLog::EVENT, records[0].kind );
+  CHECK_EQUAL( "EVENT1", records[0].text );
+  CHECK_EQUAL( AsyncFileLog::INCOMING, records[1].kind );
+  CHECK_EQUAL( AsyncFileLog::OUTGOING, records[2].kind );
+  CHECK( records[0].time <= records[2].time );
+
+  AsyncFileLog::Record record;
+  record.time = 1000000000LL * 86400 + 123456789;
+  record.text = "INCOMING1";
+  std::string line;
+  CHECK_EQUAL( "19700102-00:00:00.123 : INCOMING1",
+               AsyncFileLog::formatRecord( record, true, line ) );
+  CHECK_EQUAL( "19700102-00:00:00 : INCOMING1",
+               AsyncFileLog::formatRecord( record, false, line ) );
+}
+
+TEST_FIXTURE(asyncFileLogFixture, backupAndClear)
+{
+  AsyncFileLog object( "log", "log" + file_separator() + "backup", sessionID );
+
+  object.onEvent( "EVENT1" );
+  object.backup();
+  object.onEvent( "EVENT2" );
+  object.flush();
+
+  CHECK_EQUAL( 1U, readJournal( BACKUP ).size() );
+  std::vector<AsyncFileLog::Record> records = readJournal( CURRENT );
+  CHECK_EQUAL( 1U, records.size() );
+  if( records.size() == 1 )
+    CHECK_EQUAL( "EVENT2", records[0].text );
+
+  object.clear();
+  CHECK_EQUAL( 0U, readJournal( CURRENT ).size() );
+}
+
+TEST_FIXTURE(asyncFileLogFixture, dropWhenFull)
+{
+  const size_t count = 1000;
+  size_t dropped = 0;
+  {
+    AsyncFileLog object( "log", sessionID, 2, 60000 );
+    for( size_t i = 0; i < count; ++i )
+      object.onIncoming( "INCOMING" );
+    dropped = object.getDroppedCount();
+    object.flush();
+  }
+
+  // everything is either written or counted, and the count is logged
+  std::vector<AsyncFileLog::Record> records = readJournal( CURRENT );
+  size_t written = 0;
+  size_t reports = 0;
+  for( size_t i = 0; i < records.size(); ++i )
+  {
+    if( records[i].kind == AsyncFileLog::INCOMING ) ++written;
+    else ++reports;
+  }
+  CHECK_EQUAL( count, written + dropped );
+  CHECK_EQUAL( dropped != 0, reports != 0 );
+}
+
+}
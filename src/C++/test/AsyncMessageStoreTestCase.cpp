@@ -0,0 +1,251 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <TestHelper.h>
+#include <AsyncMessageStore.h>
+#include <FileStore.h>
+#include "MessageStoreTestCase.h"
+
+using namespace FIX;
+
+SUITE(AsyncMessageStoreTests)
+{
+
+struct asyncMessageStoreFixture
+{
+  asyncMessageStoreFixture( bool resetBefore, bool resetAfter )
+  : fileStoreFactory( "store" ), factory( fileStoreFactory )
+  {
+    if( resetBefore )
+      deleteSession( "ASYNC", "TEST" );
+
+    SessionID sessionID( BeginString( "FIX.4.2" ),
+                         SenderCompID( "ASYNC" ), TargetCompID( "TEST" ) );
+
+    object = factory.create( sessionID );
+
+    this->resetAfter = resetAfter;
+  }
+
+  ~asyncMessageStoreFixture()
+  {
+    factory.destroy( object );
+
+    if( resetAfter )
+      deleteSession( "ASYNC", "TEST" );
+  }
+
+  FileStoreFactory fileStoreFactory;
+  AsyncMessageStoreFactory factory;
+  MessageStore* object;
+  bool resetAfter;
+};
+
+struct resetBeforeAsyncMessageStoreFixture : asyncMessageStoreFixture
+{
+  resetBeforeAsyncMessageStoreFixture() : asyncMessageStoreFixture( true, false ) {}
+};
+
+struct resetAfterAsyncMessageStoreFixture : asyncMessageStoreFixture
+{
+  resetAfterAsyncMessageStoreFixture() : asyncMessageStoreFixture( false, true ) {}
+};
+
+struct resetBeforeAndAfterAsyncMessageStoreFixture : asyncMessageStoreFixture
+{
+  resetBeforeAndAfterAsyncMessageStoreFixture() : asyncMessageStoreFixture( true, true ) {}
+};
+
+struct noResetAsyncMessageStoreFixture : asyncMessageStoreFixture
+{
+  noResetAsyncMessageStoreFixture() : asyncMessageStoreFixture( false, false ) {}
+};
+
+TEST_FIXTURE(resetBeforeAndAfterAsyncMessageStoreFixture, setGet)
+{
+  CHECK_MESSAGE_STORE_SET_GET;
+}
+
+TEST_FIXTURE(resetBeforeAndAfterAsyncMessageStoreFixture, setGetWithQuote)
+{
+  CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
+}
+
+TEST_FIXTURE(resetBeforeAndAfterAsyncMessageStoreFixture, forEach)
+{
+  CHECK_MESSAGE_STORE_FOR_EACH;
+}
+
+TEST_FIXTURE(resetBeforeAsyncMessageStoreFixture, other)
+{
+  CHECK_MESSAGE_STORE_OTHER
+}
+
+TEST_FIXTURE(noResetAsyncMessageStoreFixture, reload)
+{
+  CHECK_MESSAGE_STORE_REFRESH
+}
+
+TEST_FIXTURE(resetAfterAsyncMessageStoreFixture, refresh)
+{
+  CHECK_MESSAGE_STORE_RELOAD
+}
+
+/// Holds back batches until it is released
+class HeldStore : public MemoryStore
+{
+public:
+  HeldStore() : held( true ), fail( false ) {}
+
+  void setBatch( const MessageBatch& batch ) throw ( IOException )
+  {
+    while( held ) process_sleep( 0.001 );
+    if( fail ) throw IOException( "failed" );
+    MemoryStore::setBatch( batch );
+  }
+
+  volatile bool held;
+  volatile bool fail;
+};
+
+class HeldStoreFactory : public MessageStoreFactory
+{
+public:
+  HeldStoreFactory() : pStore( 0 ) {}
+
+  MessageStore* create( const SessionID& )
+  { return pStore = new HeldStore(); }
+  void destroy( MessageStore* p )
+  { delete p; }
+
+  HeldStore* pStore;
+};
+
+TEST(servePendingMessages)
+{
+  HeldStoreFactory heldFactory;
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "ASYNC" ), TargetCompID( "HELD" ) );
+  AsyncMessageStore store( heldFactory, sessionID );
+
+  store.set( 1, "one" );
+  store.incrNextSenderMsgSeqNum();
+  store.set( 2, "two" );
+  store.incrNextSenderMsgSeqNum();
+  store.set( 3, "three" );
+  store.incrNextSenderMsgSeqNum();
+
+  CHECK_EQUAL( 4, store.getNextSenderMsgSeqNum() );
+  CHECK_EQUAL( 0, store.getDurableMsgSeqNum() );
+
+  std::vector<std::string> messages;
+  store.get( 2, 5, messages );
+  CHECK_EQUAL( 2U, messages.size() );
+  CHECK_EQUAL( "two", messages[ 0 ] );
+  CHECK_EQUAL( "three", messages[ 1 ] );
+
+  heldFactory.pStore->held = false;
+  store.flush();
+  CHECK_EQUAL( 3, store.getDurableMsgSeqNum() );
+  CHECK_EQUAL( 4, heldFactory.pStore->getNextSenderMsgSeqNum() );
+
+  store.get( 1, 3, messages );
+  CHECK_EQUAL( 3U, messages.size() );
+  CHECK_EQUAL( "one", messages[ 0 ] );
+}
+
+TEST(persistBeforeSend)
+{
+  MemoryStoreFactory memoryFactory;
+  AsyncMessageStoreFactory factory( memoryFactory, 2, true );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "ASYNC" ), TargetCompID( "SYNC" ) );
+  MessageStore* pStore = factory.create( sessionID );
+  AsyncMessageStore* pAsyncStore = static_cast<AsyncMessageStore*>( pStore );
+
+  for( int i = 1; i <= 10; ++i )
+  {
+    pStore->set( i, "message" );
+    CHECK_EQUAL( i, pAsyncStore->getDurableMsgSeqNum() );
+    pStore->incrNextSenderMsgSeqNum();
+  }
+
+  factory.destroy( pStore );
+}
+
+TEST(throwStoreErrors)
+{
+  HeldStoreFactory heldFactory;
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "ASYNC" ), TargetCompID( "FAIL" ) );
+  AsyncMessageStore store( heldFactory, sessionID );
+
+  heldFactory.pStore->held = false;
+  store.set( 1, "one" );
+  store.flush();
+
+  // both are queued before the writer gets to fail on them
+  heldFactory.pStore->held = true;
+  heldFactory.pStore->fail = true;
+  store.set( 2, "two" );
+  store.set( 3, "three" );
+  heldFactory.pStore->held = false;
+  CHECK_THROW( store.flush(), IOException );
+
+  // the failed messages are still there to be resent
+  std::vector<std::string> messages;
+  store.get( 1, 3, messages );
+  CHECK_EQUAL( 3U, messages.size() );
+  CHECK_EQUAL( "one", messages[ 0 ] );
+  CHECK_EQUAL( "two", messages[ 1 ] );
+  CHECK_EQUAL( "three", messages[ 2 ] );
+  CHECK_EQUAL( 1, store.getDurableMsgSeqNum() );
+
+  struct Collector : public StoredMessageCallback
+  {
+    void onMessage( const std::string& message )
+    { messages.push_back( message ); }
+    std::vector<std::string> messages;
+  } collector;
+  store.forEach( 2, 3, collector );
+  CHECK_EQUAL( 2U, collector.messages.size() );
+  CHECK_EQUAL( "three", collector.messages[ 1 ] );
+
+  // and later changes keep failing, even once the store works again
+  heldFactory.pStore->fail = false;
+  CHECK_THROW( store.set( 4, "four" ), IOException );
+  CHECK_THROW( store.incrNextSenderMsgSeqNum(), IOException );
+
+  store.reset();
+  store.get( 1, 3, messages );
+  CHECK_EQUAL( 0U, messages.size() );
+  store.set( 1, "one again" );
+  store.flush();
+  CHECK_EQUAL( 1, store.getDurableMsgSeqNum() );
+}
+
+}
@@ -0,0 +1,84 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <CharScanner.h>
+#include <string>
+
+using namespace FIX;
+
+SUITE(CharScannerTests)
+{
+
+TEST(field)
+{
+  std::string buffer;
+  const char* equalSign = 0;
+  const char* soh = 0;
+
+  // move the delimiters across every vector boundary
+  for( int padding = 0; padding < 70; ++padding )
+  {
+    buffer = std::string( padding, '1' ) + "=" + std::string( padding, 'X' ) + "\001" + "55=A\001";
+    const char* begin = buffer.data();
+    const char* end = begin + buffer.size();
+
+    CharScanner::field( begin, end, equalSign, soh );
+    CHECK_EQUAL( padding, equalSign - begin );
+    CHECK_EQUAL( 2 * padding + 1, soh - begin );
+
+    CharScanner::field( begin, begin + padding, equalSign, soh );
+    CHECK( equalSign == begin + padding );
+    CHECK( soh == begin + padding );
+
+    CharScanner::field( begin, begin + 2 * padding + 1, equalSign, soh );
+    CHECK( equalSign == begin + padding );
+    CHECK( soh == begin + 2 * padding + 1 );
+  }
+
+  buffer = "\00155=A";
+  CharScanner::field( buffer.data(), buffer.data() + buffer.size(), equalSign, soh );
+  CHECK_EQUAL( 3, equalSign - buffer.data() );
+  CHECK( soh == buffer.data() + buffer.size() );
+}
+
+TEST(sum)
+{
+  std::string buffer;
+  for( int length = 0; length < 200; ++length )
+  {
+    const char* begin = buffer.data();
+    const char* end = begin + buffer.size();
+    CHECK_EQUAL( CharScanner::scalarSum( begin, end ), CharScanner::sum( begin, end ) );
+    buffer += (char)( 0x80 + length );
+  }
+
+  std::string message = "8=FIX.4.2\0019=45\00135=0\00134=3\00149=TW\001"
+                        "52=20000426-12:05:06\00156=ISLD\001";
+  CHECK_EQUAL( 218u, CharScanner::sum( message.data(), message.data() + message.size() ) % 256 );
+}
+
+}
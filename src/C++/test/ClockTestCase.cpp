@@ -0,0 +1,82 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <Clock.h>
+#include <FieldConvertors.h>
+
+using namespace FIX;
+
+SUITE(ClockTests)
+{
+
+TEST(now)
+{
+  time_t before = time( 0 );
+  DateTime now = Clock::now();
+  time_t after = time( 0 );
+
+  DateTime first = DateTime::fromUtcTimeT( before );
+  DateTime last = DateTime::fromUtcTimeT( after + 1 );
+  CHECK( first <= now );
+  CHECK( now < last );
+  CHECK( now.m_time >= 0 && now.m_time < DateTime::MILLIS_PER_DAY );
+}
+
+TEST(format)
+{
+  UtcTimeStamp time( 16, 54, 32, 7, 25, 2, 2005 );
+  CHECK_EQUAL( "20050225-16:54:32", Clock::format( time, false ) );
+  CHECK_EQUAL( "20050225-16:54:32.007", Clock::format( time, true ) );
+
+  // same second again only changes the milliseconds
+  time.setMillisecond( 999 );
+  CHECK_EQUAL( "20050225-16:54:32.999", Clock::format( time, true ) );
+  time.setMillisecond( 120 );
+  CHECK_EQUAL( "20050225-16:54:32.120", Clock::format( time, true ) );
+
+  // same time of day on another date
+  UtcTimeStamp other( 16, 54, 32, 120, 26, 2, 2005 );
+  CHECK_EQUAL( "20050226-16:54:32.120", Clock::format( other, true ) );
+  CHECK_EQUAL( "20050225-16:54:33", Clock::format(
+    UtcTimeStamp( 16, 54, 33, 0, 25, 2, 2005 ), false ) );
+
+  char buffer[ Clock::MAX_FORMAT ];
+  UtcTimeStamp midnight( 0, 0, 0, 0, 1, 1, 2000 );
+  CHECK_EQUAL( 21, (int)Clock::format( midnight, true, buffer ) );
+  CHECK_EQUAL( "20000101-00:00:00.000", std::string( buffer, 21 ) );
+  CHECK_EQUAL( 17, (int)Clock::format( midnight, false, buffer ) );
+}
+
+TEST(roundTrip)
+{
+  DateTime now = Clock::now();
+  UtcTimeStamp time( now );
+  CHECK( time == UtcTimeStampConvertor::convert(
+    UtcTimeStampConvertor::convert( time, true ) ) );
+}
+
+}
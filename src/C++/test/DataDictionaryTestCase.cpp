@@ -602,5 +602,164 @@ TEST_FIXTURE( copyFixture, copy )
   CHECK_EQUAL( 2, delim );
 }
 
+
+TEST_FIXTURE( copyFixture, compiledCopy )
+{
+  object.compile();
+  CHECK( object.isCompiled() );
+
+  DataDictionary dataDictionary = object;
+  CHECK( dataDictionary.isCompiled() );
+
+  const DataDictionary* pDD = 0;
+  const DataDictionary* pCopyDD = 0;
+  int delim;
+  CHECK( object.getGroup( "A", 10, delim, pDD ) );
+  CHECK( dataDictionary.getGroup( "A", 10, delim, pCopyDD ) );
+  CHECK( pDD != pCopyDD );
+  CHECK( pCopyDD->isCompiled() );
+
+  TYPE::Type type;
+  CHECK( pCopyDD->getGroup( "A", 1, delim, pCopyDD ) );
+  CHECK( pCopyDD->getFieldType( FIELD::MsgType, type ) );
+  CHECK_EQUAL( TYPE::Char, type );
+  CHECK_EQUAL( 2, delim );
+}
+
+TEST_FIXTURE( checkIsInMessageFixture, compileAfterChange )
+{
+  object.compile();
+  CHECK( object.isCompiled() );
+
+  FIX40::TestRequest message( TestReqID( "1" ) );
+  message.setField( Symbol( "MSFT" ) );
+  CHECK_THROW( object.validate( message ), TagNotDefinedForMessage );
+
+  object.addField( FIELD::Symbol );
+  object.addMsgField( MsgType_TestRequest, FIELD::Symbol );
+  CHECK( !object.isCompiled() );
+  object.validate( message );
+
+  object.compile();
+  CHECK( object.isCompiled() );
+  object.validate( message );
+}
+
+TEST( compiledLookups )
+{
+  const char* specs[] = { "../spec/FIX42.xml", "../spec/FIX44.xml", "../spec/FIX50SP2.xml" };
+  const char chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+  std::vector<std::string> msgTypes;
+  for( const char* c = chars; *c; ++c )
+  {
+    msgTypes.push_back( std::string( 1, *c ) );
+    msgTypes.push_back( std::string( "A" ) + *c );
+    msgTypes.push_back( std::string( "B" ) + *c );
+  }
+  msgTypes.push_back( "" );
+  msgTypes.push_back( "UNKNOWN" );
+
+  std::vector<std::string> values;
+  for( const char* c = chars; *c; ++c )
+    values.push_back( std::string( 1, *c ) );
+  values.push_back( "" );
+  values.push_back( "10" );
+  values.push_back( "100" );
+  values.push_back( "1 2" );
+  values.push_back( "1 Z" );
+  values.push_back( "1 " );
+
+  for( size_t spec = 0; spec < sizeof(specs) / sizeof(specs[0]); ++spec )
+  {
+    DataDictionary compiled( specs[spec] );
+    CHECK( compiled.isCompiled() );
+
+    // adding a type it already has leaves the maps as they were
+    DataDictionary maps( compiled );
+    maps.addMsgType( "D" );
+    CHECK( !maps.isCompiled() );
+
+    for( int field = 0; field < 2000; ++field )
+    {
+      CHECK_EQUAL( maps.isField( field ), compiled.isField( field ) );
+      CHECK_EQUAL( maps.isHeaderField( field ), compiled.isHeaderField( field ) );
+      CHECK_EQUAL( maps.isTrailerField( field ), compiled.isTrailerField( field ) );
+      CHECK_EQUAL( maps.isDataField( field ), compiled.isDataField( field ) );
+      CHECK_EQUAL( maps.isMultipleValueField( field ), compiled.isMultipleValueField( field ) );
+      CHECK_EQUAL( maps.hasFieldValue( field ), compiled.hasFieldValue( field ) );
+
+      TYPE::Type mapsType = TYPE::Unknown, compiledType = TYPE::Unknown;
+      CHECK_EQUAL( maps.getFieldType( field, mapsType ),
+                   compiled.getFieldType( field, compiledType ) );
+      CHECK_EQUAL( mapsType, compiledType );
+
+      if( maps.hasFieldValue( field ) )
+      {
+        std::vector<std::string>::const_iterator value;
+        for( value = values.begin(); value != values.end(); ++value )
+          CHECK_EQUAL( maps.isFieldValue( field, *value ), compiled.isFieldValue( field, *value ) );
+      }
+
+      std::vector<std::string>::const_iterator msgType;
+      for( msgType = msgTypes.begin(); msgType != msgTypes.end(); ++msgType )
+      {
+        CHECK_EQUAL( maps.isMsgField( *msgType, field ), compiled.isMsgField( *msgType, field ) );
+        CHECK_EQUAL( maps.isRequiredField( *msgType, field ), compiled.isRequiredField( *msgType, field ) );
+
+        int mapsDelim = 0, compiledDelim = 0;
+        const DataDictionary* pMapsDD = 0;
+        const DataDictionary* pCompiledDD = 0;
+        CHECK_EQUAL( maps.getGroup( *msgType, field, mapsDelim, pMapsDD ),
+                     compiled.getGroup( *msgType, field, compiledDelim, pCompiledDD ) );
+        CHECK_EQUAL( mapsDelim, compiledDelim );
+      }
+    }
+
+    std::vector<std::string>::const_iterator msgType;
+    for( msgType = msgTypes.begin(); msgType != msgTypes.end(); ++msgType )
+      CHECK_EQUAL( maps.isMsgType( *msgType ), compiled.isMsgType( *msgType ) );
+  }
+}
+
+
+TEST( fieldValidation )
+{
+  DataDictionary object( "../spec/FIX44.xml" );
+  DataDictionary other( object );
+  DataDictionary::FieldValidation fieldValidation;
+  Message message;
+
+  std::string header = "8=FIX.4.4\0019=0\00135=D\00134=2\00149=FIXTEST\00152=20050225-16:54:32\00156=TW\001";
+  std::string body = "11=ID\00121=1\00138=100\00140=1\00154=1\00155=IBM\00160=20050225-16:54:32\001";
+  std::string trailer = "10=000\001";
+
+  message.setString( header + body + trailer, false, &object, &object, &fieldValidation );
+  CHECK( fieldValidation.passed( &object, &object ) );
+  CHECK( !fieldValidation.passed( &other, &other ) );
+  DataDictionary::validate( message, &object, &object, &fieldValidation );
+
+  message.setString( header + body + "54=Z\001" + trailer, false, &object, &object, &fieldValidation );
+  CHECK( !fieldValidation.passed( &object, &object ) );
+  CHECK_THROW( DataDictionary::validate( message, &object, &object, &fieldValidation ), RepeatedTag );
+
+  message.setString( header + "11=ID\00121=1\00138=100\00140=1\00154=Z\00155=IBM\00160=20050225-16:54:32\001" + trailer,
+                     false, &object, &object, &fieldValidation );
+  CHECK( !fieldValidation.passed( &object, &object ) );
+  CHECK_THROW( DataDictionary::validate( message, &object, &object, &fieldValidation ), IncorrectTagValue );
+
+  message.setString( header + body + "453=2\001448=A\001447=D\001452=1\001" + trailer, false, &object, &object, &fieldValidation );
+  CHECK( !fieldValidation.passed( &object, &object ) );
+  CHECK_THROW( DataDictionary::validate( message, &object, &object, &fieldValidation ), RepeatingGroupCountMismatch );
+
+  message.setString( header + body + "262=X\001" + trailer, false, &object, &object, &fieldValidation );
+  CHECK( !fieldValidation.passed( &object, &object ) );
+  CHECK_THROW( DataDictionary::validate( message, &object, &object, &fieldValidation ), TagNotDefinedForMessage );
+
+  message.setString( header + body + "453=1\001448=A\001447=D\001452=1\001" + trailer, false, &object, &object, &fieldValidation );
+  CHECK( fieldValidation.passed( &object, &object ) );
+  DataDictionary::validate( message, &object, &object, &fieldValidation );
+}
+
 }
 
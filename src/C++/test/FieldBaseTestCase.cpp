@@ -49,4 +49,34 @@ TEST(set)
   CHECK_EQUAL( 9lu, object.getLength() );
 }
 
+
+TEST(cachedValue)
+{
+  IntField integer( 34, 5 );
+  CHECK_EQUAL( 5, integer.getValue() );
+  integer.setString( "7" );
+  CHECK_EQUAL( 7, integer.getValue() );
+  CHECK_EQUAL( 7, integer.getValue() );
+  integer.setString( "X" );
+  CHECK_THROW( integer.getValue(), IncorrectDataFormat );
+
+  DoubleField real( 44 );
+  real.setString( "1.5" );
+  CHECK_EQUAL( 1.5, real.getValue() );
+  DoubleField copy( real );
+  CHECK_EQUAL( 1.5, copy.getValue() );
+  real.setString( "2.25" );
+  CHECK_EQUAL( 2.25, real.getValue() );
+  copy = real;
+  CHECK_EQUAL( 2.25, copy.getValue() );
+
+  UtcTimeStampField time( 52 );
+  time.setString( "20050225-16:54:32.123" );
+  CHECK_EQUAL( 16, time.getValue().getHour() );
+  CHECK_EQUAL( 123, time.getValue().getMillisecond() );
+  time.setString( "20050225-17:54:32" );
+  CHECK_EQUAL( 17, time.getValue().getHour() );
+  CHECK_EQUAL( 0, time.getValue().getMillisecond() );
+}
+
 }
@@ -202,6 +202,81 @@ TEST(doubleConvertFrom)
   CHECK_THROW( DoubleConvertor::convert( "." ), FieldConvertError );
 }
 
+TEST(decimalConvertTo)
+{
+  CHECK_EQUAL( "45.32", DecimalConvertor::convert( Decimal( 4532, -2 ) ) );
+  CHECK_EQUAL( "45.3200", DecimalConvertor::convert( Decimal( 453200, -4 ) ) );
+  CHECK_EQUAL( "45", DecimalConvertor::convert( Decimal( 45 ) ) );
+  CHECK_EQUAL( "4500", DecimalConvertor::convert( Decimal( 45, 2 ) ) );
+  CHECK_EQUAL( "0", DecimalConvertor::convert( Decimal() ) );
+  CHECK_EQUAL( "0", DecimalConvertor::convert( Decimal( 0, 3 ) ) );
+  CHECK_EQUAL( "0.000", DecimalConvertor::convert( Decimal( 0, -3 ) ) );
+  CHECK_EQUAL( "0.00001", DecimalConvertor::convert( Decimal( 1, -5 ) ) );
+  CHECK_EQUAL( "-0.00001", DecimalConvertor::convert( Decimal( -1, -5 ) ) );
+  CHECK_EQUAL( "-12.000000000001",
+               DecimalConvertor::convert( Decimal( -12000000000001LL, -12 ) ) );
+  CHECK_EQUAL( "-9223372036854775808",
+               DecimalConvertor::convert( Decimal( std::numeric_limits<long long>::min() ) ) );
+
+  CHECK_EQUAL( "1.500", DecimalConvertor::convert( Decimal( 15, -1 ), 3 ) );
+  CHECK_EQUAL( "45.00000", DecimalConvertor::convert( Decimal( 45 ), 5 ) );
+  CHECK_EQUAL( "-5.00", DecimalConvertor::convert( Decimal( -5 ), 2 ) );
+  CHECK_EQUAL( "-12.2345", DecimalConvertor::convert( Decimal( -122345, -4 ), 2 ) );
+  CHECK_EQUAL( "500.0", DecimalConvertor::convert( Decimal( 5, 2 ), 1 ) );
+}
+
+TEST(decimalConvertFrom)
+{
+  Decimal value = DecimalConvertor::convert( "45.3200" );
+  CHECK_EQUAL( 453200, value.getMantissa() );
+  CHECK_EQUAL( -4, value.getExponent() );
+  value = DecimalConvertor::convert( "-0045" );
+  CHECK_EQUAL( -45, value.getMantissa() );
+  CHECK_EQUAL( 0, value.getExponent() );
+  value = DecimalConvertor::convert( ".06" );
+  CHECK_EQUAL( 6, value.getMantissa() );
+  CHECK_EQUAL( -2, value.getExponent() );
+  value = DecimalConvertor::convert( "12." );
+  CHECK_EQUAL( 12, value.getMantissa() );
+  CHECK_EQUAL( 0, value.getExponent() );
+  value = DecimalConvertor::convert( "999999999999999999" );
+  CHECK_EQUAL( 999999999999999999LL, value.getMantissa() );
+  value = DecimalConvertor::convert( "0000000000000000000000.000000000000000001" );
+  CHECK_EQUAL( 1, value.getMantissa() );
+  CHECK_EQUAL( -18, value.getExponent() );
+
+  const char* values[] = { "45.32", "0.00340244000", "-12.000000000001", "0", "-1050" };
+  for( size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i )
+    CHECK_EQUAL( values[i], DecimalConvertor::convert( DecimalConvertor::convert( values[i] ) ) );
+
+  CHECK_THROW( DecimalConvertor::convert( "abc" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "123.A" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "123.45.67" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "." ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "-" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "1E5" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "1000000000000000000" ), FieldConvertError );
+}
+
+TEST(decimalCompare)
+{
+  CHECK( Decimal( 15, -1 ) == Decimal( 150, -2 ) );
+  CHECK( Decimal( 15, -1 ) < Decimal( 151, -2 ) );
+  CHECK( Decimal( -15, -1 ) < Decimal( 1 ) );
+  CHECK( Decimal( 3, 2 ) > Decimal( 29999, -2 ) );
+  CHECK( Decimal( 1, 18 ) > Decimal( 999999999999999999LL ) );
+  CHECK( Decimal( -1, 30 ) < Decimal( 1, -30 ) );
+  CHECK( Decimal( 0, 40 ) == Decimal( 0, -3 ) );
+  CHECK_EQUAL( 1.5, Decimal( 15, -1 ).toDouble() );
+  CHECK_EQUAL( 0.1, Decimal( 1, -1 ).toDouble() );
+  CHECK_EQUAL( 1500.0, Decimal( 15, 2 ).toDouble() );
+
+  Decimal rounded = Decimal::fromDouble( -1.005001, 2 );
+  CHECK_EQUAL( -101, rounded.getMantissa() );
+  CHECK_EQUAL( -2, rounded.getExponent() );
+}
+
 TEST(charConvertTo)
 {
   CHECK_EQUAL( "a", CharConvertor::convert( 'a' ) );
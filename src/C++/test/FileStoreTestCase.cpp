@@ -93,6 +93,11 @@ TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setGetWithQuote)
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
 }
 
+TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, forEach)
+{
+  CHECK_MESSAGE_STORE_FOR_EACH;
+}
+
 TEST_FIXTURE(resetBeforeFileStoreFixture, other)
 {
   CHECK_MESSAGE_STORE_OTHER
@@ -0,0 +1,214 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <fix42/FixedNewOrderSingle.h>
+#include <fix42/FixedExecutionReport.h>
+#include <fix42/NewOrderSingle.h>
+
+SUITE(FixedMessageTests)
+{
+
+struct fixedNewOrderSingleFixture
+{
+  fixedNewOrderSingleFixture()
+  : transactTime( 12, 30, 15, 17, 10, 2026 )
+  {
+    fixed.getHeader().setSenderCompID( "SENDER" );
+    fixed.getHeader().setTargetCompID( "TARGET" );
+    fixed.getHeader().setMsgSeqNum( 5 );
+    fixed.setClOrdID( "ORDERID" );
+    fixed.setHandlInst( '1' );
+    fixed.setSymbol( "LNUX" );
+    fixed.setSide( FIX::Side_BUY );
+    fixed.setTransactTime( transactTime );
+    fixed.setOrdType( FIX::OrdType_LIMIT );
+    fixed.setPrice( 12.25 );
+    fixed.setOrderQty( 100 );
+
+    message.getHeader().setField( FIX::SenderCompID( "SENDER" ) );
+    message.getHeader().setField( FIX::TargetCompID( "TARGET" ) );
+    message.getHeader().setField( FIX::MsgSeqNum( 5 ) );
+    message.set( FIX::ClOrdID( "ORDERID" ) );
+    message.set( FIX::HandlInst( '1' ) );
+    message.set( FIX::Symbol( "LNUX" ) );
+    message.set( FIX::Side( FIX::Side_BUY ) );
+    message.set( FIX::TransactTime( transactTime ) );
+    message.set( FIX::OrdType( FIX::OrdType_LIMIT ) );
+    message.set( FIX::Price( 12.25 ) );
+    message.set( FIX::OrderQty( 100 ) );
+  }
+
+  FIX::UtcTimeStamp transactTime;
+  FIX42::FixedNewOrderSingle fixed;
+  FIX42::NewOrderSingle message;
+};
+
+TEST_FIXTURE(fixedNewOrderSingleFixture, toString)
+{
+  FIX42::FixedNewOrderSingle::NoAllocs& alloc = fixed.getNoAllocs().add();
+  alloc.setAllocAccount( "ACCOUNT" );
+  alloc.setAllocShares( 100 );
+
+  FIX42::NewOrderSingle::NoAllocs group;
+  group.set( FIX::AllocAccount( "ACCOUNT" ) );
+  group.set( FIX::AllocShares( 100 ) );
+  message.addGroup( group );
+
+  CHECK_EQUAL( message.toString(), fixed.toString() );
+}
+
+TEST_FIXTURE(fixedNewOrderSingleFixture, setString)
+{
+  FIX42::NewOrderSingle::NoTradingSessions group;
+  for( int i = 0; i < 6; ++i )
+  {
+    group.set( FIX::TradingSessionID( FIX::IntConvertor::convert( i ) ) );
+    message.addGroup( group );
+  }
+
+  FIX42::FixedNewOrderSingle parsed;
+  parsed.setString( message.toString() );
+
+  CHECK_EQUAL( "SENDER", parsed.getHeader().getSenderCompID() );
+  CHECK_EQUAL( 5, parsed.getHeader().getMsgSeqNum() );
+  CHECK_EQUAL( "ORDERID", parsed.getClOrdID() );
+  CHECK_EQUAL( '1', parsed.getSide() );
+  CHECK_EQUAL( 12.25, parsed.getPrice() );
+  CHECK( transactTime == parsed.getTransactTime() );
+  CHECK( !parsed.isSetStopPx() );
+  CHECK_EQUAL( 6U, parsed.getNoTradingSessions().size() );
+  CHECK_EQUAL( "5", parsed.getNoTradingSessions()[ 5 ].getTradingSessionID() );
+  CHECK_EQUAL( message.toString(), parsed.toString() );
+
+  parsed.setString( fixed.toString() );
+  CHECK_EQUAL( 0U, parsed.getNoTradingSessions().size() );
+}
+
+TEST_FIXTURE(fixedNewOrderSingleFixture, getNotSet)
+{
+  CHECK_THROW( fixed.getStopPx(), FIX::FieldNotFound );
+  fixed.removePrice();
+  CHECK( !fixed.isSetPrice() );
+  CHECK_THROW( fixed.getPrice(), FIX::FieldNotFound );
+
+  fixed.clear();
+  CHECK( !fixed.isSetClOrdID() );
+  CHECK( !fixed.getHeader().isSetSenderCompID() );
+}
+
+TEST_FIXTURE(fixedNewOrderSingleFixture, setStringRejects)
+{
+  FIX42::NewOrderSingle::NoTradingSessions group;
+  group.set( FIX::TradingSessionID( "1" ) );
+  message.addGroup( group );
+  std::string string = message.toString();
+
+  FIX42::FixedNewOrderSingle parsed;
+  std::string mismatch = string;
+  mismatch.replace( mismatch.find( "386=1" ), 5, "386=2" );
+  CHECK_THROW( parsed.setString( mismatch ), FIX::RepeatingGroupCountMismatch );
+
+  message.setField( 9999, "UNKNOWN" );
+  CHECK_THROW( parsed.setString( message.toString() ),
+               FIX::TagNotDefinedForMessage );
+
+  FIX42::Message heartbeat( FIX::MsgType( "0" ) );
+  CHECK_THROW( parsed.setString( heartbeat.toString() ), FIX::InvalidMessage );
+}
+
+TEST_FIXTURE(fixedNewOrderSingleFixture, timestampMilliseconds)
+{
+  FIX::UtcTimeStamp withMilliseconds( 12, 30, 15, 250, 17, 10, 2026 );
+
+  // left out unless asked for, as by a TransactTime field
+  fixed.setTransactTime( withMilliseconds );
+  message.set( FIX::TransactTime( withMilliseconds ) );
+  CHECK_EQUAL( message.toString(), fixed.toString() );
+  CHECK( fixed.toString().find( "60=20261017-12:30:15\001" ) != std::string::npos );
+
+  fixed.setTransactTime( withMilliseconds, true );
+  message.set( FIX::TransactTime( withMilliseconds, true ) );
+  CHECK_EQUAL( message.toString(), fixed.toString() );
+  CHECK( fixed.toString().find( "60=20261017-12:30:15.250\001" ) != std::string::npos );
+
+  // and kept when parsed
+  FIX42::FixedNewOrderSingle parsed;
+  parsed.setString( fixed.toString() );
+  CHECK( withMilliseconds == parsed.getTransactTime() );
+  CHECK_EQUAL( fixed.toString(), parsed.toString() );
+
+  // written when asked for even when they are zero
+  fixed.setTransactTime( transactTime, true );
+  CHECK( fixed.toString().find( "60=20261017-12:30:15.000\001" ) != std::string::npos );
+}
+
+TEST_FIXTURE(fixedNewOrderSingleFixture, setStringValidates)
+{
+  std::string string = fixed.toString();
+  FIX42::FixedNewOrderSingle parsed;
+
+  std::string checkSum = string;
+  checkSum.replace( checkSum.find( "ORDERID" ), 7, "ORDERIE" );
+  CHECK_THROW( parsed.setString( checkSum ), FIX::InvalidMessage );
+  parsed.setString( checkSum, false );
+  CHECK_EQUAL( "ORDERIE", parsed.getClOrdID() );
+
+  std::string bodyLength = string;
+  bodyLength.replace( bodyLength.find( "ORDERID" ), 7, "ORDERIDX" );
+  CHECK_THROW( parsed.setString( bodyLength ), FIX::InvalidMessage );
+
+  std::string noCheckSum = string.substr( 0, string.find( "10=" ) );
+  CHECK_THROW( parsed.setString( noCheckSum ), FIX::InvalidMessage );
+
+  std::string trailing = string + "58=TEXT\001";
+  CHECK_THROW( parsed.setString( trailing ), FIX::InvalidMessage );
+
+  parsed.setString( string );
+  CHECK_EQUAL( string, parsed.toString() );
+}
+
+TEST(executionReportData)
+{
+  FIX42::FixedExecutionReport report;
+  report.setOrderID( "ORDERID" );
+  report.setExecType( FIX::ExecType_FILL );
+  report.setEncodedTextLen( 5 );
+  report.setEncodedText( std::string( "ab\001cd" ) );
+  FIX42::FixedExecutionReport::NoContraBrokers& broker
+    = report.getNoContraBrokers().add();
+  broker.setContraBroker( "BROKER" );
+  broker.setContraTradeQty( 10 );
+
+  FIX42::FixedExecutionReport parsed;
+  parsed.setString( report.toString() );
+  CHECK_EQUAL( std::string( "ab\001cd" ), parsed.getEncodedText() );
+  CHECK_EQUAL( 1U, parsed.getNoContraBrokers().size() );
+  CHECK_EQUAL( 10, parsed.getNoContraBrokers()[ 0 ].getContraTradeQty() );
+  CHECK_EQUAL( report.toString(), parsed.toString() );
+}
+
+}
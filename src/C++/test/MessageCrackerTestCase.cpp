@@ -0,0 +1,91 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <MessageCracker.h>
+#include <fix44/ExecutionReport.h>
+#include <fix44/CollateralInquiryAck.h>
+#include <fix50/ExecutionReport.h>
+
+SUITE(MessageCrackerTests)
+{
+
+class CountingCracker : public FIX::MessageCracker
+{
+public:
+  CountingCracker()
+  : fix44ExecutionReports( 0 ), fix44CollateralInquiryAcks( 0 ),
+    fix50ExecutionReports( 0 ) {}
+
+  void onMessage( const FIX44::ExecutionReport&, const FIX::SessionID& )
+  { ++fix44ExecutionReports; }
+  void onMessage( const FIX44::CollateralInquiryAck&, const FIX::SessionID& )
+  { ++fix44CollateralInquiryAcks; }
+  void onMessage( const FIX50::ExecutionReport&, const FIX::SessionID& )
+  { ++fix50ExecutionReports; }
+
+  int fix44ExecutionReports;
+  int fix44CollateralInquiryAcks;
+  int fix50ExecutionReports;
+};
+
+TEST(crackByMsgType)
+{
+  CountingCracker cracker;
+  FIX::SessionID sessionID( FIX::BeginString_FIX44, "SENDER", "TARGET" );
+
+  FIX44::ExecutionReport executionReport;
+  cracker.crack( (const FIX::Message&)executionReport, sessionID );
+  CHECK_EQUAL( 1, cracker.fix44ExecutionReports );
+
+  FIX44::CollateralInquiryAck collateralInquiryAck;
+  cracker.crack( (const FIX::Message&)collateralInquiryAck, sessionID );
+  CHECK_EQUAL( 1, cracker.fix44CollateralInquiryAcks );
+
+  FIX44::Message unknown( FIX::MsgType( "ZZ" ) );
+  CHECK_THROW( cracker.crack( (const FIX::Message&)unknown, sessionID ),
+               FIX::UnsupportedMessageType );
+}
+
+TEST(crackByApplVerID)
+{
+  CountingCracker cracker;
+  FIX::SessionID sessionID( FIX::BeginString_FIXT11, "SENDER", "TARGET" );
+
+  FIX50::ExecutionReport executionReport;
+  executionReport.getHeader().setField
+    ( FIX::ApplVerID( FIX::ApplVerID_FIX50 ) );
+  cracker.crack( (const FIX::Message&)executionReport, sessionID );
+  CHECK_EQUAL( 1, cracker.fix50ExecutionReports );
+  CHECK_EQUAL( 0, cracker.fix44ExecutionReports );
+
+  executionReport.getHeader().setField
+    ( FIX::ApplVerID( FIX::ApplVerID_FIX44 ) );
+  cracker.crack( (const FIX::Message&)executionReport, sessionID );
+  CHECK_EQUAL( 1, cracker.fix44ExecutionReports );
+}
+
+}
@@ -0,0 +1,111 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <MessagePool.h>
+#include <Message.h>
+#include <DataDictionary.h>
+#include <fix42/NewOrderList.h>
+#include <set>
+#include <typeinfo>
+
+using namespace FIX;
+
+SUITE(MessagePoolTests)
+{
+
+const char* newOrderList =
+  "8=FIX.4.2\0019=95\00135=E\00166=1\00168=3\00173=3\001"
+  "11=A\00154=1\00155=DELL\00167=1\001"
+  "11=B\00154=2\00155=LNUX\00167=2\001"
+  "11=C\00154=3\00155=RHAT\00167=3\001"
+  "394=0\00110=233\001";
+
+std::set<FieldMap*> groupsOf( const Message& message )
+{
+  std::set<FieldMap*> groups;
+  for( int num = 1; num <= 3; ++num )
+    groups.insert( message.getGroupPtr( num, FIELD::NoOrders ) );
+  return groups;
+}
+
+TEST(recycleMessages)
+{
+  Message* pMessage = MessagePool::acquire();
+  pMessage->getHeader().setField( MsgType( "D" ) );
+  pMessage->setField( ClOrdID( "ID" ) );
+  MessagePool::release( pMessage );
+
+  Message* pReused = MessagePool::acquire();
+  CHECK_EQUAL( pMessage, pReused );
+  CHECK( pReused->isEmpty() );
+  MessagePool::release( pReused );
+}
+
+TEST(recycleGroups)
+{
+  DataDictionary dataDictionary( "../spec/FIX42.xml" );
+  PooledMessage message;
+
+  message->setString( newOrderList, true, &dataDictionary );
+  std::set<FieldMap*> groups = groupsOf( *message );
+  message->clear();
+
+  message->setString( newOrderList, true, &dataDictionary );
+  CHECK( groups == groupsOf( *message ) );
+
+  FIX42::NewOrderList::NoOrders group;
+  message->getGroup( 3, group );
+  ClOrdID clOrdID;
+  group.get( clOrdID );
+  CHECK_EQUAL( "C", clOrdID.getValue() );
+}
+
+TEST(deleteDerivedObjects)
+{
+  MessagePool::release( new FIX42::NewOrderList );
+  MessagePool::releaseGroup( new FIX42::NewOrderList::NoOrders );
+
+  Message* pMessage = MessagePool::acquire();
+  CHECK( typeid( *pMessage ) == typeid( Message ) );
+  MessagePool::release( pMessage );
+}
+
+TEST(reuseAfterInvalidStructure)
+{
+  PooledMessage message;
+  int tag = 0;
+
+  message->setString
+    ( "8=FIX.4.2\0019=26\00135=0\00158=text\00149=SENDER\00110=100\001", false );
+  CHECK( !message->hasValidStructure( tag ) );
+  CHECK_EQUAL( 49, tag );
+
+  message->setString( "8=FIX.4.2\0019=12\00135=0\00149=SENDER\00110=100\001", false );
+  CHECK( message->hasValidStructure( tag ) );
+}
+
+}
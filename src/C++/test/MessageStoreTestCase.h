@@ -77,6 +77,39 @@
   CHECK_EQUAL( bothQuote.toString(), messages[2] );   \
   CHECK_EQUAL( escape.toString(), messages[3] );
 
+#define CHECK_MESSAGE_STORE_FOR_EACH                        \
+  struct Collect : public StoredMessageCallback             \
+  {                                                         \
+    void onMessage( const std::string& message )            \
+    { messages.push_back( message ); }                      \
+    std::vector < std::string > messages;                   \
+  };                                                        \
+                                                            \
+  std::vector < std::string > stored;                       \
+  for ( int i = 1; i <= 2500; ++i )                         \
+  {                                                         \
+    if ( i == 1200 ) continue;                              \
+    FIX42::Heartbeat heartbeat;                             \
+    heartbeat.getHeader().setField( MsgSeqNum( i ) );       \
+    stored.push_back( heartbeat.toString() );               \
+    object->set( i, stored.back() );                        \
+  }                                                         \
+                                                            \
+  Collect all;                                              \
+  object->forEach( 1, 3000, all );                          \
+  CHECK_EQUAL( 2499U, all.messages.size() );                \
+  CHECK( stored == all.messages );                          \
+                                                            \
+  Collect some;                                             \
+  object->forEach( 1100, 1300, some );                      \
+  CHECK_EQUAL( 200U, some.messages.size() );                \
+  CHECK_EQUAL( stored[ 1099 ], some.messages.front() );     \
+  CHECK_EQUAL( stored[ 1298 ], some.messages.back() );      \
+                                                            \
+  Collect none;                                             \
+  object->forEach( 2600, 3000, none );                      \
+  CHECK_EQUAL( 0U, none.messages.size() );
+
 #define CHECK_MESSAGE_STORE_OTHER                       \
   object->setNextSenderMsgSeqNum( 10 );                 \
   CHECK_EQUAL( 10, object->getNextSenderMsgSeqNum() );  \
@@ -291,6 +291,134 @@ TEST(copy)
   CHECK_EQUAL( object.toString(), copy2.toString() );
 }
 
+TEST(parsedFieldsOutliveString)
+{
+  FIX::Symbol symbol;
+  FIX::Message copy;
+  FIX::ClOrdID clOrdID;
+
+  {
+    FIX::Message object;
+    std::string str = "8=FIX.4.2\0019=43\00135=D\00134=3\00149=TW\001"
+                      "56=ISLD\00111=ID\00155=INTC\00154=1\00110=197\001";
+    object.setString( str );
+    str.assign( str.size(), 'x' );
+
+    object.getField( symbol );
+    copy = object;
+    const FIX::FieldBase& field = object.getFieldRef( FIX::FIELD::ClOrdID );
+    for( int i = 0; i < 64; ++i )
+      object.setField( FIX::Text( "text" ), false );
+    CHECK_EQUAL( "ID", field.getString() );
+    CHECK_EQUAL( "11=ID\001", field.getFixString() );
+
+    object.getField( clOrdID );
+    object.setString( "8=FIX.4.2\0019=24\00135=0\00134=4\00149=TW\001"
+                      "56=ISLD\00110=214\001" );
+  }
+
+  CHECK_EQUAL( "INTC", symbol.getValue() );
+  CHECK_EQUAL( "ID", clOrdID.getValue() );
+  CHECK_EQUAL( "8=FIX.4.2\0019=43\00135=D\00134=3\00149=TW\001"
+               "56=ISLD\00111=ID\00154=1\00155=INTC\00110=197\001",
+               copy.toString() );
+}
+
+TEST(setStringFromBuffer)
+{
+  char buffer[] = "8=FIX.4.2\0019=43\00135=D\00134=3\00149=TW\001"
+                  "56=ISLD\00111=ID\00155=INTC\00154=1\00110=197\001"
+                  "8=FIX.4.2";
+  const std::string::size_type length = sizeof( buffer ) - 10;
+
+  FIX::Message object;
+  object.setString( buffer, length, true, 0, 0, 0 );
+  std::fill( buffer, buffer + sizeof( buffer ), 'x' );
+
+  CHECK_EQUAL( "ID", object.getField( FIX::FIELD::ClOrdID ) );
+  CHECK_EQUAL( "INTC", object.getField( FIX::FIELD::Symbol ) );
+  CHECK_EQUAL( length, object.getRawString().size() );
+}
+
+TEST(removeParsedField)
+{
+  FIX::Message object;
+  object.setString( "8=FIX.4.2\0019=43\00135=D\00134=3\00149=TW\001"
+                    "56=ISLD\00111=ID\00155=INTC\00154=1\00110=197\001" );
+
+  object.removeField( FIX::FIELD::ClOrdID );
+  CHECK( !object.isSetField( FIX::FIELD::ClOrdID ) );
+  CHECK_EQUAL( "INTC", object.getField( FIX::FIELD::Symbol ) );
+  CHECK_EQUAL( "1", object.getField( FIX::FIELD::Side ) );
+
+  object.setField( FIX::ClOrdID( "ID2" ) );
+  CHECK_EQUAL( "ID2", object.getField( FIX::FIELD::ClOrdID ) );
+  std::string body;
+  CHECK_EQUAL( "11=ID2\00154=1\00155=INTC\001", object.FieldMap::calculateString( body ) );
+}
+
+TEST(removeMiddleField)
+{
+  FIX::Message object;
+  object.setField( FIX::ClOrdID( "ID" ) );
+  object.setField( FIX::Side( '1' ) );
+  object.setField( FIX::Symbol( "INTC" ) );
+  object.setField( FIX::Text( "text" ) );
+  const FIX::FieldBase& text = object.getFieldRef( FIX::FIELD::Text );
+
+  object.removeField( FIX::FIELD::Symbol );
+  CHECK_EQUAL( "text", text.getString() );
+
+  int tags[] = { FIX::FIELD::ClOrdID, FIX::FIELD::Side, FIX::FIELD::Text };
+  size_t count = 0;
+  FIX::FieldMap::iterator i;
+  for( i = object.begin(); i != object.end(); ++i, ++count )
+  {
+    CHECK( count < 3 );
+    if( count < 3 ) CHECK_EQUAL( tags[ count ], i->first );
+  }
+  CHECK_EQUAL( 3U, count );
+
+  object.setField( FIX::Account( "ACCT" ) );
+  CHECK_EQUAL( "text", text.getString() );
+  std::string body;
+  CHECK_EQUAL( "1=ACCT11=ID54=158=text",
+               object.FieldMap::calculateString( body ) );
+}
+
+TEST(toStringBodyLengthDigits)
+{
+  const int sizes[] = { 0, 1, 5, 90, 95, 990, 995, 100000 };
+  for( size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i )
+  {
+    FIX::Message object;
+    object.getHeader().setField( FIX::BeginString( "FIX.4.2" ) );
+    object.getHeader().setField( FIX::MsgType( "0" ) );
+    object.getTrailer().setField( FIX::CheckSum( 0 ) );
+    if( sizes[ i ] )
+      object.setField( FIX::Text( std::string( sizes[ i ], 'x' ) ) );
+
+    std::string body = "35=0\001";
+    if( sizes[ i ] )
+      body += "58=" + std::string( sizes[ i ], 'x' ) + "\001";
+    std::string expected = "8=FIX.4.2\0019="
+      + FIX::IntConvertor::convert( (int)body.size() ) + "\001" + body;
+    int checksum = 0;
+    for( std::string::size_type j = 0; j < expected.size(); ++j )
+      checksum += (unsigned char)expected[ j ];
+    expected += "10=" + FIX::CheckSumConvertor::convert( checksum % 256 ) + "\001";
+
+    std::string str = "previous contents";
+    CHECK_EQUAL( expected, object.toString( str ) );
+    CHECK_EQUAL( (int)body.size(), object.bodyLength() );
+    CHECK_EQUAL( checksum % 256, object.checkSum() );
+    CHECK_EQUAL( expected, object.toString() );
+
+    std::string::size_type start = object.toBuffer( str );
+    CHECK_EQUAL( expected, str.substr( start ) );
+  }
+}
+
 TEST(checkSum)
 {
   FIX::Message object;
@@ -1208,4 +1336,68 @@ TEST(newOrderCrossSetString)
   CHECK_EQUAL( 100, orderQty );
 }
 
+TEST(readHeader)
+{
+  FIX42::NewOrderSingle order;
+  order.getHeader().setField( FIX::SecureDataLen( 3 ) );
+  order.getHeader().setField( FIX::SecureData( "a\001b" ) );
+  order.getHeader().setField( FIX::MsgSeqNum( 12 ) );
+  order.set( FIX::ClOrdID( "ID" ) );
+
+  std::string msgType;
+  int msgSeqNum = 0;
+  CHECK( FIX::Message::readHeader( order.toString(), msgType, msgSeqNum ) );
+  CHECK_EQUAL( "D", msgType );
+  CHECK_EQUAL( 12, msgSeqNum );
+
+  FIX42::NewOrderSingle noSeqNum;
+  CHECK( !FIX::Message::readHeader( noSeqNum.toString(), msgType, msgSeqNum ) );
+  CHECK( !FIX::Message::readHeader( "35=D\00134=1\001", msgType, msgSeqNum ) );
+}
+
+TEST(toPossDup)
+{
+  FIX42::NewOrderSingle order;
+  FIX::Header& header = order.getHeader();
+  header.setField( FIX::SenderCompID( "SENDER" ) );
+  header.setField( FIX::TargetCompID( "TARGET" ) );
+  header.setField( FIX::MsgSeqNum( 12 ) );
+  header.setField( FIX::FIELD::SendingTime, "20261017-10:00:00.000" );
+  header.setField( FIX::DeliverToCompID( "DELIVER" ) );
+  order.set( FIX::ClOrdID( "ID" ) );
+  order.set( FIX::Symbol( "LNUX" ) );
+
+  FIX42::NewOrderSingle expected = order;
+  expected.getHeader().setField( FIX::PossDupFlag( true ) );
+  expected.getHeader().setField( FIX::FIELD::SendingTime, "20261017-11:00:00.000" );
+  expected.getHeader().setField( FIX::FIELD::OrigSendingTime, "20261017-10:00:00.000" );
+
+  std::string result;
+  std::string::size_type start = 0;
+  CHECK( FIX::Message::toPossDup
+         ( order.toString(), "20261017-11:00:00.000", result, start ) );
+  CHECK_EQUAL( expected.toString(), result.substr( start ) );
+  FIX::Message parsed( result.substr( start ), true );
+
+  // a message resent before keeps only the new values
+  CHECK( FIX::Message::toPossDup
+         ( expected.toString(), "20261017-11:00:00.000", result, start ) );
+  expected.getHeader().setField( FIX::FIELD::OrigSendingTime, "20261017-11:00:00.000" );
+  CHECK_EQUAL( expected.toString(), result.substr( start ) );
+
+  header.removeField( FIX::FIELD::SendingTime );
+  CHECK( !FIX::Message::toPossDup
+         ( order.toString(), "20261017-11:00:00.000", result, start ) );
+  CHECK( !FIX::Message::toPossDup( "8=FIX.4.2\00135=D\001", "", result, start ) );
+}
+
+TEST(msgTypeKey)
+{
+  CHECK_EQUAL( '8', FIX::Message::msgTypeKey( "8" ) );
+  CHECK_EQUAL( 'B' * 256 + 'G', FIX::Message::msgTypeKey( "BG" ) );
+  CHECK_EQUAL( ('X' * 256 + 'Y') * 256 + 'Z', FIX::Message::msgTypeKey( "XYZ" ) );
+  CHECK_EQUAL( -1, FIX::Message::msgTypeKey( "" ) );
+  CHECK_EQUAL( -1, FIX::Message::msgTypeKey( "ABCD" ) );
+}
+
 }
@@ -0,0 +1,239 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <TestHelper.h>
+#include <MmapFileStore.h>
+#include <FileStore.h>
+#include "MessageStoreTestCase.h"
+#include <fstream>
+#include <iterator>
+
+using namespace FIX;
+
+SUITE(MmapFileStoreTests)
+{
+
+struct mmapFileStoreFixture
+{
+  mmapFileStoreFixture( bool resetBefore, bool resetAfter )
+  : factory( "store" )
+  {
+    if( resetBefore )
+      deleteSession( "MMAP", "TEST" );
+
+    SessionID sessionID( BeginString( "FIX.4.2" ),
+                         SenderCompID( "MMAP" ), TargetCompID( "TEST" ) );
+
+    object = factory.create( sessionID );
+
+    this->resetAfter = resetAfter;
+  }
+
+  ~mmapFileStoreFixture()
+  {
+    factory.destroy( object );
+
+    if( resetAfter )
+      deleteSession( "MMAP", "TEST" );
+  }
+
+  MmapFileStoreFactory factory;
+  MessageStore* object;
+  bool resetAfter;
+};
+
+struct resetBeforeMmapFileStoreFixture : mmapFileStoreFixture
+{
+  resetBeforeMmapFileStoreFixture() : mmapFileStoreFixture( true, false ) {}
+};
+
+struct resetAfterMmapFileStoreFixture : mmapFileStoreFixture
+{
+  resetAfterMmapFileStoreFixture() : mmapFileStoreFixture( false, true ) {}
+};
+
+struct resetBeforeAndAfterMmapFileStoreFixture : mmapFileStoreFixture
+{
+  resetBeforeAndAfterMmapFileStoreFixture() : mmapFileStoreFixture( true, true ) {}
+};
+
+struct noResetMmapFileStoreFixture : mmapFileStoreFixture
+{
+  noResetMmapFileStoreFixture() : mmapFileStoreFixture( false, false ) {}
+};
+
+TEST_FIXTURE(resetBeforeAndAfterMmapFileStoreFixture, setGet)
+{
+  CHECK_MESSAGE_STORE_SET_GET;
+}
+
+TEST_FIXTURE(resetBeforeAndAfterMmapFileStoreFixture, setGetWithQuote)
+{
+  CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
+}
+
+TEST_FIXTURE(resetBeforeAndAfterMmapFileStoreFixture, forEach)
+{
+  CHECK_MESSAGE_STORE_FOR_EACH;
+}
+
+TEST_FIXTURE(resetBeforeMmapFileStoreFixture, other)
+{
+  CHECK_MESSAGE_STORE_OTHER
+}
+
+TEST_FIXTURE(noResetMmapFileStoreFixture, reload)
+{
+  CHECK_MESSAGE_STORE_REFRESH
+}
+
+TEST_FIXTURE(resetAfterMmapFileStoreFixture, refresh)
+{
+  CHECK_MESSAGE_STORE_RELOAD
+}
+
+TEST(growAndReopen)
+{
+  deleteSession( "MMAP", "GROW" );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "MMAP" ), TargetCompID( "GROW" ) );
+
+  std::vector<std::string> messages;
+  {
+    MmapFileStore store( "store", sessionID, 64, 10 );
+    for( int i = 1; i <= 100; ++i )
+    {
+      store.set( i, std::string( i, 'a' + i % 26 ) );
+      store.incrNextSenderMsgSeqNum();
+    }
+  }
+
+  MmapFileStore store( "store", sessionID, 64 );
+  CHECK_EQUAL( 101, store.getNextSenderMsgSeqNum() );
+  store.get( 1, 100, messages );
+  CHECK_EQUAL( 100U, messages.size() );
+  for( int i = 1; i <= 100; ++i )
+    CHECK_EQUAL( std::string( i, 'a' + i % 26 ), messages[ i - 1 ] );
+
+  store.set( 101, "next" );
+  store.sync();
+  store.get( 100, 200, messages );
+  CHECK_EQUAL( 2U, messages.size() );
+  CHECK_EQUAL( "next", messages[ 1 ] );
+
+  store.reset();
+  store.get( 1, 200, messages );
+  CHECK_EQUAL( 0U, messages.size() );
+  CHECK_EQUAL( 1, store.getNextSenderMsgSeqNum() );
+  deleteSession( "MMAP", "GROW" );
+}
+
+TEST(seqNumsFile)
+{
+  deleteSession( "MMAP", "SEQNUMS" );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "MMAP" ), TargetCompID( "SEQNUMS" ) );
+
+  {
+    MmapFileStore store( "store", sessionID );
+    store.setNextSenderMsgSeqNum( 12 );
+    store.setNextTargetMsgSeqNum( 345 );
+  }
+
+  std::ifstream stream( "store/FIX.4.2-MMAP-SEQNUMS.seqnums", std::ios::binary );
+  std::string contents( ( std::istreambuf_iterator<char>( stream ) ),
+                        std::istreambuf_iterator<char>() );
+  stream.close();
+  CHECK_EQUAL( "0000000012 : 0000000345", contents );
+
+  FileStore store( "store", sessionID );
+  CHECK_EQUAL( 12, store.getNextSenderMsgSeqNum() );
+  CHECK_EQUAL( 345, store.getNextTargetMsgSeqNum() );
+  store.reset();
+  deleteSession( "MMAP", "SEQNUMS" );
+}
+
+TEST(syncIntervalAfterWritesStop)
+{
+  deleteSession( "MMAP", "INTERVAL" );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "MMAP" ), TargetCompID( "INTERVAL" ) );
+
+  MmapFileStore store( "store", sessionID,
+                       MmapFileStore::DEFAULT_SEGMENT_SIZE, 0, 50 );
+  store.sync();
+  CHECK( !store.hasPendingWrites() );
+
+  store.set( 1, "first" );
+  store.incrNextSenderMsgSeqNum();
+  CHECK( store.hasPendingWrites() );
+  store.onTimer();
+  CHECK( store.hasPendingWrites() );
+
+  // nothing else is written, the timer alone writes the changes through
+  process_sleep( 0.1 );
+  store.onTimer();
+  CHECK( !store.hasPendingWrites() );
+
+  MmapFileStore noInterval( "store", sessionID );
+  noInterval.set( 2, "second" );
+  CHECK( !noInterval.hasPendingWrites() );
+  deleteSession( "MMAP", "INTERVAL" );
+}
+
+TEST(importFileStore)
+{
+  deleteSession( "MMAP", "IMPORT" );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "MMAP" ), TargetCompID( "IMPORT" ) );
+
+  {
+    FileStore store( "store", sessionID );
+    store.set( 1, "first" );
+    store.set( 2, "second" );
+    store.set( 2, "second again" );
+    store.setNextSenderMsgSeqNum( 3 );
+    store.setNextTargetMsgSeqNum( 7 );
+  }
+
+  MmapFileStore store( "store", sessionID );
+  std::vector<std::string> messages;
+  store.get( 1, 2, messages );
+  CHECK_EQUAL( 2U, messages.size() );
+  CHECK_EQUAL( "first", messages[ 0 ] );
+  CHECK_EQUAL( "second again", messages[ 1 ] );
+  CHECK_EQUAL( 3, store.getNextSenderMsgSeqNum() );
+  CHECK_EQUAL( 7, store.getNextTargetMsgSeqNum() );
+
+  store.reset();
+  store.refresh();
+  store.get( 1, 2, messages );
+  CHECK_EQUAL( 0U, messages.size() );
+  deleteSession( "MMAP", "IMPORT" );
+}
+
+}
@@ -29,6 +29,7 @@
 #include <UnitTest++.h>
 #include <TestHelper.h>
 #include <MySQLStore.h>
+#include <MySQLLog.h>
 #include "MessageStoreTestCase.h"
 
 using namespace FIX;
@@ -36,11 +37,77 @@ using namespace FIX;
 SUITE(MySQLStoreTests)
 {
 
+/// The database configured in ut.cfg
+struct mySQLDatabase
+{
+  mySQLDatabase()
+  : database( MySQLStoreFactory::DEFAULT_DATABASE ),
+    user( MySQLStoreFactory::DEFAULT_USER ),
+    password( MySQLStoreFactory::DEFAULT_PASSWORD ),
+    host( MySQLStoreFactory::DEFAULT_HOST ),
+    port( MySQLStoreFactory::DEFAULT_PORT )
+  {
+    const Dictionary& settings = TestSettings::sessionSettings.get();
+    try { database = settings.getString( MYSQL_STORE_DATABASE ); }
+    catch( ConfigError& ) {}
+    try { user = settings.getString( MYSQL_STORE_USER ); }
+    catch( ConfigError& ) {}
+    try { password = settings.getString( MYSQL_STORE_PASSWORD ); }
+    catch( ConfigError& ) {}
+    try { host = settings.getString( MYSQL_STORE_HOST ); }
+    catch( ConfigError& ) {}
+    try { port = ( short ) settings.getInt( MYSQL_STORE_PORT ); }
+    catch( ConfigError& ) {}
+  }
+
+  /// Rows logged by a test session
+  int rows( const std::string& table, const std::string& senderCompID )
+  {
+    MySQLConnection connection( database, user, password, host, port );
+    MySQLQuery query( "SELECT count(*) FROM " + table
+                      + " WHERE sendercompid=\"" + senderCompID + "\"" );
+    if( !connection.execute( query ) )
+      query.throwException();
+    return atol( query.getValue( 0, 0 ) );
+  }
+
+  std::string database;
+  std::string user;
+  std::string password;
+  std::string host;
+  short port;
+};
+
+/// Whether there is a database to run the tests against, they are
+/// skipped without one
+bool mySQLAvailable()
+{
+  static int available = -1;
+  if( available < 0 )
+  {
+    mySQLDatabase db;
+    try
+    {
+      MySQLConnection connection( db.database, db.user, db.password, db.host, db.port );
+      available = 1;
+    }
+    catch( ConfigError& e )
+    {
+      std::cerr << "Skipping MySQL tests: " << e.what() << std::endl;
+      available = 0;
+    }
+  }
+  return available == 1;
+}
+
 struct mySQLStoreFixture
 {
   mySQLStoreFixture( bool reset )
-  : factory( TestSettings::sessionSettings.get() )
+  : factory( TestSettings::sessionSettings.get() ), object( 0 )
   {
+    if( !mySQLAvailable() )
+      return;
+
     SessionID sessionID( BeginString( "FIX.4.2" ),
                          SenderCompID( "SETGET" ), TargetCompID( "TEST" ) );
 
@@ -62,7 +129,8 @@ struct mySQLStoreFixture
 
   ~mySQLStoreFixture()
   {
-    factory.destroy( object );
+    if( object )
+      factory.destroy( object );
   }
 
   MySQLStoreFactory factory;
@@ -82,29 +150,111 @@ struct resetMySQLStoreFixture : mySQLStoreFixture
 
 TEST_FIXTURE(resetMySQLStoreFixture, setGet)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
 TEST_FIXTURE(resetMySQLStoreFixture, setGetWithQuote)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
 }
 
+TEST_FIXTURE(resetMySQLStoreFixture, forEach)
+{
+  if( !object ) return;
+  CHECK_MESSAGE_STORE_FOR_EACH;
+}
+
 TEST_FIXTURE(resetMySQLStoreFixture, other)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_OTHER
 }
 
 TEST_FIXTURE(noResetMySQLStoreFixture, reload)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_RELOAD
 }
 
 TEST_FIXTURE(noResetMySQLStoreFixture, refresh)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_REFRESH
 }
 
+TEST(setBatchReplacesStored)
+{
+  if( !mySQLAvailable() ) return;
+
+  MySQLStoreFactory factory( TestSettings::sessionSettings.get() );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "BATCH" ), TargetCompID( "TEST" ) );
+  MySQLStore* pStore = static_cast<MySQLStore*>( factory.create( sessionID ) );
+  pStore->reset();
+  pStore->set( 2, "old" );
+
+  // the INSERT of the second batch of two fails on the stored message
+  std::string first = "first", second = "second's", third = "third";
+  MessageBatch batch;
+  batch.push_back( std::make_pair( 1, &first ) );
+  batch.push_back( std::make_pair( 2, &second ) );
+  batch.push_back( std::make_pair( 3, &third ) );
+  pStore->setBatchSize( 2 );
+  pStore->setBatch( batch );
+
+  std::vector<std::string> messages;
+  pStore->get( 1, 3, messages );
+  CHECK_EQUAL( 3U, messages.size() );
+  CHECK_EQUAL( "first", messages[ 0 ] );
+  CHECK_EQUAL( "second's", messages[ 1 ] );
+  CHECK_EQUAL( "third", messages[ 2 ] );
+
+  pStore->reset();
+  factory.destroy( pStore );
+}
+
+TEST(batchRows)
+{
+  // batches are split into the batch size and powers of two below it
+  CHECK_EQUAL( 100, MySQLQuery::batchRows( 250, 100 ) );
+  CHECK_EQUAL( 100, MySQLQuery::batchRows( 100, 100 ) );
+  CHECK_EQUAL( 64, MySQLQuery::batchRows( 99, 100 ) );
+  CHECK_EQUAL( 2, MySQLQuery::batchRows( 3, 100 ) );
+  CHECK_EQUAL( 1, MySQLQuery::batchRows( 1, 100 ) );
+  CHECK_EQUAL( (int)MySQLQuery::MAX_BATCH_ROWS,
+               MySQLQuery::batchRows( 5000, 5000 ) );
+}
+
+TEST(logFlushInterval)
+{
+  if( !mySQLAvailable() ) return;
+
+  mySQLDatabase db;
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "LOG" ), TargetCompID( "TEST" ) );
+  MySQLLog log( sessionID, db.database, db.user, db.password, db.host, db.port );
+  log.clear();
+  log.setBatchSize( 10 );
+  log.setFlushInterval( 50 );
+
+  log.onIncoming( "incoming with a \" quote" );
+  log.onEvent( "event" );
+  CHECK( log.hasPendingWrites() );
+  log.onTimer();
+  CHECK( log.hasPendingWrites() );
+  CHECK_EQUAL( 0, db.rows( "messages_log", "LOG" ) );
+
+  // nothing else is logged, the timer alone writes the rows
+  process_sleep( 0.1 );
+  log.onTimer();
+  CHECK( !log.hasPendingWrites() );
+  CHECK_EQUAL( 1, db.rows( "messages_log", "LOG" ) );
+  CHECK_EQUAL( 1, db.rows( "event_log", "LOG" ) );
+  log.clear();
+}
+
 }
 
 #endif
@@ -90,6 +90,11 @@ TEST_FIXTURE(resetOdbcStoreFixture, setGetWithQuote)
   //CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
 }
 
+TEST_FIXTURE(resetOdbcStoreFixture, forEach)
+{
+  CHECK_MESSAGE_STORE_FOR_EACH;
+}
+
 TEST_FIXTURE(resetOdbcStoreFixture, other)
 {
   CHECK_MESSAGE_STORE_OTHER
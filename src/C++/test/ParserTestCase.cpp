@@ -110,6 +110,30 @@ TEST_FIXTURE(readFixMessageFixture, readFixMessage)
   CHECK_EQUAL( fixMsg3, readFixMsg );
 }
 
+TEST_FIXTURE(readFixMessageFixture, readFixMessageWithoutCopy)
+{
+  const char* data = 0;
+  std::string::size_type length = 0;
+
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg1, std::string( data, length ) );
+
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg2, std::string( data, length ) );
+
+  object.addToStream( "garbage" + fixMsg1.substr( 0, 20 ) );
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg3, std::string( data, length ) );
+
+  CHECK( !object.readFixMessage( data, length ) );
+  object.addToStream( fixMsg1.substr( 20 ) + fixMsg2 );
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg1, std::string( data, length ) );
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg2, std::string( data, length ) );
+  CHECK( !object.readFixMessage( data, length ) );
+}
+
 struct readPartialFixMessageFixture
 {
   readPartialFixMessageFixture()
@@ -29,6 +29,7 @@
 #include <UnitTest++.h>
 #include <TestHelper.h>
 #include <PostgreSQLStore.h>
+#include <PostgreSQLLog.h>
 #include "MessageStoreTestCase.h"
 
 using namespace FIX;
@@ -36,11 +37,77 @@ using namespace FIX;
 SUITE(PostgreSQLStoreTests)
 {
 
+/// The database configured in ut.cfg
+struct postgreSQLDatabase
+{
+  postgreSQLDatabase()
+  : database( PostgreSQLStoreFactory::DEFAULT_DATABASE ),
+    user( PostgreSQLStoreFactory::DEFAULT_USER ),
+    password( PostgreSQLStoreFactory::DEFAULT_PASSWORD ),
+    host( PostgreSQLStoreFactory::DEFAULT_HOST ),
+    port( PostgreSQLStoreFactory::DEFAULT_PORT )
+  {
+    const Dictionary& settings = TestSettings::sessionSettings.get();
+    try { database = settings.getString( POSTGRESQL_STORE_DATABASE ); }
+    catch( ConfigError& ) {}
+    try { user = settings.getString( POSTGRESQL_STORE_USER ); }
+    catch( ConfigError& ) {}
+    try { password = settings.getString( POSTGRESQL_STORE_PASSWORD ); }
+    catch( ConfigError& ) {}
+    try { host = settings.getString( POSTGRESQL_STORE_HOST ); }
+    catch( ConfigError& ) {}
+    try { port = ( short ) settings.getInt( POSTGRESQL_STORE_PORT ); }
+    catch( ConfigError& ) {}
+  }
+
+  /// Rows logged by a test session
+  int rows( const std::string& table, const std::string& senderCompID )
+  {
+    PostgreSQLConnection connection( database, user, password, host, port );
+    PostgreSQLQuery query( "SELECT count(*) FROM " + table
+                           + " WHERE sendercompid='" + senderCompID + "'" );
+    if( !connection.execute( query ) )
+      query.throwException();
+    return atol( query.getValue( 0, 0 ) );
+  }
+
+  std::string database;
+  std::string user;
+  std::string password;
+  std::string host;
+  short port;
+};
+
+/// Whether there is a database to run the tests against, they are
+/// skipped without one
+bool postgreSQLAvailable()
+{
+  static int available = -1;
+  if( available < 0 )
+  {
+    postgreSQLDatabase db;
+    try
+    {
+      PostgreSQLConnection connection( db.database, db.user, db.password, db.host, db.port );
+      available = 1;
+    }
+    catch( ConfigError& e )
+    {
+      std::cerr << "Skipping PostgreSQL tests: " << e.what() << std::endl;
+      available = 0;
+    }
+  }
+  return available == 1;
+}
+
 struct postgreSQLStoreFixture
 {
   postgreSQLStoreFixture( bool reset )
-  : factory( TestSettings::sessionSettings.get() )
+  : factory( TestSettings::sessionSettings.get() ), object( 0 )
   {
+    if( !postgreSQLAvailable() )
+      return;
+
     SessionID sessionID( BeginString( "FIX.4.2" ),
                          SenderCompID( "SETGET" ), TargetCompID( "TEST" ) );
 
@@ -62,7 +129,8 @@ struct postgreSQLStoreFixture
 
   ~postgreSQLStoreFixture()
   {
-    factory.destroy( object );
+    if( object )
+      factory.destroy( object );
   }
 
   PostgreSQLStoreFactory factory;
@@ -82,29 +150,141 @@ struct resetPostgreSQLStoreFixture : postgreSQLStoreFixture
 
 TEST_FIXTURE(resetPostgreSQLStoreFixture, setGet)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
 TEST_FIXTURE(resetPostgreSQLStoreFixture, setGetWithQuote)
 {
-  //CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
+  if( !object ) return;
+  CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
+}
+
+TEST_FIXTURE(resetPostgreSQLStoreFixture, forEach)
+{
+  if( !object ) return;
+  CHECK_MESSAGE_STORE_FOR_EACH;
 }
 
 TEST_FIXTURE(resetPostgreSQLStoreFixture, other)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_OTHER
 }
 
 TEST_FIXTURE(noResetPostgreSQLStoreFixture, reload)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_RELOAD
 }
 
 TEST_FIXTURE(noResetPostgreSQLStoreFixture, refresh)
 {
+  if( !object ) return;
   CHECK_MESSAGE_STORE_RELOAD
 }
 
+TEST(setBatchReplacesStored)
+{
+  if( !postgreSQLAvailable() ) return;
+
+  PostgreSQLStoreFactory factory( TestSettings::sessionSettings.get() );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "BATCH" ), TargetCompID( "TEST" ) );
+  PostgreSQLStore* pStore = static_cast<PostgreSQLStore*>( factory.create( sessionID ) );
+  pStore->reset();
+  pStore->set( 2, "old" );
+
+  // the INSERT of the second batch of two fails on the stored message
+  std::string first = "first", second = "second's", third = "third";
+  MessageBatch batch;
+  batch.push_back( std::make_pair( 1, &first ) );
+  batch.push_back( std::make_pair( 2, &second ) );
+  batch.push_back( std::make_pair( 3, &third ) );
+  pStore->setBatchSize( 2 );
+  pStore->setBatch( batch );
+
+  std::vector<std::string> messages;
+  pStore->get( 1, 3, messages );
+  CHECK_EQUAL( 3U, messages.size() );
+  CHECK_EQUAL( "first", messages[ 0 ] );
+  CHECK_EQUAL( "second's", messages[ 1 ] );
+  CHECK_EQUAL( "third", messages[ 2 ] );
+
+  pStore->reset();
+  factory.destroy( pStore );
+}
+
+TEST(senderMsgSeqNumWithMessage)
+{
+  if( !postgreSQLAvailable() ) return;
+
+  PostgreSQLStoreFactory factory( TestSettings::sessionSettings.get() );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "FOLD" ), TargetCompID( "TEST" ) );
+  MessageStore* pStore = factory.create( sessionID );
+  pStore->reset();
+
+  // the first message shows the store that it is stored before its
+  // number is used up, the number is written by a query of its own
+  pStore->set( 1, "first" );
+  pStore->incrNextSenderMsgSeqNum();
+  MessageStore* pReader = factory.create( sessionID );
+  CHECK_EQUAL( 2, pReader->getNextSenderMsgSeqNum() );
+  factory.destroy( pReader );
+
+  // from then on the message writes the number that follows it
+  pStore->set( 2, "second" );
+  pReader = factory.create( sessionID );
+  CHECK_EQUAL( 3, pReader->getNextSenderMsgSeqNum() );
+  factory.destroy( pReader );
+  CHECK_EQUAL( 2, pStore->getNextSenderMsgSeqNum() );
+  pStore->incrNextSenderMsgSeqNum();
+  CHECK_EQUAL( 3, pStore->getNextSenderMsgSeqNum() );
+
+  // a number no message is stored with is written before incrementing
+  // returns
+  pStore->incrNextSenderMsgSeqNum();
+  CHECK( !pStore->hasPendingWrites() );
+  pReader = factory.create( sessionID );
+  CHECK_EQUAL( 4, pReader->getNextSenderMsgSeqNum() );
+  std::vector<std::string> messages;
+  pReader->get( 1, 3, messages );
+  CHECK_EQUAL( 2U, messages.size() );
+  factory.destroy( pReader );
+
+  pStore->reset();
+  factory.destroy( pStore );
+}
+
+TEST(logFlushInterval)
+{
+  if( !postgreSQLAvailable() ) return;
+
+  postgreSQLDatabase db;
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "LOG" ), TargetCompID( "TEST" ) );
+  PostgreSQLLog log( sessionID, db.database, db.user, db.password, db.host, db.port );
+  log.clear();
+  log.setBatchSize( 10 );
+  log.setFlushInterval( 50 );
+
+  log.onIncoming( "incoming with a ' quote" );
+  log.onEvent( "event" );
+  CHECK( log.hasPendingWrites() );
+  log.onTimer();
+  CHECK( log.hasPendingWrites() );
+  CHECK_EQUAL( 0, db.rows( "messages_log", "LOG" ) );
+
+  // nothing else is logged, the timer alone writes the rows
+  process_sleep( 0.1 );
+  log.onTimer();
+  CHECK( !log.hasPendingWrites() );
+  CHECK_EQUAL( 1, db.rows( "messages_log", "LOG" ) );
+  CHECK_EQUAL( 1, db.rows( "event_log", "LOG" ) );
+  log.clear();
+}
+
 }
 
 #endif
@@ -0,0 +1,133 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <ReactorSocketAcceptor.h>
+#include <ReactorSocketInitiator.h>
+#include <Session.h>
+#include <Utility.h>
+#include <sstream>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(ReactorSocketAcceptorTests)
+{
+
+struct reactorFixture
+{
+  reactorFixture()
+  {
+    std::stringstream acceptorInput;
+    acceptorInput <<
+      "[DEFAULT]\n"
+      "ConnectionType=acceptor\n"
+      "SocketAcceptPort=" << TestSettings::port << "\n"
+      "SocketReuseAddress=Y\n"
+      "ReactorThreads=2\n"
+      "StartTime=00:00:00\n"
+      "EndTime=00:00:00\n"
+      "UseDataDictionary=N\n"
+      "BeginString=FIX.4.2\n"
+      "SenderCompID=ISLD\n";
+
+    std::stringstream initiatorInput;
+    initiatorInput <<
+      "[DEFAULT]\n"
+      "ConnectionType=initiator\n"
+      "SocketConnectHost=127.0.0.1\n"
+      "SocketConnectPort=" << TestSettings::port << "\n"
+      "ReconnectInterval=1\n"
+      "HeartBtInt=30\n"
+      "ReactorThreads=2\n"
+      "StartTime=00:00:00\n"
+      "EndTime=00:00:00\n"
+      "UseDataDictionary=N\n"
+      "BeginString=FIX.4.2\n"
+      "TargetCompID=ISLD\n";
+
+    for( int i = 0; i < SESSIONS; ++i )
+    {
+      acceptorInput << "[SESSION]\nTargetCompID=TW" << i << "\n";
+      initiatorInput << "[SESSION]\nSenderCompID=TW" << i << "\n";
+      initiatorSessions.insert( SessionID( "FIX.4.2", "TW" + IntConvertor::convert(i), "ISLD" ) );
+    }
+
+    acceptorInput >> acceptorSettings;
+    initiatorInput >> initiatorSettings;
+  }
+
+  int loggedOn()
+  {
+    int count = 0;
+    std::set<SessionID>::iterator i;
+    for( i = initiatorSessions.begin(); i != initiatorSessions.end(); ++i )
+    {
+      Session* pSession = Session::lookupSession( *i );
+      if( pSession && pSession->isLoggedOn() )
+        ++count;
+    }
+    return count;
+  }
+
+  enum { SESSIONS = 6 };
+
+  SessionSettings acceptorSettings;
+  SessionSettings initiatorSettings;
+  std::set<SessionID> initiatorSessions;
+  TestApplication application;
+  MemoryStoreFactory factory;
+};
+
+TEST_FIXTURE(reactorFixture, logonThroughReactors)
+{
+  ReactorSocketAcceptor acceptor( application, factory, acceptorSettings );
+  ReactorSocketInitiator initiator( application, factory, initiatorSettings );
+  acceptor.start();
+  initiator.start();
+
+  for( int i = 0; i < 100 && loggedOn() < SESSIONS; ++i )
+    process_sleep( 0.1 );
+  CHECK_EQUAL( SESSIONS, loggedOn() );
+  CHECK( acceptor.isLoggedOn() );
+
+  initiator.stop();
+  acceptor.stop();
+  CHECK_EQUAL( 0, loggedOn() );
+  CHECK( !acceptor.isLoggedOn() );
+}
+
+TEST_FIXTURE(reactorFixture, rejectInvalidThreads)
+{
+  Dictionary defaults = acceptorSettings.get();
+  defaults.setInt( REACTOR_THREADS, 0 );
+  acceptorSettings.set( defaults );
+
+  ReactorSocketAcceptor acceptor( application, factory, acceptorSettings );
+  CHECK_THROW( acceptor.start(), ConfigError );
+}
+
+}
@@ -738,6 +738,56 @@ TEST_FIXTURE(sessionFixture, lookupSession)
   delete pSession5;
 }
 
+TEST_FIXTURE(sessionFixture, sessionHandle)
+{
+  DataDictionaryProvider provider;
+  provider.addTransportDataDictionary( BeginString("FIX.4.2"), std::shared_ptr<DataDictionary>(new DataDictionary()) );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "TW" ), TargetCompID( "HNDL" ) );
+
+  SessionHandle handle = Session::getSessionHandle( sessionID );
+  CHECK( sessionID == handle.getSessionID() );
+  CHECK( !handle.getSession() );
+  FIX::Message message;
+  CHECK_THROW( Session::sendToTarget( message, handle ), SessionNotFound );
+  CHECK( !Session::doesSessionExist( sessionID ) );
+
+  Session* pSession = new Session
+    ( *this, factory, sessionID, provider,
+      TimeRange(UtcTimeOnly(), UtcTimeOnly()), 0, 0 );
+  CHECK_EQUAL( pSession, handle.getSession() );
+  CHECK( handle == Session::getSessionHandle( sessionID ) );
+  delete pSession;
+  CHECK( !handle.getSession() );
+
+  pSession = new Session
+    ( *this, factory, sessionID, provider,
+      TimeRange(UtcTimeOnly(), UtcTimeOnly()), 0, 0 );
+  CHECK_EQUAL( pSession, handle.getSession() );
+  CHECK_EQUAL( pSession, Session::lookupSession( sessionID ) );
+
+  // enough ids to outgrow the first tables
+  std::vector<SessionHandle> handles;
+  for( int i = 0; i < 500; ++i )
+  {
+    handles.push_back( Session::getSessionHandle( SessionID( BeginString( "FIX.4.2" ),
+      SenderCompID( "TW" ), TargetCompID( "HNDL" + IntConvertor::convert( i ) ) ) ) );
+  }
+  for( int i = 0; i < 500; ++i )
+  {
+    SessionID id( BeginString( "FIX.4.2" ), SenderCompID( "TW" ),
+                  TargetCompID( "HNDL" + IntConvertor::convert( i ) ) );
+    CHECK( handles[i] == Session::getSessionHandle( id ) );
+    CHECK( id == handles[i].getSessionID() );
+    CHECK( !handles[i].getSession() );
+  }
+  CHECK_EQUAL( pSession, handle.getSession() );
+  CHECK_EQUAL( pSession, Session::lookupSession( sessionID ) );
+  delete pSession;
+
+  CHECK( !SessionHandle().getSession() );
+}
+
 TEST_FIXTURE(sessionFixture, registerSession)
 {
   DataDictionaryProvider provider;
@@ -1330,6 +1380,357 @@ TEST_FIXTURE(acceptorFixture, processQueuedMessages)
   CHECK_EQUAL( 2, toResendRequest );
 }
 
+/// Records what is written and can hold a write back until released
+struct sendingAcceptorFixture : public acceptorFixture
+{
+  sendingAcceptorFixture() : hold( false ), holding( false ) {}
+
+  bool send( const std::string& message )
+  {
+    while( hold )
+    {
+      holding = true;
+      process_sleep( 0.001 );
+    }
+
+    Locker l( mutex );
+    sent.push_back( message );
+    return true;
+  }
+
+  void disconnect()
+  {
+    Locker l( mutex );
+    sent.push_back( "disconnect" );
+    disconnected++;
+  }
+
+  std::vector<std::string> sent;
+  volatile bool hold;
+  volatile bool holding;
+  Mutex mutex;
+};
+
+std::string sentField( const std::string& message, const std::string& tag )
+{
+  std::string::size_type begin = message.find( "\001" + tag + "=" );
+  if( begin == std::string::npos ) return "";
+  begin += tag.size() + 2;
+  return message.substr( begin, message.find( '\001', begin ) - begin );
+}
+
+struct SendOrders
+{
+  Session* pSession;
+  int thread;
+  int count;
+};
+
+THREAD_PROC sendOrders( void* p )
+{
+  SendOrders* pOrders = static_cast < SendOrders* > ( p );
+  for( int i = 0; i < pOrders->count; ++i )
+  {
+    FIX42::NewOrderSingle order = createNewOrderSingle( "TW", "ISLD", 0 );
+    order.set( ClOrdID( IntConvertor::convert( pOrders->thread ) + ":"
+                        + IntConvertor::convert( i ) ) );
+    pOrders->pSession->send( order );
+  }
+  return 0;
+}
+
+THREAD_PROC releaseHeldSend( void* p )
+{
+  process_sleep( 0.1 );
+  static_cast < sendingAcceptorFixture* > ( p )->hold = false;
+  return 0;
+}
+
+TEST_FIXTURE(sendingAcceptorFixture, sendFromThreadsInSequence)
+{
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1U, sent.size() );
+
+  const int THREADS = 4;
+  const int ORDERS = 250;
+  SendOrders orders[ THREADS ];
+  thread_id threads[ THREADS ];
+  for( int i = 0; i < THREADS; ++i )
+  {
+    orders[ i ].pSession = object;
+    orders[ i ].thread = i;
+    orders[ i ].count = ORDERS;
+    CHECK( thread_spawn( &sendOrders, &orders[ i ], threads[ i ] ) );
+  }
+  for( int i = 0; i < THREADS; ++i )
+    thread_join( threads[ i ] );
+
+  CHECK_EQUAL( (size_t)( THREADS * ORDERS + 1 ), sent.size() );
+  CHECK_EQUAL( THREADS * ORDERS + 2, object->getExpectedSenderNum() );
+
+  // numbers follow the order on the wire, the store holds what was
+  // written and each thread's orders keep the order they were sent in
+  std::vector<std::string> stored;
+  object->getStore()->get( 2, THREADS * ORDERS + 1, stored );
+  CHECK_EQUAL( sent.size() - 1, stored.size() );
+
+  int next[ THREADS ] = { 0 };
+  for( size_t i = 1; i < sent.size() && i <= stored.size(); ++i )
+  {
+    CHECK_EQUAL( IntConvertor::convert( (int)i + 1 ), sentField( sent[ i ], "34" ) );
+    CHECK_EQUAL( sent[ i ], stored[ i - 1 ] );
+
+    std::string clOrdID = sentField( sent[ i ], "11" );
+    int thread = atoi( clOrdID.c_str() );
+    CHECK( thread >= 0 && thread < THREADS );
+    if( thread < 0 || thread >= THREADS ) continue;
+    CHECK_EQUAL( IntConvertor::convert( next[ thread ]++ ),
+                 clOrdID.substr( clOrdID.find( ':' ) + 1 ) );
+  }
+}
+
+TEST_FIXTURE(sendingAcceptorFixture, disconnectWritesPendingMessages)
+{
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1U, sent.size() );
+
+  // the first order is held in the transport, the rest queue behind it
+  hold = true;
+  SendOrders first = { object, 0, 1 };
+  thread_id writer;
+  CHECK( thread_spawn( &sendOrders, &first, writer ) );
+  while( !holding ) process_sleep( 0.001 );
+
+  for( int i = 0; i < 3; ++i )
+  {
+    FIX::Message order = createNewOrderSingle( "TW", "ISLD", 0 );
+    CHECK( object->send( order ) );
+  }
+  CHECK_EQUAL( 1U, sent.size() );
+
+  thread_id releaser;
+  CHECK( thread_spawn( &releaseHeldSend, this, releaser ) );
+  object->disconnect();
+  thread_join( writer );
+  thread_join( releaser );
+
+  CHECK_EQUAL( 6U, sent.size() );
+  for( size_t i = 1; i < 5 && i < sent.size(); ++i )
+    CHECK_EQUAL( IntConvertor::convert( (int)i + 1 ), sentField( sent[ i ], "34" ) );
+  CHECK_EQUAL( "disconnect", sent.back() );
+  CHECK_EQUAL( 1, disconnected );
+}
+
+TEST_FIXTURE(sendingAcceptorFixture, resendWhileAnotherThreadWrites)
+{
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+
+  const int ORDERS = MessageStore::FOR_EACH_BATCH + 100;
+  for( int i = 0; i < ORDERS; ++i )
+  {
+    FIX::Message order = createNewOrderSingle( "TW", "ISLD", 0 );
+    CHECK( object->send( order ) );
+  }
+
+  // the resend is written while the other thread waits to flush again
+  hold = true;
+  SendOrders first = { object, 0, 1 };
+  thread_id writer;
+  CHECK( thread_spawn( &sendOrders, &first, writer ) );
+  while( !holding ) process_sleep( 0.001 );
+
+  thread_id releaser;
+  CHECK( thread_spawn( &releaseHeldSend, this, releaser ) );
+  object->next( createResendRequest( "ISLD", "TW", 2, 2, ORDERS + 1 ),
+                UtcTimeStamp() );
+
+  size_t written = 0;
+  {
+    Locker l( mutex );
+    written = sent.size();
+  }
+  thread_join( writer );
+  thread_join( releaser );
+
+  CHECK_EQUAL( (size_t)( 2 * ORDERS + 2 ), written );
+  CHECK_EQUAL( (size_t)( 2 * ORDERS + 2 ), sent.size() );
+  for( int i = 0; i < ORDERS && (size_t)( ORDERS + 2 + i ) < sent.size(); ++i )
+  {
+    CHECK_EQUAL( IntConvertor::convert( i + 2 ),
+                 sentField( sent[ ORDERS + 2 + i ], "34" ) );
+    CHECK_EQUAL( "Y", sentField( sent[ ORDERS + 2 + i ], "43" ) );
+  }
+}
+
+/// Memory store that fails to store messages while fail is set
+class FailingStore : public MemoryStore
+{
+public:
+  FailingStore() : fail( false ) {}
+
+  bool set( int num, const std::string& message ) throw ( IOException )
+  {
+    if( fail ) throw IOException( "store failed" );
+    return MemoryStore::set( num, message );
+  }
+
+  bool set( int num, const char* data, size_t size ) throw ( IOException )
+  {
+    if( fail ) throw IOException( "store failed" );
+    return MemoryStore::set( num, data, size );
+  }
+
+  bool fail;
+};
+
+class FailingStoreFactory : public MessageStoreFactory
+{
+public:
+  FailingStoreFactory() : pStore( 0 ) {}
+
+  MessageStore* create( const SessionID& )
+  { return pStore = new FailingStore; }
+  void destroy( MessageStore* pStore )
+  { delete pStore; }
+
+  FailingStore* pStore;
+};
+
+struct failingStoreFixture : public TestCallback
+{
+  failingStoreFixture() : sent( 0 )
+  {
+    SessionID sessionID( BeginString( "FIX.4.2" ),
+                         SenderCompID( "TW" ), TargetCompID( "ISLD" ) );
+    TimeRange sessionTime( startTime, endTime );
+
+    DataDictionaryProvider provider;
+    provider.addTransportDataDictionary( sessionID.getBeginString(), "../spec/FIX42.xml" );
+    object = new Session( *this, factory, sessionID, provider,
+                           sessionTime, 0, 0 );
+    object->setResponder( this );
+  }
+
+  ~failingStoreFixture() { delete object; }
+
+  bool send( const std::string& ) { ++sent; return true; }
+
+  int sent;
+  Session* object;
+  FailingStoreFactory factory;
+};
+
+TEST_FIXTURE(failingStoreFixture, sendFailsWhenStoreFails)
+{
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1, sent );
+  CHECK_EQUAL( 2, object->getExpectedSenderNum() );
+
+  // a message that is not stored is not sent and keeps its number free
+  factory.pStore->fail = true;
+  FIX::Message order = createNewOrderSingle( "TW", "ISLD", 0 );
+  CHECK( !object->send( order ) );
+  CHECK_EQUAL( 2, object->getExpectedSenderNum() );
+  CHECK_EQUAL( 1, sent );
+
+  factory.pStore->fail = false;
+  FIX::Message retry = createNewOrderSingle( "TW", "ISLD", 0 );
+  CHECK( object->send( retry ) );
+  CHECK_EQUAL( 3, object->getExpectedSenderNum() );
+  CHECK_EQUAL( 2, sent );
+
+  std::vector<std::string> stored;
+  object->getStore()->get( 2, 2, stored );
+  CHECK_EQUAL( 1U, stored.size() );
+  if( stored.size() == 1 )
+  {
+    FIX::Message message( stored[ 0 ] );
+    MsgSeqNum msgSeqNum;
+    message.getHeader().getField( msgSeqNum );
+    CHECK_EQUAL( 2, msgSeqNum );
+  }
+}
+
+/// Stores a message from another thread while the first one is read
+struct StoreWhileReading : public StoredMessageCallback
+{
+  StoreWhileReading( SessionState& state )
+  : state( state ), stored( false ), storedDuringRead( false ) {}
+
+  static THREAD_PROC storeLate( void* p )
+  {
+    StoreWhileReading* pReader = static_cast < StoreWhileReading* > ( p );
+    pReader->state.set( 5000, "late" );
+    pReader->stored = true;
+    return 0;
+  }
+
+  void onMessage( const std::string& message )
+  {
+    if( messages.empty() )
+    {
+      thread_spawn( &storeLate, this, thread );
+      for( int i = 0; i < 1000 && !stored; ++i )
+        process_sleep( 0.001 );
+      storedDuringRead = stored;
+    }
+    messages.push_back( message );
+  }
+
+  SessionState& state;
+  thread_id thread;
+  volatile bool stored;
+  bool storedDuringRead;
+  std::vector<std::string> messages;
+};
+
+TEST(sessionStateForEachWithoutLock)
+{
+  MemoryStore store;
+  SessionState state;
+  state.store( &store );
+  const int COUNT = MessageStore::FOR_EACH_BATCH + 10;
+  for( int i = 1; i <= COUNT; ++i )
+    state.set( i, IntConvertor::convert( i ) );
+
+  StoreWhileReading reader( state );
+  state.forEach( 1, COUNT, reader );
+  thread_join( reader.thread );
+
+  CHECK( reader.storedDuringRead );
+  CHECK_EQUAL( (size_t)COUNT, reader.messages.size() );
+  CHECK_EQUAL( "1", reader.messages.front() );
+  CHECK_EQUAL( IntConvertor::convert( COUNT ), reader.messages.back() );
+}
+
+/// Holds back entries until the timer writes them
+class HeldLog : public NullLog
+{
+public:
+  HeldLog() : pending( 0 ) {}
+
+  void onEvent( const std::string& ) { ++pending; }
+  bool hasPendingWrites() const { return pending > 0; }
+  void onTimer() { pending = 0; }
+
+  int pending;
+};
+
+TEST(sessionStateLogTimer)
+{
+  MemoryStore store;
+  HeldLog log;
+  SessionState state;
+  state.store( &store );
+  CHECK( !state.hasPendingWrites() );
+
+  state.log( &log );
+  state.onEvent( "held" );
+  CHECK( state.hasPendingWrites() );
+  state.onTimer();
+  CHECK( !state.hasPendingWrites() );
+}
+
 struct initiatorCreatedBeforeStartTimeFixture : public TestCallback
 {
   static const int HEARTBTINT = 30;
@@ -27,6 +27,8 @@
 #include <UnitTest++.h>
 #include <TestHelper.h>
 #include <SocketServer.h>
+#include <SessionSettings.h>
+#include <Responder.h>
 #ifdef _MSC_VER
 #include <stdlib.h>
 #endif
@@ -134,6 +136,58 @@ TEST_FIXTURE(socketServerFixture, block)
   CHECK( disconnectSocket > 0 );
 }
 
+#ifdef HAVE_SYS_EPOLL_H
+TEST_FIXTURE(socketServerFixture, blockEpoll)
+{
+  SocketServer object( 0, SocketMonitor::EPOLL );
+  CHECK_EQUAL( SocketMonitor::EPOLL, object.getMonitor().getType() );
+  object.add( TestSettings::port, true, true );
+  int clientS = createSocket( TestSettings::port, "127.0.0.1" );
+  CHECK( clientS >= 0 );
+
+  object.block( *this );
+  CHECK_EQUAL( 1, connect );
+  CHECK( connectSocket > 0 );
+
+  send( clientS, "1", 1, 0 );
+  object.block( *this );
+  object.block( *this );
+  CHECK_EQUAL( 1, data );
+  CHECK_EQUAL( 1U, bufLen );
+  CHECK_EQUAL( '1', *buf );
+  CHECK( dataSocket > 0 );
+
+  // writability is only reported while the socket is signaled
+  object.getMonitor().signal( dataSocket );
+  object.block( *this );
+  object.block( *this );
+  CHECK_EQUAL( 1, write );
+  CHECK_EQUAL( dataSocket, writeSocket );
+  object.getMonitor().unsignal( dataSocket );
+  object.block( *this, true );
+  CHECK_EQUAL( 1, write );
+
+  destroySocket( clientS );
+  object.block( *this );
+  CHECK_EQUAL( 1, disconnect );
+  CHECK( disconnectSocket > 0 );
+}
+#endif
+
+TEST_FIXTURE(socketServerFixture, parseMonitorType)
+{
+  Dictionary settings;
+  CHECK_EQUAL( SocketMonitor::SELECT, SocketMonitor::parseType( settings ) );
+  settings.setString( SOCKET_MONITOR_TYPE, "select" );
+  CHECK_EQUAL( SocketMonitor::SELECT, SocketMonitor::parseType( settings ) );
+#ifdef HAVE_SYS_EPOLL_H
+  settings.setString( SOCKET_MONITOR_TYPE, "EPOLL" );
+  CHECK_EQUAL( SocketMonitor::EPOLL, SocketMonitor::parseType( settings ) );
+#endif
+  settings.setString( SOCKET_MONITOR_TYPE, "KQUEUE" );
+  CHECK_THROW( SocketMonitor::parseType( settings ), ConfigError );
+}
+
 TEST_FIXTURE(socketServerFixture, close)
 {
   SocketServer object( 0 );
@@ -142,4 +196,57 @@ TEST_FIXTURE(socketServerFixture, close)
   object.block( *this );
 }
 
+TEST_FIXTURE(socketServerFixture, sendv)
+{
+  SocketServer object( 0 );
+  int serverS = object.add( TestSettings::port, true, true );
+  int clientS = createSocket( TestSettings::port, "127.0.0.1" );
+  CHECK( clientS > 0 );
+  process_sleep(0.1);
+  int s = object.accept( serverS );
+  CHECK( s >= 0 );
+
+  const char* buffers[] = { "8=FIX", ".4.2", "|10=000|" };
+  size_t lengths[] = { 5, 4, 8 };
+  CHECK_EQUAL( 17, (int)socket_sendv( s, buffers, lengths, 3, true ) );
+  CHECK_EQUAL( 5, (int)socket_sendv( s, buffers, lengths, 1 ) );
+
+  char received[ 32 ];
+  size_t length = 0;
+  for( int i = 0; i < 10 && length < 22; ++i )
+  {
+    process_sleep(0.01);
+    ssize_t result = recv( clientS, received + length,
+                           sizeof(received) - length, 0 );
+    if( result > 0 ) length += result;
+  }
+  CHECK_EQUAL( "8=FIX.4.2|10=000|8=FIX", std::string( received, length ) );
+
+  destroySocket( clientS );
+  object.close();
+}
+
+TEST_FIXTURE(socketServerFixture, parseSendBatch)
+{
+  Dictionary settings;
+  SendBatch batch = SendBatch::parse( settings );
+  CHECK_EQUAL( 65536U, (unsigned)batch.m_maxBytes );
+  CHECK_EQUAL( 64U, (unsigned)batch.m_maxMessages );
+  CHECK( !batch.m_cork );
+
+  settings.setInt( SEND_BATCH_BYTES, 1024 );
+  settings.setInt( SEND_BATCH_MESSAGES, 16 );
+  settings.setBool( SOCKET_CORK, true );
+  batch = SendBatch::parse( settings );
+  CHECK_EQUAL( 1024U, (unsigned)batch.m_maxBytes );
+  CHECK_EQUAL( 16U, (unsigned)batch.m_maxMessages );
+  CHECK( batch.m_cork );
+
+  settings.setInt( SEND_BATCH_MESSAGES, (int)SOCKET_SENDV_MAX + 1 );
+  CHECK_THROW( SendBatch::parse( settings ), ConfigError );
+  settings.setInt( SEND_BATCH_MESSAGES, 16 );
+  settings.setInt( SEND_BATCH_BYTES, 0 );
+  CHECK_THROW( SendBatch::parse( settings ), ConfigError );
+}
+
 }
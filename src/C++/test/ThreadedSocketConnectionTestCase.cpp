@@ -0,0 +1,163 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <ThreadedSocketConnection.h>
+#include <Session.h>
+#include <Application.h>
+#include <DataDictionaryProvider.h>
+#include <fix42/Logon.h>
+#include <fix42/Heartbeat.h>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(ThreadedSocketConnectionTests)
+{
+
+struct threadedSocketConnectionFixture
+{
+  threadedSocketConnectionFixture()
+  : sessionID( BeginString( "FIX.4.2" ),
+               SenderCompID( "THREADED" ), TargetCompID( "PEER" ) ),
+    sockets( socket_createpair() ), pSession( 0 ), pConnection( 0 )
+  {
+    UtcTimeOnly startTime;
+    DataDictionaryProvider provider;
+    provider.addTransportDataDictionary( sessionID.getBeginString(), "../spec/FIX42.xml" );
+    pSession = new Session( application, factory, sessionID, provider,
+                            TimeRange( startTime, startTime ), 0, 0 );
+    pConnection = new ThreadedSocketConnection
+      ( sessionID, sockets.first, "127.0.0.1", 0, 0 );
+  }
+
+  ~threadedSocketConnectionFixture()
+  {
+    delete pConnection;
+    delete pSession;
+    socket_close( sockets.first );
+    socket_close( sockets.second );
+  }
+
+  /// Message from the peer with the given sequence number
+  std::string incoming( FIX::Message message, int msgSeqNum )
+  {
+    FIX::Header& header = message.getHeader();
+    header.setField( SenderCompID( "PEER" ) );
+    header.setField( TargetCompID( "THREADED" ) );
+    header.setField( MsgSeqNum( msgSeqNum ) );
+    header.setField( SendingTime() );
+    return message.toString();
+  }
+
+  void write( const std::string& string )
+  {
+    for( size_t sent = 0; sent < string.size(); )
+    {
+      ssize_t result = socket_send
+        ( sockets.second, string.data() + sent, string.size() - sent );
+      if( result <= 0 ) return;
+      sent += result;
+    }
+  }
+
+  std::string logon()
+  {
+    FIX42::Logon logon;
+    logon.set( EncryptMethod( 0 ) );
+    logon.set( HeartBtInt( 30 ) );
+    return incoming( logon, 1 );
+  }
+
+  SessionID sessionID;
+  std::pair<int, int> sockets;
+  NullApplication application;
+  MemoryStoreFactory factory;
+  Session* pSession;
+  ThreadedSocketConnection* pConnection;
+};
+
+TEST_FIXTURE(threadedSocketConnectionFixture, readDrainsSocket)
+{
+  // more than the first few reads of the growing buffer take in
+  std::string burst = logon();
+  for( int i = 2; i <= 600; ++i )
+    burst += incoming( FIX42::Heartbeat(), i );
+  CHECK( burst.size() > 4 * BUFSIZ );
+  write( burst );
+
+  CHECK( pConnection->read() );
+  CHECK( pSession->isLoggedOn() );
+  CHECK_EQUAL( 601, pSession->getExpectedTargetNum() );
+
+  // small reads after the burst still come through whole
+  write( incoming( FIX42::Heartbeat(), 601 ) );
+  CHECK( pConnection->read() );
+  write( incoming( FIX42::Heartbeat(), 602 ) );
+  CHECK( pConnection->read() );
+  CHECK_EQUAL( 603, pSession->getExpectedTargetNum() );
+}
+
+struct DelayedWrite
+{
+  threadedSocketConnectionFixture* pFixture;
+  std::string message;
+};
+
+THREAD_PROC writeDelayed( void* p )
+{
+  DelayedWrite* pWrite = static_cast < DelayedWrite* > ( p );
+  process_sleep( 0.02 );
+  pWrite->pFixture->write( pWrite->message );
+  return 0;
+}
+
+TEST_FIXTURE(threadedSocketConnectionFixture, busyPollReceives)
+{
+  pConnection->setBusyPoll( 500000 );
+
+  // arrives while the connection spins, before it would block
+  DelayedWrite delayed = { this, logon() };
+  thread_id thread;
+  long start = process_milliseconds();
+  CHECK( thread_spawn( &writeDelayed, &delayed, thread ) );
+  CHECK( pConnection->read() );
+  long elapsed = process_milliseconds() - start;
+  thread_join( thread );
+
+  CHECK( pSession->isLoggedOn() );
+  CHECK_EQUAL( 2, pSession->getExpectedTargetNum() );
+  CHECK( elapsed < 500 );
+
+  // nothing arrives, the spin ends and the read waits in select
+  start = process_milliseconds();
+  CHECK( pConnection->read() );
+  elapsed = process_milliseconds() - start;
+  CHECK( elapsed >= 500 );
+  CHECK_EQUAL( 2, pSession->getExpectedTargetNum() );
+}
+
+}
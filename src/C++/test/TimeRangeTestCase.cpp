@@ -288,4 +288,24 @@ TEST(isInSameRangeWithDay)
   CHECK( TimeRange::isInSameRange(startTime, endTime, startDay, endDay, time1, time2) );
 }
 
+
+TEST(getTimeToChange)
+{
+  TimeRange range( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ) );
+
+  UtcTimeStamp now( 10, 0, 0, 10, 10, 2000 );
+  CHECK_EQUAL( 8 * 3600, range.getTimeToChange( now ) );
+
+  now = UtcTimeStamp( 20, 0, 0, 10, 10, 2000 );
+  CHECK_EQUAL( 7 * 3600, range.getTimeToChange( now ) );
+
+  // the last second in range is followed by the first one out of it
+  now = UtcTimeStamp( 18, 0, 0, 10, 10, 2000 );
+  CHECK_EQUAL( 1, range.getTimeToChange( now ) );
+
+  TimeRange weekly( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ), 2, 6 );
+  now = UtcTimeStamp( 17, 59, 30, 10, 10, 2000 );
+  CHECK_EQUAL( 30, weekly.getTimeToChange( now ) );
+}
+
 }
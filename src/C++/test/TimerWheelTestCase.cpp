@@ -0,0 +1,199 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <TimerWheel.h>
+#include <SocketMonitor.h>
+#include <Utility.h>
+
+using namespace FIX;
+
+SUITE(TimerWheelTests)
+{
+
+class TestTimer : public TimerWheel::Timer
+{
+public:
+  TestTimer() : fired( 0 ), firedAt( 0 ), repeat( 0 ) {}
+
+  void onTimer( TimerWheel& wheel )
+  {
+    ++fired;
+    firedAt = wheel.getNow();
+    if( repeat )
+      wheel.schedule( *this, repeat );
+  }
+
+  int fired;
+  long firedAt;
+  long repeat;
+};
+
+TEST(fireInOrder)
+{
+  TimerWheel wheel;
+  long start = wheel.getNow();
+  TestTimer first, second, third;
+  wheel.schedule( third, 30 );
+  wheel.schedule( first, 5 );
+  wheel.schedule( second, 20 );
+  CHECK_EQUAL( 3, (int)wheel.size() );
+  CHECK_EQUAL( 5, wheel.getTimeout( start ) );
+
+  CHECK_EQUAL( 0, wheel.expire( start + 4 ) );
+  CHECK_EQUAL( 1, wheel.expire( start + 19 ) );
+  CHECK_EQUAL( start + 5, first.firedAt );
+  CHECK_EQUAL( 1, wheel.expire( start + 25 ) );
+  CHECK_EQUAL( start + 20, second.firedAt );
+  CHECK_EQUAL( 0, third.fired );
+  CHECK_EQUAL( 1, wheel.expire( start + 1000 ) );
+  CHECK_EQUAL( start + 30, third.firedAt );
+  CHECK_EQUAL( 0, (int)wheel.size() );
+  CHECK_EQUAL( -1, wheel.getTimeout( start + 1000 ) );
+}
+
+TEST(cascade)
+{
+  TimerWheel wheel;
+  long start = wheel.getNow();
+  long delays[] = { 31, 32, 33, 1000, 1023, 1024, 30000, 65537, 3600000 };
+  const int count = sizeof(delays) / sizeof(delays[0]);
+  TestTimer timers[ count ];
+
+  for( int i = 0; i < count; ++i )
+    wheel.schedule( timers[i], delays[i] );
+
+  for( int i = 0; i < count; ++i )
+  {
+    // a timer may be reported early, but never late
+    long timeout = wheel.getTimeout( wheel.getNow() );
+    CHECK( timeout >= 0 );
+    CHECK( wheel.getNow() + timeout <= start + delays[i] );
+
+    wheel.expire( start + delays[i] - 1 );
+    CHECK_EQUAL( 0, timers[i].fired );
+    wheel.expire( start + delays[i] );
+    CHECK_EQUAL( 1, timers[i].fired );
+    CHECK_EQUAL( start + delays[i], timers[i].firedAt );
+  }
+}
+
+TEST(beyondLastLevel)
+{
+  TimerWheel wheel;
+  long start = wheel.getNow();
+  TestTimer timer;
+  long delay = 2L * 24 * 3600 * 1000;
+  wheel.schedule( timer, delay );
+
+  wheel.expire( start + delay - 1 );
+  CHECK_EQUAL( 0, timer.fired );
+  wheel.expire( start + delay );
+  CHECK_EQUAL( 1, timer.fired );
+}
+
+TEST(cancel)
+{
+  TimerWheel wheel;
+  long start = wheel.getNow();
+  TestTimer timer;
+  wheel.schedule( timer, 10 );
+  CHECK( timer.isScheduled() );
+  wheel.cancel( timer );
+  CHECK( !timer.isScheduled() );
+  CHECK_EQUAL( 0, wheel.expire( start + 100 ) );
+
+  {
+    TestTimer destroyed;
+    wheel.schedule( destroyed, 10 );
+  }
+  CHECK_EQUAL( 0, (int)wheel.size() );
+  CHECK_EQUAL( 0, wheel.expire( start + 200 ) );
+}
+
+TEST(reschedule)
+{
+  TimerWheel wheel;
+  long start = wheel.getNow();
+  TestTimer timer;
+  timer.repeat = 1;
+  wheel.schedule( timer, 0 );
+
+  // rescheduling from the callback only fires on a later tick
+  CHECK_EQUAL( 1, wheel.expire( start + 1 ) );
+  CHECK_EQUAL( 3, wheel.expire( start + 4 ) );
+  CHECK_EQUAL( start + 4, timer.firedAt );
+
+  wheel.schedule( timer, 100 );
+  wheel.schedule( timer, 10 );
+  CHECK_EQUAL( 1, (int)wheel.size() );
+  timer.repeat = 0;
+  CHECK_EQUAL( 1, wheel.expire( start + 200 ) );
+  CHECK_EQUAL( start + 14, timer.firedAt );
+}
+
+class TimeoutStrategy : public SocketMonitor::Strategy
+{
+public:
+  TimeoutStrategy() : timeouts( 0 ) {}
+
+  void onConnect( SocketMonitor&, int ) {}
+  void onEvent( SocketMonitor&, int ) {}
+  void onWrite( SocketMonitor&, int ) {}
+  void onError( SocketMonitor&, int ) {}
+  void onError( SocketMonitor& ) {}
+  void onTimeout( SocketMonitor& ) { ++timeouts; }
+
+  int timeouts;
+};
+
+static void checkPeriodicTimeout( SocketMonitor::Type type )
+{
+  // a timer that is always due before the periodic timeout must not
+  // keep the periodic timeout from being reported
+  SocketMonitor monitor( 1, type );
+  TestTimer timer;
+  timer.repeat = 1000;
+  monitor.getTimers().schedule( timer, 1000 );
+
+  TimeoutStrategy strategy;
+  long start = process_milliseconds();
+  while( process_milliseconds() - start < 3200 )
+    monitor.block( strategy );
+
+  CHECK( timer.fired >= 2 );
+  CHECK( strategy.timeouts >= 2 );
+}
+
+TEST(periodicTimeoutWithTimers)
+{
+  checkPeriodicTimeout( SocketMonitor::SELECT );
+#ifdef HAVE_SYS_EPOLL_H
+  checkPeriodicTimeout( SocketMonitor::EPOLL );
+#endif
+}
+
+}
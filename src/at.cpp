@@ -18,6 +18,7 @@
 ****************************************************************************/
 
 #include "ThreadedSocketAcceptor.h"
+#include "ReactorSocketAcceptor.h"
 #include "SocketAcceptor.h"
 #include "SessionSettings.h"
 #include "FileStore.h"
@@ -38,18 +39,22 @@ int main( int argc, char** argv )
 {
   std::string file;
   bool threaded = false;
+  bool reactor = false;
 
   if ( getopt( argc, argv, "+f:" ) == 'f' )
     file = optarg;
   else
   {
     std::cout << "usage: " << argv[ 0 ]
-    << " -f FILE [-t]" << std::endl;
+    << " -f FILE [-t | -r]" << std::endl;
     return 1;
   }
 
-  if ( getopt( argc, argv, "+t" ) == 't' )
-    threaded = true;
+  switch ( getopt( argc, argv, "+tr" ) )
+  {
+  case 't': threaded = true; break;
+  case 'r': reactor = true; break;
+  }
 
   try
   {
@@ -65,6 +70,13 @@ int main( int argc, char** argv )
                         ( application, factory, settings ) );
       pAcceptor = p;
     }
+    else if ( reactor )
+    {
+      AcceptorPtr p = std::auto_ptr < FIX::Acceptor >
+                      ( new FIX::ReactorSocketAcceptor
+                        ( application, factory, settings ) );
+      pAcceptor = p;
+    }
     else
     {
       AcceptorPtr p = std::auto_ptr < FIX::Acceptor >
@@ -0,0 +1,83 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#include "AsyncFileLog.h"
+#include <iostream>
+#include <fstream>
+#include "getopt-repl.h"
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 )
+#endif
+
+// Prints a journal written by AsyncFileLog in the format of FileLog,
+// the messages log with -m, the event log with -e, both by default
+int main( int argc, char** argv )
+{
+  bool messages = false;
+  bool events = false;
+  bool milliseconds = true;
+
+  int opt;
+  while ( (opt = getopt( argc, argv, "+mes" )) != -1 )
+  {
+    switch( opt )
+    {
+    case 'm':
+      messages = true;
+      break;
+    case 'e':
+      events = true;
+      break;
+    case 's':
+      milliseconds = false;
+      break;
+    default:
+      optind = argc;
+    }
+  }
+
+  if ( optind != argc - 1 )
+  {
+    std::cout << "usage: " << argv[ 0 ]
+    << " [-m] [-e] [-s] JOURNAL" << std::endl;
+    return 1;
+  }
+
+  if ( !messages && !events )
+    messages = events = true;
+
+  std::ifstream journal( argv[ optind ], std::ios::in | std::ios::binary );
+  if ( !journal.is_open() || !FIX::AsyncFileLog::readHeader( journal ) )
+  {
+    std::cerr << argv[ optind ] << " is not a journal" << std::endl;
+    return 1;
+  }
+
+  FIX::AsyncFileLog::Record record;
+  std::string line;
+  while ( FIX::AsyncFileLog::readRecord( journal, record ) )
+  {
+    bool event = record.kind == FIX::AsyncFileLog::EVENT;
+    if ( event ? !events : !messages ) continue;
+    std::cout << FIX::AsyncFileLog::formatRecord( record, milliseconds, line ) << '\n';
+  }
+
+  return 0;
+}
@@ -33,6 +33,8 @@
 #include "FieldConvertors.h"
 #include "Values.h"
 #include "FileStore.h"
+#include "MmapFileStore.h"
+#include "AsyncMessageStore.h"
 #include "SessionID.h"
 #include "Session.h"
 #include "DataDictionary.h"
@@ -44,12 +46,15 @@
 #include "ThreadedSocketInitiator.h"
 #include "fix42/Heartbeat.h"
 #include "fix42/NewOrderSingle.h"
+#include "fix42/FixedNewOrderSingle.h"
 #include "fix42/QuoteRequest.h"
 
 long testIntegerToString( int );
 long testStringToInteger( int );
 long testDoubleToString( int );
 long testStringToDouble( int );
+long testDecimalToString( int );
+long testStringToDecimal( int );
 long testCreateHeartbeat( int );
 long testIdentifyType( int );
 long testSerializeToStringHeartbeat( int );
@@ -59,12 +64,17 @@ long testCreateNewOrderSingle( int );
 long testSerializeToStringNewOrderSingle( int );
 long testSerializeFromStringNewOrderSingle( int );
 long testSerializeFromStringAndValidateNewOrderSingle( int );
+long testCreateFixedNewOrderSingle( int );
+long testSerializeToStringFixedNewOrderSingle( int );
+long testSerializeFromStringFixedNewOrderSingle( int );
 long testCreateQuoteRequest( int );
 long testReadFromQuoteRequest( int );
 long testSerializeToStringQuoteRequest( int );
 long testSerializeFromStringQuoteRequest( int );
 long testSerializeFromStringAndValidateQuoteRequest( int );
 long testFileStoreNewOrderSingle( int );
+long testMmapFileStoreNewOrderSingle( int );
+long testAsyncFileStoreNewOrderSingle( int );
 long testValidateNewOrderSingle( int );
 long testValidateDictNewOrderSingle( int );
 long testValidateQuoteRequest( int );
@@ -128,6 +138,12 @@ int main( int argc, char** argv )
   std::cout << "Converting strings to doubles: ";
   report( testStringToDouble( count ), count );
 
+  std::cout << "Converting decimals to strings: ";
+  report( testDecimalToString( count ), count );
+
+  std::cout << "Converting strings to decimals: ";
+  report( testStringToDecimal( count ), count );
+
   std::cout << "Creating Heartbeat messages: ";
   report( testCreateHeartbeat( count ), count );
 
@@ -155,6 +171,15 @@ int main( int argc, char** argv )
   std::cout << "Serializing NewOrderSingle messages from strings and validation: ";
   report( testSerializeFromStringAndValidateNewOrderSingle( count ), count );
 
+  std::cout << "Creating fixed NewOrderSingle messages: ";
+  report( testCreateFixedNewOrderSingle( count ), count );
+
+  std::cout << "Serializing fixed NewOrderSingle messages to strings: ";
+  report( testSerializeToStringFixedNewOrderSingle( count ), count );
+
+  std::cout << "Serializing fixed NewOrderSingle messages from strings: ";
+  report( testSerializeFromStringFixedNewOrderSingle( count ), count );
+
   std::cout << "Creating QuoteRequest messages: ";
   report( testCreateQuoteRequest( count ), count );
 
@@ -173,6 +198,12 @@ int main( int argc, char** argv )
   std::cout << "Storing NewOrderSingle messages: ";
   report( testFileStoreNewOrderSingle( count ), count );
 
+  std::cout << "Storing NewOrderSingle messages in memory mapped files: ";
+  report( testMmapFileStoreNewOrderSingle( count ), count );
+
+  std::cout << "Storing NewOrderSingle messages on a writer thread: ";
+  report( testAsyncFileStoreNewOrderSingle( count ), count );
+
   std::cout << "Validating NewOrderSingle messages with no data dictionary: ";
   report( testValidateNewOrderSingle( count ), count );
 
@@ -253,6 +284,32 @@ long testStringToDouble( int count )
   return GetTickCount() - start;
 }
 
+long testDecimalToString( int count )
+{
+  FIX::Decimal value( 12345, -2 );
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX::DecimalConvertor::convert( value );
+  }
+  return GetTickCount() - start;
+}
+
+long testStringToDecimal( int count )
+{
+  std::string value( "123.45" );
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX::DecimalConvertor::convert( value );
+  }
+  return GetTickCount() - start;
+}
+
 long testCreateHeartbeat( int count )
 {
   count = count - 1;
@@ -312,13 +369,21 @@ long testSerializeFromStringHeartbeat( int count )
 long testSerializeFromStringAndValidateHeartbeat( int count )
 {
   FIX42::Heartbeat message;
+  message.getHeader().set( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().set( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().set( FIX::SendingTime() );
   std::string string = message.toString();
   count = count - 1;
 
+  FIX::DataDictionary::FieldValidation fieldValidation;
   long start = GetTickCount();
   for ( int i = 0; i <= count; ++i )
   {
-    message.setString( string, VALIDATE, s_dataDictionary.get() );
+    message.setString( string, VALIDATE, s_dataDictionary.get(),
+                       s_dataDictionary.get(), &fieldValidation );
+    FIX::DataDictionary::validate( message, s_dataDictionary.get(),
+                                   s_dataDictionary.get(), &fieldValidation );
   }
   return GetTickCount() - start;
 }
@@ -393,14 +458,81 @@ long testSerializeFromStringAndValidateNewOrderSingle( int count )
   FIX::OrdType ordType( FIX::OrdType_MARKET );
   FIX42::NewOrderSingle message
     ( clOrdID, handlInst, symbol, side, transactTime, ordType );
+  message.getHeader().set( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().set( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().set( FIX::SendingTime() );
   std::string string = message.toString();
 
   count = count - 1;
 
+  FIX::DataDictionary::FieldValidation fieldValidation;
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.setString( string, VALIDATE, s_dataDictionary.get(),
+                       s_dataDictionary.get(), &fieldValidation );
+    FIX::DataDictionary::validate( message, s_dataDictionary.get(),
+                                   s_dataDictionary.get(), &fieldValidation );
+  }
+  return GetTickCount() - start;
+}
+
+long testCreateFixedNewOrderSingle( int count )
+{
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX42::FixedNewOrderSingle message;
+    message.setClOrdID( "ORDERID" );
+    message.setHandlInst( '1' );
+    message.setSymbol( "LNUX" );
+    message.setSide( FIX::Side_BUY );
+    message.setTransactTime( FIX::UtcTimeStamp() );
+    message.setOrdType( FIX::OrdType_MARKET );
+  }
+
+  return GetTickCount() - start;
+}
+
+long testSerializeToStringFixedNewOrderSingle( int count )
+{
+  FIX42::FixedNewOrderSingle message;
+  message.setClOrdID( "ORDERID" );
+  message.setHandlInst( '1' );
+  message.setSymbol( "LNUX" );
+  message.setSide( FIX::Side_BUY );
+  message.setTransactTime( FIX::UtcTimeStamp() );
+  message.setOrdType( FIX::OrdType_MARKET );
+  std::string string;
+
+  count = count - 1;
+
   long start = GetTickCount();
   for ( int i = 0; i <= count; ++i )
   {
-    message.setString( string, VALIDATE, s_dataDictionary.get() );
+    message.toString( string );
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeFromStringFixedNewOrderSingle( int count )
+{
+  FIX42::FixedNewOrderSingle message;
+  message.setClOrdID( "ORDERID" );
+  message.setHandlInst( '1' );
+  message.setSymbol( "LNUX" );
+  message.setSide( FIX::Side_BUY );
+  message.setTransactTime( FIX::UtcTimeStamp() );
+  message.setOrdType( FIX::OrdType_MARKET );
+  std::string string = message.toString();
+
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.setString( string );
   }
   return GetTickCount() - start;
 }
@@ -524,14 +656,22 @@ long testSerializeFromStringAndValidateQuoteRequest( int count )
     noRelatedSym.set( FIX::OrdType(FIX::OrdType_MARKET) );
     message.addGroup( noRelatedSym );
   }
+  message.getHeader().set( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().set( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().set( FIX::SendingTime() );
   std::string string = message.toString();
 
   count = count - 1;
 
+  FIX::DataDictionary::FieldValidation fieldValidation;
   long start = GetTickCount();
   for ( int j = 0; j <= count; ++j )
   {
-    message.setString( string, VALIDATE, s_dataDictionary.get() );
+    message.setString( string, VALIDATE, s_dataDictionary.get(),
+                       s_dataDictionary.get(), &fieldValidation );
+    FIX::DataDictionary::validate( message, s_dataDictionary.get(),
+                                   s_dataDictionary.get(), &fieldValidation );
   }
   return GetTickCount() - start;
 }
@@ -629,6 +769,72 @@ long testFileStoreNewOrderSingle( int count )
   return end - start;
 }
 
+long testMmapFileStoreNewOrderSingle( int count )
+{
+  FIX::BeginString beginString( FIX::BeginString_FIX42 );
+  FIX::SenderCompID senderCompID( "SENDER" );
+  FIX::TargetCompID targetCompID( "TARGET" );
+  FIX::SessionID id( beginString, senderCompID, targetCompID );
+
+  FIX::ClOrdID clOrdID( "ORDERID" );
+  FIX::HandlInst handlInst( '1' );
+  FIX::Symbol symbol( "LNUX" );
+  FIX::Side side( FIX::Side_BUY );
+  FIX::TransactTime transactTime;
+  FIX::OrdType ordType( FIX::OrdType_MARKET );
+  FIX42::NewOrderSingle message
+  ( clOrdID, handlInst, symbol, side, transactTime, ordType );
+  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  std::string messageString = message.toString();
+
+  FIX::MmapFileStore store( "store", id );
+  store.reset();
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    store.set( ++i, messageString );
+  }
+  long end = GetTickCount();
+  store.reset();
+  return end - start;
+}
+
+long testAsyncFileStoreNewOrderSingle( int count )
+{
+  FIX::BeginString beginString( FIX::BeginString_FIX42 );
+  FIX::SenderCompID senderCompID( "SENDER" );
+  FIX::TargetCompID targetCompID( "TARGET" );
+  FIX::SessionID id( beginString, senderCompID, targetCompID );
+
+  FIX::ClOrdID clOrdID( "ORDERID" );
+  FIX::HandlInst handlInst( '1' );
+  FIX::Symbol symbol( "LNUX" );
+  FIX::Side side( FIX::Side_BUY );
+  FIX::TransactTime transactTime;
+  FIX::OrdType ordType( FIX::OrdType_MARKET );
+  FIX42::NewOrderSingle message
+  ( clOrdID, handlInst, symbol, side, transactTime, ordType );
+  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  std::string messageString = message.toString();
+
+  FIX::FileStoreFactory factory( "store" );
+  FIX::AsyncMessageStore store( factory, id );
+  store.reset();
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    store.set( ++i, messageString );
+  }
+  store.flush();
+  long end = GetTickCount();
+  store.reset();
+  return end - start;
+}
+
 long testValidateNewOrderSingle( int count )
 {
   FIX::ClOrdID clOrdID( "ORDERID" );
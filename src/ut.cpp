@@ -27,6 +27,8 @@
 #include "C++/Utility.h"
 #include "C++/SessionSettings.h"
 #ifndef _MSC_VER
+#include <CharScannerTestCase.cpp>
+#include <ClockTestCase.cpp>
 #include <DataDictionaryTestCase.cpp>
 #include <DictionaryTestCase.cpp>
 #include <FieldBaseTestCase.cpp>
@@ -34,11 +36,15 @@
 #include <FileLogTestCase.cpp>
 #include <FileStoreFactoryTestCase.cpp>
 #include <FileStoreTestCase.cpp>
+#include <MmapFileStoreTestCase.cpp>
+#include <AsyncMessageStoreTestCase.cpp>
+#include <AsyncFileLogTestCase.cpp>
 #include <FileUtilitiesTestCase.cpp>
 #include <HttpMessageTestCase.cpp>
 #include <HttpParserTestCase.cpp>
 #include <MemoryStoreTestCase.cpp>
 #include <MessageSortersTestCase.cpp>
+#include <MessagePoolTestCase.cpp>
 #include <MessagesTestCase.cpp>
 #include <MySQLStoreTestCase.cpp>
 #include <NullStoreTestCase.cpp>
@@ -52,10 +58,15 @@
 #include <SettingsTestCase.cpp>
 #include <SocketAcceptorTestCase.cpp>
 #include <SocketConnectorTestCase.cpp>
+#include <ThreadedSocketConnectionTestCase.cpp>
 #include <SocketServerTestCase.cpp>
+#include <ReactorSocketAcceptorTestCase.cpp>
 #include <TestHelper.cpp>
 #include <TimeRangeTestCase.cpp>
+#include <TimerWheelTestCase.cpp>
 #include <UtcTimeOnlyTestCase.cpp>
+#include <MessageCrackerTestCase.cpp>
+#include <FixedMessageTestCase.cpp>
 #include <UtcTimeStampTestCase.cpp>
 #endif
 #include <UnitTest++.h>